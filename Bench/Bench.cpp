@@ -0,0 +1,258 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "Bench.h"
+
+#include "CPUDispatch.h"
+
+#include <cassert>
+#include <cstring>
+#include <ctime>
+
+// Each case is timed for at least this long
+const unsigned long long MIN_RUN_NS = 200000000ULL;
+
+uint32_t CBench::s_state = 1U;
+
+// Stops the compiler from discarding the timed loops
+volatile uint64_t g_sink = 0U;
+
+int main(int argc, char** argv)
+{
+	FILE* json = stdout;
+
+	if (argc > 1) {
+		json = ::fopen(argv[1], "wt");
+		if (json == NULL) {
+			::fprintf(stderr, "Bench: unable to open %s\n", argv[1]);
+			return 1;
+		}
+	}
+
+	// The primitives run with the kernels the bridges would pick on this host
+	CCPUDispatch::select(CCPUDispatch::detect());
+	::fprintf(stderr, "Bench: using the %s kernels\n", CCPUDispatch::getName(CCPUDispatch::getKernels()));
+
+	CBench bench;
+	addFECBench(bench);
+	addIMBEBench(bench);
+	addAMBEBench(bench);
+	addNXDNBench(bench);
+	addUDPBench(bench);
+	// Switches the kernels case by case, so it has to stay last
+	addDispatchBench(bench);
+
+	unsigned int failed = bench.run(json);
+
+	if (json != stdout)
+		::fclose(json);
+
+	if (failed > 0U) {
+		::fprintf(stderr, "Bench: %u case(s) do not match the reference output\n", failed);
+		return 1;
+	}
+
+	return 0;
+}
+
+CBench::CBench() :
+m_suites()
+{
+}
+
+CBench::~CBench()
+{
+}
+
+void CBench::add(const std::string& suite, const CBenchCase* cases, unsigned int count)
+{
+	assert(cases != NULL);
+
+	CBenchSuite s;
+	s.m_name  = suite;
+	s.m_cases = cases;
+	s.m_count = count;
+
+	m_suites.push_back(s);
+}
+
+unsigned int CBench::run(FILE* json)
+{
+	assert(json != NULL);
+
+	unsigned int failed = 0U;
+
+	::fprintf(json, "{\n  \"suites\": [");
+
+	for (unsigned int i = 0U; i < m_suites.size(); i++) {
+		const CBenchSuite& suite = m_suites.at(i);
+
+		::fprintf(json, "%s\n    {\n      \"name\": \"%s\",\n      \"cases\": [", i == 0U ? "" : ",", suite.m_name.c_str());
+
+		for (unsigned int j = 0U; j < suite.m_count; j++) {
+			CBenchResult r = measure(suite.m_cases[j]);
+			if (!r.m_verified)
+				failed++;
+
+			if (r.m_case->m_syscalls != NULL)
+				::fprintf(stderr, "%-6s %-36s %-8s %10.1f ns/op %12.0f frames/s %10.1f cpu ns/op %8.2f syscalls/frame %s\n", suite.m_name.c_str(), r.m_case->m_name,
+					r.m_case->m_input, r.m_nsPerOp, r.m_framesPerSec, r.m_cpuNsPerOp, r.m_syscallsPerFrame, r.m_verified ? "ok" : "MISMATCH");
+			else
+				::fprintf(stderr, "%-6s %-36s %-8s %10.1f ns/op %12.0f frames/s %s\n", suite.m_name.c_str(), r.m_case->m_name, r.m_case->m_input,
+					r.m_nsPerOp, r.m_framesPerSec, r.m_verified ? "ok" : "MISMATCH");
+
+			::fprintf(json, "%s\n        {\"name\": \"%s\", \"input\": \"%s\", \"frame\": \"%s\", \"ops_per_frame\": %u, \"ops\": %llu, "
+				"\"ns_per_op\": %.2f, \"frames_per_s\": %.0f, \"digest\": \"%016llx\", \"verified\": %s",
+				j == 0U ? "" : ",", r.m_case->m_name, r.m_case->m_input, r.m_case->m_frame, r.m_case->m_opsPerFrame, r.m_ops,
+				r.m_nsPerOp, r.m_framesPerSec, (unsigned long long)r.m_digest, r.m_verified ? "true" : "false");
+			if (r.m_case->m_syscalls != NULL)
+				::fprintf(json, ", \"cpu_ns_per_op\": %.2f, \"syscalls_per_frame\": %.2f", r.m_cpuNsPerOp, r.m_syscallsPerFrame);
+			::fprintf(json, "}");
+		}
+
+		::fprintf(json, "\n      ]\n    }");
+	}
+
+	::fprintf(json, "\n  ],\n  \"failed\": %u\n}\n", failed);
+
+	return failed;
+}
+
+CBenchResult CBench::measure(const CBenchCase& c) const
+{
+	CBenchResult r;
+	r.m_case = &c;
+
+	// One untimed pass over the prepared vectors checks the outputs bit for bit
+	c.m_setup();
+	r.m_digest   = c.m_run(BENCH_VECTORS);
+	r.m_verified = r.m_digest == c.m_golden;
+
+	unsigned long long ops = BENCH_VECTORS;
+	unsigned long long elapsed = 0ULL;
+	unsigned long long cpuTime = 0ULL;
+	unsigned long long syscalls = 0ULL;
+	for (;;) {
+		unsigned long long calls = c.m_syscalls != NULL ? c.m_syscalls() : 0ULL;
+		unsigned long long startCPU = cpu();
+		unsigned long long start = now();
+		g_sink += c.m_run(ops);
+		elapsed  = now() - start;
+		cpuTime  = cpu() - startCPU;
+		syscalls = c.m_syscalls != NULL ? c.m_syscalls() - calls : 0ULL;
+
+		if (elapsed >= MIN_RUN_NS)
+			break;
+
+		ops *= 2ULL;
+	}
+
+	r.m_ops          = ops;
+	r.m_nsPerOp      = double(elapsed) / double(ops);
+	r.m_framesPerSec = 1.0E9 / (r.m_nsPerOp * double(c.m_opsPerFrame));
+
+	// Kernel time spent on behalf of the thread counts as well, which is what the network cases are about
+	r.m_cpuNsPerOp       = double(cpuTime) / double(ops);
+	r.m_syscallsPerFrame = double(syscalls) * double(c.m_opsPerFrame) / double(ops);
+
+	return r;
+}
+
+unsigned long long CBench::now()
+{
+	struct timespec ts;
+	::clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (unsigned long long)ts.tv_sec * 1000000000ULL + (unsigned long long)ts.tv_nsec;
+}
+
+unsigned long long CBench::cpu()
+{
+	struct timespec ts;
+	::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+
+	return (unsigned long long)ts.tv_sec * 1000000000ULL + (unsigned long long)ts.tv_nsec;
+}
+
+void CBench::seed(uint32_t seed)
+{
+	s_state = seed != 0U ? seed : 1U;
+}
+
+uint32_t CBench::random()
+{
+	// xorshift32, the inputs have to be identical on every host
+	uint32_t x = s_state;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	s_state = x;
+
+	return x;
+}
+
+uint32_t CBench::errors(unsigned int n, unsigned int width)
+{
+	assert(n <= width);
+	assert(width <= 32U);
+
+	uint32_t mask = 0U;
+	while (n > 0U) {
+		uint32_t bit = 1U << (random() % width);
+		if ((mask & bit) == 0U) {
+			mask |= bit;
+			n--;
+		}
+	}
+
+	return mask;
+}
+
+uint64_t CBench::digest(uint64_t hash, const unsigned char* data, unsigned int length)
+{
+	assert(data != NULL);
+
+	// FNV-1a
+	for (unsigned int i = 0U; i < length; i++) {
+		hash ^= data[i];
+		hash *= 0x100000001B3ULL;
+	}
+
+	return hash;
+}
+
+uint64_t CBench::digest(uint64_t hash, uint32_t value)
+{
+	// One multiply per word keeps the digest cheap next to a table lookup
+	hash ^= value;
+	hash *= 0x100000001B3ULL;
+
+	return hash;
+}
+
+uint64_t CBench::digest(uint64_t hash, const bool* bits, unsigned int length)
+{
+	assert(bits != NULL);
+
+	for (unsigned int i = 0U; i < length; i++) {
+		hash ^= bits[i] ? 1U : 0U;
+		hash *= 0x100000001B3ULL;
+	}
+
+	return hash;
+}
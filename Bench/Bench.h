@@ -0,0 +1,98 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(BENCH_H)
+#define	BENCH_H
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Number of prepared input vectors per case, a verification pass runs each once
+const unsigned int BENCH_VECTORS = 1024U;
+
+struct CBenchCase {
+	const char*  m_name;		// Class and method under test
+	const char*  m_input;		// Input pattern, "clean" or the injected errors
+	const char*  m_frame;		// What one frame is for this primitive
+	unsigned int m_opsPerFrame;	// Calls needed per frame
+	void     (*m_setup)();		// Prepares the BENCH_VECTORS inputs
+	uint64_t (*m_run)(unsigned int ops);	// Runs ops calls and returns a digest of the outputs
+	uint64_t     m_golden;		// Digest of one pass produced by the reference implementation
+	unsigned long long (*m_syscalls)();	// Optional, the system calls made so far
+};
+
+struct CBenchResult {
+	const CBenchCase* m_case;
+	unsigned long long m_ops;
+	double             m_nsPerOp;
+	double             m_framesPerSec;
+	uint64_t           m_digest;
+	bool               m_verified;
+	double             m_cpuNsPerOp;
+	double             m_syscallsPerFrame;
+};
+
+class CBench {
+public:
+	CBench();
+	~CBench();
+
+	void add(const std::string& suite, const CBenchCase* cases, unsigned int count);
+
+	// Returns the number of failed verifications
+	unsigned int run(FILE* json);
+
+	// Deterministic input generation, reseeded before every setup
+	static void     seed(uint32_t seed);
+	static uint32_t random();
+	// Returns a word with exactly n of the low width bits set
+	static uint32_t errors(unsigned int n, unsigned int width);
+
+	static uint64_t digest(uint64_t hash, const unsigned char* data, unsigned int length);
+	static uint64_t digest(uint64_t hash, uint32_t value);
+	static uint64_t digest(uint64_t hash, const bool* bits, unsigned int length);
+
+	static const uint64_t DIGEST_INIT = 0xCBF29CE484222325ULL;
+
+private:
+	struct CBenchSuite {
+		std::string       m_name;
+		const CBenchCase* m_cases;
+		unsigned int      m_count;
+	};
+
+	std::vector<CBenchSuite> m_suites;
+
+	static uint32_t s_state;
+
+	CBenchResult measure(const CBenchCase& c) const;
+	static unsigned long long now();
+	static unsigned long long cpu();
+};
+
+// Suite registration, one per source file
+extern void addFECBench(CBench& bench);
+extern void addAMBEBench(CBench& bench);
+extern void addIMBEBench(CBench& bench);
+extern void addNXDNBench(CBench& bench);
+extern void addUDPBench(CBench& bench);
+extern void addDispatchBench(CBench& bench);
+
+#endif
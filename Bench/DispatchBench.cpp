@@ -0,0 +1,153 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "Bench.h"
+
+#include "CPUDispatch.h"
+#include "ViterbiACS.h"
+#include "YSFConvolution.h"
+#include "NXDNConvolution.h"
+
+#include <cstring>
+#include <vector>
+
+const unsigned int VECTOR_MASK = BENCH_VECTORS - 1U;
+
+const unsigned int NUM_OF_STATES = 16U;
+
+// Trellis steps per decode, as in the FEC suite
+const unsigned int CONV_BITS = 100U;
+
+static uint16_t s_oldMetrics[BENCH_VECTORS][NUM_OF_STATES];
+static uint16_t s_metrics[BENCH_VECTORS][NUM_OF_STATES / 2U];
+static uint8_t  s_symbols[BENCH_VECTORS][CONV_BITS * 2U];
+
+// Every case selects its kernels in the setup, the verification pass and the timed runs then use them
+
+static void setupACSData()
+{
+	// Path metrics over the full 16-bit range so that the wrap around is covered, and
+	// branch metrics beyond m so that m - metric wraps too
+	CBench::seed(0xAC5U);
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++) {
+		for (unsigned int j = 0U; j < NUM_OF_STATES; j++)
+			s_oldMetrics[i][j] = CBench::random() & 0xFFFFU;
+		for (unsigned int j = 0U; j < NUM_OF_STATES / 2U; j++)
+			s_metrics[i][j] = CBench::random() % 7U;
+	}
+}
+
+static void setupSymbols(uint32_t range)
+{
+	// Random received symbols rather than codewords, so every survivor decision is exercised
+	CBench::seed(0x5EB0U + range);
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++) {
+		for (unsigned int j = 0U; j < CONV_BITS * 2U; j++)
+			s_symbols[i][j] = CBench::random() % range;
+	}
+}
+
+static uint64_t runACS(unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		unsigned int n = i & VECTOR_MASK;
+
+		uint16_t newMetrics[NUM_OF_STATES];
+		uint64_t decisions = CViterbiACS::acs(s_oldMetrics[n], newMetrics, s_metrics[n], (i & 1U) == 0U ? 2U : 4U);
+
+		hash = CBench::digest(hash, uint32_t(decisions));
+		hash = CBench::digest(hash, (const unsigned char*)newMetrics, NUM_OF_STATES * sizeof(uint16_t));
+	}
+	return hash;
+}
+
+static uint64_t runYSFDecode(unsigned int ops)
+{
+	CYSFConvolution conv;
+
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		const uint8_t* symbols = s_symbols[i & VECTOR_MASK];
+
+		conv.start();
+		for (unsigned int j = 0U; j < CONV_BITS; j++)
+			conv.decode(symbols[2U * j + 0U], symbols[2U * j + 1U]);
+
+		unsigned char data[13U];
+		conv.chainback(data, CONV_BITS - 4U);
+		hash = CBench::digest(hash, data, 12U);
+	}
+	return hash;
+}
+
+static uint64_t runNXDNDecode(unsigned int ops)
+{
+	CNXDNConvolution conv;
+
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		const uint8_t* symbols = s_symbols[i & VECTOR_MASK];
+
+		conv.start();
+		for (unsigned int j = 0U; j < CONV_BITS; j++)
+			conv.decode(symbols[2U * j + 0U], symbols[2U * j + 1U]);
+
+		unsigned char data[13U];
+		conv.chainback(data, CONV_BITS - 4U);
+		hash = CBench::digest(hash, data, 12U);
+	}
+	return hash;
+}
+
+template <CPU_KERNELS K> static void setupACS()     { CCPUDispatch::select(K); setupACSData(); }
+template <CPU_KERNELS K> static void setupYSFConv()  { CCPUDispatch::select(K); setupSymbols(2U); }
+template <CPU_KERNELS K> static void setupNXDNConv() { CCPUDispatch::select(K); setupSymbols(3U); }
+
+#define DISPATCH_ENTRIES(KERNELS, NAME) \
+	{"CViterbiACS::acs [" NAME "]",         "random", "trellis step", 1U, setupACS<KERNELS>,      runACS,        0x3BD2DA6581D48ED6ULL}, \
+	{"CYSFConvolution::decode [" NAME "]",  "random", "YSF FICH",     1U, setupYSFConv<KERNELS>,  runYSFDecode,  0x0ABFB2B3D0F48522ULL}, \
+	{"CNXDNConvolution::decode [" NAME "]", "soft",   "NXDN FACCH1",  1U, setupNXDNConv<KERNELS>, runNXDNDecode, 0x29132B3465BE7DCEULL}
+
+// Every kernel variant has to reproduce the digests of the scalar code, this is the
+// cross-variant equivalence check. Variants the CPU does not support are skipped.
+static const CBenchCase DISPATCH_CASES[] = {
+	DISPATCH_ENTRIES(CPUK_SCALAR, "scalar"),
+	DISPATCH_ENTRIES(CPUK_SSE41,  "sse4.1"),
+	DISPATCH_ENTRIES(CPUK_AVX2,   "avx2"),
+	DISPATCH_ENTRIES(CPUK_NEON,   "neon")
+};
+
+const unsigned int DISPATCH_ENTRY_COUNT = 3U;
+
+static std::vector<CBenchCase> s_cases;
+
+void addDispatchBench(CBench& bench)
+{
+	const CPU_KERNELS kernels[] = {CPUK_SCALAR, CPUK_SSE41, CPUK_AVX2, CPUK_NEON};
+
+	for (unsigned int i = 0U; i < sizeof(kernels) / sizeof(CPU_KERNELS); i++) {
+		if (!CCPUDispatch::isSupported(kernels[i]))
+			continue;
+
+		for (unsigned int j = 0U; j < DISPATCH_ENTRY_COUNT; j++)
+			s_cases.push_back(DISPATCH_CASES[i * DISPATCH_ENTRY_COUNT + j]);
+	}
+
+	bench.add("simd", s_cases.data(), s_cases.size());
+}
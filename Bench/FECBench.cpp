@@ -0,0 +1,769 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "Bench.h"
+
+#include "Golay24128.h"
+#include "Golay2087.h"
+#include "QR1676.h"
+#include "Hamming.h"
+#include "RS129.h"
+#include "BPTC19696.h"
+#include "CRC.h"
+#include "NXDNCRC.h"
+#include "YSFConvolution.h"
+#include "NXDNConvolution.h"
+
+#include <cstring>
+
+const unsigned char BIT_MASK_TABLE[] = {0x80U, 0x40U, 0x20U, 0x10U, 0x08U, 0x04U, 0x02U, 0x01U};
+
+#define WRITE_BIT(p,i,b) p[(i)>>3] = (b) ? (p[(i)>>3] | BIT_MASK_TABLE[(i)&7]) : (p[(i)>>3] & ~BIT_MASK_TABLE[(i)&7])
+#define READ_BIT(p,i)    (p[(i)>>3] & BIT_MASK_TABLE[(i)&7])
+
+const unsigned int VECTOR_MASK = BENCH_VECTORS - 1U;
+
+const unsigned int MAX_BYTES = 40U;
+const unsigned int MAX_BITS  = 200U;
+
+// Convolutional code length used by the YSF FICH and the NXDN FACCH1, including the tail
+const unsigned int CONV_BITS = 100U;
+
+static uint32_t      s_words[BENCH_VECTORS];
+static unsigned char s_bytes[BENCH_VECTORS][MAX_BYTES];
+static bool          s_bits[BENCH_VECTORS][MAX_BITS];
+
+static void randomBytes(unsigned char* data, unsigned int length)
+{
+	for (unsigned int i = 0U; i < length; i++)
+		data[i] = CBench::random() & 0xFFU;
+}
+
+static void flipBits(unsigned char* data, unsigned int n, unsigned int first, unsigned int width)
+{
+	unsigned int flipped[8U];
+	unsigned int count = 0U;
+
+	while (count < n && count < 8U) {
+		unsigned int pos = first + CBench::random() % width;
+
+		bool seen = false;
+		for (unsigned int i = 0U; i < count; i++)
+			seen = seen || flipped[i] == pos;
+		if (seen)
+			continue;
+
+		WRITE_BIT(data, pos, !READ_BIT(data, pos));
+		flipped[count++] = pos;
+	}
+}
+
+// Golay (23,12) and (24,12)
+
+static void setupGolay23127Data()
+{
+	CBench::seed(0x23127U);
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++)
+		s_words[i] = CBench::random() & 0xFFFU;
+}
+
+static void setupGolay23127Clean()
+{
+	setupGolay23127Data();
+
+	// The (23,12) table is stored left aligned, as the AMBE b words use it
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++)
+		s_words[i] = CGolay24128::encode23127(s_words[i]) >> 1;
+}
+
+static void setupGolay23127Errors()
+{
+	setupGolay23127Clean();
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++)
+		s_words[i] ^= CBench::errors(3U, 23U);
+}
+
+static void setupGolay24128Clean()
+{
+	setupGolay23127Data();
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++)
+		s_words[i] = CGolay24128::encode24128(s_words[i]);
+}
+
+static void setupGolay24128Errors()
+{
+	setupGolay24128Clean();
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++)
+		s_words[i] ^= CBench::errors(3U, 24U);
+}
+
+static void setupGolay24128Bytes()
+{
+	setupGolay24128Errors();
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++) {
+		s_bytes[i][0U] = (s_words[i] >> 16) & 0xFFU;
+		s_bytes[i][1U] = (s_words[i] >> 8) & 0xFFU;
+		s_bytes[i][2U] = (s_words[i] >> 0) & 0xFFU;
+	}
+}
+
+static uint64_t runGolayEncode23127(unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++)
+		hash = CBench::digest(hash, CGolay24128::encode23127(s_words[i & VECTOR_MASK]));
+	return hash;
+}
+
+static uint64_t runGolayEncode24128(unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++)
+		hash = CBench::digest(hash, CGolay24128::encode24128(s_words[i & VECTOR_MASK]));
+	return hash;
+}
+
+static uint64_t runGolayDecode23127(unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++)
+		hash = CBench::digest(hash, CGolay24128::decode23127(s_words[i & VECTOR_MASK]));
+	return hash;
+}
+
+static uint64_t runGolayDecode24128(unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++)
+		hash = CBench::digest(hash, CGolay24128::decode24128(s_words[i & VECTOR_MASK]));
+	return hash;
+}
+
+static uint64_t runGolayDecode24128Bytes(unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++)
+		hash = CBench::digest(hash, CGolay24128::decode24128(s_bytes[i & VECTOR_MASK]));
+	return hash;
+}
+
+// Golay (20,8)
+
+static void setupGolay2087Data()
+{
+	CBench::seed(0x2087U);
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++) {
+		s_bytes[i][0U] = CBench::random() & 0xFFU;
+		s_bytes[i][1U] = 0x00U;
+		s_bytes[i][2U] = 0x00U;
+	}
+}
+
+static void setupGolay2087Clean()
+{
+	setupGolay2087Data();
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++)
+		CGolay2087::encode(s_bytes[i]);
+}
+
+static void setupGolay2087Errors()
+{
+	setupGolay2087Clean();
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++)
+		flipBits(s_bytes[i], 3U, 0U, 19U);
+}
+
+static uint64_t runGolay2087Encode(unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		unsigned char data[3U];
+		data[0U] = s_bytes[i & VECTOR_MASK][0U];
+		CGolay2087::encode(data);
+		hash = CBench::digest(hash, data, 3U);
+	}
+	return hash;
+}
+
+static uint64_t runGolay2087Decode(unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++)
+		hash = CBench::digest(hash, CGolay2087::decode(s_bytes[i & VECTOR_MASK]));
+	return hash;
+}
+
+// Quadratic residue (16,7,6)
+
+static void setupQR1676Clean()
+{
+	CBench::seed(0x1676U);
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++) {
+		s_bytes[i][0U] = CBench::random() & 0xFEU;
+		s_bytes[i][1U] = 0x00U;
+		CQR1676::encode(s_bytes[i]);
+	}
+}
+
+static void setupQR1676Errors()
+{
+	setupQR1676Clean();
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++)
+		flipBits(s_bytes[i], 2U, 0U, 15U);
+}
+
+static uint64_t runQR1676Encode(unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		unsigned char data[2U];
+		data[0U] = s_bytes[i & VECTOR_MASK][0U];
+		data[1U] = 0x00U;
+		CQR1676::encode(data);
+		hash = CBench::digest(hash, data, 2U);
+	}
+	return hash;
+}
+
+static uint64_t runQR1676Decode(unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++)
+		hash = CBench::digest(hash, CQR1676::decode(s_bytes[i & VECTOR_MASK]));
+	return hash;
+}
+
+// Hamming, all variants share the setup and only differ in the codeword length
+
+static void setupHamming(void (*encode)(bool*), unsigned int length, unsigned int errors)
+{
+	CBench::seed(0x15113U + length);
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++) {
+		for (unsigned int j = 0U; j < length; j++)
+			s_bits[i][j] = (CBench::random() & 0x01U) == 0x01U;
+
+		encode(s_bits[i]);
+
+		if (errors > 0U) {
+			unsigned int pos = CBench::random() % length;
+			s_bits[i][pos] = !s_bits[i][pos];
+		}
+	}
+}
+
+static uint64_t runHammingEncode(void (*encode)(bool*), unsigned int length, unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		bool d[MAX_BITS];
+		::memcpy(d, s_bits[i & VECTOR_MASK], length * sizeof(bool));
+		encode(d);
+		hash = CBench::digest(hash, d, length);
+	}
+	return hash;
+}
+
+static uint64_t runHammingDecode(bool (*decode)(bool*), unsigned int length, unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		bool d[MAX_BITS];
+		::memcpy(d, s_bits[i & VECTOR_MASK], length * sizeof(bool));
+		bool ok = decode(d);
+		hash = CBench::digest(hash, d, length);
+		hash = CBench::digest(hash, ok ? 1U : 0U);
+	}
+	return hash;
+}
+
+#define HAMMING_CASES(NAME, LENGTH) \
+static void setupHamming##NAME##Clean()  { setupHamming(CHamming::encode##NAME, LENGTH, 0U); } \
+static void setupHamming##NAME##Errors() { setupHamming(CHamming::encode##NAME, LENGTH, 1U); } \
+static uint64_t runHamming##NAME##Encode(unsigned int ops) { return runHammingEncode(CHamming::encode##NAME, LENGTH, ops); } \
+static uint64_t runHamming##NAME##Decode(unsigned int ops) { return runHammingDecode(CHamming::decode##NAME, LENGTH, ops); }
+
+HAMMING_CASES(15113_1, 15U)
+HAMMING_CASES(15113_2, 15U)
+HAMMING_CASES(1393, 13U)
+HAMMING_CASES(1063, 10U)
+HAMMING_CASES(16114, 16U)
+HAMMING_CASES(17123, 17U)
+
+// Reed-Solomon (12,9)
+
+static void setupRS129Clean()
+{
+	CBench::seed(0x129U);
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++) {
+		randomBytes(s_bytes[i], 9U);
+
+		unsigned char parity[4U];
+		CRS129::encode(s_bytes[i], 9U, parity);
+		s_bytes[i][9U]  = parity[2U];
+		s_bytes[i][10U] = parity[1U];
+		s_bytes[i][11U] = parity[0U];
+	}
+}
+
+static void setupRS129Errors()
+{
+	setupRS129Clean();
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++)
+		s_bytes[i][CBench::random() % 12U] ^= (CBench::random() % 255U) + 1U;
+}
+
+static uint64_t runRS129Encode(unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		unsigned char parity[4U];
+		CRS129::encode(s_bytes[i & VECTOR_MASK], 9U, parity);
+		hash = CBench::digest(hash, parity, 3U);
+	}
+	return hash;
+}
+
+static uint64_t runRS129Check(unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++)
+		hash = CBench::digest(hash, CRS129::check(s_bytes[i & VECTOR_MASK]) ? 1U : 0U);
+	return hash;
+}
+
+// BPTC (196,96)
+
+static void setupBPTCData()
+{
+	CBench::seed(0x19696U);
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++)
+		randomBytes(s_bytes[i], 12U);
+}
+
+static void setupBPTCClean()
+{
+	setupBPTCData();
+
+	CBPTC19696 bptc;
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++) {
+		unsigned char data[12U];
+		::memcpy(data, s_bytes[i], 12U);
+		::memset(s_bytes[i], 0x00U, 33U);
+		bptc.encode(data, s_bytes[i]);
+	}
+}
+
+static void setupBPTCErrors()
+{
+	setupBPTCClean();
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++)
+		flipBits(s_bytes[i], 3U, 0U, 98U);
+}
+
+static uint64_t runBPTCEncode(unsigned int ops)
+{
+	CBPTC19696 bptc;
+
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		unsigned char data[33U];
+		::memset(data, 0x00U, 33U);
+		bptc.encode(s_bytes[i & VECTOR_MASK], data);
+		hash = CBench::digest(hash, data, 33U);
+	}
+	return hash;
+}
+
+static uint64_t runBPTCDecode(unsigned int ops)
+{
+	CBPTC19696 bptc;
+
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		unsigned char data[12U];
+		bptc.decode(s_bytes[i & VECTOR_MASK], data);
+		hash = CBench::digest(hash, data, 12U);
+	}
+	return hash;
+}
+
+// CRC-CCITT, CRC8, the five bit checksum and the Wires-X additive checksum
+
+static void setupCCITTData()
+{
+	CBench::seed(0xCC177U);
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++)
+		randomBytes(s_bytes[i], 12U);
+}
+
+static void setupCCITT161Clean()
+{
+	setupCCITTData();
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++)
+		CCRC::addCCITT161(s_bytes[i], 12U);
+}
+
+static void setupCCITT161Errors()
+{
+	setupCCITT161Clean();
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++)
+		flipBits(s_bytes[i], 1U, 0U, 32U);
+}
+
+static void setupCCITT162Clean()
+{
+	setupCCITTData();
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++)
+		CCRC::addCCITT162(s_bytes[i], 12U);
+}
+
+static void setupCCITT162Errors()
+{
+	setupCCITT162Clean();
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++)
+		flipBits(s_bytes[i], 1U, 0U, 32U);
+}
+
+static uint64_t runCCITT161Add(unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		unsigned char data[12U];
+		::memcpy(data, s_bytes[i & VECTOR_MASK], 12U);
+		CCRC::addCCITT161(data, 12U);
+		hash = CBench::digest(hash, data + 10U, 2U);
+	}
+	return hash;
+}
+
+static uint64_t runCCITT161Check(unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++)
+		hash = CBench::digest(hash, CCRC::checkCCITT161(s_bytes[i & VECTOR_MASK], 12U) ? 1U : 0U);
+	return hash;
+}
+
+static uint64_t runCCITT162Add(unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		unsigned char data[12U];
+		::memcpy(data, s_bytes[i & VECTOR_MASK], 12U);
+		CCRC::addCCITT162(data, 12U);
+		hash = CBench::digest(hash, data + 10U, 2U);
+	}
+	return hash;
+}
+
+static uint64_t runCCITT162Check(unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++)
+		hash = CBench::digest(hash, CCRC::checkCCITT162(s_bytes[i & VECTOR_MASK], 12U) ? 1U : 0U);
+	return hash;
+}
+
+static uint64_t runCRC8(unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++)
+		hash = CBench::digest(hash, CCRC::crc8(s_bytes[i & VECTOR_MASK], 12U));
+	return hash;
+}
+
+static uint64_t runAddCRC(unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++)
+		hash = CBench::digest(hash, CCRC::addCRC(s_bytes[i & VECTOR_MASK], 12U));
+	return hash;
+}
+
+static void setupFiveBit()
+{
+	CBench::seed(0x5B17U);
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++) {
+		for (unsigned int j = 0U; j < 72U; j++)
+			s_bits[i][j] = (CBench::random() & 0x01U) == 0x01U;
+
+		unsigned int crc;
+		CCRC::encodeFiveBit(s_bits[i], crc);
+		s_words[i] = crc;
+	}
+}
+
+static uint64_t runFiveBitEncode(unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		unsigned int crc;
+		CCRC::encodeFiveBit(s_bits[i & VECTOR_MASK], crc);
+		hash = CBench::digest(hash, crc);
+	}
+	return hash;
+}
+
+static uint64_t runFiveBitCheck(unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		unsigned int n = i & VECTOR_MASK;
+		hash = CBench::digest(hash, CCRC::checkFiveBit(s_bits[n], s_words[n]) ? 1U : 0U);
+	}
+	return hash;
+}
+
+// NXDN CRC6 (SACCH), CRC12 (FACCH1) and CRC15 (UDCH)
+
+static void setupNXDNCRC(void (*encode)(unsigned char*, unsigned int), unsigned int length, unsigned int crcLength, unsigned int errors)
+{
+	CBench::seed(0xC0DEU + length);
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++) {
+		::memset(s_bytes[i], 0x00U, MAX_BYTES);
+		randomBytes(s_bytes[i], length / 8U);
+		for (unsigned int j = length & ~7U; j < length; j++)
+			WRITE_BIT(s_bytes[i], j, (CBench::random() & 0x01U) == 0x01U);
+
+		encode(s_bytes[i], length);
+
+		if (errors > 0U)
+			flipBits(s_bytes[i], errors, 0U, length + crcLength < 32U ? length + crcLength : 32U);
+	}
+}
+
+static uint64_t runNXDNCRCEncode(void (*encode)(unsigned char*, unsigned int), unsigned int length, unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		unsigned char data[MAX_BYTES];
+		::memcpy(data, s_bytes[i & VECTOR_MASK], MAX_BYTES);
+		encode(data, length);
+		hash = CBench::digest(hash, data, (length + 15U) / 8U + 1U);
+	}
+	return hash;
+}
+
+static uint64_t runNXDNCRCCheck(bool (*check)(const unsigned char*, unsigned int), unsigned int length, unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++)
+		hash = CBench::digest(hash, check(s_bytes[i & VECTOR_MASK], length) ? 1U : 0U);
+	return hash;
+}
+
+#define NXDNCRC_CASES(NAME, LENGTH, CRC_LENGTH) \
+static void setupNXDN##NAME##Clean()  { setupNXDNCRC(CNXDNCRC::encode##NAME, LENGTH, CRC_LENGTH, 0U); } \
+static void setupNXDN##NAME##Errors() { setupNXDNCRC(CNXDNCRC::encode##NAME, LENGTH, CRC_LENGTH, 1U); } \
+static uint64_t runNXDN##NAME##Encode(unsigned int ops) { return runNXDNCRCEncode(CNXDNCRC::encode##NAME, LENGTH, ops); } \
+static uint64_t runNXDN##NAME##Check(unsigned int ops)  { return runNXDNCRCCheck(CNXDNCRC::check##NAME, LENGTH, ops); }
+
+NXDNCRC_CASES(CRC6,  26U,  6U)
+NXDNCRC_CASES(CRC12, 80U,  12U)
+NXDNCRC_CASES(CRC15, 184U, 15U)
+
+// Convolutional codes, the YSF one with hard bits and the NXDN one with 0/1/2 soft symbols
+
+static void setupConvData()
+{
+	CBench::seed(0xC0471U);
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++) {
+		::memset(s_bytes[i], 0x00U, MAX_BYTES);
+		randomBytes(s_bytes[i], 12U);
+	}
+}
+
+static void setupConvSymbols(unsigned int errors)
+{
+	setupConvData();
+
+	CYSFConvolution conv;
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++) {
+		unsigned char encoded[MAX_BYTES];
+		::memset(encoded, 0x00U, MAX_BYTES);
+		conv.encode(s_bytes[i], encoded, CONV_BITS);
+
+		if (errors > 0U) {
+			flipBits(encoded, errors / 2U, 0U, 32U);
+			flipBits(encoded, errors - errors / 2U, CONV_BITS, 32U);
+		}
+
+		// One hard decision per slot, the decoders scale it to their own symbol range
+		for (unsigned int j = 0U; j < CONV_BITS * 2U; j++)
+			s_bits[i][j] = READ_BIT(encoded, j) != 0U;
+	}
+}
+
+static void setupYSFConvEncode()
+{
+	setupConvData();
+}
+
+static void setupYSFConvClean()
+{
+	setupConvSymbols(0U);
+}
+
+static void setupYSFConvErrors()
+{
+	setupConvSymbols(4U);
+}
+
+static uint64_t runYSFConvEncode(unsigned int ops)
+{
+	CYSFConvolution conv;
+
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		unsigned char data[25U];
+		::memset(data, 0x00U, 25U);
+		conv.encode(s_bytes[i & VECTOR_MASK], data, CONV_BITS);
+		hash = CBench::digest(hash, data, 25U);
+	}
+	return hash;
+}
+
+static uint64_t runYSFConvDecode(unsigned int ops)
+{
+	CYSFConvolution conv;
+
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		const bool* symbols = s_bits[i & VECTOR_MASK];
+
+		conv.start();
+		for (unsigned int j = 0U; j < CONV_BITS; j++)
+			conv.decode(symbols[2U * j + 0U] ? 1U : 0U, symbols[2U * j + 1U] ? 1U : 0U);
+
+		unsigned char data[13U];
+		conv.chainback(data, CONV_BITS - 4U);
+		hash = CBench::digest(hash, data, 12U);
+	}
+	return hash;
+}
+
+static void setupNXDNConvEncode()
+{
+	setupConvData();
+}
+
+static void setupNXDNConvClean()
+{
+	setupConvSymbols(0U);
+}
+
+static void setupNXDNConvErrors()
+{
+	setupConvSymbols(4U);
+}
+
+static uint64_t runNXDNConvEncode(unsigned int ops)
+{
+	CNXDNConvolution conv;
+
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		unsigned char data[25U];
+		::memset(data, 0x00U, 25U);
+		conv.encode(s_bytes[i & VECTOR_MASK], data, CONV_BITS);
+		hash = CBench::digest(hash, data, 25U);
+	}
+	return hash;
+}
+
+static uint64_t runNXDNConvDecode(unsigned int ops)
+{
+	CNXDNConvolution conv;
+
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		const bool* symbols = s_bits[i & VECTOR_MASK];
+
+		conv.start();
+		for (unsigned int j = 0U; j < CONV_BITS; j++)
+			conv.decode(symbols[2U * j + 0U] ? 2U : 0U, symbols[2U * j + 1U] ? 2U : 0U);
+
+		unsigned char data[13U];
+		conv.chainback(data, CONV_BITS - 4U);
+		hash = CBench::digest(hash, data, 12U);
+	}
+	return hash;
+}
+
+#define HAMMING_ENTRIES(NAME, FRAME, OPS, GOLDEN_ENC, GOLDEN_DEC) \
+	{"CHamming::encode" #NAME, "clean", FRAME, OPS, setupHamming##NAME##Clean,  runHamming##NAME##Encode, GOLDEN_ENC}, \
+	{"CHamming::decode" #NAME, "1bit",  FRAME, OPS, setupHamming##NAME##Errors, runHamming##NAME##Decode, GOLDEN_DEC}
+
+#define NXDNCRC_ENTRIES(NAME, FRAME, GOLDEN_ENC, GOLDEN_CLEAN, GOLDEN_ERR) \
+	{"CNXDNCRC::encode" #NAME, "clean", FRAME, 1U, setupNXDN##NAME##Clean,  runNXDN##NAME##Encode, GOLDEN_ENC}, \
+	{"CNXDNCRC::check" #NAME,  "clean", FRAME, 1U, setupNXDN##NAME##Clean,  runNXDN##NAME##Check,  GOLDEN_CLEAN}, \
+	{"CNXDNCRC::check" #NAME,  "1bit",  FRAME, 1U, setupNXDN##NAME##Errors, runNXDN##NAME##Check,  GOLDEN_ERR}
+
+// The digests were produced by the original bit-at-a-time implementations, any
+// optimised replacement has to reproduce them exactly.
+static const CBenchCase FEC_CASES[] = {
+	{"CGolay24128::encode23127",        "clean", "DMR voice burst", 3U, setupGolay23127Data,   runGolayEncode23127,      0x94449763E9E43A4DULL},
+	{"CGolay24128::encode24128",        "clean", "DMR voice burst", 3U, setupGolay23127Data,   runGolayEncode24128,      0x37FB0943C5C97935ULL},
+	{"CGolay24128::decode23127",        "clean", "DMR voice burst", 3U, setupGolay23127Clean,  runGolayDecode23127,      0x49F3DB614BD774B3ULL},
+	{"CGolay24128::decode23127",        "3bit",  "DMR voice burst", 3U, setupGolay23127Errors, runGolayDecode23127,      0x49F3DB614BD774B3ULL},
+	{"CGolay24128::decode24128",        "clean", "DMR voice burst", 3U, setupGolay24128Clean,  runGolayDecode24128,      0x49F3DB614BD774B3ULL},
+	{"CGolay24128::decode24128",        "3bit",  "DMR voice burst", 3U, setupGolay24128Errors, runGolayDecode24128,      0x49F3DB614BD774B3ULL},
+	{"CGolay24128::decode24128(bytes)", "3bit",  "YSF FICH",        4U, setupGolay24128Bytes,  runGolayDecode24128Bytes, 0x49F3DB614BD774B3ULL},
+	{"CGolay2087::encode",              "clean", "DMR data burst",  1U, setupGolay2087Data,    runGolay2087Encode,       0xE7A9E4FCF46FEE48ULL},
+	{"CGolay2087::decode",              "clean", "DMR data burst",  1U, setupGolay2087Clean,   runGolay2087Decode,       0x01335593DDAC9ED3ULL},
+	{"CGolay2087::decode",              "3bit",  "DMR data burst",  1U, setupGolay2087Errors,  runGolay2087Decode,       0x01335593DDAC9ED3ULL},
+	{"CQR1676::encode",                 "clean", "DMR voice burst", 1U, setupQR1676Clean,      runQR1676Encode,          0x1EFDA49D57FC3DFBULL},
+	{"CQR1676::decode",                 "clean", "DMR voice burst", 1U, setupQR1676Clean,      runQR1676Decode,          0x4D2BEF20A3465FA2ULL},
+	{"CQR1676::decode",                 "2bit",  "DMR voice burst", 1U, setupQR1676Errors,     runQR1676Decode,          0x4D2BEF20A3465FA2ULL},
+	HAMMING_ENTRIES(15113_1, "BPTC block",       15U, 0xA82D719CF5B6D7E8ULL, 0xE6D2A43C7EA7BFF0ULL),
+	HAMMING_ENTRIES(15113_2, "BPTC block",       9U,  0x30BBAA3E50BEE532ULL, 0x6592BB6C23709136ULL),
+	HAMMING_ENTRIES(1393,    "BPTC block",       15U, 0x15DD24DEB7AC6C6BULL, 0x4825B7E09B61A775ULL),
+	HAMMING_ENTRIES(1063,    "BPTC block",       15U, 0x76C7D146BA9AC7ABULL, 0xAE2917BCC3D73F33ULL),
+	HAMMING_ENTRIES(16114,   "DMR embedded LC",  7U,  0xB2B96BFC21784A3DULL, 0xCAEC00A2C1A890ADULL),
+	HAMMING_ENTRIES(17123,   "DMR embedded LC",  7U,  0x3344BE1CBFAFFD13ULL, 0x496C9285838718BCULL),
+	{"CRS129::encode",                  "clean", "DMR full LC",     1U, setupRS129Clean,       runRS129Encode,           0xE5A957AF1E2DAB3AULL},
+	{"CRS129::check",                   "clean", "DMR full LC",     1U, setupRS129Clean,       runRS129Check,            0xF2929686B07EF725ULL},
+	{"CRS129::check",                   "1byte", "DMR full LC",     1U, setupRS129Errors,      runRS129Check,            0x51D88627DF287325ULL},
+	{"CBPTC19696::encode",              "clean", "DMR data burst",  1U, setupBPTCData,         runBPTCEncode,            0xF00E64419C250063ULL},
+	{"CBPTC19696::decode",              "clean", "DMR data burst",  1U, setupBPTCClean,        runBPTCDecode,            0x6AD87E07BA957BE8ULL},
+	{"CBPTC19696::decode",              "3bit",  "DMR data burst",  1U, setupBPTCErrors,       runBPTCDecode,            0x6AD87E07BA957BE8ULL},
+	{"CCRC::addCCITT161",               "clean", "12 byte block",   1U, setupCCITTData,        runCCITT161Add,           0xD98C22A7C66BA01BULL},
+	{"CCRC::checkCCITT161",             "clean", "12 byte block",   1U, setupCCITT161Clean,    runCCITT161Check,         0xF2929686B07EF725ULL},
+	{"CCRC::checkCCITT161",             "1bit",  "12 byte block",   1U, setupCCITT161Errors,   runCCITT161Check,         0x51D88627DF287325ULL},
+	{"CCRC::addCCITT162",               "clean", "YSF FICH",        1U, setupCCITTData,        runCCITT162Add,           0xC09B72295453C8BCULL},
+	{"CCRC::checkCCITT162",             "clean", "YSF FICH",        1U, setupCCITT162Clean,    runCCITT162Check,         0xF2929686B07EF725ULL},
+	{"CCRC::checkCCITT162",             "1bit",  "YSF FICH",        1U, setupCCITT162Errors,   runCCITT162Check,         0x51D88627DF287325ULL},
+	{"CCRC::crc8",                      "clean", "12 byte block",   1U, setupCCITTData,        runCRC8,                  0x77251F20B58A0D53ULL},
+	{"CCRC::addCRC",                    "clean", "12 byte block",   1U, setupCCITTData,        runAddCRC,                0x8AC538825468F9F5ULL},
+	{"CCRC::encodeFiveBit",             "clean", "DMR embedded LC", 1U, setupFiveBit,          runFiveBitEncode,         0xBAB638EF1538F1EBULL},
+	{"CCRC::checkFiveBit",              "clean", "DMR embedded LC", 1U, setupFiveBit,          runFiveBitCheck,          0xF2929686B07EF725ULL},
+	NXDNCRC_ENTRIES(CRC6,  "NXDN SACCH", 0xF21983B36F203614ULL, 0xF2929686B07EF725ULL, 0x51D88627DF287325ULL),
+	NXDNCRC_ENTRIES(CRC12, "NXDN FACCH1", 0x0C76C9C59227D2D6ULL, 0xF2929686B07EF725ULL, 0x51D88627DF287325ULL),
+	NXDNCRC_ENTRIES(CRC15, "NXDN UDCH", 0x9467F416F60C7645ULL, 0xF2929686B07EF725ULL, 0x51D88627DF287325ULL),
+	{"CYSFConvolution::encode",         "clean", "YSF FICH",        1U, setupYSFConvEncode,    runYSFConvEncode,         0xFDE7F04AF47D2298ULL},
+	{"CYSFConvolution::decode",         "clean", "YSF FICH",        1U, setupYSFConvClean,     runYSFConvDecode,         0x266F7D80908C2635ULL},
+	{"CYSFConvolution::decode",         "4bit",  "YSF FICH",        1U, setupYSFConvErrors,    runYSFConvDecode,         0xD85D6CF8CA5C6775ULL},
+	{"CNXDNConvolution::encode",        "clean", "NXDN FACCH1",     1U, setupNXDNConvEncode,   runNXDNConvEncode,        0xFDE7F04AF47D2298ULL},
+	{"CNXDNConvolution::decode",        "clean", "NXDN FACCH1",     1U, setupNXDNConvClean,    runNXDNConvDecode,        0x266F7D80908C2635ULL},
+	{"CNXDNConvolution::decode",        "4bit",  "NXDN FACCH1",     1U, setupNXDNConvErrors,   runNXDNConvDecode,        0xD85D6CF8CA5C6775ULL}
+};
+
+void addFECBench(CBench& bench)
+{
+	bench.add("fec", FEC_CASES, sizeof(FEC_CASES) / sizeof(CBenchCase));
+}
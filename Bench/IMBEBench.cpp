@@ -0,0 +1,242 @@
+/*
+ *   Copyright (C) 2010,2014,2016 and 2018 by Jonathan Naylor G4KLX
+ *   Copyright (C) 2016 Mathias Weyland, HB9FRV
+ *   Copyright (C) 2018 by Andy Uribe CA6JAU
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "Bench.h"
+
+#include "IMBEConv.h"
+#include "Golay24128.h"
+#include "Hamming.h"
+
+#include <cstring>
+
+const unsigned char BIT_MASK_TABLE[] = {0x80U, 0x40U, 0x20U, 0x10U, 0x08U, 0x04U, 0x02U, 0x01U};
+
+#define WRITE_BIT(p,i,b) p[(i)>>3] = (b) ? (p[(i)>>3] | BIT_MASK_TABLE[(i)&7]) : (p[(i)>>3] & ~BIT_MASK_TABLE[(i)&7])
+#define READ_BIT(p,i)    (p[(i)>>3] & BIT_MASK_TABLE[(i)&7])
+
+const unsigned int VECTOR_MASK = BENCH_VECTORS - 1U;
+
+const unsigned int VCH_BYTES  = 18U;
+const unsigned int IMBE_BYTES = 11U;
+
+const unsigned int IMBE_INTERLEAVE[] = {
+	0,  7, 12, 19, 24, 31, 36, 43, 48, 55, 60, 67, 72, 79, 84, 91,  96, 103, 108, 115, 120, 127, 132, 139,
+	1,  6, 13, 18, 25, 30, 37, 42, 49, 54, 61, 66, 73, 78, 85, 90,  97, 102, 109, 114, 121, 126, 133, 138,
+	2,  9, 14, 21, 26, 33, 38, 45, 50, 57, 62, 69, 74, 81, 86, 93,  98, 105, 110, 117, 122, 129, 134, 141,
+	3,  8, 15, 20, 27, 32, 39, 44, 51, 56, 63, 68, 75, 80, 87, 92,  99, 104, 111, 116, 123, 128, 135, 140,
+	4, 11, 16, 23, 28, 35, 40, 47, 52, 59, 64, 71, 76, 83, 88, 95, 100, 107, 112, 119, 124, 131, 136, 143,
+	5, 10, 17, 22, 29, 34, 41, 46, 53, 58, 65, 70, 77, 82, 89, 94, 101, 106, 113, 118, 125, 130, 137, 142};
+
+static unsigned char s_vch[BENCH_VECTORS][VCH_BYTES];
+static unsigned char s_imbe[BENCH_VECTORS][IMBE_BYTES];
+
+// The bit at a time conversion YSF2P25 used before CIMBEConv, kept as the reference
+
+static void refDecode(const unsigned char* data, unsigned char* imbe)
+{
+	bool bit[144U];
+
+	for (unsigned int i = 0U; i < 144U; i++) {
+		unsigned int n = IMBE_INTERLEAVE[i];
+		bit[i] = READ_BIT(data, n);
+	}
+
+	unsigned int c0data = 0U;
+	for (unsigned int i = 0U; i < 12U; i++)
+		c0data = (c0data << 1) | (bit[i] ? 0x01U : 0x00U);
+
+	unsigned int p = 16U * c0data;
+	for (unsigned int i = 0U; i < 114U; i++) {
+		p = (173U * p + 13849U) % 65536U;
+		bit[i + 23U] ^= p >= 32768U;
+	}
+
+	const unsigned int start[]  = {0U, 23U, 46U, 69U, 92U, 107U, 122U, 137U};
+	const unsigned int length[] = {12U, 12U, 12U, 12U, 11U, 11U, 11U, 7U};
+
+	unsigned int offset = 0U;
+	for (unsigned int v = 0U; v < 8U; v++) {
+		for (unsigned int i = 0U; i < length[v]; i++, offset++)
+			WRITE_BIT(imbe, offset, bit[i + start[v]]);
+	}
+}
+
+static void refEncode(unsigned char* data, const unsigned char* imbe)
+{
+	bool bTemp[144U];
+	bool* bit = bTemp;
+
+	unsigned int c0 = 0U;
+	for (unsigned int v = 0U; v < 4U; v++) {
+		unsigned int c = 0U;
+		for (unsigned int i = v * 12U; i < v * 12U + 12U; i++)
+			c = (c << 1) | (READ_BIT(imbe, i) ? 0x01U : 0x00U);
+		if (v == 0U)
+			c0 = c;
+
+		// The 24th bit of the (24,12) word is overwritten by the next vector
+		unsigned int g2 = CGolay24128::encode23127(c);
+		for (int i = 23; i >= 0; i--) {
+			bit[i] = (g2 & 0x01U) == 0x01U;
+			g2 >>= 1;
+		}
+		bit += 23U;
+	}
+
+	for (unsigned int v = 0U; v < 3U; v++) {
+		for (unsigned int i = 0U; i < 11U; i++)
+			bit[i] = READ_BIT(imbe, i + 48U + v * 11U);
+		CHamming::encode15113_1(bit);
+		bit += 15U;
+	}
+
+	for (unsigned int i = 0U; i < 7U; i++)
+		bit[i] = READ_BIT(imbe, i + 81U);
+
+	unsigned int p = 16U * c0;
+	for (unsigned int i = 0U; i < 114U; i++) {
+		p = (173U * p + 13849U) % 65536U;
+		bTemp[i + 23U] ^= p >= 32768U;
+	}
+
+	for (unsigned int i = 0U; i < 144U; i++) {
+		unsigned int n = IMBE_INTERLEAVE[i];
+		WRITE_BIT(data, n, bTemp[i]);
+	}
+}
+
+static void setupIMBE()
+{
+	CBench::seed(0x1BEU);
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++) {
+		for (unsigned int j = 0U; j < IMBE_BYTES; j++)
+			s_imbe[i][j] = CBench::random() & 0xFFU;
+	}
+}
+
+static void setupVCHRandom()
+{
+	// Arbitrary air bits, so that the whitening seed and every vector are uncorrelated
+	CBench::seed(0x144U);
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++) {
+		for (unsigned int j = 0U; j < VCH_BYTES; j++)
+			s_vch[i][j] = CBench::random() & 0xFFU;
+	}
+}
+
+static void setupVCHClean()
+{
+	setupIMBE();
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++)
+		refEncode(s_vch[i], s_imbe[i]);
+}
+
+static void setupVCHErrors()
+{
+	setupVCHClean();
+
+	// Three errors in each Golay word and one in each Hamming word, all correctable
+	const unsigned int start[]  = {0U, 23U, 46U, 69U, 92U, 107U, 122U};
+	const unsigned int length[] = {23U, 23U, 23U, 23U, 15U, 15U, 15U};
+	const unsigned int count[]  = {3U, 3U, 3U, 3U, 1U, 1U, 1U};
+
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++) {
+		for (unsigned int v = 0U; v < 7U; v++) {
+			uint32_t mask = CBench::errors(count[v], length[v]);
+			for (unsigned int j = 0U; j < length[v]; j++) {
+				if ((mask & (1U << j)) != 0U) {
+					unsigned int n = IMBE_INTERLEAVE[start[v] + j];
+					WRITE_BIT(s_vch[i], n, !READ_BIT(s_vch[i], n));
+				}
+			}
+		}
+	}
+}
+
+static uint64_t runRefDecode(unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		unsigned char imbe[IMBE_BYTES];
+		refDecode(s_vch[i & VECTOR_MASK], imbe);
+		hash = CBench::digest(hash, imbe, IMBE_BYTES);
+	}
+	return hash;
+}
+
+static uint64_t runDecode(unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		unsigned char imbe[IMBE_BYTES];
+		CIMBEConv::decode(s_vch[i & VECTOR_MASK], imbe, false);
+		hash = CBench::digest(hash, imbe, IMBE_BYTES);
+	}
+	return hash;
+}
+
+static uint64_t runDecodeCorrect(unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		unsigned char imbe[IMBE_BYTES];
+		CIMBEConv::decode(s_vch[i & VECTOR_MASK], imbe, true);
+		hash = CBench::digest(hash, imbe, IMBE_BYTES);
+	}
+	return hash;
+}
+
+static uint64_t runRefEncode(unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		unsigned char vch[VCH_BYTES];
+		refEncode(vch, s_imbe[i & VECTOR_MASK]);
+		hash = CBench::digest(hash, vch, VCH_BYTES);
+	}
+	return hash;
+}
+
+static uint64_t runEncode(unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		unsigned char vch[VCH_BYTES];
+		CIMBEConv::encode(s_imbe[i & VECTOR_MASK], vch);
+		hash = CBench::digest(hash, vch, VCH_BYTES);
+	}
+	return hash;
+}
+
+// The reference and the tables have to agree, and a corrected decode of damaged frames has to give back the clean payload
+static const CBenchCase IMBE_CASES[] = {
+	{"reference IMBE decode",           "random",  "YSF VD2 frame", 5U, setupVCHRandom, runRefDecode,     0x1E20718BB57145AAULL},
+	{"CIMBEConv::decode",               "random",  "YSF VD2 frame", 5U, setupVCHRandom, runDecode,        0x1E20718BB57145AAULL},
+	{"CIMBEConv::decode correct",       "clean",   "YSF VD2 frame", 5U, setupVCHClean,  runDecodeCorrect, 0x12274355C5FEB848ULL},
+	{"CIMBEConv::decode correct",       "3+1 err", "YSF VD2 frame", 5U, setupVCHErrors, runDecodeCorrect, 0x12274355C5FEB848ULL},
+	{"reference IMBE encode",           "clean",   "YSF VD2 frame", 5U, setupIMBE,      runRefEncode,     0x330413773FC946E5ULL},
+	{"CIMBEConv::encode",               "clean",   "YSF VD2 frame", 5U, setupIMBE,      runEncode,        0x330413773FC946E5ULL}
+};
+
+void addIMBEBench(CBench& bench)
+{
+	bench.add("imbe", IMBE_CASES, sizeof(IMBE_CASES) / sizeof(CBenchCase));
+}
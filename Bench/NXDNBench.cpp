@@ -0,0 +1,199 @@
+/*
+ *   Copyright (C) 2016,2017 by Jonathan Naylor G4KLX
+ *   Copyright (C) 2018,2019 by Andy Uribe CA6JAU
+ *   Copyright (C) 2018 by Manuel Sanchez EA7EE
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "Bench.h"
+
+#include "NXDNCallTemplate.h"
+#include "NXDNDefines.h"
+#include "NXDNLayer3.h"
+#include "NXDNSACCH.h"
+#include "NXDNLICH.h"
+
+#include <cstring>
+
+const unsigned int VECTOR_MASK = BENCH_VECTORS - 1U;
+
+// Voice frames sent before the next call starts
+const unsigned int CALL_FRAMES = 32U;
+
+static unsigned int s_src[BENCH_VECTORS];
+static unsigned int s_dst[BENCH_VECTORS];
+
+// The per frame builders the NXDN bridges used before CNXDNCallTemplate, kept as the reference
+
+static void refControl(unsigned char messageType, unsigned int src, unsigned int dst, unsigned char* frame)
+{
+	CNXDNLICH lich;
+	lich.setRFCT(NXDN_LICH_RFCT_RDCH);
+	lich.setFCT(NXDN_LICH_USC_SACCH_NS);
+	lich.setOption(NXDN_LICH_STEAL_FACCH);
+	lich.setDirection(NXDN_LICH_DIRECTION_INBOUND);
+	frame[0U] = lich.getRaw();
+
+	CNXDNSACCH sacch;
+	sacch.setRAN(0x01);
+	sacch.setStructure(NXDN_SR_SINGLE);
+	sacch.setData(SACCH_IDLE);
+	sacch.getRaw(frame + 1U);
+
+	unsigned char layer3data[25U];
+	CNXDNLayer3 layer3;
+	layer3.setMessageType(messageType);
+	layer3.setSourceUnitId(src & 0xFFFF);
+	layer3.setDestinationGroupId(dst & 0xFFFF);
+	layer3.setGroup(true);
+	layer3.setDataBlocks(0U);
+	layer3.getData(layer3data);
+
+	::memcpy(frame + 5U, layer3data, 14U);
+	::memcpy(frame + 5U + 14U, layer3data, 14U);
+}
+
+static void refVoice(unsigned int nxdn_cnt, unsigned int src, unsigned int dst, unsigned char* frame)
+{
+	CNXDNLICH lich;
+	lich.setRFCT(NXDN_LICH_RFCT_RDCH);
+	lich.setFCT(NXDN_LICH_USC_SACCH_SS);
+	lich.setOption(NXDN_LICH_STEAL_NONE);
+	lich.setDirection(NXDN_LICH_DIRECTION_INBOUND);
+	frame[0U] = lich.getRaw();
+
+	CNXDNSACCH sacch;
+	CNXDNLayer3 layer3;
+	unsigned char message[3U];
+
+	layer3.setMessageType(NXDN_MESSAGE_TYPE_VCALL);
+	layer3.setSourceUnitId(src & 0xFFFF);
+	layer3.setDestinationGroupId(dst & 0xFFFF);
+	layer3.setGroup(true);
+	layer3.setDataBlocks(0U);
+
+	switch (nxdn_cnt % 4) {
+		case 0:
+			sacch.setStructure(NXDN_SR_1_4);
+			layer3.encode(message, 18U, 0U);
+			sacch.setData(message);
+			break;
+		case 1:
+			sacch.setStructure(NXDN_SR_2_4);
+			layer3.encode(message, 18U, 18U);
+			sacch.setData(message);
+			break;
+		case 2:
+			sacch.setStructure(NXDN_SR_3_4);
+			layer3.encode(message, 18U, 36U);
+			sacch.setData(message);
+			break;
+		case 3:
+			sacch.setStructure(NXDN_SR_4_4);
+			layer3.encode(message, 18U, 54U);
+			sacch.setData(message);
+			break;
+	}
+
+	sacch.setRAN(0x01);
+	sacch.getRaw(frame + 1U);
+}
+
+static void setupCalls()
+{
+	// Wider than 16 bits, the builders only keep the low half
+	CBench::seed(0xCA11U);
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++) {
+		s_src[i] = CBench::random() & 0xFFFFFFU;
+		s_dst[i] = CBench::random() & 0xFFFFFFU;
+	}
+}
+
+static uint64_t runRefVoice(unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		unsigned int n = (i / CALL_FRAMES) & VECTOR_MASK;
+
+		unsigned char frame[NXDN_PREFIX_LENGTH];
+		refVoice(i % CALL_FRAMES, s_src[n], s_dst[n], frame);
+		hash = CBench::digest(hash, frame, NXDN_PREFIX_LENGTH);
+	}
+	return hash;
+}
+
+static uint64_t runVoice(unsigned int ops)
+{
+	CNXDNCallTemplate call;
+
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		unsigned int n = (i / CALL_FRAMES) & VECTOR_MASK;
+
+		unsigned char frame[NXDN_PREFIX_LENGTH];
+		call.setCall(s_src[n], s_dst[n]);
+		call.getVoice(frame, i % CALL_FRAMES);
+		hash = CBench::digest(hash, frame, NXDN_PREFIX_LENGTH);
+	}
+	return hash;
+}
+
+static uint64_t runRefControl(unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		unsigned int n = i & VECTOR_MASK;
+
+		unsigned char frame[NXDN_CALL_FRAME_LENGTH];
+		refControl(NXDN_MESSAGE_TYPE_VCALL, s_src[n], s_dst[n], frame);
+		hash = CBench::digest(hash, frame, NXDN_CALL_FRAME_LENGTH);
+		refControl(NXDN_MESSAGE_TYPE_TX_REL, s_src[n], s_dst[n], frame);
+		hash = CBench::digest(hash, frame, NXDN_CALL_FRAME_LENGTH);
+	}
+	return hash;
+}
+
+static uint64_t runControl(unsigned int ops)
+{
+	CNXDNCallTemplate call;
+
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		unsigned int n = i & VECTOR_MASK;
+
+		unsigned char frame[NXDN_CALL_FRAME_LENGTH];
+		call.setCall(s_src[n], s_dst[n]);
+		call.getHeader(frame);
+		hash = CBench::digest(hash, frame, NXDN_CALL_FRAME_LENGTH);
+		call.getTerminator(frame);
+		hash = CBench::digest(hash, frame, NXDN_CALL_FRAME_LENGTH);
+	}
+	return hash;
+}
+
+// A new call every op for the header and terminator, so the template build is timed there
+static const CBenchCase NXDN_CASES[] = {
+	{"reference NXDN voice prefix",     "clean", "NXDN voice frame", 1U, setupCalls, runRefVoice,   0x048B4973A3F49BA5ULL},
+	{"CNXDNCallTemplate::getVoice",     "clean", "NXDN voice frame", 1U, setupCalls, runVoice,      0x048B4973A3F49BA5ULL},
+	{"reference NXDN header+term",      "clean", "NXDN call",        1U, setupCalls, runRefControl, 0xD352290478C5FC5DULL},
+	{"CNXDNCallTemplate::setCall",      "clean", "NXDN call",        1U, setupCalls, runControl,    0xD352290478C5FC5DULL}
+};
+
+void addNXDNBench(CBench& bench)
+{
+	bench.add("nxdn", NXDN_CASES, sizeof(NXDN_CASES) / sizeof(CBenchCase));
+}
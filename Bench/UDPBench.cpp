@@ -0,0 +1,330 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "Bench.h"
+
+#include "UDPSocket.h"
+
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+const unsigned int VECTOR_MASK = BENCH_VECTORS - 1U;
+
+const unsigned int YSF_FRAME_LENGTH = 155U;
+const unsigned int DMR_FRAME_LENGTH = 55U;
+
+// A bridge loop polls its sockets every 5 ms, so twenty passes go by for each 100 ms YSF frame
+const unsigned int PASSES_PER_FRAME = 20U;
+
+// The 100 ms YSF frames become 60 ms DMR frames, close enough to two of them per YSF frame
+const unsigned int DMR_PER_FRAME = 2U;
+
+// Gives up on a datagram that never arrives, the digest then shows it
+const unsigned int MAX_POLLS = 100000U;
+
+const unsigned int YSF_PORT = 47301U;
+const unsigned int DMR_PORT = 47302U;
+
+// The link cases play a gateway and a bridge on the same host, the bridge has the higher port so it connects
+const unsigned int GATEWAY_PORT = 47311U;
+const unsigned int BRIDGE_PORT  = 47312U;
+
+const unsigned int LINK_SETUP_MS = 5000U;
+
+static unsigned char s_frames[BENCH_VECTORS][YSF_FRAME_LENGTH];
+
+// The bridge end, the sockets under test
+static CUDPSocket* s_ysf = NULL;
+static CUDPSocket* s_dmr = NULL;
+
+// The gateway and the master at the far end use plain sockets, so only the bridge is counted
+static int          s_peer = -1;
+static unsigned int s_peerPort = 0U;
+static in_addr      s_loopback;
+
+// Both ends of the link cases are CUDPSocket, the gateway standing in for a peer that supports the link
+static CUDPSocket* s_gateway = NULL;
+static CUDPSocket* s_bridge  = NULL;
+
+static unsigned long long getSystemCalls()
+{
+	return CUDPSocket::getSystemCalls();
+}
+
+static void openSockets(UDP_BACKEND backend)
+{
+	delete s_ysf;
+	delete s_dmr;
+
+	CUDPSocket::setBackend(backend);
+
+	s_ysf = new CUDPSocket("127.0.0.1", YSF_PORT);
+	s_dmr = new CUDPSocket("127.0.0.1", DMR_PORT);
+	s_ysf->open();
+	s_dmr->open();
+
+	if (s_peer < 0) {
+		s_peer = ::socket(PF_INET, SOCK_DGRAM, 0);
+
+		sockaddr_in addr;
+		::memset(&addr, 0x00, sizeof(sockaddr_in));
+		addr.sin_family      = AF_INET;
+		addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		::bind(s_peer, (sockaddr*)&addr, sizeof(sockaddr_in));
+
+		socklen_t size = sizeof(sockaddr_in);
+		::getsockname(s_peer, (sockaddr*)&addr, &size);
+		s_peerPort = ntohs(addr.sin_port);
+
+		s_loopback.s_addr = htonl(INADDR_LOOPBACK);
+	}
+
+	CBench::seed(0x0D9U);
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++) {
+		for (unsigned int j = 0U; j < YSF_FRAME_LENGTH; j++)
+			s_frames[i][j] = CBench::random() & 0xFFU;
+	}
+}
+
+static void setupSelect()
+{
+	openSockets(UDPB_SELECT);
+}
+
+static void setupRing()
+{
+	openSockets(UDPB_IO_URING);
+}
+
+static uint64_t runIdle(unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		unsigned char buffer[YSF_FRAME_LENGTH];
+		in_addr address;
+		unsigned int port;
+
+		CUDPSocket* socket = (i & 1U) == 0U ? s_ysf : s_dmr;
+		int len = socket->read(buffer, YSF_FRAME_LENGTH, address, port);
+
+		hash = CBench::digest(hash, uint32_t(len));
+	}
+	return hash;
+}
+
+static uint64_t runFrame(unsigned int ops)
+{
+	sockaddr_in ysf;
+	::memset(&ysf, 0x00, sizeof(sockaddr_in));
+	ysf.sin_family      = AF_INET;
+	ysf.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	ysf.sin_port        = htons(YSF_PORT);
+
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		const unsigned char* frame = s_frames[i & VECTOR_MASK];
+
+		// The gateway sends one YSF frame
+		::sendto(s_peer, frame, YSF_FRAME_LENGTH, 0, (sockaddr*)&ysf, sizeof(sockaddr_in));
+
+		// The bridge polls both its sockets every pass, one of them finds the frame
+		unsigned char buffer[YSF_FRAME_LENGTH];
+		int len = 0;
+		unsigned int polls = 0U;
+		for (unsigned int n = 0U; n < PASSES_PER_FRAME || (len == 0 && polls < MAX_POLLS); n++, polls++) {
+			in_addr address;
+			unsigned int port;
+
+			if (len == 0)
+				len = s_ysf->read(buffer, YSF_FRAME_LENGTH, address, port);
+			else
+				s_ysf->read(buffer, YSF_FRAME_LENGTH, address, port);
+
+			s_dmr->read(buffer + YSF_FRAME_LENGTH - DMR_FRAME_LENGTH, DMR_FRAME_LENGTH, address, port);
+		}
+
+		hash = CBench::digest(hash, uint32_t(len));
+		if (len <= 0)
+			continue;
+
+		hash = CBench::digest(hash, buffer, YSF_FRAME_LENGTH - DMR_FRAME_LENGTH);
+
+		// And sends what it made of it to the master
+		for (unsigned int n = 0U; n < DMR_PER_FRAME; n++)
+			s_dmr->write(buffer + n * DMR_FRAME_LENGTH, DMR_FRAME_LENGTH, s_loopback, s_peerPort);
+
+		for (unsigned int n = 0U; n < DMR_PER_FRAME; n++) {
+			unsigned char dmr[DMR_FRAME_LENGTH];
+			ssize_t ret = -1;
+			for (unsigned int m = 0U; ret < 0 && m < MAX_POLLS; m++)
+				ret = ::recv(s_peer, dmr, DMR_FRAME_LENGTH, MSG_DONTWAIT);
+
+			hash = CBench::digest(hash, uint32_t(ret));
+			if (ret > 0)
+				hash = CBench::digest(hash, dmr, (unsigned int)ret);
+		}
+	}
+	return hash;
+}
+
+static void openLink(bool shared)
+{
+	delete s_gateway;
+	delete s_bridge;
+
+	CUDPSocket::setBackend(UDPB_SELECT);
+	CUDPSocket::setSharedMemory(shared);
+
+	s_gateway = new CUDPSocket("127.0.0.1", GATEWAY_PORT);
+	s_bridge  = new CUDPSocket("127.0.0.1", BRIDGE_PORT);
+	s_gateway->open();
+	s_bridge->open();
+
+	CUDPSocket::setSharedMemory(false);
+
+	s_loopback.s_addr = htonl(INADDR_LOOPBACK);
+
+	CBench::seed(0x5D0U);
+	for (unsigned int i = 0U; i < BENCH_VECTORS; i++) {
+		for (unsigned int j = 0U; j < YSF_FRAME_LENGTH; j++)
+			s_frames[i][j] = CBench::random() & 0xFFU;
+	}
+
+	if (!shared)
+		return;
+
+	// The first datagrams tell each end where its peer is, the handshake follows within a second or two
+	const unsigned char poll[] = "YSFPBENCH";
+	s_bridge->write(poll, sizeof(poll), s_loopback, GATEWAY_PORT);
+	s_gateway->write(poll, sizeof(poll), s_loopback, BRIDGE_PORT);
+
+	struct timespec start;
+	::clock_gettime(CLOCK_MONOTONIC, &start);
+
+	for (;;) {
+		unsigned char buffer[YSF_FRAME_LENGTH];
+		in_addr address;
+		unsigned int port;
+		s_gateway->read(buffer, YSF_FRAME_LENGTH, address, port);
+		s_bridge->read(buffer, YSF_FRAME_LENGTH, address, port);
+
+		if (s_gateway->isLinked() && s_bridge->isLinked())
+			return;
+
+		struct timespec now;
+		::clock_gettime(CLOCK_MONOTONIC, &now);
+		if ((now.tv_sec - start.tv_sec) * 1000L + (now.tv_nsec - start.tv_nsec) / 1000000L > long(LINK_SETUP_MS)) {
+			::fprintf(stderr, "Bench: the shared memory link did not come up\n");
+			return;
+		}
+
+		::usleep(1000U);
+	}
+}
+
+static void setupLinkUDP()
+{
+	openLink(false);
+}
+
+static void setupLinkShared()
+{
+	openLink(true);
+}
+
+static int receive(CUDPSocket* socket, unsigned char* buffer, unsigned int length)
+{
+	int len = 0;
+	for (unsigned int n = 0U; len == 0 && n < MAX_POLLS; n++) {
+		in_addr address;
+		unsigned int port;
+		len = socket->read(buffer, length, address, port);
+	}
+
+	return len;
+}
+
+static uint64_t runLink(unsigned int ops)
+{
+	uint64_t hash = CBench::DIGEST_INIT;
+	for (unsigned int i = 0U; i < ops; i++) {
+		const unsigned char* frame = s_frames[i & VECTOR_MASK];
+
+		// A YSF frame from the gateway, and a DMR sized answer from the bridge
+		s_gateway->write(frame, YSF_FRAME_LENGTH, s_loopback, BRIDGE_PORT);
+
+		unsigned char buffer[YSF_FRAME_LENGTH];
+		int len = receive(s_bridge, buffer, YSF_FRAME_LENGTH);
+		hash = CBench::digest(hash, uint32_t(len));
+		if (len <= 0)
+			continue;
+		hash = CBench::digest(hash, buffer, (unsigned int)len);
+
+		s_bridge->write(buffer, DMR_FRAME_LENGTH, s_loopback, GATEWAY_PORT);
+
+		len = receive(s_gateway, buffer, YSF_FRAME_LENGTH);
+		hash = CBench::digest(hash, uint32_t(len));
+		if (len > 0)
+			hash = CBench::digest(hash, buffer, (unsigned int)len);
+	}
+	return hash;
+}
+
+// The io_uring cases come last, so that they can be left out
+static const CBenchCase UDP_CASES[] = {
+	{"CUDPSocket::read select",          "idle",  "loop pass", 2U, setupSelect, runIdle,  0x51D88627DF287325ULL, getSystemCalls},
+	{"CUDPSocket select",                "call",  "YSF frame", 1U, setupSelect, runFrame, 0xAC163D544C48E0C9ULL, getSystemCalls},
+	{"CUDPSocket::read io_uring",        "idle",  "loop pass", 2U, setupRing,   runIdle,  0x51D88627DF287325ULL, getSystemCalls},
+	{"CUDPSocket io_uring",              "call",  "YSF frame", 1U, setupRing,   runFrame, 0xAC163D544C48E0C9ULL, getSystemCalls}
+};
+
+const unsigned int UDP_SELECT_CASES = 2U;
+
+static const CBenchCase LINK_CASES[] = {
+	{"CUDPSocket UDP loopback",          "frame", "exchange",  1U, setupLinkUDP,    runLink, 0xC596479FEC5922D2ULL, getSystemCalls},
+	{"CUDPSocket shared memory",         "frame", "exchange",  1U, setupLinkShared, runLink, 0xC596479FEC5922D2ULL, getSystemCalls}
+};
+
+void addUDPBench(CBench& bench)
+{
+	unsigned int count = UDP_SELECT_CASES;
+
+	// Only when the library was built with IO_URING=1 and the kernel allows it
+	UDP_BACKEND backend = CUDPSocket::getBackend();
+	if (CUDPSocket::setBackend(UDPB_IO_URING)) {
+		CUDPSocket probe(0U);
+		probe.open();
+		probe.close();
+
+		if (CUDPSocket::getBackend() == UDPB_IO_URING)
+			count = sizeof(UDP_CASES) / sizeof(CBenchCase);
+	}
+	CUDPSocket::setBackend(backend);
+
+	bench.add("udp", UDP_CASES, count);
+
+#if defined(__linux__)
+	bench.add("link", LINK_CASES, sizeof(LINK_CASES) / sizeof(CBenchCase));
+#endif
+}
@@ -0,0 +1,78 @@
+/*
+ *   Copyright (C) 2010,2014,2016,2018 by Jonathan Naylor G4KLX
+ *   Copyright (C) 2016 Mathias Weyland, HB9FRV
+ *   Copyright (C) 2018 by Andy Uribe CA6JAU
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(AMBEConv_H)
+#define	AMBEConv_H
+
+// One interleaved DMR AMBE+2 vector and its 49 voice parameter bits, left aligned
+const unsigned int AMBE_VECTOR_LENGTH = 9U;
+const unsigned int AMBE_PARAMS_LENGTH = 7U;
+
+const unsigned int AMBE_PARAMS_BITS = 49U;
+
+// One System Fusion V/D mode 2 voice channel
+const unsigned int YSF_VCH_LENGTH = 13U;
+
+// Vectors carried by a DMR voice burst, an NXDN voice frame and a System Fusion V/D
+// mode 2 frame
+const unsigned int DMR_BURST_VECTORS  = 3U;
+const unsigned int NXDN_FRAME_VECTORS = 4U;
+const unsigned int YSF_FRAME_VECTORS  = 5U;
+
+// Converts AMBE+2 between the 72 bit DMR vectors, with the a and b words Golay coded
+// and b whitened, the System Fusion V/D mode 2 channels, and the bare 49 voice parameter
+// bits that NXDN networks carry.
+// The canonical form every conversion goes through is those 49 bits, a (12), b (12) and
+// c (25) left aligned in AMBE_PARAMS_LENGTH bytes, so any pair of modes converts with
+// one decode and one encode. The frame kernels convert a whole frame of vectors to and
+// from consecutive canonical vectors.
+// The a, b and c words are gathered and scattered with byte lookup tables instead of
+// bit by bit.
+class CAMBEConv {
+public:
+	// Optionally corrects the a and b words with their Golay codes
+	static void decode(const unsigned char* vch, unsigned char* params, bool correct);
+	static void encode(const unsigned char* params, unsigned char* vch);
+
+	// All three vectors of a DMR voice burst, the second one is split by the sync
+	static void decodeBurst(const unsigned char* burst, unsigned char* params, bool correct);
+	static void encodeBurst(const unsigned char* params, unsigned char* burst);
+	static void encodeBurst(const unsigned char* params1, const unsigned char* params2, const unsigned char* params3, unsigned char* burst);
+
+	// Moves the parameters to and from a bit offset in an NXDN voice frame
+	static void getNXDN(const unsigned char* nxdn, unsigned int offset, unsigned char* params);
+	static void putNXDN(const unsigned char* params, unsigned char* nxdn, unsigned int offset);
+
+	// Moves the parameters to and from one interleaved and whitened System Fusion V/D
+	// mode 2 channel, the tripled bits are read back from their middle copy
+	static void decodeYSF(const unsigned char* vch, unsigned char* params);
+	static void encodeYSF(const unsigned char* params, unsigned char* vch);
+
+	// The five channels of a V/D mode 2 frame, the payload starts after the sync and FICH
+	static void decodeYSFFrame(const unsigned char* payload, unsigned char* params);
+	static void encodeYSFFrame(const unsigned char* params, unsigned char* payload);
+
+	// The four vectors of an NXDN voice frame, the voice starts after the LICH and SACCH
+	static void decodeNXDNFrame(const unsigned char* voice, unsigned char* params);
+	static void encodeNXDNFrame(const unsigned char* params, unsigned char* voice);
+};
+
+#endif
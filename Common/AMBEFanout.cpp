@@ -0,0 +1,218 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "AMBEFanout.h"
+#include "NXDNCallTemplate.h"
+#include "YSFDefines.h"
+#include "Defines.h"
+#include "Log.h"
+
+#include <cstdio>
+#include <cassert>
+#include <cstring>
+
+// The DMR, NXDN and System Fusion silence frames all carry these parameters
+const unsigned char AMBE_SILENCE[] = {0xF8U, 0x01U, 0xA9U, 0x9FU, 0x8CU, 0xE0U, 0x80U};
+
+CAMBEFanout::CAMBEFanout(unsigned int length, const char* name) :
+m_length(length),
+m_name(name),
+m_records(NULL),
+m_write(0U),
+m_taps()
+{
+	assert(length > 0U);
+	assert(name != NULL);
+
+	m_records = new CAMBERecord[length];
+
+	::memset(m_records, 0x00U, m_length * sizeof(CAMBERecord));
+}
+
+CAMBEFanout::~CAMBEFanout()
+{
+	delete[] m_records;
+}
+
+unsigned int CAMBEFanout::addTap(AMBE_TAP_MODE mode)
+{
+	CAMBETap tap;
+	tap.m_mode   = mode;
+	tap.m_read   = m_write;
+	tap.m_count  = 0U;
+	tap.m_padded = false;
+
+	switch (mode) {
+	case ATM_DMR:
+		tap.m_vectors = DMR_BURST_VECTORS;
+		break;
+	case ATM_NXDN:
+		tap.m_vectors = NXDN_FRAME_VECTORS;
+		break;
+	default:
+		tap.m_vectors = YSF_FRAME_VECTORS;
+		break;
+	}
+
+	m_taps.push_back(tap);
+
+	return m_taps.size() - 1U;
+}
+
+void CAMBEFanout::putHeader()
+{
+	put(TAG_HEADER, NULL);
+}
+
+void CAMBEFanout::putData(const unsigned char* params)
+{
+	assert(params != NULL);
+
+	put(TAG_DATA, params);
+}
+
+void CAMBEFanout::putSilence()
+{
+	put(TAG_DATA, AMBE_SILENCE);
+}
+
+void CAMBEFanout::putEOT()
+{
+	put(TAG_EOT, NULL);
+}
+
+void CAMBEFanout::put(unsigned char tag, const unsigned char* params)
+{
+	// A tap that has fallen a whole ring behind loses its backlog, the others carry on
+	for (unsigned int i = 0U; i < m_taps.size(); i++) {
+		CAMBETap& tap = m_taps.at(i);
+		if (tap.m_count >= m_length) {
+			LogError("%s tap %u overflow, clearing the tap", m_name, i);
+			tap.m_read   = m_write;
+			tap.m_count  = 0U;
+			tap.m_padded = false;
+		}
+	}
+
+	CAMBERecord& record = m_records[m_write];
+	record.m_tag = tag;
+	if (params != NULL)
+		::memcpy(record.m_params, params, AMBE_PARAMS_LENGTH);
+
+	m_write++;
+	if (m_write >= m_length)
+		m_write = 0U;
+
+	for (unsigned int i = 0U; i < m_taps.size(); i++)
+		m_taps.at(i).m_count++;
+}
+
+unsigned int CAMBEFanout::get(unsigned int tap, unsigned char* data)
+{
+	assert(data != NULL);
+
+	CAMBETap& t = m_taps.at(tap);
+
+	// The records are encoded where they are, only pointers to them are gathered
+	const unsigned char* params[YSF_FRAME_VECTORS];
+
+	unsigned int n = 0U;
+	unsigned int pos = t.m_read;
+	while (n < t.m_vectors && n < t.m_count) {
+		const CAMBERecord& record = m_records[pos];
+		if (record.m_tag != TAG_DATA)
+			break;
+
+		params[n++] = record.m_params;
+
+		pos++;
+		if (pos >= m_length)
+			pos = 0U;
+	}
+
+	// Still waiting for the rest of the frame
+	if (n == t.m_count && n < t.m_vectors)
+		return TAG_NODATA;
+
+	unsigned char tag = m_records[pos].m_tag;
+
+	if (n == 0U) {
+		// The last frame of a call is padded with silence, a whole frame of it when
+		// the voice ended on a frame boundary, as the single mode bridges did
+		if (tag == TAG_EOT && !t.m_padded) {
+			for (unsigned int i = 0U; i < t.m_vectors; i++)
+				params[i] = AMBE_SILENCE;
+
+			encode(t, params, data);
+			t.m_padded = true;
+
+			return TAG_DATA;
+		}
+
+		t.m_read = pos + 1U;
+		if (t.m_read >= m_length)
+			t.m_read = 0U;
+		t.m_count -= 1U;
+		t.m_padded = false;
+
+		if (t.m_mode == ATM_YSF)
+			::memset(data + YSF_SYNC_LENGTH_BYTES + YSF_FICH_LENGTH_BYTES, 0x00U, YSF_VCH_LENGTH);
+		else if (t.m_mode == ATM_DMR)
+			::memset(data, 0x00U, AMBE_VECTOR_LENGTH);
+		else
+			::memset(data, 0x00U, AMBE_PARAMS_LENGTH);
+
+		return tag;
+	}
+
+	// A frame cut short by a header or the end of the call
+	for (unsigned int i = n; i < t.m_vectors; i++)
+		params[i] = AMBE_SILENCE;
+
+	encode(t, params, data);
+
+	t.m_read   = pos;
+	t.m_count -= n;
+	t.m_padded = n < t.m_vectors && tag == TAG_EOT;
+
+	return TAG_DATA;
+}
+
+void CAMBEFanout::encode(const CAMBETap& tap, const unsigned char* const* params, unsigned char* data) const
+{
+	switch (tap.m_mode) {
+	case ATM_DMR:
+		CAMBEConv::encodeBurst(params[0U], params[1U], params[2U], data);
+		break;
+
+	case ATM_NXDN:
+		data += NXDN_PREFIX_LENGTH;
+		::memset(data, 0x00U, NXDN_CALL_FRAME_LENGTH - NXDN_PREFIX_LENGTH);
+		CAMBEConv::putNXDN(params[0U], data, 0U);
+		CAMBEConv::putNXDN(params[1U], data, 49U);
+		CAMBEConv::putNXDN(params[2U], data, 112U);
+		CAMBEConv::putNXDN(params[3U], data, 161U);
+		break;
+
+	default:
+		data += YSF_SYNC_LENGTH_BYTES + YSF_FICH_LENGTH_BYTES + 5U;
+		for (unsigned int i = 0U; i < YSF_FRAME_VECTORS; i++, data += 18U)
+			CAMBEConv::encodeYSF(params[i], data);
+		break;
+	}
+}
@@ -0,0 +1,79 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(AMBEFanout_H)
+#define	AMBEFanout_H
+
+#include "AMBEConv.h"
+
+#include <vector>
+
+enum AMBE_TAP_MODE {
+	ATM_DMR,
+	ATM_NXDN,
+	ATM_YSF
+};
+
+// Carries one inbound voice stream to several destination modes. The source vocoder
+// frames are decoded once into the AMBE+2 voice parameters and written to a single
+// ring, and every destination reads the same records through its own tap and encodes
+// them straight into its outgoing frame. Adding a destination costs one encode per
+// vector instead of another decode and another copy of the stream.
+class CAMBEFanout {
+public:
+	CAMBEFanout(unsigned int length, const char* name);
+	~CAMBEFanout();
+
+	// Returns the tap number to pass to get()
+	unsigned int addTap(AMBE_TAP_MODE mode);
+
+	void putHeader();
+	void putData(const unsigned char* params);
+	void putSilence();
+	void putEOT();
+
+	// Returns TAG_HEADER, TAG_EOT, TAG_NODATA or TAG_DATA with a full DMR voice burst,
+	// the four vectors of an NXDN voice frame after the LICH and SACCH, or the five
+	// channels of a System Fusion V/D mode 2 frame after the sync and FICH
+	unsigned int get(unsigned int tap, unsigned char* data);
+
+private:
+	struct CAMBERecord {
+		unsigned char m_tag;
+		unsigned char m_params[AMBE_PARAMS_LENGTH];
+	};
+
+	struct CAMBETap {
+		AMBE_TAP_MODE m_mode;
+		unsigned int  m_vectors;
+		unsigned int  m_read;
+		unsigned int  m_count;
+		bool          m_padded;
+	};
+
+	unsigned int          m_length;
+	const char*           m_name;
+	CAMBERecord*          m_records;
+	unsigned int          m_write;
+	std::vector<CAMBETap> m_taps;
+
+	void put(unsigned char tag, const unsigned char* params);
+	void encode(const CAMBETap& tap, const unsigned char* const* params, unsigned char* data) const;
+};
+
+#endif
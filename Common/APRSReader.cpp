@@ -19,6 +19,7 @@
 */
 
 #include "APRSReader.h"
+#include "JSONFields.h"
 #include "Timer.h"
 #include "Log.h"
 
@@ -26,6 +27,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <cctype>
+#include <algorithm>
 #include <time.h>
 
 #if defined(_WIN32) || defined(_WIN64)
@@ -50,18 +52,23 @@ int gettimeofday(struct timeval * tp, struct timezone * tzp)
 #include <sys/time.h>
 #endif
 
-const unsigned int APRS_TIMEOUT = 10U;
+// Callsigns asked for in one go on the connection
+const unsigned int APRS_PIPELINE = 8U;
+
+// How often the lookup thread looks for new callsigns, in ms
+const unsigned int APRS_POLL = 100U;
 
 CAPRSReader::CAPRSReader(std::string ApiKey,int refres_time) :
 CThread(),
 m_ApiKey(ApiKey),
-m_cs(),
 m_stop(false),
-m_new_callsign(false),
 m_refres_time(refres_time),
 m_lat_table(),
 m_lon_table(),
-m_time_table()
+m_time_table(),
+m_pending(),
+m_http("api.aprs.fi", 80U, "YSF2DMR/0.12"),
+m_mutex()
 {
 	m_lat_table.clear();
 	m_lon_table.clear();
@@ -79,21 +86,28 @@ void CAPRSReader::entry()
 	LogMessage("Started the APRS Reader lookup thread");
 
 	while (!m_stop) {
-		
-		while(!m_new_callsign)
-			sleep(1000U);
-		
-		load_call();
-		
-		m_new_callsign = false;
+		m_mutex.lock();
+		bool pending = !m_pending.empty();
+		m_mutex.unlock();
+
+		if (pending)
+			load_call();
+		else
+			sleep(APRS_POLL);
 	}
 
+	m_http.close();
+
+	LogMessage("APRS Reader: %u requests on %u connections", m_http.getRequests(), m_http.getConnections());
+
 	LogMessage("Stopped the APRS Reader lookup thread");
 }
 
 void CAPRSReader::stop()
 {
 	m_stop = true;
+
+	wait();
 }
 
 void CAPRSReader::formatGPS(unsigned char *buffer, int latitude, int longitude)
@@ -173,82 +187,99 @@ void CAPRSReader::formatGPS(unsigned char *buffer, int latitude, int longitude)
 	*(buffer + 19U) = crc;
 }
 
-bool CAPRSReader::load_call() 
+bool CAPRSReader::load_call()
 {
-	struct timeval timeinfo;
-	unsigned long epoch;
-
-	int longitude = 0;
-	int latitude = 0;
-	
-	unsigned char buffer[10000];
-	int nDataLength;
-	std::string website_HTML;
-
-	// get information
-	// LogMessage("Searching %s", callsign.c_str());
-	// website url
-	std::string url = "/api/get?name=" + m_cs + "-Y," + m_cs + "-7," + m_cs + "-8," + m_cs + "-9,";
-	url = url + m_cs + "-14," + m_cs + "&what=loc&apikey=" + m_ApiKey + "&format=json";
-	//HTTP GET
-	std::string get_http = "GET " + url + " HTTP/1.1\r\nHost: api.aprs.fi\r\nUser-Agent: YSF2DMR/0.12\r\n\r\n";		
-	CTCPSocket sockfd("api.aprs.fi", 80);
-
-	bool ret = sockfd.open();
-	if (!ret){
-		LogMessage("Could not connect to api.aprs.fi");
-		return false;
+	static const char* const FIELDS[] = {"lat", "lng"};
+
+	m_mutex.lock();
+	std::vector<std::string> calls(m_pending.begin(), m_pending.begin() + (m_pending.size() < APRS_PIPELINE ? m_pending.size() : APRS_PIPELINE));
+	m_mutex.unlock();
+
+	// All the requests go out before the first response is read
+	unsigned int sent = 0U;
+	for (; sent < calls.size(); sent++) {
+		const std::string& cs = calls.at(sent);
+
+		std::string url = "/api/get?name=" + cs + "-Y," + cs + "-7," + cs + "-8," + cs + "-9,";
+		url = url + cs + "-14," + cs + "&what=loc&apikey=" + m_ApiKey + "&format=json";
+
+		if (!m_http.get(url))
+			break;
 	}
 
-	// send GET / HTTP
-	sockfd.write((const unsigned char*)get_http.c_str(), strlen(get_http.c_str()));
-
-	// recieve html
-	while ((nDataLength = sockfd.read(buffer, 10000, APRS_TIMEOUT)) > 0){
-		int i = 0;
-		char tmp_str[20];
-		for (i = 0; i < nDataLength; i++) {
-			if (i > 5 && buffer[i - 4] == '\"' && buffer[i - 3] == 'l' && buffer[i - 2] == 'a' && buffer[i - 1] == 't' && buffer[i] == '\"'){
-				::memcpy(tmp_str, buffer + i + 3, 8U);
-				tmp_str[8] = 0;
-				//LogMessage("Latitude: %s", tmp_str);
-				latitude = (int)(atof(tmp_str) * 1000);
-				m_lat_table[m_cs] = latitude;
-			}
-			if (i > 5 && buffer[i - 4] == '\"' && buffer[i - 3] == 'l' && buffer[i - 2] == 'n' && buffer[i - 1] == 'g' && buffer[i] == '\"'){
-				::memcpy(tmp_str,buffer + i + 3, 8U);
-				tmp_str[8] = 0;
-				//LogMessage("Longitude: %s", tmp_str);
-				longitude = (int)(atof(tmp_str) * 1000);
-				m_lon_table[m_cs] = longitude;
-			}
-			
-			if ((latitude != 0) && (longitude != 0))
-				break;
-		}
-		if ((latitude != 0) && (longitude != 0))
+	if (sent == 0U)
+		LogMessage("Could not connect to api.aprs.fi");
+
+	bool found = false;
+
+	CJSONFields fields(FIELDS, 2U);
+	for (unsigned int i = 0U; i < sent; i++) {
+		fields.reset();
+
+		if (m_http.read(fields) < 0) {
+			LogMessage("No reply from api.aprs.fi");
 			break;
+		}
+
+		int latitude  = fields.has(0U) ? (int)(::atof(fields.get(0U).c_str()) * 1000) : 0;
+		int longitude = fields.has(1U) ? (int)(::atof(fields.get(1U).c_str()) * 1000) : 0;
+
+		if (store(calls.at(i), latitude, longitude))
+			found = true;
 	}
 
-	sockfd.close();
+	// Whatever failed is asked for again the next time the callsign is seen
+	m_mutex.lock();
+	for (std::vector<std::string>::const_iterator it = calls.begin(); it != calls.end(); ++it) {
+		std::vector<std::string>::iterator p = std::find(m_pending.begin(), m_pending.end(), *it);
+		if (p != m_pending.end())
+			m_pending.erase(p);
+	}
+	m_mutex.unlock();
 
+	return found;
+}
+
+bool CAPRSReader::store(const std::string& cs, int latitude, int longitude)
+{
+	struct timeval timeinfo;
 	gettimeofday(&timeinfo, 0);
-	epoch = timeinfo.tv_sec;
-	m_time_table[m_cs] = epoch;
+	unsigned long epoch = timeinfo.tv_sec;
 
 	if (latitude == 0 || longitude == 0) {
-		m_lat_table[m_cs] = 0;
-		m_lon_table[m_cs] = 0;
-		LogMessage("GPS Position of %s not found", m_cs.c_str());
+		latitude  = 0;
+		longitude = 0;
+	}
+
+	m_mutex.lock();
+
+	m_time_table[cs] = epoch;
+	m_lat_table[cs]  = latitude;
+	m_lon_table[cs]  = longitude;
+
+	m_mutex.unlock();
+
+	if (latitude == 0 || longitude == 0) {
+		LogMessage("GPS Position of %s not found", cs.c_str());
 		return false;
 	}
 	else {
-		LogMessage("GPS Position of %s Lat: %0.3f, Lon: %0.3f", m_cs.c_str(), (float)latitude / 1000.0, (float)longitude / 1000.0);
+		LogMessage("GPS Position of %s Lat: %0.3f, Lon: %0.3f", cs.c_str(), (float)latitude / 1000.0, (float)longitude / 1000.0);
 		return true;
 	}
 }
 
 bool CAPRSReader::findCall(std::string cs, int *latitude, int *longitude)
+{
+	// The bridge sessions may ask from several threads
+	m_mutex.lock();
+	bool ret = lookup(cs, latitude, longitude);
+	m_mutex.unlock();
+
+	return ret;
+}
+
+bool CAPRSReader::lookup(const std::string& cs, int *latitude, int *longitude)
 {
 	bool not_found = false;
 	struct timeval timeinfo;
@@ -266,18 +297,8 @@ bool CAPRSReader::findCall(std::string cs, int *latitude, int *longitude)
 		not_found = true;
 	}
 
-	if (m_new_callsign) {
-		if (not_found)
-			return false;
-		else if ((*latitude != 0) && (*longitude != 0))
-			return true;
-		else
-			return false;
-	} 
-
 	if (not_found) {
-		m_new_callsign = true;
-		m_cs = cs;
+		request(cs);
 		return false;
 	}
 	else {
@@ -287,8 +308,7 @@ bool CAPRSReader::findCall(std::string cs, int *latitude, int *longitude)
 
 		if (epoch > (tempo + m_refres_time)) {
 			//LogMessage("Location expired");
-			m_new_callsign = true;
-			m_cs = cs;
+			request(cs);
 		}
 
 		if ((*latitude != 0) && (*longitude != 0))
@@ -297,3 +317,10 @@ bool CAPRSReader::findCall(std::string cs, int *latitude, int *longitude)
 			return false;
 	}
 }
+
+void CAPRSReader::request(const std::string& cs)
+{
+	// Called with the mutex held
+	if (std::find(m_pending.begin(), m_pending.end(), cs) == m_pending.end())
+		m_pending.push_back(cs);
+}
@@ -20,12 +20,13 @@
 #ifndef	APRSReader_H
 #define	APRSReader_H
 
-#include "TCPSocket.h"
+#include "HTTPClient.h"
 #include "Thread.h"
 #include "Mutex.h"
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 class CAPRSReader : public CThread  {
 public:
@@ -41,13 +42,18 @@ public:
 
 private:
 	std::string m_ApiKey;
-	std::string m_cs;
 	bool m_stop;
-	bool m_new_callsign;
 	unsigned int  m_refres_time;
 	std::unordered_map<std::string, int> m_lat_table;
 	std::unordered_map<std::string, int> m_lon_table;
 	std::unordered_map<std::string, unsigned int> m_time_table;
+	std::vector<std::string> m_pending;
+	CHTTPClient m_http;
+	CMutex m_mutex;
+
+	bool lookup(const std::string& cs, int *latitude, int *longitude);
+	void request(const std::string& cs);
+	bool store(const std::string& cs, int latitude, int longitude);
 };
 
 #endif
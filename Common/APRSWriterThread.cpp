@@ -26,25 +26,46 @@
 #include <cctype>
 #include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <cassert>
 
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
 // #define	DUMP_TX
 
 const unsigned int CALLSIGN_LENGTH = 8U;
 
 const unsigned int APRS_TIMEOUT = 10U;
 
+// Reconnect attempts start this far apart and back off up to the maximum, in ms
+const unsigned int APRS_MIN_BACKOFF = 5000U;
+const unsigned int APRS_MAX_BACKOFF = 300000U;
+
+// How long the thread sleeps on the socket, a queued frame wakes it up earlier. Without an
+// event descriptor the queue is polled instead.
+const unsigned int APRS_WAIT = 10000U;
+const unsigned int APRS_POLL = 100U;
+
 CAPRSWriterThread::CAPRSWriterThread(const std::string& callsign, const std::string& password, const std::string& address, unsigned int port) :
 CThread(),
 m_username(callsign),
 m_password(password),
 m_socket(address, port),
 m_queue(20U, "APRS Queue"),
+m_mutex(),
+m_event(-1),
+m_clock(),
 m_exit(false),
 m_connected(false),
 m_APRSReadCallback(NULL),
 m_filter(),
-m_clientName("YSF2DMR")
+m_clientName("YSF2DMR"),
+m_sent(0U),
+m_latency(0ULL),
+m_maxLatency(0U)
 {
 	assert(!callsign.empty());
 	assert(!password.empty());
@@ -62,11 +83,17 @@ m_username(callsign),
 m_password(password),
 m_socket(address, port),
 m_queue(20U, "APRS Queue"),
+m_mutex(),
+m_event(-1),
+m_clock(),
 m_exit(false),
 m_connected(false),
 m_APRSReadCallback(NULL),
 m_filter(filter),
-m_clientName(clientName)
+m_clientName(clientName),
+m_sent(0U),
+m_latency(0ULL),
+m_maxLatency(0U)
 {
 	assert(!callsign.empty());
 	assert(!password.empty());
@@ -81,10 +108,21 @@ m_clientName(clientName)
 CAPRSWriterThread::~CAPRSWriterThread()
 {
 	m_username.clear();
+
+#if !defined(_WIN32) && !defined(_WIN64)
+	if (m_event >= 0)
+		::close(m_event);
+#endif
 }
 
 bool CAPRSWriterThread::start()
 {
+#if !defined(_WIN32) && !defined(_WIN64)
+	m_event = ::eventfd(0U, EFD_NONBLOCK | EFD_CLOEXEC);
+	if (m_event < 0)
+		LogWarning("Cannot create the APRS queue event, polling the queue instead");
+#endif
+
 	run();
 
 	return true;
@@ -94,66 +132,78 @@ void CAPRSWriterThread::entry()
 {
 	LogMessage("Starting the APRS Writer thread");
 
-	m_connected = connect();
+	unsigned int backoff = APRS_MIN_BACKOFF;
 
 	try {
 		while (!m_exit) {
 			if (!m_connected) {
 				m_connected = connect();
 
-				if (!m_connected){
-					LogError("Reconnect attempt to the APRS server has failed");
-					sleep(10000UL);		// 10 secs
+				if (!m_connected) {
+					LogError("Reconnect attempt to the APRS server has failed, next attempt in %u seconds", backoff / 1000U);
+					pause(backoff);
+
+					backoff *= 2U;
+					if (backoff > APRS_MAX_BACKOFF)
+						backoff = APRS_MAX_BACKOFF;
+
+					continue;
 				}
+
+				backoff = APRS_MIN_BACKOFF;
 			}
 
-			if (m_connected) {
-				if (!m_queue.isEmpty()){
-					char* p = NULL;
-					m_queue.getData(&p, 1U);
+			// Our own reports go out before anything the server has sent is looked at
+			if (!writeQueue()) {
+				m_connected = false;
+				m_socket.close();
+				LogError("Connection to the APRS thread has failed");
+				continue;
+			}
 
-					LogMessage("APRS ==> %s", p);
+			if (!m_socket.hasLine()) {
+				int ret = m_socket.wait(m_event >= 0 ? APRS_WAIT : APRS_POLL, m_event);
+				clearEvent();
 
-					::strcat(p, "\r\n");
+				if (ret < 0) {
+					m_connected = false;
+					m_socket.close();
+					LogError("Error when reading from the APRS server");
+					continue;
+				}
 
-					bool ret = m_socket.write((unsigned char*)p, ::strlen(p));
-					if (!ret) {
-						m_connected = false;
-						m_socket.close();
-						LogError("Connection to the APRS thread has failed");
-					}
+				if (ret == 0)
+					continue;
+			}
 
-					delete[] p;
-				}
-				{
-					std::string line;
-					int length = m_socket.readLine(line, APRS_TIMEOUT);
-
-					if (length < 0) {
-						m_connected = false;
-						m_socket.close();
-						LogError("Error when reading from the APRS server");
-					}
-
-					if(length > 0 && line.at(0U) != '#'//check if we have something and if that something is an APRS frame
-					    && m_APRSReadCallback != NULL)//do we have someone wanting an APRS Frame?
-					{	
-						//wxLogMessage(wxT("Received APRS Frame : ") + line);
-						m_APRSReadCallback(std::string(line));
-					}
-				}
+			std::string line;
+			int length = m_socket.readLine(line, 0U);
+
+			if (length < 0) {
+				m_connected = false;
+				m_socket.close();
+				LogError("Error when reading from the APRS server");
+			}
 
+			if(length > 0 && line.at(0U) != '#'//check if we have something and if that something is an APRS frame
+			    && m_APRSReadCallback != NULL)//do we have someone wanting an APRS Frame?
+			{
+				m_APRSReadCallback(std::string(line));
 			}
 		}
 
 		if (m_connected)
 			m_socket.close();
 
+		m_mutex.lock();
+
 		while (!m_queue.isEmpty()) {
-			char* p = NULL;
-			m_queue.getData(&p, 1U);
-			delete[] p;
+			CAPRSFrame frame = {NULL, 0ULL};
+			m_queue.getData(&frame, 1U);
+			delete[] frame.m_data;
 		}
+
+		m_mutex.unlock();
 	}
 	catch (std::exception& e) {
 		LogError("Exception raised in the APRS Writer thread - \"%s\"", e.what());
@@ -165,6 +215,69 @@ void CAPRSWriterThread::entry()
 	LogMessage("Stopping the APRS Writer thread");
 }
 
+bool CAPRSWriterThread::writeQueue()
+{
+	for (;;) {
+		CAPRSFrame frame = {NULL, 0ULL};
+
+		m_mutex.lock();
+		bool found = m_queue.hasData();
+		if (found)
+			m_queue.getData(&frame, 1U);
+		m_mutex.unlock();
+
+		if (!found)
+			return true;
+
+		LogMessage("APRS ==> %s", frame.m_data);
+
+		::strcat(frame.m_data, "\r\n");
+
+		bool ret = m_socket.write((unsigned char*)frame.m_data, ::strlen(frame.m_data));
+
+		delete[] frame.m_data;
+
+		if (!ret)
+			return false;
+
+		unsigned int latency = (unsigned int)(m_clock.time() - frame.m_queued);
+
+		m_sent++;
+		m_latency += latency;
+		if (latency > m_maxLatency)
+			m_maxLatency = latency;
+	}
+}
+
+void CAPRSWriterThread::signal()
+{
+#if !defined(_WIN32) && !defined(_WIN64)
+	if (m_event >= 0) {
+		uint64_t one = 1ULL;
+		ssize_t ret = ::write(m_event, &one, sizeof(uint64_t));
+		(void)ret;
+	}
+#endif
+}
+
+void CAPRSWriterThread::clearEvent()
+{
+#if !defined(_WIN32) && !defined(_WIN64)
+	if (m_event >= 0) {
+		uint64_t count;
+		ssize_t ret = ::read(m_event, &count, sizeof(uint64_t));
+		(void)ret;
+	}
+#endif
+}
+
+void CAPRSWriterThread::pause(unsigned int ms)
+{
+	// Short steps, so that a stop does not wait for the whole back off
+	for (unsigned int i = 0U; i < ms && !m_exit; i += APRS_POLL)
+		sleep(APRS_POLL);
+}
+
 void CAPRSWriterThread::setReadAPRSCallback(ReadAPRSFrameCallback cb)
 {
 	m_APRSReadCallback = cb;
@@ -179,10 +292,21 @@ void CAPRSWriterThread::write(const char* data)
 
 	unsigned int len = ::strlen(data);
 
-	char* p = new char[len + 5U];
-	::strcpy(p, data);
+	CAPRSFrame frame;
+	frame.m_data = new char[len + 5U];
+	frame.m_queued = m_clock.time();
+	::strcpy(frame.m_data, data);
+
+	m_mutex.lock();
+	bool ret = m_queue.addData(&frame, 1U);
+	m_mutex.unlock();
 
-	m_queue.addData(&p, 1U);
+	if (!ret) {
+		delete[] frame.m_data;
+		return;
+	}
+
+	signal();
 }
 
 bool CAPRSWriterThread::isConnected() const
@@ -194,7 +318,12 @@ void CAPRSWriterThread::stop()
 {
 	m_exit = true;
 
+	signal();
+
 	wait();
+
+	LogMessage("APRS: %llu bytes in, %llu bytes out, %u frames sent, queue latency %u ms average %u ms maximum", m_socket.getBytesIn(), m_socket.getBytesOut(),
+		m_sent, m_sent > 0U ? (unsigned int)(m_latency / m_sent) : 0U, m_maxLatency);
 }
 
 bool CAPRSWriterThread::connect()
@@ -21,12 +21,20 @@
 
 #include "TCPSocket.h"
 #include "RingBuffer.h"
+#include "StopWatch.h"
 #include "Thread.h"
+#include "Mutex.h"
 
 #include <string>
 
 typedef void (*ReadAPRSFrameCallback)(const std::string&);
 
+// A frame waiting to be sent and when it was queued
+struct CAPRSFrame {
+	char*              m_data;
+	unsigned long long m_queued;
+};
+
 class CAPRSWriterThread : public CThread {
 public:
 	CAPRSWriterThread(const std::string& callsign, const std::string& password, const std::string& address, unsigned int port);
@@ -46,17 +54,27 @@ public:
 	void setReadAPRSCallback(ReadAPRSFrameCallback cb);
 
 private:
-	std::string            m_username;
-	std::string            m_password;
-	CTCPSocket             m_socket;
-	CRingBuffer<char*>     m_queue;
-	bool                   m_exit;
-	bool                   m_connected;
-	ReadAPRSFrameCallback  m_APRSReadCallback;
-	std::string            m_filter;
-	std::string            m_clientName;
+	std::string             m_username;
+	std::string             m_password;
+	CTCPSocket              m_socket;
+	CRingBuffer<CAPRSFrame> m_queue;
+	CMutex                  m_mutex;
+	int                     m_event;
+	CStopWatch              m_clock;
+	bool                    m_exit;
+	bool                    m_connected;
+	ReadAPRSFrameCallback   m_APRSReadCallback;
+	std::string             m_filter;
+	std::string             m_clientName;
+	unsigned int            m_sent;
+	unsigned long long      m_latency;
+	unsigned int            m_maxLatency;
 
 	bool connect();
+	bool writeQueue();
+	void signal();
+	void clearEvent();
+	void pause(unsigned int ms);
 };
 
 #endif
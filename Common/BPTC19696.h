@@ -30,15 +30,15 @@ public:
 	void encode(const unsigned char* in, unsigned char* out);
 
 private:
-	bool* m_rawData;
-	bool* m_deInterData;
+	bool m_rawData[196];
+	bool m_deInterData[196];
 
 	void decodeExtractBinary(const unsigned char* in);
 	void decodeErrorCheck();
 	void decodeDeInterleave();
 	void decodeExtractData(unsigned char* data) const;
 
-	void encodeExtractData(const unsigned char* in) const;
+	void encodeExtractData(const unsigned char* in);
 	void encodeInterleave();
 	void encodeErrorCheck();
 	void encodeExtractBinary(unsigned char* data);
@@ -0,0 +1,130 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "CPUDispatch.h"
+#include "ViterbiACS.h"
+#include "Log.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__arm__) && defined(__linux__)
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+
+CPU_KERNELS CCPUDispatch::s_kernels = CPUK_SCALAR;
+
+void CCPUDispatch::init(const std::string& kernels)
+{
+	std::string name = kernels;
+
+	// The environment overrides the ini file, handy for comparing the kernels on one host
+	const char* env = ::getenv("MMDVM_CM_KERNELS");
+	if (env != NULL && *env != '\0')
+		name = env;
+
+	CPU_KERNELS best = detect();
+
+	if (name == "scalar") {
+		select(CPUK_SCALAR);
+		LogInfo("CPU kernels: %s (forced, %s available)", getName(CPUK_SCALAR), getName(best));
+		return;
+	}
+
+	if (!name.empty() && name != "auto")
+		LogWarning("Unknown CPU kernels \"%s\", using auto", name.c_str());
+
+	select(best);
+	LogInfo("CPU kernels: %s", getName(best));
+}
+
+bool CCPUDispatch::select(CPU_KERNELS kernels)
+{
+	if (!isSupported(kernels))
+		return false;
+
+	CViterbiACS::select(kernels);
+
+	s_kernels = kernels;
+
+	return true;
+}
+
+bool CCPUDispatch::isSupported(CPU_KERNELS kernels)
+{
+	switch (kernels) {
+	case CPUK_SCALAR:
+		return true;
+#if defined(VITERBI_ACS_X86)
+	case CPUK_SSE41:
+		return __builtin_cpu_supports("sse4.1") != 0;
+	case CPUK_AVX2:
+		return __builtin_cpu_supports("avx2") != 0;
+#endif
+#if defined(VITERBI_ACS_NEON)
+	case CPUK_NEON:
+#if defined(__aarch64__)
+		// Advanced SIMD is mandatory on ARMv8
+		return true;
+#elif defined(__linux__)
+		return (::getauxval(AT_HWCAP) & HWCAP_NEON) != 0UL;
+#elif defined(__ARM_NEON)
+		return true;
+#else
+		return false;
+#endif
+#endif
+	default:
+		return false;
+	}
+}
+
+CPU_KERNELS CCPUDispatch::getKernels()
+{
+	return s_kernels;
+}
+
+const char* CCPUDispatch::getName(CPU_KERNELS kernels)
+{
+	switch (kernels) {
+	case CPUK_SSE41:
+		return "sse4.1";
+	case CPUK_AVX2:
+		return "avx2";
+	case CPUK_NEON:
+		return "neon";
+	default:
+		return "scalar";
+	}
+}
+
+CPU_KERNELS CCPUDispatch::detect()
+{
+	if (isSupported(CPUK_AVX2))
+		return CPUK_AVX2;
+
+	if (isSupported(CPUK_SSE41))
+		return CPUK_SSE41;
+
+	if (isSupported(CPUK_NEON))
+		return CPUK_NEON;
+
+	return CPUK_SCALAR;
+}
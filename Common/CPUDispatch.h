@@ -1,7 +1,5 @@
 /*
- *   Copyright (C) 2012,2013,2017 by Jonathan Naylor G4KLX
- *   Copyright (C) 2018 by Manuel Sanchez EA7EE
- *   Copyright (C) 2018 by Andy Uribe CA6JAU
+ *   Copyright (C) 2026 by agent
  *
  *   This program is free software; you can redistribute it and/or modify
  *   it under the terms of the GNU General Public License as published by
@@ -18,34 +16,35 @@
  *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
  */
 
-#ifndef DTMF_H
-#define	DTMF_H
-
-#include "WiresX.h"
+#if !defined(CPUDispatch_H)
+#define	CPUDispatch_H
 
 #include <string>
 
-class CDTMF {
+enum CPU_KERNELS {
+	CPUK_SCALAR,
+	CPUK_SSE41,
+	CPUK_AVX2,
+	CPUK_NEON
+};
+
+class CCPUDispatch {
 public:
-	CDTMF();
-	~CDTMF();
+	// Selects the best kernels this CPU supports. "scalar" in the ini file or in the
+	// MMDVM_CM_KERNELS environment variable forces the portable code.
+	static void init(const std::string& kernels);
 
-	WX_STATUS decodeVDMode2(const unsigned char* payload, bool end);
+	static bool select(CPU_KERNELS kernels);
+	static bool isSupported(CPU_KERNELS kernels);
 
-	unsigned int getDstID();
+	// The best kernels this CPU supports
+	static CPU_KERNELS detect();
 
-	void reset();
+	static CPU_KERNELS getKernels();
+	static const char* getName(CPU_KERNELS kernels);
 
 private:
-	std::string  m_data;
-	std::string  m_command;
-	bool         m_pressed;
-	unsigned int m_releaseCount;
-	unsigned int m_pressCount;
-	char         m_lastChar;
-
-	WX_STATUS decodeVDMode2Slice(const unsigned char* ambe, bool end);
-	WX_STATUS validate() const;
+	static CPU_KERNELS s_kernels;
 };
 
 #endif
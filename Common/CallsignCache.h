@@ -0,0 +1,176 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(CALLSIGNCACHE_H)
+#define	CALLSIGNCACHE_H
+
+#include "YSFDefines.h"
+#include "Log.h"
+
+#include <cassert>
+#include <cstring>
+#include <cctype>
+#include <string>
+
+// Entries kept, a bridge only ever sees a handful of sources at a time
+const unsigned int CALLSIGN_CACHE_SIZE = 16U;
+
+struct CCallsignEntry {
+	unsigned char m_raw[YSF_CALLSIGN_LENGTH];		// The source field as received, the key
+	char          m_source[YSF_CALLSIGN_LENGTH + 1U];	// Cut at the first NUL, trailing white space removed
+	char          m_callsign[YSF_CALLSIGN_LENGTH + 1U];	// Without the suffix, N0CALL when there is nothing left
+	unsigned int  m_id;					// Zero when the lookup does not know the callsign
+	unsigned int  m_used;					// Zero for an empty entry
+};
+
+// Remembers what the last few YSF sources resolved to, so that a header or a Wires-X frame from a
+// known station neither builds strings nor takes the lookup lock. The lookup has to provide
+// findID() and getGeneration(), a new generation after a reload empties the cache.
+template<class T> class CCallsignCache {
+public:
+	CCallsignCache() :
+	m_lookup(NULL),
+	m_generation(0U),
+	m_clock(0U),
+	m_lookups(0U),
+	m_hits(0U)
+	{
+		clear();
+	}
+
+	void setLookup(T* lookup)
+	{
+		assert(lookup != NULL);
+
+		m_lookup     = lookup;
+		m_generation = lookup->getGeneration();
+
+		clear();
+	}
+
+	const CCallsignEntry& find(const unsigned char* source)
+	{
+		assert(m_lookup != NULL);
+		assert(source != NULL);
+
+		unsigned int generation = m_lookup->getGeneration();
+		if (generation != m_generation) {
+			m_generation = generation;
+			clear();
+		}
+
+		m_lookups++;
+		m_clock++;
+
+		CCallsignEntry* oldest = &m_entries[0U];
+		for (unsigned int i = 0U; i < CALLSIGN_CACHE_SIZE; i++) {
+			CCallsignEntry& entry = m_entries[i];
+
+			if (entry.m_used != 0U && ::memcmp(entry.m_raw, source, YSF_CALLSIGN_LENGTH) == 0) {
+				entry.m_used = m_clock;
+				m_hits++;
+				return entry;
+			}
+
+			if (entry.m_used < oldest->m_used)
+				oldest = &entry;
+		}
+
+		resolve(*oldest, source);
+
+		return *oldest;
+	}
+
+	unsigned int getLookups() const
+	{
+		return m_lookups;
+	}
+
+	unsigned int getHits() const
+	{
+		return m_hits;
+	}
+
+	void report() const
+	{
+		LogMessage("Callsign cache: %u lookups, %u hits (%.1f%%)", m_lookups, m_hits, m_lookups > 0U ? 100.0F * float(m_hits) / float(m_lookups) : 0.0F);
+	}
+
+private:
+	T*             m_lookup;
+	unsigned int   m_generation;
+	unsigned int   m_clock;
+	unsigned int   m_lookups;
+	unsigned int   m_hits;
+	CCallsignEntry m_entries[CALLSIGN_CACHE_SIZE];
+
+	void clear()
+	{
+		for (unsigned int i = 0U; i < CALLSIGN_CACHE_SIZE; i++)
+			m_entries[i].m_used = 0U;
+	}
+
+	void resolve(CCallsignEntry& entry, const unsigned char* source)
+	{
+		::memcpy(entry.m_raw, source, YSF_CALLSIGN_LENGTH);
+		entry.m_used = m_clock;
+
+		int length = 0;
+		while (length < int(YSF_CALLSIGN_LENGTH) && source[length] != 0x00U)
+			length++;
+		while (length > 0 && ::isspace(source[length - 1]))
+			length--;
+
+		::memcpy(entry.m_source, source, length);
+		entry.m_source[length] = 0x00;
+
+		// The callsign is what comes before the last '-' or '/' suffix, without the padding
+		int first = -1, mid1 = -1, mid2 = -1, last = -1;
+		for (int i = 0; i < length; i++) {
+			char c = entry.m_source[i];
+			if (c != ' ') {
+				if (first == -1)
+					first = i;
+				last = i;
+			}
+			if (c == '-')
+				mid1 = i;
+			else if (c == '/')
+				mid2 = i;
+		}
+
+		int start = first, end = -1;
+		if (mid1 == -1 && mid2 == -1 && first != -1)
+			end = last + 1;
+		else if (mid1 > first)
+			end = mid1;
+		else if (mid2 > first)
+			end = mid2;
+
+		if (end == -1) {
+			::strcpy(entry.m_callsign, "N0CALL");
+		} else {
+			::memcpy(entry.m_callsign, entry.m_source + start, end - start);
+			entry.m_callsign[end - start] = 0x00;
+		}
+
+		entry.m_id = m_lookup->findID(std::string(entry.m_callsign));
+	}
+};
+
+#endif
@@ -23,7 +23,6 @@
 
 CDMRData::CDMRData(const CDMRData& data) :
 m_slotNo(data.m_slotNo),
-m_data(NULL),
 m_srcId(data.m_srcId),
 m_dstId(data.m_dstId),
 m_flco(data.m_flco),
@@ -35,13 +34,11 @@ m_ber(data.m_ber),
 m_rssi(data.m_rssi),
 m_streamId(data.m_streamId)
 {
-	m_data = new unsigned char[2U * DMR_FRAME_LENGTH_BYTES];
 	::memcpy(m_data, data.m_data, 2U * DMR_FRAME_LENGTH_BYTES);
 }
 
 CDMRData::CDMRData() :
 m_slotNo(1U),
-m_data(NULL),
 m_srcId(0U),
 m_dstId(0U),
 m_flco(FLCO_GROUP),
@@ -53,12 +50,10 @@ m_ber(0U),
 m_rssi(0U),
 m_streamId(0U)
 {
-	m_data = new unsigned char[2U * DMR_FRAME_LENGTH_BYTES];
 }
 
 CDMRData::~CDMRData()
 {
-	delete[] m_data;
 }
 
 CDMRData& CDMRData::operator=(const CDMRData& data)
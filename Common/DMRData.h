@@ -62,7 +62,8 @@ public:
 
 private:
 	unsigned int   m_slotNo;
-	unsigned char* m_data;
+	// Held in the object, so a frame built on the stack costs no allocation
+	unsigned char  m_data[2U * DMR_FRAME_LENGTH_BYTES];
 	unsigned int   m_srcId;
 	unsigned int   m_dstId;
 	FLCO           m_flco;
@@ -32,7 +32,8 @@ const unsigned int BUFFER_LENGTH = 500U;
 const unsigned int HOMEBREW_DATA_PACKET_LENGTH = 55U;
 
 CDMRNetwork::CDMRNetwork(const std::string& address, unsigned int port, unsigned int local, unsigned int id, const std::string& password, bool duplex, const char* version, bool debug, bool slot1, bool slot2, HW_TYPE hwType, unsigned int jitter) :
-m_address(),
+m_address(NULL),
+m_generation(0U),
 m_port(port),
 m_id(NULL),
 m_password(password),
@@ -48,6 +49,9 @@ m_hwType(hwType),
 m_status(WAITING_CONNECT),
 m_retryTimer(1000U, 10U),
 m_timeoutTimer(1000U, 60U),
+m_voiceTimer(1000U, 2U),
+m_login(false),
+m_connect(true),
 m_buffer(NULL),
 m_salt(NULL),
 m_streamId(NULL),
@@ -71,7 +75,7 @@ m_beacon(false)
 	assert(!password.empty());
 	assert(jitter > 0U);
 
-	m_address = CUDPSocket::lookup(address);
+	m_address = CResolver::find(address);
 
 	m_buffer        = new unsigned char[BUFFER_LENGTH];
 	m_salt          = new unsigned char[sizeof(uint32_t)];
@@ -128,11 +132,40 @@ void CDMRNetwork::setConfig(const std::string& callsign, unsigned int rxFrequenc
 	m_url         = url;
 }
 
+void CDMRNetwork::setPassword(const std::string& password)
+{
+	assert(!password.empty());
+
+	m_password = password;
+}
+
+void CDMRNetwork::setMaster(const std::string& address, unsigned int port)
+{
+	assert(!address.empty());
+	assert(port > 0U);
+
+	close();
+
+	m_address = CResolver::find(address);
+	m_port    = port;
+	m_connect = true;
+
+	open();
+}
+
+void CDMRNetwork::login()
+{
+	// Before the first login everything set is used anyway
+	if (m_status != WAITING_CONNECT)
+		m_login = true;
+}
+
 bool CDMRNetwork::open()
 {
 	LogMessage("DMR, Opening DMR Network");
 
 	m_status = WAITING_CONNECT;
+	m_login  = false;
 	m_timeoutTimer.stop();
 	m_retryTimer.start();
 
@@ -164,11 +197,14 @@ bool CDMRNetwork::read(CDMRData& data)
 
 			FLCO flco = (m_buffer[15U] & 0x40U) == 0x40U ? FLCO_USER_USER : FLCO_GROUP;
 
+			unsigned int streamId = (m_buffer[16U] << 24) | (m_buffer[17U] << 16) | (m_buffer[18U] << 8) | (m_buffer[19U] << 0);
+
 			data.setSeqNo(seqNo);
 			data.setSlotNo(slotNo);
 			data.setSrcId(srcId);
 			data.setDstId(dstId);
 			data.setFLCO(flco);
+			data.setStreamId(streamId);
 			data.setMissing(status == BS_MISSING);
 
 			bool dataSync = (m_buffer[15U] & 0x20U) == 0x20U;
@@ -267,6 +303,8 @@ bool CDMRNetwork::write(const CDMRData& data)
 	for (unsigned int i = 0U; i < count; i++)
 		write(buffer, HOMEBREW_DATA_PACKET_LENGTH);
 
+	m_voiceTimer.start();
+
 	return true;
 }
 
@@ -336,9 +374,17 @@ void CDMRNetwork::clock(unsigned int ms)
 
 	if (m_status == WAITING_CONNECT) {
 		m_retryTimer.clock(ms);
-		if (m_retryTimer.isRunning() && m_retryTimer.hasExpired()) {
+		if (m_retryTimer.isRunning() && (m_connect || m_retryTimer.hasExpired())) {
+			// The login waits until the name of the master has resolved, and starts as soon as it has
+			if (!m_address->isResolved())
+				return;
+
+			m_connect = false;
+
 			bool ret = m_socket.open();
 			if (ret) {
+				m_generation = m_address->getGeneration();
+
 				ret = writeLogin();
 				if (!ret)
 					return;
@@ -353,6 +399,13 @@ void CDMRNetwork::clock(unsigned int ms)
 		return;
 	}
 
+	if (m_address->getGeneration() != m_generation) {
+		LogMessage("DMR, The master has moved to a new address, logging in again");
+		close();
+		open();
+		return;
+	}
+
 	in_addr address;
 	unsigned int port;
 	int length = m_socket.read(m_buffer, BUFFER_LENGTH, address, port);
@@ -366,12 +419,13 @@ void CDMRNetwork::clock(unsigned int ms)
 	// if (m_debug && length > 0)
 	//	CUtils::dump(1U, "Network Received", m_buffer, length);
 
-	if (length > 0 && m_address.s_addr == address.s_addr && m_port == port) {
+	if (length > 0 && m_address->matches(address) && m_port == port) {
 		if (::memcmp(m_buffer, "DMRD", 4U) == 0) {
 			if (m_enabled) {
 				if (m_debug)
 					CUtils::dump(1U, "Network Received", m_buffer, length);
 				receiveData(m_buffer, length);
+				m_voiceTimer.start();
 			}
 		} else if (::memcmp(m_buffer, "MSTNAK",  6U) == 0) {
 			if (m_status == RUNNING) {
@@ -439,6 +493,19 @@ void CDMRNetwork::clock(unsigned int ms)
 		}
 	}
 
+	// A new login waits for the calls on both slots to finish, a login already under way picks up the changes itself
+	m_voiceTimer.clock(ms);
+	if (m_login && m_status == RUNNING && (!m_voiceTimer.isRunning() || m_voiceTimer.hasExpired())) {
+		LogMessage("DMR, Logging into the master again with the new configuration");
+		m_login = false;
+		m_voiceTimer.stop();
+		writeLogin();
+		m_status = WAITING_LOGIN;
+		m_timeoutTimer.start();
+		m_retryTimer.start();
+		return;
+	}
+
 	m_retryTimer.clock(ms);
 	if (m_retryTimer.isRunning() && m_retryTimer.hasExpired()) {
 		switch (m_status) {
@@ -654,7 +721,7 @@ bool CDMRNetwork::write(const unsigned char* data, unsigned int length)
 	// if (m_debug)
 	//	CUtils::dump(1U, "Network Transmitted", data, length);
 
-	bool ret = m_socket.write(data, length, m_address, m_port);
+	bool ret = m_socket.write(data, length, m_address->getAddress(), m_port);
 	if (!ret) {
 		LogError("DMR, Socket has failed when writing data to the master, retrying connection");
 		m_socket.close();
@@ -21,13 +21,16 @@
 
 #include "DelayBuffer.h"
 #include "UDPSocket.h"
+#include "Resolver.h"
 #include "Timer.h"
 #include "DMRData.h"
 #include "Defines.h"
 
 #include <string>
 #include <cstdint>
+#include <atomic>
 
+// Owned by one thread, which does everything but isConnected(), that one may be asked from any thread
 class CDMRNetwork
 {
 public:
@@ -38,6 +41,15 @@ public:
 
 	void setConfig(const std::string& callsign, unsigned int rxFrequency, unsigned int txFrequency, unsigned int power, unsigned int colorCode, float latitude, float longitude, int height, const std::string& location, const std::string& description, const std::string& url);
 
+	void setPassword(const std::string& password);
+
+	// Connects to another master, from the start of the login
+	void setMaster(const std::string& address, unsigned int port);
+
+	// Goes through the login again on the same socket once both slots are quiet,
+	// so that the master takes up the password, options and config set since
+	void login();
+
 	bool open();
 
 	void enable(bool enabled);
@@ -61,7 +73,8 @@ public:
 	void close();
 
 private: 
-	in_addr         m_address;
+	CResolvedHost*  m_address;
+	unsigned int    m_generation;
 	unsigned int    m_port;
 	uint8_t*        m_id;
 	std::string     m_password;
@@ -84,9 +97,12 @@ private:
 		RUNNING
 	};
 
-	STATUS         m_status;
+	std::atomic<STATUS> m_status;
 	CTimer         m_retryTimer;
 	CTimer         m_timeoutTimer;
+	CTimer         m_voiceTimer;
+	bool           m_login;
+	bool           m_connect;		// The first connection after startup or a new master does not wait for the retry timer
 	unsigned char* m_buffer;
 	unsigned char* m_salt;
 	uint32_t*      m_streamId;
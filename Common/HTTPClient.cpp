@@ -0,0 +1,230 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "HTTPClient.h"
+#include "Log.h"
+
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
+
+const unsigned int HTTP_TIMEOUT = 10U;
+
+CHTTPClient::CHTTPClient(const std::string& host, unsigned int port, const std::string& userAgent) :
+m_host(host),
+m_port(port),
+m_userAgent(userAgent),
+m_socket(host, port),
+m_connected(false),
+m_outstanding(0U),
+m_connections(0U),
+m_requests(0U)
+{
+	assert(!host.empty());
+	assert(port > 0U);
+}
+
+CHTTPClient::~CHTTPClient()
+{
+	close();
+}
+
+bool CHTTPClient::get(const std::string& path)
+{
+	if (!m_connected && !connect())
+		return false;
+
+	std::string request = "GET " + path + " HTTP/1.1\r\nHost: " + m_host + "\r\nUser-Agent: " + m_userAgent + "\r\nConnection: keep-alive\r\n\r\n";
+
+	if (!m_socket.write((const unsigned char*)request.c_str(), request.length())) {
+		close();
+		return false;
+	}
+
+	m_outstanding++;
+	m_requests++;
+
+	return true;
+}
+
+int CHTTPClient::read(CHTTPHandler& handler)
+{
+	if (!m_connected || m_outstanding == 0U)
+		return -1;
+
+	std::string line;
+	if (!readLine(line) || line.compare(0U, 5U, "HTTP/") != 0) {
+		close();
+		return -1;
+	}
+
+	std::string::size_type space = line.find(' ');
+	int status = space != std::string::npos ? ::atoi(line.c_str() + space + 1U) : 0;
+
+	bool keepAlive = line.compare(0U, 8U, "HTTP/1.0") != 0;
+	bool chunked   = false;
+	int  length    = -1;
+
+	for (;;) {
+		if (!readLine(line)) {
+			close();
+			return -1;
+		}
+
+		if (line.empty())
+			break;
+
+		std::string::size_type colon = line.find(':');
+		if (colon == std::string::npos)
+			continue;
+
+		std::string name = line.substr(0U, colon);
+		for (std::string::iterator it = name.begin(); it != name.end(); ++it)
+			*it = ::tolower(*it);
+
+		std::string::size_type start = line.find_first_not_of(' ', colon + 1U);
+		std::string value = start != std::string::npos ? line.substr(start) : std::string();
+		for (std::string::iterator it = value.begin(); it != value.end(); ++it)
+			*it = ::tolower(*it);
+
+		if (name == "content-length")
+			length = ::atoi(value.c_str());
+		else if (name == "transfer-encoding")
+			chunked = value.find("chunked") != std::string::npos;
+		else if (name == "connection")
+			keepAlive = value.find("close") == std::string::npos;
+	}
+
+	m_outstanding--;
+
+	bool ret;
+	if (chunked) {
+		ret = readChunks(handler);
+	} else if (length >= 0) {
+		ret = readBody(handler, (unsigned int)length);
+	} else {
+		// No length, the body runs until the server closes the connection
+		unsigned char buffer[1024U];
+		int n;
+		while ((n = m_socket.read(buffer, sizeof(buffer), HTTP_TIMEOUT)) > 0)
+			handler.body(buffer, (unsigned int)n);
+
+		ret = true;
+		keepAlive = false;
+	}
+
+	if (!ret) {
+		close();
+		return -1;
+	}
+
+	if (!keepAlive)
+		close();
+
+	return status;
+}
+
+void CHTTPClient::close()
+{
+	if (m_connected)
+		m_socket.close();
+
+	m_connected   = false;
+	m_outstanding = 0U;
+}
+
+unsigned int CHTTPClient::getConnections() const
+{
+	return m_connections;
+}
+
+unsigned int CHTTPClient::getRequests() const
+{
+	return m_requests;
+}
+
+bool CHTTPClient::connect()
+{
+	// The resolver keeps the address, and looks it up again when the connection fails
+	if (!m_socket.open())
+		return false;
+
+	m_connected   = true;
+	m_outstanding = 0U;
+	m_connections++;
+
+	return true;
+}
+
+bool CHTTPClient::readBody(CHTTPHandler& handler, unsigned int length)
+{
+	unsigned char buffer[1024U];
+
+	while (length > 0U) {
+		int n = m_socket.read(buffer, length < sizeof(buffer) ? length : sizeof(buffer), HTTP_TIMEOUT);
+		if (n <= 0)
+			return false;
+
+		handler.body(buffer, (unsigned int)n);
+		length -= (unsigned int)n;
+	}
+
+	return true;
+}
+
+bool CHTTPClient::readChunks(CHTTPHandler& handler)
+{
+	std::string line;
+
+	for (;;) {
+		if (!readLine(line))
+			return false;
+
+		unsigned int length = (unsigned int)::strtoul(line.c_str(), NULL, 16);
+		if (length == 0U)
+			break;
+
+		if (!readBody(handler, length))
+			return false;
+
+		// The CRLF after the chunk
+		if (!readLine(line))
+			return false;
+	}
+
+	// Trailers, up to the empty line
+	do {
+		if (!readLine(line))
+			return false;
+	} while (!line.empty());
+
+	return true;
+}
+
+bool CHTTPClient::readLine(std::string& line)
+{
+	if (m_socket.readLine(line, HTTP_TIMEOUT) <= 0)
+		return false;
+
+	while (!line.empty() && (line.at(line.length() - 1U) == '\n' || line.at(line.length() - 1U) == '\r'))
+		line.erase(line.length() - 1U);
+
+	return true;
+}
@@ -0,0 +1,69 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(HTTPCLIENT_H)
+#define	HTTPCLIENT_H
+
+#include "TCPSocket.h"
+
+#include <string>
+
+// Receives a response body as it is read off the connection
+class CHTTPHandler {
+public:
+	virtual ~CHTTPHandler() {}
+
+	virtual void body(const unsigned char* data, unsigned int length) = 0;
+};
+
+// A keep-alive HTTP/1.1 connection to one server. Several requests can be sent before their
+// responses are read, which then come back in the same order.
+class CHTTPClient {
+public:
+	CHTTPClient(const std::string& host, unsigned int port, const std::string& userAgent);
+	~CHTTPClient();
+
+	// Sends a GET, connecting first when there is no connection
+	bool get(const std::string& path);
+
+	// Reads the response to the oldest request still outstanding, returns the status code or
+	// -1 when the connection failed, which also drops the requests still outstanding
+	int  read(CHTTPHandler& handler);
+
+	void close();
+
+	unsigned int getConnections() const;
+	unsigned int getRequests() const;
+
+private:
+	std::string        m_host;
+	unsigned int       m_port;
+	std::string        m_userAgent;
+	CTCPSocket         m_socket;
+	bool               m_connected;
+	unsigned int       m_outstanding;
+	unsigned int       m_connections;
+	unsigned int       m_requests;
+
+	bool connect();
+	bool readBody(CHTTPHandler& handler, unsigned int length);
+	bool readChunks(CHTTPHandler& handler);
+	bool readLine(std::string& line);
+};
+
+#endif
@@ -0,0 +1,239 @@
+/*
+ *   Copyright (C) 2010,2014,2016 and 2018 by Jonathan Naylor G4KLX
+ *   Copyright (C) 2016 Mathias Weyland, HB9FRV
+ *   Copyright (C) 2018 by Andy Uribe CA6JAU
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "IMBEConv.h"
+#include "Golay24128.h"
+#include "Hamming.h"
+
+#include <cstdio>
+#include <cassert>
+
+const unsigned int IMBE_INTERLEAVE[] = {
+	0,  7, 12, 19, 24, 31, 36, 43, 48, 55, 60, 67, 72, 79, 84, 91,  96, 103, 108, 115, 120, 127, 132, 139,
+	1,  6, 13, 18, 25, 30, 37, 42, 49, 54, 61, 66, 73, 78, 85, 90,  97, 102, 109, 114, 121, 126, 133, 138,
+	2,  9, 14, 21, 26, 33, 38, 45, 50, 57, 62, 69, 74, 81, 86, 93,  98, 105, 110, 117, 122, 129, 134, 141,
+	3,  8, 15, 20, 27, 32, 39, 44, 51, 56, 63, 68, 75, 80, 87, 92,  99, 104, 111, 116, 123, 128, 135, 140,
+	4, 11, 16, 23, 28, 35, 40, 47, 52, 59, 64, 71, 76, 83, 88, 95, 100, 107, 112, 119, 124, 131, 136, 143,
+	5, 10, 17, 22, 29, 34, 41, 46, 53, 58, 65, 70, 77, 82, 89, 94, 101, 106, 113, 118, 125, 130, 137, 142};
+
+const unsigned int VCH_BITS   = 144U;
+const unsigned int VCH_BYTES  = 18U;
+const unsigned int IMBE_BYTES = 11U;
+
+// The first bit of the whitened section and its length
+const unsigned int PRN_START  = 23U;
+const unsigned int PRN_LENGTH = 114U;
+
+// Start and length of the voice bits of each vector, c0 to c7, in the de-interleaved frame
+const unsigned int VECTOR_START[]  = {0U, 23U, 46U, 69U, 92U, 107U, 122U, 137U};
+const unsigned int VECTOR_LENGTH[] = {12U, 12U, 12U, 12U, 11U, 11U, 11U, 7U};
+
+// A 144 bit frame is held as three words, bit 0 is the top bit of the first word
+static uint64_t s_deinterleave[VCH_BYTES][256U][3U];
+static uint64_t s_interleave[VCH_BYTES][256U][3U];
+static uint64_t s_whitening[4096U][3U];
+static uint16_t s_hamming[2048U];
+
+static void setBit(uint64_t* frame, unsigned int n)
+{
+	frame[n / 64U] |= 0x8000000000000000ULL >> (n % 64U);
+}
+
+static unsigned int getBits(const uint64_t* frame, unsigned int start, unsigned int length)
+{
+	unsigned int word  = start / 64U;
+	unsigned int shift = start % 64U;
+
+	// Join two words when the field straddles them
+	uint64_t bits = frame[word] << shift;
+	if (shift + length > 64U)
+		bits |= frame[word + 1U] >> (64U - shift);
+
+	return (unsigned int)(bits >> (64U - length));
+}
+
+static void putBits(uint64_t* frame, unsigned int start, unsigned int length, unsigned int value)
+{
+	unsigned int word  = start / 64U;
+	unsigned int shift = start % 64U;
+
+	uint64_t bits = uint64_t(value) << (64U - length);
+
+	frame[word] |= bits >> shift;
+	if (shift + length > 64U)
+		frame[word + 1U] |= bits << (64U - shift);
+}
+
+class CIMBETables {
+public:
+	CIMBETables()
+	{
+		for (unsigned int i = 0U; i < VCH_BITS; i++) {
+			unsigned int n = IMBE_INTERLEAVE[i];
+
+			// Air bit n becomes frame bit i, and back
+			for (unsigned int b = 0U; b < 256U; b++) {
+				if ((b & (0x80U >> (n % 8U))) != 0U)
+					setBit(s_deinterleave[n / 8U][b], i);
+				if ((b & (0x80U >> (i % 8U))) != 0U)
+					setBit(s_interleave[i / 8U][b], n);
+			}
+		}
+
+		for (unsigned int c0 = 0U; c0 < 4096U; c0++) {
+			unsigned int p = 16U * c0;
+			for (unsigned int i = 0U; i < PRN_LENGTH; i++) {
+				p = (173U * p + 13849U) % 65536U;
+				if (p >= 32768U)
+					setBit(s_whitening[c0], i + PRN_START);
+			}
+		}
+
+		for (unsigned int data = 0U; data < 2048U; data++) {
+			bool bits[15U];
+			for (unsigned int i = 0U; i < 11U; i++)
+				bits[i] = (data & (0x400U >> i)) != 0U;
+
+			CHamming::encode15113_1(bits);
+
+			uint16_t code = 0U;
+			for (unsigned int i = 0U; i < 15U; i++)
+				code = (code << 1) | (bits[i] ? 1U : 0U);
+
+			s_hamming[data] = code;
+		}
+	}
+};
+
+static CIMBETables s_tables;
+
+void CIMBEConv::permute(const uint64_t table[][256U][3U], const unsigned char* in, uint64_t* out)
+{
+	uint64_t w0 = 0U, w1 = 0U, w2 = 0U;
+
+	for (unsigned int i = 0U; i < VCH_BYTES; i++) {
+		const uint64_t* bits = table[i][in[i]];
+		w0 |= bits[0U];
+		w1 |= bits[1U];
+		w2 |= bits[2U];
+	}
+
+	out[0U] = w0;
+	out[1U] = w1;
+	out[2U] = w2;
+}
+
+static unsigned int correctHamming(unsigned int code)
+{
+	bool bits[15U];
+	for (unsigned int i = 0U; i < 15U; i++)
+		bits[i] = (code & (0x4000U >> i)) != 0U;
+
+	CHamming::decode15113_1(bits);
+
+	unsigned int data = 0U;
+	for (unsigned int i = 0U; i < 11U; i++)
+		data = (data << 1) | (bits[i] ? 1U : 0U);
+
+	return data;
+}
+
+void CIMBEConv::decode(const unsigned char* vch, unsigned char* imbe, bool correct)
+{
+	assert(vch != NULL);
+	assert(imbe != NULL);
+
+	uint64_t frame[3U];
+	permute(s_deinterleave, vch, frame);
+
+	unsigned int vectors[8U];
+
+	// c0 seeds the whitening, so it is corrected first
+	unsigned int c0 = getBits(frame, 0U, 12U);
+	if (correct)
+		c0 = CGolay24128::decode23127(getBits(frame, 0U, 23U));
+	vectors[0U] = c0;
+
+	const uint64_t* prn = s_whitening[c0];
+	frame[0U] ^= prn[0U];
+	frame[1U] ^= prn[1U];
+	frame[2U] ^= prn[2U];
+
+	for (unsigned int i = 1U; i < 8U; i++)
+		vectors[i] = getBits(frame, VECTOR_START[i], VECTOR_LENGTH[i]);
+
+	if (correct) {
+		for (unsigned int i = 1U; i < 4U; i++)
+			vectors[i] = CGolay24128::decode23127(getBits(frame, VECTOR_START[i], 23U));
+		for (unsigned int i = 4U; i < 7U; i++)
+			vectors[i] = correctHamming(getBits(frame, VECTOR_START[i], 15U));
+	}
+
+	// Pack the 88 voice bits, the first 48 and the last 40 as two words
+	uint64_t hi = (uint64_t(vectors[0U]) << 36) | (uint64_t(vectors[1U]) << 24) | (uint64_t(vectors[2U]) << 12) | uint64_t(vectors[3U]);
+	uint64_t lo = (uint64_t(vectors[4U]) << 29) | (uint64_t(vectors[5U]) << 18) | (uint64_t(vectors[6U]) << 7) | uint64_t(vectors[7U]);
+
+	for (unsigned int i = 0U; i < 6U; i++)
+		imbe[i] = (unsigned char)(hi >> (40U - 8U * i));
+	for (unsigned int i = 0U; i < 5U; i++)
+		imbe[i + 6U] = (unsigned char)(lo >> (32U - 8U * i));
+}
+
+void CIMBEConv::encode(const unsigned char* imbe, unsigned char* vch)
+{
+	assert(imbe != NULL);
+	assert(vch != NULL);
+
+	uint64_t hi = 0U, lo = 0U;
+	for (unsigned int i = 0U; i < 6U; i++)
+		hi = (hi << 8) | imbe[i];
+	for (unsigned int i = 6U; i < IMBE_BYTES; i++)
+		lo = (lo << 8) | imbe[i];
+
+	unsigned int c0 = (unsigned int)(hi >> 36) & 0xFFFU;
+
+	uint64_t frame[3U] = {0U, 0U, 0U};
+
+	putBits(frame, VECTOR_START[0U], 23U, CGolay24128::encode23127(c0) >> 1);
+	putBits(frame, VECTOR_START[1U], 23U, CGolay24128::encode23127((unsigned int)(hi >> 24) & 0xFFFU) >> 1);
+	putBits(frame, VECTOR_START[2U], 23U, CGolay24128::encode23127((unsigned int)(hi >> 12) & 0xFFFU) >> 1);
+	putBits(frame, VECTOR_START[3U], 23U, CGolay24128::encode23127((unsigned int)(hi >> 0) & 0xFFFU) >> 1);
+	putBits(frame, VECTOR_START[4U], 15U, s_hamming[(lo >> 29) & 0x7FFU]);
+	putBits(frame, VECTOR_START[5U], 15U, s_hamming[(lo >> 18) & 0x7FFU]);
+	putBits(frame, VECTOR_START[6U], 15U, s_hamming[(lo >> 7) & 0x7FFU]);
+	putBits(frame, VECTOR_START[7U], 7U,  (unsigned int)(lo & 0x7FU));
+
+	const uint64_t* prn = s_whitening[c0];
+	frame[0U] ^= prn[0U];
+	frame[1U] ^= prn[1U];
+	frame[2U] ^= prn[2U];
+
+	// The frame words are in frame bit order, view them as bytes for the interleave
+	unsigned char bytes[VCH_BYTES];
+	for (unsigned int i = 0U; i < VCH_BYTES; i++)
+		bytes[i] = (unsigned char)(frame[i / 8U] >> (56U - 8U * (i % 8U)));
+
+	uint64_t air[3U];
+	permute(s_interleave, bytes, air);
+
+	for (unsigned int i = 0U; i < VCH_BYTES; i++)
+		vch[i] = (unsigned char)(air[i / 8U] >> (56U - 8U * (i % 8U)));
+}
@@ -0,0 +1,41 @@
+/*
+ *   Copyright (C) 2010,2014,2016 and 2018 by Jonathan Naylor G4KLX
+ *   Copyright (C) 2016 Mathias Weyland, HB9FRV
+ *   Copyright (C) 2018 by Andy Uribe CA6JAU
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(IMBEConv_H)
+#define	IMBEConv_H
+
+#include <cstdint>
+
+// Converts between the 144 bit interleaved and whitened IMBE voice channel of YSF
+// voice full rate mode and the 88 bit packed IMBE frame used on P25 networks.
+// The interleave is done with byte lookup tables and the whitening with one of
+// 4096 masks precomputed from the first vector, instead of bit by bit.
+class CIMBEConv {
+public:
+	// Optionally corrects the vectors with the Golay (23,12) and Hamming (15,11) codes
+	static void decode(const unsigned char* vch, unsigned char* imbe, bool correct);
+	static void encode(const unsigned char* imbe, unsigned char* vch);
+
+private:
+	static void permute(const uint64_t table[][256U][3U], const unsigned char* in, uint64_t* out);
+};
+
+#endif
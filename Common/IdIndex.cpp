@@ -0,0 +1,169 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "IdIndex.h"
+#include "Log.h"
+
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
+
+#include <sys/stat.h>
+
+// NXDN Ids fit in 16 bits, this flag tells a callsign match from a precomputed truncation
+const unsigned int ID_JOINED = 0x10000U;
+
+CIdIndex::CIdIndex(const std::string& dmrFile, const std::string& nxdnFile, unsigned int defaultID, unsigned int reloadTime) :
+CReloader("DMR/NXDN Id index", reloadTime),
+m_dmrFile(dmrFile),
+m_nxdnFile(nxdnFile),
+m_defaultID(defaultID),
+m_dmrTime(0),
+m_nxdnTime(0),
+m_table()
+{
+}
+
+CIdIndex::~CIdIndex()
+{
+}
+
+bool CIdIndex::findNXDNID(unsigned int dmrId, unsigned int& nxdnId)
+{
+	std::shared_ptr<const CIdIndexTable> table = m_table.get();
+
+	std::unordered_map<unsigned int, unsigned int>::const_iterator it = table->m_nxdnIds.find(dmrId);
+	if (it == table->m_nxdnIds.end()) {
+		nxdnId = truncID(dmrId);
+		return false;
+	}
+
+	nxdnId = it->second & ~ID_JOINED;
+
+	return (it->second & ID_JOINED) == ID_JOINED;
+}
+
+bool CIdIndex::findDMRID(unsigned int nxdnId, unsigned int& dmrId)
+{
+	std::shared_ptr<const CIdIndexTable> table = m_table.get();
+
+	std::unordered_map<unsigned int, unsigned int>::const_iterator it = table->m_dmrIds.find(nxdnId);
+	if (it == table->m_dmrIds.end())
+		return false;
+
+	dmrId = it->second;
+
+	return true;
+}
+
+unsigned int CIdIndex::truncID(unsigned int id) const
+{
+	// The last five of the first seven digits, as "%07d" cut to seven characters gave
+	while (id > 9999999U)
+		id /= 10U;
+
+	unsigned int newid = id % 100000U;
+
+	if (newid > 65519U || newid == 0U)
+		newid = m_defaultID;
+
+	return newid;
+}
+
+bool CIdIndex::load()
+{
+	struct stat dmrStat, nxdnStat;
+	time_t dmrTime  = ::stat(m_dmrFile.c_str(), &dmrStat) == 0 ? dmrStat.st_mtime : 0;
+	time_t nxdnTime = ::stat(m_nxdnFile.c_str(), &nxdnStat) == 0 ? nxdnStat.st_mtime : 0;
+
+	// Nothing to do until one of the files is replaced
+	if (dmrTime == m_dmrTime && nxdnTime == m_nxdnTime)
+		return true;
+
+	std::unordered_map<unsigned int, std::string> dmrTable, nxdnTable;
+	std::unordered_map<std::string, unsigned int> dmrCSTable, nxdnCSTable;
+
+	if (!readFile(m_dmrFile, " \t\r\n", dmrTable, dmrCSTable) || !readFile(m_nxdnFile, ",\t\r\n", nxdnTable, nxdnCSTable))
+		return false;
+
+	m_dmrTime  = dmrTime;
+	m_nxdnTime = nxdnTime;
+
+	std::shared_ptr<CIdIndexTable> table(new CIdIndexTable);
+
+	unsigned int count = 0U;
+
+	for (std::unordered_map<unsigned int, std::string>::const_iterator it = dmrTable.begin(); it != dmrTable.end(); ++it) {
+		std::unordered_map<std::string, unsigned int>::const_iterator cs = nxdnCSTable.find(it->second);
+		if (cs != nxdnCSTable.end()) {
+			table->m_nxdnIds[it->first] = cs->second | ID_JOINED;
+			count++;
+		} else {
+			table->m_nxdnIds[it->first] = truncID(it->first);
+		}
+	}
+
+	for (std::unordered_map<unsigned int, std::string>::const_iterator it = nxdnTable.begin(); it != nxdnTable.end(); ++it) {
+		std::unordered_map<std::string, unsigned int>::const_iterator cs = dmrCSTable.find(it->second);
+		if (cs != dmrCSTable.end() && cs->second != 0U)
+			table->m_dmrIds[it->first] = cs->second;
+	}
+
+	LogInfo("Joined %u DMR Ids and %u NXDN Ids on %u callsigns", (unsigned int)dmrTable.size(), (unsigned int)nxdnTable.size(), count);
+
+	m_table.set(table);
+
+	return true;
+}
+
+bool CIdIndex::readFile(const std::string& filename, const char* separators, std::unordered_map<unsigned int, std::string>& table, std::unordered_map<std::string, unsigned int>& cstable) const
+{
+	assert(separators != NULL);
+
+	FILE* fp = ::fopen(filename.c_str(), "rt");
+	if (fp == NULL)
+		return false;
+
+	// Parsed as CDMRLookup and CNXDNLookup do, so that the index agrees with their callsigns
+	char buffer[100U];
+	while (::fgets(buffer, 100U, fp) != NULL) {
+		if (buffer[0U] == '#')
+			continue;
+
+		char* p1 = ::strtok(buffer, separators);
+		char* p2 = ::strtok(NULL, separators);
+
+		if (p1 != NULL && p2 != NULL) {
+			unsigned int id = (unsigned int)::atoi(p1);
+			if (id == 0U)
+				continue;
+
+			for (char* p = p2; *p != 0x00U; p++)
+				*p = ::toupper(*p);
+
+			table[id] = std::string(p2);
+			cstable[p2] = id;
+		}
+	}
+
+	::fclose(fp);
+
+	return true;
+}
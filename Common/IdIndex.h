@@ -0,0 +1,68 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(IDINDEX_H)
+#define	IDINDEX_H
+
+#include "Reloader.h"
+#include "Snapshot.h"
+
+#include <unordered_map>
+#include <string>
+#include <ctime>
+
+// One join of the DMR and NXDN Id files, never changed once published
+class CIdIndexTable {
+public:
+	CIdIndexTable() :
+	m_nxdnIds(),
+	m_dmrIds()
+	{
+	}
+
+	std::unordered_map<unsigned int, unsigned int> m_nxdnIds;	// DMR Id to NXDN Id, ID_JOINED set when the callsigns matched
+	std::unordered_map<unsigned int, unsigned int> m_dmrIds;	// NXDN Id to DMR Id, matched callsigns only
+};
+
+// Maps the DMR and NXDN Ids onto each other without going through the callsigns on every call.
+// The reload thread only joins the files again when one of them has changed.
+class CIdIndex : public CReloader {
+public:
+	CIdIndex(const std::string& dmrFile, const std::string& nxdnFile, unsigned int defaultID, unsigned int reloadTime);
+	virtual ~CIdIndex();
+
+	// Always sets nxdnId, to the truncated DMR Id when the callsign has no NXDN Id
+	bool findNXDNID(unsigned int dmrId, unsigned int& nxdnId);
+	bool findDMRID(unsigned int nxdnId, unsigned int& dmrId);
+
+protected:
+	virtual bool load();
+
+private:
+	std::string              m_dmrFile;
+	std::string              m_nxdnFile;
+	unsigned int             m_defaultID;
+	time_t                   m_dmrTime;
+	time_t                   m_nxdnTime;
+	CSnapshot<CIdIndexTable> m_table;
+
+	unsigned int truncID(unsigned int id) const;
+	bool readFile(const std::string& filename, const char* separators, std::unordered_map<unsigned int, std::string>& table, std::unordered_map<std::string, unsigned int>& cstable) const;
+};
+
+#endif
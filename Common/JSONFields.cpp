@@ -0,0 +1,160 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "JSONFields.h"
+
+#include <cassert>
+#include <cstring>
+
+CJSONFields::CJSONFields(const char* const* names, unsigned int count) :
+m_names(names),
+m_count(count),
+m_values(),
+m_found(),
+m_state(JS_NONE),
+m_token(),
+m_length(0U),
+m_field(-1)
+{
+	assert(names != NULL);
+	assert(count > 0U && count <= JSON_MAX_FIELDS);
+
+	reset();
+}
+
+CJSONFields::~CJSONFields()
+{
+}
+
+void CJSONFields::reset()
+{
+	for (unsigned int i = 0U; i < JSON_MAX_FIELDS; i++) {
+		m_values[i].clear();
+		m_found[i] = false;
+	}
+
+	m_state  = JS_NONE;
+	m_length = 0U;
+	m_field  = -1;
+}
+
+void CJSONFields::body(const unsigned char* data, unsigned int length)
+{
+	assert(data != NULL);
+
+	for (unsigned int i = 0U; i < length; i++) {
+		char c = char(data[i]);
+
+		switch (m_state) {
+			case JS_NONE:
+				if (c == '"') {
+					m_length = 0U;
+					m_state  = JS_STRING;
+				}
+				break;
+
+			case JS_STRING:
+				// Only the start of a long string is kept, it can never be one of the names
+				if (c == '\\')
+					m_state = JS_ESCAPE;
+				else if (c == '"')
+					m_state = JS_AFTER_STRING;
+				else if (m_length < JSON_MAX_TOKEN)
+					m_token[m_length++] = c;
+				break;
+
+			case JS_ESCAPE:
+				m_length = JSON_MAX_TOKEN;
+				m_state  = JS_STRING;
+				break;
+
+			case JS_AFTER_STRING:
+				if (c == ':') {
+					m_field = match();
+					m_state = m_field >= 0 ? JS_VALUE_START : JS_NONE;
+				} else if (c == '"') {
+					m_length = 0U;
+					m_state  = JS_STRING;
+				} else if (c != ' ' && c != '\t' && c != '\r' && c != '\n') {
+					m_state = JS_NONE;
+				}
+				break;
+
+			case JS_VALUE_START:
+				if (c == '"') {
+					m_state = JS_QUOTED_VALUE;
+				} else if (c != ' ' && c != '\t' && c != '\r' && c != '\n') {
+					store(c);
+					m_state = JS_VALUE;
+				}
+				break;
+
+			case JS_VALUE:
+				if (c == ',' || c == '}' || c == ']' || c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+					m_found[m_field] = true;
+					m_state = JS_NONE;
+				} else {
+					store(c);
+				}
+				break;
+
+			case JS_QUOTED_VALUE:
+				if (c == '"') {
+					m_found[m_field] = true;
+					m_state = JS_NONE;
+				} else {
+					store(c);
+				}
+				break;
+		}
+	}
+}
+
+bool CJSONFields::has(unsigned int n) const
+{
+	assert(n < m_count);
+
+	return m_found[n];
+}
+
+const std::string& CJSONFields::get(unsigned int n) const
+{
+	assert(n < m_count);
+
+	return m_values[n];
+}
+
+int CJSONFields::match() const
+{
+	if (m_length >= JSON_MAX_TOKEN)
+		return -1;
+
+	for (unsigned int i = 0U; i < m_count; i++) {
+		// The first value of a field is the one that counts
+		if (!m_found[i] && ::strlen(m_names[i]) == m_length && ::memcmp(m_names[i], m_token, m_length) == 0)
+			return int(i);
+	}
+
+	return -1;
+}
+
+void CJSONFields::store(char c)
+{
+	if (m_values[m_field].length() < JSON_MAX_TOKEN)
+		m_values[m_field] += c;
+}
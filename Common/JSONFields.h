@@ -0,0 +1,67 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(JSONFIELDS_H)
+#define	JSONFIELDS_H
+
+#include "HTTPClient.h"
+
+#include <string>
+
+const unsigned int JSON_MAX_FIELDS = 4U;
+const unsigned int JSON_MAX_TOKEN  = 32U;
+
+// Picks the first value of a few named fields out of a JSON body as it arrives, in pieces of any
+// size, without keeping the body. Nesting is ignored, a field is found at any depth.
+class CJSONFields : public CHTTPHandler {
+public:
+	CJSONFields(const char* const* names, unsigned int count);
+	virtual ~CJSONFields();
+
+	void reset();
+
+	virtual void body(const unsigned char* data, unsigned int length);
+
+	bool has(unsigned int n) const;
+	const std::string& get(unsigned int n) const;
+
+private:
+	enum JSON_STATE {
+		JS_NONE,
+		JS_STRING,
+		JS_ESCAPE,
+		JS_AFTER_STRING,
+		JS_VALUE_START,
+		JS_VALUE,
+		JS_QUOTED_VALUE
+	};
+
+	const char* const* m_names;
+	unsigned int       m_count;
+	std::string        m_values[JSON_MAX_FIELDS];
+	bool               m_found[JSON_MAX_FIELDS];
+	JSON_STATE         m_state;
+	char               m_token[JSON_MAX_TOKEN];
+	unsigned int       m_length;
+	int                m_field;
+
+	int  match() const;
+	void store(char c);
+};
+
+#endif
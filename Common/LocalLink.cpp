@@ -0,0 +1,632 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "LocalLink.h"
+
+#if defined(__linux__)
+
+#include "Log.h"
+
+#include <cassert>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pwd.h>
+
+// How often an idle end looks for a peer, and a linked one checks that the peer is still there
+const unsigned int LINK_CHECK_MS   = 1000U;
+// A peer that did not answer is asked again after this long
+const unsigned int LINK_RETRY_MS   = 10000U;
+// The handshake has to be over by then
+const unsigned int LINK_TIMEOUT_MS = 2000U;
+
+const unsigned int  LINK_VERSION = 1U;
+const unsigned char LINK_ACK     = 0x06U;
+
+struct CLinkHello {
+	char         m_magic[8U];
+	unsigned int m_version;
+	unsigned int m_size;
+	unsigned int m_port;
+};
+
+static std::atomic<unsigned long long> s_systemCalls(0ULL);
+
+// The other user whose processes may link, besides our own
+static bool  s_peerUser = false;
+static uid_t s_peerUid  = 0U;
+
+static socklen_t linkName(sockaddr_un& addr, unsigned int port)
+{
+	::memset(&addr, 0x00, sizeof(sockaddr_un));
+	addr.sun_family = AF_UNIX;
+
+	// An abstract name, nothing is left behind in the filesystem
+	int len = ::snprintf(addr.sun_path + 1U, sizeof(addr.sun_path) - 1U, "MMDVM_CM.%u", port);
+
+	return socklen_t(offsetof(sockaddr_un, sun_path) + 1U + len);
+}
+
+// In ms, read from the vDSO so it costs no system call
+static unsigned long long now()
+{
+	struct timespec ts;
+	::clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (unsigned long long)ts.tv_sec * 1000ULL + (unsigned long long)ts.tv_nsec / 1000000ULL;
+}
+
+static bool isLoopback(const in_addr& address)
+{
+	return (ntohl(address.s_addr) >> 24) == 127U;
+}
+
+CLocalLink::CLocalLink(int fd, unsigned int localPort) :
+m_fd(fd),
+m_localPort(localPort),
+m_listen(-1),
+m_conn(-1),
+m_state(LS_IDLE),
+m_up(false),
+m_shared(NULL),
+m_tx(NULL),
+m_rx(NULL),
+m_txEvent(-1),
+m_peerAddress(),
+m_peerPort(0U),
+m_lastAddress(),
+m_lastPort(0U),
+m_mutex(),
+m_next(0ULL),
+m_retry(0ULL),
+m_timeout(0ULL)
+{
+	assert(fd >= 0);
+
+	m_events[0U] = -1;
+	m_events[1U] = -1;
+}
+
+CLocalLink::~CLocalLink()
+{
+	close();
+}
+
+unsigned long long CLocalLink::getSystemCalls()
+{
+	return s_systemCalls.load(std::memory_order_relaxed);
+}
+
+bool CLocalLink::setPeerUser(const std::string& user)
+{
+	s_peerUser = false;
+
+	if (user.empty())
+		return true;
+
+	struct passwd* entry = ::getpwnam(user.c_str());
+	if (entry == NULL) {
+		LogWarning("Shared memory link, unknown user %s, only the processes of this user may link", user.c_str());
+		return false;
+	}
+
+	s_peerUser = true;
+	s_peerUid  = entry->pw_uid;
+
+	return true;
+}
+
+bool CLocalLink::open()
+{
+	// Without a fixed UDP port the peer cannot find this end, it can still find the peer
+	if (m_localPort == 0U)
+		return true;
+
+	m_listen = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+	if (m_listen < 0) {
+		LogWarning("Cannot create the shared memory link socket, err: %d", errno);
+		return false;
+	}
+
+	sockaddr_un addr;
+	socklen_t size = linkName(addr, m_localPort);
+
+	if (::bind(m_listen, (sockaddr*)&addr, size) != 0 || ::listen(m_listen, 1) != 0) {
+		LogWarning("Cannot listen for a shared memory link on port %u, err: %d", m_localPort, errno);
+		::close(m_listen);
+		m_listen = -1;
+		return false;
+	}
+
+	return true;
+}
+
+int CLocalLink::read(unsigned char* buffer, unsigned int length, in_addr& address, unsigned int& port)
+{
+	assert(buffer != NULL);
+	assert(length > 0U);
+
+	clock();
+
+	if (m_state != LS_UP)
+		return 0;
+
+	unsigned int head = m_rx->m_head.load(std::memory_order_relaxed);
+	if (head == m_rx->m_tail.load(std::memory_order_acquire))
+		return 0;
+
+	unsigned int n = head % LINK_SLOTS;
+	unsigned int len = m_rx->m_slots[n].m_length;
+	if (len > LINK_SLOT_LENGTH)
+		len = LINK_SLOT_LENGTH;
+	if (len > length)
+		len = length;
+
+	::memcpy(buffer, m_rx->m_slots[n].m_data, len);
+
+	m_rx->m_head.store(head + 1U, std::memory_order_release);
+
+	address = m_peerAddress;
+	port    = m_peerPort;
+
+	return int(len);
+}
+
+LINK_RESULT CLocalLink::write(const unsigned char* buffer, unsigned int length, const in_addr& address, unsigned int port)
+{
+	assert(buffer != NULL);
+	assert(length > 0U);
+
+	if (!isLoopback(address))
+		return LR_NOT_LINKED;
+
+	m_mutex.lock();
+
+	// The reading thread looks for a peer where the frames are going
+	m_lastAddress = address;
+	m_lastPort    = port;
+
+	if (!m_up.load(std::memory_order_relaxed) || port != m_peerPort || length > LINK_SLOT_LENGTH) {
+		m_mutex.unlock();
+		return LR_NOT_LINKED;
+	}
+
+	unsigned int tail = m_tx->m_tail.load(std::memory_order_relaxed);
+	if (tail - m_tx->m_head.load(std::memory_order_acquire) >= LINK_SLOTS) {
+		m_mutex.unlock();
+		return LR_FULL;
+	}
+
+	unsigned int n = tail % LINK_SLOTS;
+	m_tx->m_slots[n].m_length = length;
+	::memcpy(m_tx->m_slots[n].m_data, buffer, length);
+
+	// Ordered against the waiting flag, so a reader going to sleep cannot miss the frame
+	m_tx->m_tail.store(tail + 1U);
+
+	if (m_tx->m_waiting.load() != 0U) {
+		s_systemCalls.fetch_add(1ULL, std::memory_order_relaxed);
+		uint64_t one = 1ULL;
+		ssize_t ret = ::write(m_txEvent, &one, sizeof(uint64_t));
+		(void)ret;
+	}
+
+	m_mutex.unlock();
+
+	return LR_SENT;
+}
+
+void CLocalLink::close()
+{
+	if (m_state == LS_UP)
+		LogMessage("Shared memory link with port %u closed", m_peerPort);
+
+	down();
+
+	if (m_listen >= 0) {
+		::close(m_listen);
+		m_listen = -1;
+	}
+}
+
+bool CLocalLink::isUp() const
+{
+	return m_up.load(std::memory_order_relaxed);
+}
+
+void CLocalLink::clock()
+{
+	unsigned long long ms = now();
+
+	switch (m_state) {
+	case LS_UP:
+		if (ms >= m_next) {
+			m_next = ms + LINK_CHECK_MS;
+			if (isPeerGone()) {
+				LogMessage("Shared memory link with port %u lost, back to UDP", m_peerPort);
+				down();
+				// A restarted peer is looked for straight away
+				m_retry = ms;
+			}
+		}
+		break;
+
+	case LS_ACCEPTING:
+		if (!receiveHello() && m_state == LS_ACCEPTING && ms >= m_timeout) {
+			LogWarning("Shared memory link, the peer did not complete the handshake");
+			down();
+		}
+		break;
+
+	case LS_CONNECTING:
+		if (!receiveAck() && m_state == LS_CONNECTING && ms >= m_timeout) {
+			LogWarning("Shared memory link, port %u did not complete the handshake", m_peerPort);
+			down();
+			m_retry = ms + LINK_RETRY_MS;
+		}
+		break;
+
+	default:
+		if (ms < m_next)
+			break;
+		m_next = ms + LINK_CHECK_MS;
+
+		if (m_listen >= 0)
+			accept();
+
+		if (m_state == LS_IDLE && ms >= m_retry) {
+			m_mutex.lock();
+			in_addr address   = m_lastAddress;
+			unsigned int port = m_lastPort;
+			m_mutex.unlock();
+
+			// Only one end of a pair connects, the other one waits for it
+			if (port > 0U && (m_localPort == 0U || m_localPort > port))
+				connect(address, port);
+		}
+		break;
+	}
+}
+
+void CLocalLink::accept()
+{
+	s_systemCalls.fetch_add(1ULL, std::memory_order_relaxed);
+
+	int fd = ::accept4(m_listen, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+	if (fd < 0)
+		return;
+
+	if (!isTrusted(fd)) {
+		::close(fd);
+		return;
+	}
+
+	m_conn    = fd;
+	m_state   = LS_ACCEPTING;
+	m_timeout = now() + LINK_TIMEOUT_MS;
+
+	receiveHello();
+}
+
+void CLocalLink::connect(const in_addr& address, unsigned int port)
+{
+	m_retry = now() + LINK_RETRY_MS;
+
+	// The peer learns the UDP port of this end from the hello, there is none before the first datagram
+	sockaddr_in local;
+	socklen_t localSize = sizeof(sockaddr_in);
+	if (::getsockname(m_fd, (sockaddr*)&local, &localSize) != 0 || local.sin_port == 0U)
+		return;
+
+	s_systemCalls.fetch_add(1ULL, std::memory_order_relaxed);
+
+	int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (fd < 0)
+		return;
+
+	sockaddr_un addr;
+	socklen_t size = linkName(addr, port);
+
+	// Nothing listening, the peer only speaks UDP
+	if (::connect(fd, (sockaddr*)&addr, size) != 0) {
+		::close(fd);
+		return;
+	}
+
+	// Anyone could have taken the name first
+	if (!isTrusted(fd)) {
+		::close(fd);
+		return;
+	}
+
+	m_conn = fd;
+
+	int memfd = ::memfd_create("MMDVM_CM link", MFD_CLOEXEC);
+	if (memfd < 0 || ::ftruncate(memfd, sizeof(CLinkShared)) != 0) {
+		LogWarning("Cannot create the shared memory for a link, err: %d", errno);
+		if (memfd >= 0)
+			::close(memfd);
+		down();
+		return;
+	}
+
+	m_events[0U] = ::eventfd(0U, EFD_NONBLOCK | EFD_CLOEXEC);
+	m_events[1U] = ::eventfd(0U, EFD_NONBLOCK | EFD_CLOEXEC);
+
+	if (m_events[0U] < 0 || m_events[1U] < 0 || !map(memfd)) {
+		LogWarning("Cannot set up a shared memory link, err: %d", errno);
+		::close(memfd);
+		down();
+		return;
+	}
+
+	CLinkHello hello;
+	::memset(&hello, 0x00, sizeof(CLinkHello));
+	::memcpy(hello.m_magic, "MMDVMSHM", 8U);
+	hello.m_version = LINK_VERSION;
+	hello.m_size    = sizeof(CLinkShared);
+	hello.m_port    = ntohs(local.sin_port);
+
+	struct iovec iov;
+	iov.iov_base = &hello;
+	iov.iov_len  = sizeof(CLinkHello);
+
+	int fds[3U] = {memfd, m_events[0U], m_events[1U]};
+
+	union {
+		char           m_buffer[CMSG_SPACE(sizeof(fds))];
+		struct cmsghdr m_align;
+	} control;
+	::memset(&control, 0x00, sizeof(control));
+
+	struct msghdr msg;
+	::memset(&msg, 0x00, sizeof(struct msghdr));
+	msg.msg_iov        = &iov;
+	msg.msg_iovlen     = 1U;
+	msg.msg_control    = control.m_buffer;
+	msg.msg_controllen = sizeof(control.m_buffer);
+
+	struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+	cmsg->cmsg_level = SOL_SOCKET;
+	cmsg->cmsg_type  = SCM_RIGHTS;
+	cmsg->cmsg_len   = CMSG_LEN(sizeof(fds));
+	::memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+
+	ssize_t ret = ::sendmsg(fd, &msg, MSG_NOSIGNAL);
+
+	// The mapping keeps the memory, and the peer has its own descriptor now
+	::close(memfd);
+
+	if (ret != ssize_t(sizeof(CLinkHello))) {
+		LogWarning("Cannot offer a shared memory link to port %u, err: %d", port, errno);
+		down();
+		return;
+	}
+
+	::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+	m_mutex.lock();
+	m_peerAddress = address;
+	m_peerPort    = port;
+	m_mutex.unlock();
+
+	m_state   = LS_CONNECTING;
+	m_timeout = now() + LINK_TIMEOUT_MS;
+}
+
+bool CLocalLink::receiveHello()
+{
+	CLinkHello hello;
+
+	struct iovec iov;
+	iov.iov_base = &hello;
+	iov.iov_len  = sizeof(CLinkHello);
+
+	union {
+		char           m_buffer[CMSG_SPACE(3U * sizeof(int))];
+		struct cmsghdr m_align;
+	} control;
+
+	struct msghdr msg;
+	::memset(&msg, 0x00, sizeof(struct msghdr));
+	msg.msg_iov        = &iov;
+	msg.msg_iovlen     = 1U;
+	msg.msg_control    = control.m_buffer;
+	msg.msg_controllen = sizeof(control.m_buffer);
+
+	s_systemCalls.fetch_add(1ULL, std::memory_order_relaxed);
+
+	ssize_t ret = ::recvmsg(m_conn, &msg, MSG_DONTWAIT | MSG_CMSG_CLOEXEC);
+	if (ret < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+		return false;
+
+	int fds[3U] = {-1, -1, -1};
+	struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+	if (ret > 0 && cmsg != NULL && cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS && cmsg->cmsg_len == CMSG_LEN(sizeof(fds)))
+		::memcpy(fds, CMSG_DATA(cmsg), sizeof(fds));
+
+	bool valid = ret == ssize_t(sizeof(CLinkHello)) && fds[0U] >= 0 && ::memcmp(hello.m_magic, "MMDVMSHM", 8U) == 0 &&
+		hello.m_version == LINK_VERSION && hello.m_size == sizeof(CLinkShared) && hello.m_port > 0U;
+
+	// The link only stands in for the UDP port this end already sends to, never for one the peer names
+	m_mutex.lock();
+	in_addr address   = m_lastAddress;
+	unsigned int port = m_lastPort;
+	m_mutex.unlock();
+
+	bool expected = valid && port == hello.m_port;
+
+	m_events[0U] = fds[1U];
+	m_events[1U] = fds[2U];
+
+	bool linked = expected && map(fds[0U]);
+
+	// Before this end has sent anything the peer is turned away quietly, and asks again later
+	if (!valid)
+		LogWarning("Shared memory link, the peer sent an invalid hello");
+	else if (!expected && port > 0U)
+		LogWarning("Shared memory link, refused a peer for port %u, this end sends to port %u", hello.m_port, port);
+	else if (expected && !linked)
+		LogWarning("Shared memory link, cannot map the memory of the peer, err: %d", errno);
+
+	if (!linked) {
+		if (fds[0U] >= 0)
+			::close(fds[0U]);
+		down();
+		return false;
+	}
+
+	::close(fds[0U]);
+
+	unsigned char ack = LINK_ACK;
+	if (::send(m_conn, &ack, 1U, MSG_NOSIGNAL) != 1) {
+		down();
+		return false;
+	}
+
+	// The frames come from where this end sends its own
+	m_mutex.lock();
+	m_peerAddress = address;
+	m_peerPort    = port;
+	m_mutex.unlock();
+
+	up(false);
+
+	return true;
+}
+
+bool CLocalLink::receiveAck()
+{
+	s_systemCalls.fetch_add(1ULL, std::memory_order_relaxed);
+
+	unsigned char ack = 0x00U;
+	ssize_t ret = ::recv(m_conn, &ack, 1U, MSG_DONTWAIT);
+	if (ret < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+		return false;
+
+	if (ret != 1 || ack != LINK_ACK) {
+		LogWarning("Shared memory link, port %u refused the link", m_peerPort);
+		down();
+		m_retry = now() + LINK_RETRY_MS;
+		return false;
+	}
+
+	up(true);
+
+	return true;
+}
+
+bool CLocalLink::isPeerGone()
+{
+	s_systemCalls.fetch_add(1ULL, std::memory_order_relaxed);
+
+	unsigned char data;
+	ssize_t ret = ::recv(m_conn, &data, 1U, MSG_PEEK | MSG_DONTWAIT);
+	if (ret == 0)
+		return true;
+
+	return ret < 0 && errno != EAGAIN && errno != EWOULDBLOCK;
+}
+
+bool CLocalLink::isTrusted(int fd) const
+{
+	s_systemCalls.fetch_add(1ULL, std::memory_order_relaxed);
+
+	struct ucred cred;
+	socklen_t size = sizeof(struct ucred);
+	if (::getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &cred, &size) != 0) {
+		LogWarning("Shared memory link, cannot get the credentials of the peer, err: %d", errno);
+		return false;
+	}
+
+	if (cred.uid == ::geteuid() || (s_peerUser && cred.uid == s_peerUid))
+		return true;
+
+	LogWarning("Shared memory link, refused a peer running as uid %u", (unsigned int)cred.uid);
+
+	return false;
+}
+
+bool CLocalLink::map(int memfd)
+{
+	void* shared = ::mmap(NULL, sizeof(CLinkShared), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, memfd, 0);
+	if (shared == MAP_FAILED)
+		return false;
+
+	m_shared = (CLinkShared*)shared;
+
+	return true;
+}
+
+void CLocalLink::up(bool connector)
+{
+	m_mutex.lock();
+	m_tx      = &m_shared->m_rings[connector ? 0U : 1U];
+	m_rx      = &m_shared->m_rings[connector ? 1U : 0U];
+	m_txEvent = m_events[connector ? 0U : 1U];
+	m_up.store(true);
+	m_mutex.unlock();
+
+	m_state = LS_UP;
+	m_next  = now() + LINK_CHECK_MS;
+
+	LogMessage("Shared memory link with port %u up", m_peerPort);
+}
+
+void CLocalLink::down()
+{
+	// A writing thread is either done with the ring or sees the link gone
+	m_mutex.lock();
+	m_up.store(false);
+	m_tx      = NULL;
+	m_txEvent = -1;
+	m_mutex.unlock();
+
+	m_rx = NULL;
+
+	if (m_shared != NULL) {
+		::munmap(m_shared, sizeof(CLinkShared));
+		m_shared = NULL;
+	}
+
+	for (unsigned int i = 0U; i < 2U; i++) {
+		if (m_events[i] >= 0) {
+			::close(m_events[i]);
+			m_events[i] = -1;
+		}
+	}
+
+	if (m_conn >= 0) {
+		::close(m_conn);
+		m_conn = -1;
+	}
+
+	m_state = LS_IDLE;
+}
+
+#endif
@@ -0,0 +1,129 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(LocalLink_H)
+#define	LocalLink_H
+
+#include "Mutex.h"
+
+#include <atomic>
+#include <string>
+
+#include <netinet/in.h>
+#include <sys/types.h>
+
+const unsigned int LINK_SLOTS       = 64U;
+const unsigned int LINK_SLOT_LENGTH = 512U;
+
+// One direction of a link, written by one process and read by the other
+struct CLinkRing {
+	std::atomic<unsigned int> m_head;
+	unsigned char             m_pad1[60U];
+	std::atomic<unsigned int> m_tail;
+	unsigned char             m_pad2[60U];
+	// Set by a reader that sleeps on the eventfd, the writer only signals it then
+	std::atomic<unsigned int> m_waiting;
+	unsigned char             m_pad3[60U];
+	struct {
+		unsigned int  m_length;
+		unsigned char m_data[LINK_SLOT_LENGTH];
+	} m_slots[LINK_SLOTS];
+};
+
+// The memfd shared by the two ends, ring 0 carries the frames of the end that connected
+struct CLinkShared {
+	CLinkRing m_rings[2U];
+};
+
+enum LINK_RESULT {
+	LR_NOT_LINKED,
+	LR_SENT,
+	LR_FULL
+};
+
+// A shared memory path between a CUDPSocket and a co-located peer that
+// supports it. Each end listens on an abstract Unix socket named after its
+// UDP port; the end with the higher port, or none, connects and passes a
+// memfd holding two rings and an eventfd for each. Frames for the peer then
+// go through the rings, and anything else, or everything when the peer does
+// not answer, stays on UDP. Only a process of the same user, or of the one
+// configured, may link, and only for the UDP port this end sends to. The link
+// is managed from read(), so it belongs to the reading thread, and a writing
+// thread only ever pushes to the ring.
+class CLocalLink {
+public:
+	CLocalLink(int fd, unsigned int localPort);
+	~CLocalLink();
+
+	bool open();
+
+	int  read(unsigned char* buffer, unsigned int length, in_addr& address, unsigned int& port);
+	LINK_RESULT write(const unsigned char* buffer, unsigned int length, const in_addr& address, unsigned int port);
+
+	void close();
+
+	bool isUp() const;
+
+	static unsigned long long getSystemCalls();
+
+	// Also links with the processes of this user, an empty name only with those of the same user
+	static bool setPeerUser(const std::string& user);
+
+private:
+	enum LINK_STATE {
+		LS_IDLE,
+		LS_ACCEPTING,
+		LS_CONNECTING,
+		LS_UP
+	};
+
+	int                  m_fd;
+	unsigned int         m_localPort;
+	int                  m_listen;
+	int                  m_conn;
+	LINK_STATE           m_state;
+	std::atomic<bool>    m_up;
+	CLinkShared*         m_shared;
+	CLinkRing*           m_tx;
+	CLinkRing*           m_rx;
+	int                  m_events[2U];
+	int                  m_txEvent;
+	in_addr              m_peerAddress;
+	unsigned int         m_peerPort;
+	in_addr              m_lastAddress;
+	unsigned int         m_lastPort;
+	CMutex               m_mutex;
+	unsigned long long   m_next;
+	unsigned long long   m_retry;
+	unsigned long long   m_timeout;
+
+	void clock();
+
+	void accept();
+	void connect(const in_addr& address, unsigned int port);
+	bool receiveHello();
+	bool receiveAck();
+	bool isPeerGone();
+	bool isTrusted(int fd) const;
+
+	bool map(int memfd);
+	void up(bool connector);
+	void down();
+};
+
+#endif
@@ -17,6 +17,7 @@
  */
 
 #include "Log.h"
+#include "Mutex.h"
 
 #if defined(_WIN32) || defined(_WIN64)
 #include <Windows.h>
@@ -41,6 +42,9 @@ static unsigned int m_displayLevel = 2U;
 
 static struct tm m_tm;
 
+// Several threads log, the file rotation and the timestamp conversion are not reentrant
+static CMutex m_mutex;
+
 static char LEVELS[] = " DMIWEF";
 
 static bool LogOpen()
@@ -103,7 +107,8 @@ void Log(unsigned int level, const char* fmt, ...)
 	struct timeval now;
 	::gettimeofday(&now, NULL);
 
-	struct tm* tm = ::gmtime(&now.tv_sec);
+	struct tm tmNow;
+	struct tm* tm = ::gmtime_r(&now.tv_sec, &tmNow);
 
 	::sprintf(buffer, "%c: %04d-%02d-%02d %02d:%02d:%02d.%03lu ", LEVELS[level], tm->tm_year + 1900, tm->tm_mon + 1, tm->tm_mday, tm->tm_hour, tm->tm_min, tm->tm_sec, now.tv_usec / 1000U);
 #endif
@@ -115,10 +120,14 @@ void Log(unsigned int level, const char* fmt, ...)
 
 	va_end(vl);
 
+	m_mutex.lock();
+
 	if (level >= m_fileLevel && m_fileLevel != 0U) {
 		bool ret = ::LogOpen();
-		if (!ret)
+		if (!ret) {
+			m_mutex.unlock();
 			return;
+		}
 
 		::fprintf(m_fpLog, "%s\n", buffer);
 		::fflush(m_fpLog);
@@ -129,6 +138,8 @@ void Log(unsigned int level, const char* fmt, ...)
 		::fflush(stdout);
 	}
 
+	m_mutex.unlock();
+
 	if (level == 6U) {		// Fatal
         ::fclose(m_fpLog);
         exit(1);
@@ -32,7 +32,7 @@ const unsigned int HOMEBREW_DATA_PACKET_LENGTH = 55U;
 
 
 CMMDVMNetwork::CMMDVMNetwork(const std::string& rptAddress, unsigned int rptPort, const std::string& localAddress, unsigned int localPort, bool debug) :
-m_rptAddress(),
+m_rptAddress(NULL),
 m_rptPort(rptPort),
 m_id(0U),
 m_netId(NULL),
@@ -51,7 +51,7 @@ m_talkerAliasLen(0U)
 	assert(!rptAddress.empty());
 	assert(rptPort > 0U);
 
-	m_rptAddress = CUDPSocket::lookup(rptAddress);
+	m_rptAddress = CResolver::find(rptAddress);
 
 	m_buffer = new unsigned char[BUFFER_LENGTH];
 	m_netId  = new unsigned char[4U];
@@ -213,7 +213,7 @@ bool CMMDVMNetwork::write(const CDMRData& data)
 	if (m_debug)
 		CUtils::dump(1U, "Network Transmitted", buffer, HOMEBREW_DATA_PACKET_LENGTH);
 
-	m_socket.write(buffer, HOMEBREW_DATA_PACKET_LENGTH, m_rptAddress, m_rptPort);
+	m_socket.write(buffer, HOMEBREW_DATA_PACKET_LENGTH, m_rptAddress->getAddress(), m_rptPort);
 
 	return true;
 }
@@ -250,7 +250,7 @@ bool CMMDVMNetwork::writeBeacon()
 	::memcpy(buffer + 0U, "RPTSBKN", 7U);
 	::memcpy(buffer + 7U, m_netId, 4U);
 
-	return m_socket.write(buffer, 11U, m_rptAddress, m_rptPort);
+	return m_socket.write(buffer, 11U, m_rptAddress->getAddress(), m_rptPort);
 }
 
 void CMMDVMNetwork::close()
@@ -263,7 +263,7 @@ void CMMDVMNetwork::close()
 	::memcpy(buffer + 0U, "MSTCL", 5U);
 	::memcpy(buffer + 5U, m_netId, 4U);
 
-	m_socket.write(buffer, HOMEBREW_DATA_PACKET_LENGTH, m_rptAddress, m_rptPort);
+	m_socket.write(buffer, HOMEBREW_DATA_PACKET_LENGTH, m_rptAddress->getAddress(), m_rptPort);
 	m_socket.close();
 }
 
@@ -282,7 +282,7 @@ void CMMDVMNetwork::clock(unsigned int ms)
 	// if (m_debug && length > 0)
 	//	CUtils::dump(1U, "Network Received", m_buffer, length);
 
-	if (length > 0 && m_rptAddress.s_addr == address.s_addr && m_rptPort == port) {
+	if (length > 0 && m_rptAddress->matches(address) && m_rptPort == port) {
 		if (::memcmp(m_buffer, "DMRD", 4U) == 0) {
 			if (m_debug)
 				CUtils::dump(1U, "Network Received", m_buffer, length);
@@ -306,12 +306,12 @@ void CMMDVMNetwork::clock(unsigned int ms)
 			uint32_t salt = 1U;
 			::memcpy(ack + 6U, &salt, sizeof(uint32_t));
 
-			m_socket.write(ack, 10U, m_rptAddress, m_rptPort);
+			m_socket.write(ack, 10U, m_rptAddress->getAddress(), m_rptPort);
 		} else if (::memcmp(m_buffer, "RPTK", 4U) == 0) {
 			unsigned char ack[10U];
 			::memcpy(ack + 0U, "RPTACK", 6U);
 			::memcpy(ack + 6U, m_netId, 4U);
-			m_socket.write(ack, 10U, m_rptAddress, m_rptPort);
+			m_socket.write(ack, 10U, m_rptAddress->getAddress(), m_rptPort);
 		} else if (::memcmp(m_buffer, "RPTCL", 5U) == 0) {
 			::LogMessage("MMDVM Network, The connected MMDVM is closing down");
 		} else if (::memcmp(m_buffer, "RPTC", 4U) == 0) {
@@ -322,19 +322,19 @@ void CMMDVMNetwork::clock(unsigned int ms)
 			unsigned char ack[10U];
 			::memcpy(ack + 0U, "RPTACK", 6U);
 			::memcpy(ack + 6U, m_netId, 4U);
-			m_socket.write(ack, 10U, m_rptAddress, m_rptPort);
+			m_socket.write(ack, 10U, m_rptAddress->getAddress(), m_rptPort);
 		} else if (::memcmp(m_buffer, "RPTO", 4U) == 0) {
 			m_options = std::string((char*)(m_buffer + 8U), length - 8U);
 
 			unsigned char ack[10U];
 			::memcpy(ack + 0U, "RPTACK", 6U);
 			::memcpy(ack + 6U, m_netId, 4U);
-			m_socket.write(ack, 10U, m_rptAddress, m_rptPort);
+			m_socket.write(ack, 10U, m_rptAddress->getAddress(), m_rptPort);
 		} else if (::memcmp(m_buffer, "RPTPING", 7U) == 0) {
 			unsigned char pong[11U];
 			::memcpy(pong + 0U, "MSTPONG", 7U);
 			::memcpy(pong + 7U, m_netId, 4U);
-			m_socket.write(pong, 11U, m_rptAddress, m_rptPort);
+			m_socket.write(pong, 11U, m_rptAddress->getAddress(), m_rptPort);
 		} else {
 			CUtils::dump("Unknown packet from the master", m_buffer, length);
 		}
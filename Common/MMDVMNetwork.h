@@ -20,6 +20,7 @@
 #define	MMDVMNetwork_H
 
 #include "UDPSocket.h"
+#include "Resolver.h"
 #include "Timer.h"
 #include "RingBuffer.h"
 #include "DMRData.h"
@@ -56,7 +57,7 @@ public:
 	void close();
 
 private: 
-	in_addr                    m_rptAddress;
+	CResolvedHost*             m_rptAddress;
 	unsigned int               m_rptPort;
 	unsigned int               m_id;
 	unsigned char*             m_netId;
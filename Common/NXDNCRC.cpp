@@ -0,0 +1,290 @@
+/*
+ *   Copyright (C) 2018 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "NXDNCRC.h"
+
+#include <cstdio>
+#include <cassert>
+
+const uint8_t  BIT_MASK_TABLE1[] = { 0x80U, 0x40U, 0x20U, 0x10U, 0x08U, 0x04U, 0x02U, 0x01U };
+
+#define WRITE_BIT1(p,i,b) p[(i)>>3] = (b) ? (p[(i)>>3] | BIT_MASK_TABLE1[(i)&7]) : (p[(i)>>3] & ~BIT_MASK_TABLE1[(i)&7])
+#define READ_BIT1(p,i)    (p[(i)>>3] & BIT_MASK_TABLE1[(i)&7])
+
+// Byte at a time tables, CRC6 is kept left aligned in the top six bits of the byte
+const uint8_t  CRC6_TABLE[] = {
+	0x00U, 0x9CU, 0xA4U, 0x38U, 0xD4U, 0x48U, 0x70U, 0xECU, 0x34U, 0xA8U, 0x90U, 0x0CU,
+	0xE0U, 0x7CU, 0x44U, 0xD8U, 0x68U, 0xF4U, 0xCCU, 0x50U, 0xBCU, 0x20U, 0x18U, 0x84U,
+	0x5CU, 0xC0U, 0xF8U, 0x64U, 0x88U, 0x14U, 0x2CU, 0xB0U, 0xD0U, 0x4CU, 0x74U, 0xE8U,
+	0x04U, 0x98U, 0xA0U, 0x3CU, 0xE4U, 0x78U, 0x40U, 0xDCU, 0x30U, 0xACU, 0x94U, 0x08U,
+	0xB8U, 0x24U, 0x1CU, 0x80U, 0x6CU, 0xF0U, 0xC8U, 0x54U, 0x8CU, 0x10U, 0x28U, 0xB4U,
+	0x58U, 0xC4U, 0xFCU, 0x60U, 0x3CU, 0xA0U, 0x98U, 0x04U, 0xE8U, 0x74U, 0x4CU, 0xD0U,
+	0x08U, 0x94U, 0xACU, 0x30U, 0xDCU, 0x40U, 0x78U, 0xE4U, 0x54U, 0xC8U, 0xF0U, 0x6CU,
+	0x80U, 0x1CU, 0x24U, 0xB8U, 0x60U, 0xFCU, 0xC4U, 0x58U, 0xB4U, 0x28U, 0x10U, 0x8CU,
+	0xECU, 0x70U, 0x48U, 0xD4U, 0x38U, 0xA4U, 0x9CU, 0x00U, 0xD8U, 0x44U, 0x7CU, 0xE0U,
+	0x0CU, 0x90U, 0xA8U, 0x34U, 0x84U, 0x18U, 0x20U, 0xBCU, 0x50U, 0xCCU, 0xF4U, 0x68U,
+	0xB0U, 0x2CU, 0x14U, 0x88U, 0x64U, 0xF8U, 0xC0U, 0x5CU, 0x78U, 0xE4U, 0xDCU, 0x40U,
+	0xACU, 0x30U, 0x08U, 0x94U, 0x4CU, 0xD0U, 0xE8U, 0x74U, 0x98U, 0x04U, 0x3CU, 0xA0U,
+	0x10U, 0x8CU, 0xB4U, 0x28U, 0xC4U, 0x58U, 0x60U, 0xFCU, 0x24U, 0xB8U, 0x80U, 0x1CU,
+	0xF0U, 0x6CU, 0x54U, 0xC8U, 0xA8U, 0x34U, 0x0CU, 0x90U, 0x7CU, 0xE0U, 0xD8U, 0x44U,
+	0x9CU, 0x00U, 0x38U, 0xA4U, 0x48U, 0xD4U, 0xECU, 0x70U, 0xC0U, 0x5CU, 0x64U, 0xF8U,
+	0x14U, 0x88U, 0xB0U, 0x2CU, 0xF4U, 0x68U, 0x50U, 0xCCU, 0x20U, 0xBCU, 0x84U, 0x18U,
+	0x44U, 0xD8U, 0xE0U, 0x7CU, 0x90U, 0x0CU, 0x34U, 0xA8U, 0x70U, 0xECU, 0xD4U, 0x48U,
+	0xA4U, 0x38U, 0x00U, 0x9CU, 0x2CU, 0xB0U, 0x88U, 0x14U, 0xF8U, 0x64U, 0x5CU, 0xC0U,
+	0x18U, 0x84U, 0xBCU, 0x20U, 0xCCU, 0x50U, 0x68U, 0xF4U, 0x94U, 0x08U, 0x30U, 0xACU,
+	0x40U, 0xDCU, 0xE4U, 0x78U, 0xA0U, 0x3CU, 0x04U, 0x98U, 0x74U, 0xE8U, 0xD0U, 0x4CU,
+	0xFCU, 0x60U, 0x58U, 0xC4U, 0x28U, 0xB4U, 0x8CU, 0x10U, 0xC8U, 0x54U, 0x6CU, 0xF0U,
+	0x1CU, 0x80U, 0xB8U, 0x24U };
+
+const uint16_t CRC12_TABLE[] = {
+	0x0000U, 0x080FU, 0x0811U, 0x001EU, 0x082DU, 0x0022U, 0x003CU, 0x0833U,
+	0x0855U, 0x005AU, 0x0044U, 0x084BU, 0x0078U, 0x0877U, 0x0869U, 0x0066U,
+	0x08A5U, 0x00AAU, 0x00B4U, 0x08BBU, 0x0088U, 0x0887U, 0x0899U, 0x0096U,
+	0x00F0U, 0x08FFU, 0x08E1U, 0x00EEU, 0x08DDU, 0x00D2U, 0x00CCU, 0x08C3U,
+	0x0945U, 0x014AU, 0x0154U, 0x095BU, 0x0168U, 0x0967U, 0x0979U, 0x0176U,
+	0x0110U, 0x091FU, 0x0901U, 0x010EU, 0x093DU, 0x0132U, 0x012CU, 0x0923U,
+	0x01E0U, 0x09EFU, 0x09F1U, 0x01FEU, 0x09CDU, 0x01C2U, 0x01DCU, 0x09D3U,
+	0x09B5U, 0x01BAU, 0x01A4U, 0x09ABU, 0x0198U, 0x0997U, 0x0989U, 0x0186U,
+	0x0A85U, 0x028AU, 0x0294U, 0x0A9BU, 0x02A8U, 0x0AA7U, 0x0AB9U, 0x02B6U,
+	0x02D0U, 0x0ADFU, 0x0AC1U, 0x02CEU, 0x0AFDU, 0x02F2U, 0x02ECU, 0x0AE3U,
+	0x0220U, 0x0A2FU, 0x0A31U, 0x023EU, 0x0A0DU, 0x0202U, 0x021CU, 0x0A13U,
+	0x0A75U, 0x027AU, 0x0264U, 0x0A6BU, 0x0258U, 0x0A57U, 0x0A49U, 0x0246U,
+	0x03C0U, 0x0BCFU, 0x0BD1U, 0x03DEU, 0x0BEDU, 0x03E2U, 0x03FCU, 0x0BF3U,
+	0x0B95U, 0x039AU, 0x0384U, 0x0B8BU, 0x03B8U, 0x0BB7U, 0x0BA9U, 0x03A6U,
+	0x0B65U, 0x036AU, 0x0374U, 0x0B7BU, 0x0348U, 0x0B47U, 0x0B59U, 0x0356U,
+	0x0330U, 0x0B3FU, 0x0B21U, 0x032EU, 0x0B1DU, 0x0312U, 0x030CU, 0x0B03U,
+	0x0D05U, 0x050AU, 0x0514U, 0x0D1BU, 0x0528U, 0x0D27U, 0x0D39U, 0x0536U,
+	0x0550U, 0x0D5FU, 0x0D41U, 0x054EU, 0x0D7DU, 0x0572U, 0x056CU, 0x0D63U,
+	0x05A0U, 0x0DAFU, 0x0DB1U, 0x05BEU, 0x0D8DU, 0x0582U, 0x059CU, 0x0D93U,
+	0x0DF5U, 0x05FAU, 0x05E4U, 0x0DEBU, 0x05D8U, 0x0DD7U, 0x0DC9U, 0x05C6U,
+	0x0440U, 0x0C4FU, 0x0C51U, 0x045EU, 0x0C6DU, 0x0462U, 0x047CU, 0x0C73U,
+	0x0C15U, 0x041AU, 0x0404U, 0x0C0BU, 0x0438U, 0x0C37U, 0x0C29U, 0x0426U,
+	0x0CE5U, 0x04EAU, 0x04F4U, 0x0CFBU, 0x04C8U, 0x0CC7U, 0x0CD9U, 0x04D6U,
+	0x04B0U, 0x0CBFU, 0x0CA1U, 0x04AEU, 0x0C9DU, 0x0492U, 0x048CU, 0x0C83U,
+	0x0780U, 0x0F8FU, 0x0F91U, 0x079EU, 0x0FADU, 0x07A2U, 0x07BCU, 0x0FB3U,
+	0x0FD5U, 0x07DAU, 0x07C4U, 0x0FCBU, 0x07F8U, 0x0FF7U, 0x0FE9U, 0x07E6U,
+	0x0F25U, 0x072AU, 0x0734U, 0x0F3BU, 0x0708U, 0x0F07U, 0x0F19U, 0x0716U,
+	0x0770U, 0x0F7FU, 0x0F61U, 0x076EU, 0x0F5DU, 0x0752U, 0x074CU, 0x0F43U,
+	0x0EC5U, 0x06CAU, 0x06D4U, 0x0EDBU, 0x06E8U, 0x0EE7U, 0x0EF9U, 0x06F6U,
+	0x0690U, 0x0E9FU, 0x0E81U, 0x068EU, 0x0EBDU, 0x06B2U, 0x06ACU, 0x0EA3U,
+	0x0660U, 0x0E6FU, 0x0E71U, 0x067EU, 0x0E4DU, 0x0642U, 0x065CU, 0x0E53U,
+	0x0E35U, 0x063AU, 0x0624U, 0x0E2BU, 0x0618U, 0x0E17U, 0x0E09U, 0x0606U };
+
+const uint16_t CRC15_TABLE[] = {
+	0x0000U, 0x4CC5U, 0x554FU, 0x198AU, 0x665BU, 0x2A9EU, 0x3314U, 0x7FD1U,
+	0x0073U, 0x4CB6U, 0x553CU, 0x19F9U, 0x6628U, 0x2AEDU, 0x3367U, 0x7FA2U,
+	0x00E6U, 0x4C23U, 0x55A9U, 0x196CU, 0x66BDU, 0x2A78U, 0x33F2U, 0x7F37U,
+	0x0095U, 0x4C50U, 0x55DAU, 0x191FU, 0x66CEU, 0x2A0BU, 0x3381U, 0x7F44U,
+	0x01CCU, 0x4D09U, 0x5483U, 0x1846U, 0x6797U, 0x2B52U, 0x32D8U, 0x7E1DU,
+	0x01BFU, 0x4D7AU, 0x54F0U, 0x1835U, 0x67E4U, 0x2B21U, 0x32ABU, 0x7E6EU,
+	0x012AU, 0x4DEFU, 0x5465U, 0x18A0U, 0x6771U, 0x2BB4U, 0x323EU, 0x7EFBU,
+	0x0159U, 0x4D9CU, 0x5416U, 0x18D3U, 0x6702U, 0x2BC7U, 0x324DU, 0x7E88U,
+	0x0398U, 0x4F5DU, 0x56D7U, 0x1A12U, 0x65C3U, 0x2906U, 0x308CU, 0x7C49U,
+	0x03EBU, 0x4F2EU, 0x56A4U, 0x1A61U, 0x65B0U, 0x2975U, 0x30FFU, 0x7C3AU,
+	0x037EU, 0x4FBBU, 0x5631U, 0x1AF4U, 0x6525U, 0x29E0U, 0x306AU, 0x7CAFU,
+	0x030DU, 0x4FC8U, 0x5642U, 0x1A87U, 0x6556U, 0x2993U, 0x3019U, 0x7CDCU,
+	0x0254U, 0x4E91U, 0x571BU, 0x1BDEU, 0x640FU, 0x28CAU, 0x3140U, 0x7D85U,
+	0x0227U, 0x4EE2U, 0x5768U, 0x1BADU, 0x647CU, 0x28B9U, 0x3133U, 0x7DF6U,
+	0x02B2U, 0x4E77U, 0x57FDU, 0x1B38U, 0x64E9U, 0x282CU, 0x31A6U, 0x7D63U,
+	0x02C1U, 0x4E04U, 0x578EU, 0x1B4BU, 0x649AU, 0x285FU, 0x31D5U, 0x7D10U,
+	0x0730U, 0x4BF5U, 0x527FU, 0x1EBAU, 0x616BU, 0x2DAEU, 0x3424U, 0x78E1U,
+	0x0743U, 0x4B86U, 0x520CU, 0x1EC9U, 0x6118U, 0x2DDDU, 0x3457U, 0x7892U,
+	0x07D6U, 0x4B13U, 0x5299U, 0x1E5CU, 0x618DU, 0x2D48U, 0x34C2U, 0x7807U,
+	0x07A5U, 0x4B60U, 0x52EAU, 0x1E2FU, 0x61FEU, 0x2D3BU, 0x34B1U, 0x7874U,
+	0x06FCU, 0x4A39U, 0x53B3U, 0x1F76U, 0x60A7U, 0x2C62U, 0x35E8U, 0x792DU,
+	0x068FU, 0x4A4AU, 0x53C0U, 0x1F05U, 0x60D4U, 0x2C11U, 0x359BU, 0x795EU,
+	0x061AU, 0x4ADFU, 0x5355U, 0x1F90U, 0x6041U, 0x2C84U, 0x350EU, 0x79CBU,
+	0x0669U, 0x4AACU, 0x5326U, 0x1FE3U, 0x6032U, 0x2CF7U, 0x357DU, 0x79B8U,
+	0x04A8U, 0x486DU, 0x51E7U, 0x1D22U, 0x62F3U, 0x2E36U, 0x37BCU, 0x7B79U,
+	0x04DBU, 0x481EU, 0x5194U, 0x1D51U, 0x6280U, 0x2E45U, 0x37CFU, 0x7B0AU,
+	0x044EU, 0x488BU, 0x5101U, 0x1DC4U, 0x6215U, 0x2ED0U, 0x375AU, 0x7B9FU,
+	0x043DU, 0x48F8U, 0x5172U, 0x1DB7U, 0x6266U, 0x2EA3U, 0x3729U, 0x7BECU,
+	0x0564U, 0x49A1U, 0x502BU, 0x1CEEU, 0x633FU, 0x2FFAU, 0x3670U, 0x7AB5U,
+	0x0517U, 0x49D2U, 0x5058U, 0x1C9DU, 0x634CU, 0x2F89U, 0x3603U, 0x7AC6U,
+	0x0582U, 0x4947U, 0x50CDU, 0x1C08U, 0x63D9U, 0x2F1CU, 0x3696U, 0x7A53U,
+	0x05F1U, 0x4934U, 0x50BEU, 0x1C7BU, 0x63AAU, 0x2F6FU, 0x36E5U, 0x7A20U };
+
+bool CNXDNCRC::checkCRC6(const unsigned char* in, unsigned int length)
+{
+	assert(in != NULL);
+
+	uint8_t crc = createCRC6(in, length);
+
+	uint8_t temp[1U];
+	temp[0U] = 0x00U;
+	unsigned int j = length;
+	for (unsigned int i = 2U; i < 8U; i++, j++) {
+		bool b = READ_BIT1(in, j);
+		WRITE_BIT1(temp, i, b);
+	}
+
+	return crc == temp[0U];
+}
+
+void CNXDNCRC::encodeCRC6(unsigned char* in, unsigned int length)
+{
+	assert(in != NULL);
+
+	uint8_t crc[1U];
+	crc[0U] = createCRC6(in, length);
+
+	unsigned int n = length;
+	for (unsigned int i = 2U; i < 8U; i++, n++) {
+		bool b = READ_BIT1(crc, i);
+		WRITE_BIT1(in, n, b);
+	}
+}
+
+bool CNXDNCRC::checkCRC12(const unsigned char* in, unsigned int length)
+{
+	assert(in != NULL);
+
+	uint16_t crc = createCRC12(in, length);
+	uint8_t temp1[2U];
+	temp1[0U] = (crc >> 8) & 0xFFU;
+	temp1[1U] = (crc >> 0) & 0xFFU;
+
+	uint8_t temp2[2U];
+	temp2[0U] = 0x00U;
+	temp2[1U] = 0x00U;
+	unsigned int j = length;
+	for (unsigned int i = 4U; i < 16U; i++, j++) {
+		bool b = READ_BIT1(in, j);
+		WRITE_BIT1(temp2, i, b);
+	}
+
+	return temp1[0U] == temp2[0U] && temp1[1U] == temp2[1U];
+}
+
+void CNXDNCRC::encodeCRC12(unsigned char* in, unsigned int length)
+{
+	assert(in != NULL);
+
+	uint16_t crc = createCRC12(in, length);
+
+	uint8_t temp[2U];
+	temp[0U] = (crc >> 8) & 0xFFU;
+	temp[1U] = (crc >> 0) & 0xFFU;
+
+	unsigned int n = length;
+	for (unsigned int i = 4U; i < 16U; i++, n++) {
+		bool b = READ_BIT1(temp, i);
+		WRITE_BIT1(in, n, b);
+	}
+}
+
+bool CNXDNCRC::checkCRC15(const unsigned char* in, unsigned int length)
+{
+	assert(in != NULL);
+
+	uint16_t crc = createCRC15(in, length);
+	uint8_t temp1[2U];
+	temp1[0U] = (crc >> 8) & 0xFFU;
+	temp1[1U] = (crc >> 0) & 0xFFU;
+
+	uint8_t temp2[2U];
+	temp2[0U] = 0x00U;
+	temp2[1U] = 0x00U;
+	unsigned int j = length;
+	for (unsigned int i = 1U; i < 16U; i++, j++) {
+		bool b = READ_BIT1(in, j);
+		WRITE_BIT1(temp2, i, b);
+	}
+
+	return temp1[0U] == temp2[0U] && temp1[1U] == temp2[1U];
+}
+
+void CNXDNCRC::encodeCRC15(unsigned char* in, unsigned int length)
+{
+	assert(in != NULL);
+
+	uint16_t crc = createCRC15(in, length);
+
+	uint8_t temp[2U];
+	temp[0U] = (crc >> 8) & 0xFFU;
+	temp[1U] = (crc >> 0) & 0xFFU;
+
+	unsigned int n = length;
+	for (unsigned int i = 1U; i < 16U; i++, n++) {
+		bool b = READ_BIT1(temp, i);
+		WRITE_BIT1(in, n, b);
+	}
+}
+
+uint8_t CNXDNCRC::createCRC6(const unsigned char* in, unsigned int length)
+{
+	uint8_t crc = 0x3FU << 2;
+
+	unsigned int n = length / 8U;
+	for (unsigned int i = 0U; i < n; i++)
+		crc = CRC6_TABLE[crc ^ in[i]];
+
+	for (unsigned int i = n * 8U; i < length; i++) {
+		bool bit1 = READ_BIT1(in, i) != 0x00U;
+		bool bit2 = (crc & 0x80U) == 0x80U;
+
+		crc <<= 1;
+
+		if (bit1 ^ bit2)
+			crc ^= 0x27U << 2;
+	}
+
+	return crc >> 2;
+}
+
+uint16_t CNXDNCRC::createCRC12(const unsigned char* in, unsigned int length)
+{
+	uint16_t crc = 0x0FFFU;
+
+	unsigned int n = length / 8U;
+	for (unsigned int i = 0U; i < n; i++)
+		crc = ((crc << 8) ^ CRC12_TABLE[((crc >> 4) ^ in[i]) & 0xFFU]) & 0x0FFFU;
+
+	for (unsigned int i = n * 8U; i < length; i++) {
+		bool bit1 = READ_BIT1(in, i) != 0x00U;
+		bool bit2 = (crc & 0x0800U) == 0x0800U;
+
+		crc <<= 1;
+
+		if (bit1 ^ bit2)
+			crc ^= 0x080FU;
+	}
+
+	return crc & 0x0FFFU;
+}
+
+uint16_t CNXDNCRC::createCRC15(const unsigned char* in, unsigned int length)
+{
+	uint16_t crc = 0x7FFFU;
+
+	unsigned int n = length / 8U;
+	for (unsigned int i = 0U; i < n; i++)
+		crc = ((crc << 8) ^ CRC15_TABLE[((crc >> 7) ^ in[i]) & 0xFFU]) & 0x7FFFU;
+
+	for (unsigned int i = n * 8U; i < length; i++) {
+		bool bit1 = READ_BIT1(in, i) != 0x00U;
+		bool bit2 = (crc & 0x4000U) == 0x4000U;
+
+		crc <<= 1;
+
+		if (bit1 ^ bit2)
+			crc ^= 0x4CC5U;
+	}
+
+	return crc & 0x7FFFU;
+}
@@ -0,0 +1,143 @@
+/*
+ *   Copyright (C) 2016,2017 by Jonathan Naylor G4KLX
+ *   Copyright (C) 2018,2019 by Andy Uribe CA6JAU
+ *   Copyright (C) 2018 by Manuel Sanchez EA7EE
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "NXDNCallTemplate.h"
+#include "NXDNDefines.h"
+#include "NXDNLayer3.h"
+#include "NXDNSACCH.h"
+#include "NXDNLICH.h"
+
+#include <cstdio>
+#include <cassert>
+#include <cstring>
+
+// The SACCH structure and the VCALL bit offset for each superframe position
+const unsigned char VOICE_STRUCTURE[] = {NXDN_SR_1_4, NXDN_SR_2_4, NXDN_SR_3_4, NXDN_SR_4_4};
+const unsigned int  VOICE_OFFSET[]    = {0U, 18U, 36U, 54U};
+
+CNXDNCallTemplate::CNXDNCallTemplate() :
+m_valid(false),
+m_srcId(0U),
+m_dstId(0U)
+{
+}
+
+CNXDNCallTemplate::~CNXDNCallTemplate()
+{
+}
+
+void CNXDNCallTemplate::setCall(unsigned int srcId, unsigned int dstId)
+{
+	if (m_valid && srcId == m_srcId && dstId == m_dstId)
+		return;
+
+	m_srcId = srcId;
+	m_dstId = dstId;
+	m_valid = true;
+
+	build();
+}
+
+void CNXDNCallTemplate::getHeader(unsigned char* frame) const
+{
+	assert(frame != NULL);
+	assert(m_valid);
+
+	::memcpy(frame, m_header, NXDN_CALL_FRAME_LENGTH);
+}
+
+void CNXDNCallTemplate::getTerminator(unsigned char* frame) const
+{
+	assert(frame != NULL);
+	assert(m_valid);
+
+	::memcpy(frame, m_terminator, NXDN_CALL_FRAME_LENGTH);
+}
+
+void CNXDNCallTemplate::getVoice(unsigned char* frame, unsigned int n) const
+{
+	assert(frame != NULL);
+	assert(m_valid);
+
+	::memcpy(frame, m_voice[n % 4U], NXDN_PREFIX_LENGTH);
+}
+
+void CNXDNCallTemplate::build()
+{
+	buildControl(NXDN_MESSAGE_TYPE_VCALL, m_header);
+	buildControl(NXDN_MESSAGE_TYPE_TX_REL, m_terminator);
+
+	CNXDNLICH lich;
+	lich.setRFCT(NXDN_LICH_RFCT_RDCH);
+	lich.setFCT(NXDN_LICH_USC_SACCH_SS);
+	lich.setOption(NXDN_LICH_STEAL_NONE);
+	lich.setDirection(NXDN_LICH_DIRECTION_INBOUND);
+
+	CNXDNLayer3 layer3;
+	layer3.setMessageType(NXDN_MESSAGE_TYPE_VCALL);
+	layer3.setSourceUnitId(m_srcId & 0xFFFF);
+	layer3.setDestinationGroupId(m_dstId & 0xFFFF);
+	layer3.setGroup(true);
+	layer3.setDataBlocks(0U);
+
+	for (unsigned int i = 0U; i < 4U; i++) {
+		unsigned char message[3U];
+		layer3.encode(message, 18U, VOICE_OFFSET[i]);
+
+		CNXDNSACCH sacch;
+		sacch.setStructure(VOICE_STRUCTURE[i]);
+		sacch.setData(message);
+		sacch.setRAN(0x01);
+
+		m_voice[i][0U] = lich.getRaw();
+		sacch.getRaw(m_voice[i] + 1U);
+	}
+}
+
+void CNXDNCallTemplate::buildControl(unsigned char messageType, unsigned char* frame) const
+{
+	assert(frame != NULL);
+
+	CNXDNLICH lich;
+	lich.setRFCT(NXDN_LICH_RFCT_RDCH);
+	lich.setFCT(NXDN_LICH_USC_SACCH_NS);
+	lich.setOption(NXDN_LICH_STEAL_FACCH);
+	lich.setDirection(NXDN_LICH_DIRECTION_INBOUND);
+	frame[0U] = lich.getRaw();
+
+	CNXDNSACCH sacch;
+	sacch.setRAN(0x01);
+	sacch.setStructure(NXDN_SR_SINGLE);
+	sacch.setData(SACCH_IDLE);
+	sacch.getRaw(frame + 1U);
+
+	unsigned char layer3data[25U];
+	CNXDNLayer3 layer3;
+	layer3.setMessageType(messageType);
+	layer3.setSourceUnitId(m_srcId & 0xFFFF);
+	layer3.setDestinationGroupId(m_dstId & 0xFFFF);
+	layer3.setGroup(true);
+	layer3.setDataBlocks(0U);
+	layer3.getData(layer3data);
+
+	::memcpy(frame + 5U, layer3data, 14U);
+	::memcpy(frame + 5U + 14U, layer3data, 14U);
+}
@@ -0,0 +1,58 @@
+/*
+ *   Copyright (C) 2016,2017 by Jonathan Naylor G4KLX
+ *   Copyright (C) 2018,2019 by Andy Uribe CA6JAU
+ *   Copyright (C) 2018 by Manuel Sanchez EA7EE
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(NXDNCallTemplate_H)
+#define	NXDNCallTemplate_H
+
+// LICH and SACCH at the start of every frame, and the whole header or terminator
+const unsigned int NXDN_PREFIX_LENGTH     = 5U;
+const unsigned int NXDN_CALL_FRAME_LENGTH = 33U;
+
+// The parts of the outgoing NXDN frames that stay the same for a whole group call:
+// the voice call header, the TX release terminator and the LICH and SACCH for each
+// of the four superframe positions, which carry a quarter of the VCALL message.
+class CNXDNCallTemplate {
+public:
+	CNXDNCallTemplate();
+	~CNXDNCallTemplate();
+
+	// Rebuilds the frames only when the source or destination has changed
+	void setCall(unsigned int srcId, unsigned int dstId);
+
+	void getHeader(unsigned char* frame) const;
+	void getTerminator(unsigned char* frame) const;
+
+	// The prefix for the voice frame at position n of the call
+	void getVoice(unsigned char* frame, unsigned int n) const;
+
+private:
+	bool          m_valid;
+	unsigned int  m_srcId;
+	unsigned int  m_dstId;
+	unsigned char m_header[NXDN_CALL_FRAME_LENGTH];
+	unsigned char m_terminator[NXDN_CALL_FRAME_LENGTH];
+	unsigned char m_voice[4U][NXDN_PREFIX_LENGTH];
+
+	void build();
+	void buildControl(unsigned char messageType, unsigned char* frame) const;
+};
+
+#endif
@@ -28,22 +28,17 @@ const unsigned char BIT_MASK_TABLE[] = {0x80U, 0x40U, 0x20U, 0x10U, 0x08U, 0x04U
 #define WRITE_BIT1(p,i,b) p[(i)>>3] = (b) ? (p[(i)>>3] | BIT_MASK_TABLE[(i)&7]) : (p[(i)>>3] & ~BIT_MASK_TABLE[(i)&7])
 #define READ_BIT1(p,i)    (p[(i)>>3] & BIT_MASK_TABLE[(i)&7])
 
-CNXDNLICH::CNXDNLICH(const CNXDNLICH& lich) :
-m_lich(NULL)
+CNXDNLICH::CNXDNLICH(const CNXDNLICH& lich)
 {
-	m_lich = new unsigned char[1U];
 	m_lich[0U] = lich.m_lich[0U];
 }
 
-CNXDNLICH::CNXDNLICH() :
-m_lich(NULL)
+CNXDNLICH::CNXDNLICH()
 {
-	m_lich = new unsigned char[1U];
 }
 
 CNXDNLICH::~CNXDNLICH()
 {
-	delete[] m_lich;
 }
 
 bool CNXDNLICH::decode(const unsigned char* bytes)
@@ -104,13 +99,12 @@ unsigned char CNXDNLICH::getDirection() const
 
 unsigned char CNXDNLICH::getRaw() const
 {
+	// The parity bit is recomputed by every encode, so it does not need storing here
 	bool parity = getParity();
 	if (parity)
-		m_lich[0U] |= 0x01U;
+		return m_lich[0U] | 0x01U;
 	else
-		m_lich[0U] &= 0xFEU;
-
-	return m_lich[0U];
+		return m_lich[0U] & 0xFEU;
 }
 
 void CNXDNLICH::setRFCT(unsigned char rfct)
@@ -44,7 +44,7 @@ public:
 	CNXDNLICH& operator=(const CNXDNLICH& lich);
 
 private:
-	unsigned char* m_lich;
+	unsigned char m_lich[1U];
 
 	bool getParity() const;
 };
@@ -28,23 +28,18 @@ const unsigned char BIT_MASK_TABLE[] = { 0x80U, 0x40U, 0x20U, 0x10U, 0x08U, 0x04
 #define WRITE_BIT1(p,i,b) p[(i)>>3] = (b) ? (p[(i)>>3] | BIT_MASK_TABLE[(i)&7]) : (p[(i)>>3] & ~BIT_MASK_TABLE[(i)&7])
 #define READ_BIT1(p,i)    (p[(i)>>3] & BIT_MASK_TABLE[(i)&7])
 
-CNXDNLayer3::CNXDNLayer3(const CNXDNLayer3& layer3) :
-m_data(NULL)
+CNXDNLayer3::CNXDNLayer3(const CNXDNLayer3& layer3)
 {
-	m_data = new unsigned char[22U];
 	::memcpy(m_data, layer3.m_data, 22U);
 }
 
-CNXDNLayer3::CNXDNLayer3() :
-m_data(NULL)
+CNXDNLayer3::CNXDNLayer3()
 {
-	m_data = new unsigned char[22U];
 	::memset(m_data, 0x00U, 22U);
 }
 
 CNXDNLayer3::~CNXDNLayer3()
 {
-	delete[] m_data;
 }
 
 void CNXDNLayer3::decode(const unsigned char* bytes, unsigned int length, unsigned int offset)
@@ -48,7 +48,7 @@ public:
 	CNXDNLayer3& operator=(const CNXDNLayer3& layer3);
 
 private:
-	unsigned char* m_data;
+	unsigned char m_data[22U];
 };
 
 #endif
@@ -17,7 +17,6 @@
 */
 
 #include "NXDNLookup.h"
-#include "Timer.h"
 #include "Log.h"
 
 #include <cstdio>
@@ -26,13 +25,10 @@
 #include <cctype>
 
 CNXDNLookup::CNXDNLookup(const std::string& filename, unsigned int reloadTime) :
-CThread(),
+CReloader("NXDN Id lookup", 60U * reloadTime),
 m_filename(filename),
-m_reloadTime(reloadTime),
 m_table(),
-m_cstable(),
-m_mutex(),
-m_stop(false)
+m_generation(0U)
 {
 }
 
@@ -40,96 +36,44 @@ CNXDNLookup::~CNXDNLookup()
 {
 }
 
-bool CNXDNLookup::read()
-{
-	bool ret = load();
-
-	if (m_reloadTime > 0U)
-		run();
-
-	return ret;
-}
-
-void CNXDNLookup::entry()
-{
-	LogInfo("Started the NXDN Id lookup reload thread");
-
-	CTimer timer(1U, 3600U * m_reloadTime);
-	timer.start();
-
-	while (!m_stop) {
-		sleep(1000U);
-
-		timer.clock();
-		if (timer.hasExpired()) {
-			load();
-			timer.start();
-		}
-	}
-
-	LogInfo("Stopped the NXDN Id lookup reload thread");
-}
-
-void CNXDNLookup::stop()
-{
-	if (m_reloadTime == 0U) {
-		delete this;
-		return;
-	}
-
-	m_stop = true;
-
-	wait();
-}
-
 std::string CNXDNLookup::findCS(unsigned int id)
 {
-	std::string callsign;
-
 	if (id == 0xFFFFU)
 		return std::string("ALL");
 
-	m_mutex.lock();
+	std::shared_ptr<const CNXDNLookupTable> table = m_table.get();
 
-	try {
-		callsign = m_table.at(id);
-	} catch (...) {
-		char text[10U];
-		::sprintf(text, "%u", id);
-		callsign = std::string(text);
-	}
+	std::unordered_map<unsigned int, std::string>::const_iterator it = table->m_callsigns.find(id);
+	if (it != table->m_callsigns.end())
+		return it->second;
 
-	m_mutex.unlock();
+	char text[10U];
+	::sprintf(text, "%u", id);
 
-	return callsign;
+	return std::string(text);
 }
 
 unsigned int CNXDNLookup::findID(std::string cs)
 {
-	unsigned int nxdnID;
-
-	m_mutex.lock();
-
-	try {
-		nxdnID = m_cstable.at(cs);
-	} catch (...) {
-		nxdnID = 0U;
-	}
+	std::shared_ptr<const CNXDNLookupTable> table = m_table.get();
 
-	m_mutex.unlock();
+	std::unordered_map<std::string, unsigned int>::const_iterator it = table->m_ids.find(cs);
+	if (it == table->m_ids.end())
+		return 0U;
 
-	return nxdnID;
+	return it->second;
 }
 
 bool CNXDNLookup::exists(unsigned int id)
 {
-	m_mutex.lock();
-
-	bool found = m_table.count(id) == 1U;
+	std::shared_ptr<const CNXDNLookupTable> table = m_table.get();
 
-	m_mutex.unlock();
+	return table->m_callsigns.count(id) == 1U;
+}
 
-	return found;
+unsigned int CNXDNLookup::getGeneration() const
+{
+	return m_generation;
 }
 
 bool CNXDNLookup::load()
@@ -140,11 +84,7 @@ bool CNXDNLookup::load()
 		return false;
 	}
 
-	m_mutex.lock();
-
-	// Remove the old entries
-	m_table.clear();
-	m_cstable.clear();
+	std::shared_ptr<CNXDNLookupTable> table(new CNXDNLookupTable);
 
 	char buffer[100U];
 	while (::fgets(buffer, 100U, fp) != NULL) {
@@ -160,21 +100,22 @@ bool CNXDNLookup::load()
 				for (char* p = p2; *p != 0x00U; p++)
 					*p = ::toupper(*p);
 
-				m_table[id] = std::string(p2);
-				m_cstable[p2] = id;
+				table->m_callsigns[id] = std::string(p2);
+				table->m_ids[p2] = id;
 			}
 		}
 	}
 
-	m_mutex.unlock();
-
 	::fclose(fp);
 
-	size_t size = m_table.size();
+	m_table.set(table);
+	m_generation++;
+
+	size_t size = table->m_callsigns.size();
 	if (size == 0U)
 		return false;
 
 	LogInfo("Loaded %u Ids to the NXDN callsign lookup table", size);
 
 	return true;
-}
\ No newline at end of file
+}
@@ -19,37 +19,48 @@
 #ifndef	NXDNLookup_H
 #define	NXDNLookup_H
 
-#include "Thread.h"
-#include "Mutex.h"
+#include "Reloader.h"
+#include "Snapshot.h"
 
 #include <string>
 #include <unordered_map>
+#include <atomic>
 
-class CNXDNLookup : public CThread {
+// One load of the NXDN Id file, never changed once published
+class CNXDNLookupTable {
 public:
-	CNXDNLookup(const std::string& filename, unsigned int reloadTime);
-	virtual ~CNXDNLookup();
+	CNXDNLookupTable() :
+	m_callsigns(),
+	m_ids()
+	{
+	}
 
-	bool read();
+	std::unordered_map<unsigned int, std::string> m_callsigns;
+	std::unordered_map<std::string, unsigned int> m_ids;
+};
 
-	virtual void entry();
+// The reload time is in hours, the file is parsed on the side and the lookups keep using the
+// table they have until the new one is published
+class CNXDNLookup : public CReloader {
+public:
+	CNXDNLookup(const std::string& filename, unsigned int reloadTime);
+	virtual ~CNXDNLookup();
 
 	std::string findCS(unsigned int id);
 	unsigned int findID(std::string cs);
 
 	bool exists(unsigned int id);
 
-	void stop();
+	// Changes every time the file is loaded again
+	unsigned int getGeneration() const;
+
+protected:
+	virtual bool load();
 
 private:
-	std::string                                   m_filename;
-	unsigned int                                  m_reloadTime;
-	std::unordered_map<unsigned int, std::string> m_table;
-	std::unordered_map<std::string, unsigned int> m_cstable;
-	CMutex                                        m_mutex;
-	bool                                          m_stop;
-
-	bool load();
+	std::string                 m_filename;
+	CSnapshot<CNXDNLookupTable> m_table;
+	std::atomic<unsigned int>   m_generation;
 };
 
 #endif
@@ -31,7 +31,7 @@ CNXDNNetwork::CNXDNNetwork(const std::string& address, unsigned int port, const
 m_socket(address, port),
 m_callsign(callsign),
 m_debug(debug),
-m_address(),
+m_address(NULL),
 m_port(0U)
 {
 	m_callsign.resize(10U, ' ');
@@ -48,16 +48,16 @@ bool CNXDNNetwork::open()
 	return m_socket.open();
 }
 
-void CNXDNNetwork::setDestination(const in_addr& address, unsigned int port)
+void CNXDNNetwork::setDestination(const std::string& address, unsigned int port)
 {
-	m_address = address;
+	m_address = CResolver::find(address);
 	m_port    = port;
 }
 
 void CNXDNNetwork::clearDestination()
 {
-	m_address.s_addr = INADDR_NONE;
-	m_port           = 0U;
+	m_address = NULL;
+	m_port    = 0U;
 }
 
 bool CNXDNNetwork::write(const unsigned char* data, unsigned int length)
@@ -65,16 +65,22 @@ bool CNXDNNetwork::write(const unsigned char* data, unsigned int length)
 	assert(data != NULL);
 	assert(length > 0U);
 
+	if (m_port == 0U)
+		return true;
+
 	if (m_debug)
 		CUtils::dump(1U, "NXDN Network Data Sent", data, length);
 
-	return m_socket.write(data, length, m_address, m_port);
+	return m_socket.write(data, length, m_address->getAddress(), m_port);
 }
 
 bool CNXDNNetwork::write(const unsigned char* data, unsigned short srcId, unsigned short dstId, bool grp)
 {
 	assert(data != NULL);
 
+	if (m_port == 0U)
+		return true;
+
 	unsigned char buffer[50U];
 
 	buffer[0U] = 'N';
@@ -102,7 +108,7 @@ bool CNXDNNetwork::write(const unsigned char* data, unsigned short srcId, unsign
 	if (m_debug)
 		CUtils::dump(1U, "NXDN Network Data Sent", buffer, 43U);
 
-	return m_socket.write(buffer, 43U, m_address, m_port);
+	return m_socket.write(buffer, 43U, m_address->getAddress(), m_port);
 }
 
 unsigned int CNXDNNetwork::read(unsigned char* data)
@@ -131,6 +137,9 @@ unsigned int CNXDNNetwork::read(unsigned char* data)
 
 bool CNXDNNetwork::writePoll(unsigned short tg)
 {
+	if (m_port == 0U)
+		return true;
+
 	unsigned char data[20U];
 
 	data[0U] = 'N';
@@ -148,11 +157,14 @@ bool CNXDNNetwork::writePoll(unsigned short tg)
 	if (m_debug)
 		CUtils::dump(1U, "NXDN Network Poll Sent", data, 17U);
 
-	return m_socket.write(data, 17U, m_address, m_port);
+	return m_socket.write(data, 17U, m_address->getAddress(), m_port);
 }
 
 bool CNXDNNetwork::writeUnlink(unsigned short tg)
 {
+	if (m_port == 0U)
+		return true;
+
 	unsigned char data[20U];
 
 	data[0U] = 'N';
@@ -170,7 +182,7 @@ bool CNXDNNetwork::writeUnlink(unsigned short tg)
 	if (m_debug)
 		CUtils::dump(1U, "NXDN Network Unlink Sent", data, 17U);
 
-	return m_socket.write(data, 17U, m_address, m_port);
+	return m_socket.write(data, 17U, m_address->getAddress(), m_port);
 }
 
 void CNXDNNetwork::close()
@@ -22,6 +22,7 @@
 
 #include "NXDNDefines.h"
 #include "UDPSocket.h"
+#include "Resolver.h"
 
 #include <cstdint>
 #include <string>
@@ -33,7 +34,7 @@ public:
 
 	bool open();
 
-	void setDestination(const in_addr& address, unsigned int port);
+	void setDestination(const std::string& address, unsigned int port);
 	void clearDestination();
 
 	bool write(const unsigned char* data, unsigned int length);
@@ -50,7 +51,7 @@ private:
 	CUDPSocket      m_socket;
 	std::string     m_callsign;
 	bool            m_debug;
-	in_addr         m_address;
+	CResolvedHost*  m_address;
 	unsigned int    m_port;
 };
 
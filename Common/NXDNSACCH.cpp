@@ -41,22 +41,17 @@ const unsigned char BIT_MASK_TABLE[] = { 0x80U, 0x40U, 0x20U, 0x10U, 0x08U, 0x04
 #define WRITE_BIT1(p,i,b) p[(i)>>3] = (b) ? (p[(i)>>3] | BIT_MASK_TABLE[(i)&7]) : (p[(i)>>3] & ~BIT_MASK_TABLE[(i)&7])
 #define READ_BIT1(p,i)    (p[(i)>>3] & BIT_MASK_TABLE[(i)&7])
 
-CNXDNSACCH::CNXDNSACCH(const CNXDNSACCH& sacch) :
-m_data(NULL)
+CNXDNSACCH::CNXDNSACCH(const CNXDNSACCH& sacch)
 {
-	m_data = new unsigned char[5U];
 	::memcpy(m_data, sacch.m_data, 5U);
 }
 
-CNXDNSACCH::CNXDNSACCH() :
-m_data(NULL)
+CNXDNSACCH::CNXDNSACCH()
 {
-	m_data = new unsigned char[5U];
 }
 
 CNXDNSACCH::~CNXDNSACCH()
 {
-	delete[] m_data;
 }
 
 bool CNXDNSACCH::decode(const unsigned char* data)
@@ -44,7 +44,7 @@ public:
 	CNXDNSACCH& operator=(const CNXDNSACCH& sacch);
 
 private:
-	unsigned char* m_data;
+	unsigned char m_data[5U];
 };
 
 #endif
@@ -0,0 +1,191 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "RealTime.h"
+#include "Log.h"
+
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+
+#if defined(__linux__)
+#include <sys/resource.h>
+#include <sys/mman.h>
+#include <pthread.h>
+#include <sched.h>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+#endif
+
+// Touched once so the first deep call on the frame path does not fault
+const unsigned int PREFAULT_STACK_SIZE = 256U * 1024U;
+
+// Every thread stack is locked whole, so they are kept far below the usual 8 MB
+const unsigned int THREAD_STACK_SIZE   = 512U * 1024U;
+
+unsigned int CRealTime::s_priority = 0U;
+bool         CRealTime::s_locked   = false;
+
+#if defined(__linux__)
+
+static void prefaultStack()
+{
+	volatile unsigned char stack[PREFAULT_STACK_SIZE];
+
+	for (unsigned int i = 0U; i < PREFAULT_STACK_SIZE; i += 4096U)
+		stack[i] = 0U;
+
+	// The volatile read keeps the writes, and the compiler quiet about them
+	(void)stack[0U];
+}
+
+bool CRealTime::prepare(unsigned int priority)
+{
+	if (priority == 0U)
+		return true;
+
+	int max = ::sched_get_priority_max(SCHED_FIFO);
+	if (max > 0 && priority > (unsigned int)max)
+		priority = max;
+
+	bool ret = true;
+
+	// Lets the threads raise themselves to SCHED_FIFO after root has been given up
+	struct rlimit limit;
+	::getrlimit(RLIMIT_RTPRIO, &limit);
+	if (limit.rlim_max != RLIM_INFINITY && limit.rlim_max < priority)
+		limit.rlim_max = priority;
+	limit.rlim_cur = priority;
+	if (::setrlimit(RLIMIT_RTPRIO, &limit) != 0) {
+		::fprintf(stderr, "Could not allow real-time priority %u: %s\n", priority, ::strerror(errno));
+		ret = false;
+	}
+
+	// Without this the locked memory stops growing once root is given up, and new threads fail
+	limit.rlim_cur = RLIM_INFINITY;
+	limit.rlim_max = RLIM_INFINITY;
+	bool unlimited = ::setrlimit(RLIMIT_MEMLOCK, &limit) == 0;
+	if (!unlimited) {
+		::fprintf(stderr, "Could not lift the locked memory limit: %s\n", ::strerror(errno));
+		ret = false;
+	}
+
+#if defined(__GLIBC__)
+	// Freed memory stays in the heap, so the next allocation does not fault it in again
+	::mallopt(M_TRIM_THRESHOLD, -1);
+	::mallopt(M_MMAP_MAX, 0);
+
+	pthread_attr_t attr;
+	::pthread_attr_init(&attr);
+	::pthread_attr_setstacksize(&attr, THREAD_STACK_SIZE);
+	::pthread_setattr_default_np(&attr);
+	::pthread_attr_destroy(&attr);
+#endif
+
+	if (unlimited && ::mlockall(MCL_CURRENT | MCL_FUTURE) == 0) {
+		s_locked = true;
+	} else if (unlimited) {
+		::fprintf(stderr, "Could not lock the memory: %s\n", ::strerror(errno));
+		ret = false;
+	}
+
+	prefaultStack();
+
+	s_priority = priority;
+
+	return ret;
+}
+
+bool CRealTime::enter(const char* name)
+{
+	if (s_priority == 0U)
+		return false;
+
+	struct sched_param param;
+	::memset(&param, 0x00U, sizeof(struct sched_param));
+	param.sched_priority = s_priority;
+
+	int err = ::pthread_setschedparam(::pthread_self(), SCHED_FIFO, &param);
+	if (err != 0) {
+		LogWarning("Real-time, unable to run the %s thread at SCHED_FIFO priority %u: %s", name, s_priority, ::strerror(err));
+		return false;
+	}
+
+	LogMessage("Real-time, %s thread running at SCHED_FIFO priority %u%s", name, s_priority, s_locked ? " with the memory locked" : "");
+
+	return true;
+}
+
+#else
+
+bool CRealTime::prepare(unsigned int priority)
+{
+	if (priority == 0U)
+		return true;
+
+	::fprintf(stderr, "Real-time mode is only available on Linux\n");
+
+	return false;
+}
+
+bool CRealTime::enter(const char*)
+{
+	return false;
+}
+
+#endif
+
+bool CRealTime::isEnabled()
+{
+	return s_priority > 0U;
+}
+
+CLoopWatchdog::CLoopWatchdog(const std::string& name, unsigned int budget) :
+m_name(name),
+m_budget(budget),
+m_passes(0ULL),
+m_overruns(0U),
+m_worst(0U)
+{
+}
+
+CLoopWatchdog::~CLoopWatchdog()
+{
+}
+
+void CLoopWatchdog::clock(unsigned int ms)
+{
+	m_passes++;
+
+	if (ms > m_worst)
+		m_worst = ms;
+
+	if (ms > m_budget)
+		m_overruns++;
+}
+
+unsigned int CLoopWatchdog::getOverruns() const
+{
+	return m_overruns;
+}
+
+void CLoopWatchdog::report() const
+{
+	LogMessage("%s, %llu loop passes, %u longer than %u ms, worst %u ms", m_name.c_str(), m_passes, m_overruns, m_budget, m_worst);
+}
@@ -0,0 +1,65 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(REALTIME_H)
+#define	REALTIME_H
+
+#include <string>
+
+// Opt-in real-time operation. prepare() is called while the process can
+// still raise its own limits, before it gives up root, and enter() by each
+// thread on the frame path once everything else has been started.
+class CRealTime
+{
+public:
+	// Locks the memory and allows SCHED_FIFO up to the priority, 0 leaves everything alone
+	static bool prepare(unsigned int priority);
+
+	// Moves the calling thread to SCHED_FIFO, false when real-time mode is off or refused
+	static bool enter(const char* name);
+
+	static bool isEnabled();
+
+private:
+	static unsigned int s_priority;
+	static bool         s_locked;
+};
+
+// Counts the passes of a loop that took longer than the frame period it has to keep up with
+class CLoopWatchdog
+{
+public:
+	CLoopWatchdog(const std::string& name, unsigned int budget);
+	~CLoopWatchdog();
+
+	// Called once per pass with the ms since the previous one
+	void clock(unsigned int ms);
+
+	unsigned int getOverruns() const;
+
+	void report() const;
+
+private:
+	std::string        m_name;
+	unsigned int       m_budget;
+	unsigned long long m_passes;
+	unsigned int       m_overruns;
+	unsigned int       m_worst;
+};
+
+#endif
@@ -0,0 +1,93 @@
+/*
+*   Copyright (C) 2016,2017 by Jonathan Naylor G4KLX
+*
+*   This program is free software; you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation; either version 2 of the License, or
+*   (at your option) any later version.
+*
+*   This program is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program; if not, write to the Free Software
+*   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+*/
+
+#include "Reflectors.h"
+#include "Log.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+CReflectors::CReflectors(const std::string& hostsFile, unsigned int reloadTime) :
+CReloader("XLX reflector", reloadTime),
+m_hostsFile(hostsFile),
+m_table()
+{
+}
+
+CReflectors::~CReflectors()
+{
+}
+
+bool CReflectors::load()
+{
+	FILE* fp = ::fopen(m_hostsFile.c_str(), "rt");
+	if (fp == NULL) {
+		// Only the XLX setups have a hosts file
+		if (!m_hostsFile.empty())
+			LogWarning("Cannot open the XLX reflector file - %s", m_hostsFile.c_str());
+		return false;
+	}
+
+	std::shared_ptr<CReflectorTable> table(new CReflectorTable);
+
+	char buffer[100U];
+	while (::fgets(buffer, 100U, fp) != NULL) {
+		if (buffer[0U] == '#')
+			continue;
+
+		char* p1 = ::strtok(buffer, ";\r\n");
+		char* p2 = ::strtok(NULL, ";\r\n");
+		char* p3 = ::strtok(NULL, "\r\n");
+
+		if (p1 != NULL && p2 != NULL && p3 != NULL) {
+			CReflector refl;
+			refl.m_id       = (unsigned int)::atoi(p1);
+			refl.m_address  = std::string(p2);
+			refl.m_startup  = (unsigned int)::atoi(p3);
+
+			// The first entry of an id wins, as with the old linear search
+			table->m_index.insert(std::make_pair(refl.m_id, (unsigned int)table->m_reflectors.size()));
+			table->m_reflectors.push_back(refl);
+		}
+	}
+
+	::fclose(fp);
+
+	size_t size = table->m_reflectors.size();
+	LogInfo("Loaded %u XLX reflectors", size);
+
+	m_table.set(table);
+
+	return size > 0U;
+}
+
+bool CReflectors::find(unsigned int id, CReflector& reflector)
+{
+	std::shared_ptr<const CReflectorTable> table = m_table.get();
+
+	std::unordered_map<unsigned int, unsigned int>::const_iterator it = table->m_index.find(id);
+	if (it == table->m_index.end()) {
+		LogMessage("Trying to find non existent XLX reflector with an id of %u", id);
+		return false;
+	}
+
+	reflector = table->m_reflectors.at(it->second);
+
+	return true;
+}
@@ -19,8 +19,10 @@
 #if !defined(Reflectors_H)
 #define	Reflectors_H
 
-#include "Timer.h"
+#include "Reloader.h"
+#include "Snapshot.h"
 
+#include <unordered_map>
 #include <vector>
 #include <string>
 
@@ -38,21 +40,32 @@ public:
 	unsigned int m_startup;
 };
 
-class CReflectors {
+// One load of the hosts file, never changed once published
+class CReflectorTable {
 public:
-	CReflectors(const std::string& hostsFile, unsigned int reloadTime);
-	~CReflectors();
+	CReflectorTable() :
+	m_reflectors(),
+	m_index()
+	{
+	}
 
-	bool load();
+	std::vector<CReflector>                        m_reflectors;
+	std::unordered_map<unsigned int, unsigned int> m_index;
+};
+
+class CReflectors : public CReloader {
+public:
+	CReflectors(const std::string& hostsFile, unsigned int reloadTime);
+	virtual ~CReflectors();
 
-	CReflector* find(unsigned int id);
+	bool find(unsigned int id, CReflector& reflector);
 
-    void clock(unsigned int ms);
+protected:
+	virtual bool load();
 
 private:
-	std::string              m_hostsFile;
-	std::vector<CReflector*> m_reflectors;
-    CTimer                   m_timer;
+	std::string                m_hostsFile;
+	CSnapshot<CReflectorTable> m_table;
 };
 
 #endif
@@ -0,0 +1,126 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "Reloader.h"
+#include "Timer.h"
+#include "Log.h"
+
+CReloader::CReloader(const std::string& name, unsigned int reloadTime) :
+CThread(),
+m_name(name),
+m_reloadTime(reloadTime),
+m_started(false),
+m_loaded(false),
+m_reload(false),
+m_stop(false)
+{
+}
+
+CReloader::~CReloader()
+{
+}
+
+bool CReloader::read()
+{
+	bool ret = load();
+	m_loaded = true;
+
+	if (m_reloadTime > 0U)
+		m_started = run();
+
+	return ret;
+}
+
+void CReloader::start()
+{
+	m_started = run();
+
+	// Without a thread it has to be loaded here after all
+	if (!m_started) {
+		load();
+		m_loaded = true;
+	}
+}
+
+bool CReloader::isLoaded() const
+{
+	return m_loaded;
+}
+
+void CReloader::entry()
+{
+	LogInfo("Started the %s reload thread", m_name.c_str());
+
+	if (!m_loaded) {
+		load();
+		m_loaded = true;
+	}
+
+	unsigned int reloadTime = m_reloadTime;
+
+	// Without a reload time the thread only answers reload()
+	CTimer timer(1U, 60U * reloadTime);
+	timer.start();
+
+	while (!m_stop) {
+		sleep(1000U);
+
+		// A reload of the configuration may have changed the interval
+		if (m_reloadTime != reloadTime) {
+			reloadTime = m_reloadTime;
+			timer.start(60U * reloadTime);
+		}
+
+		timer.clock();
+		if (m_reload || timer.hasExpired()) {
+			m_reload = false;
+			load();
+			timer.start();
+		}
+	}
+
+	LogInfo("Stopped the %s reload thread", m_name.c_str());
+}
+
+void CReloader::reload()
+{
+	if (m_started)
+		m_reload = true;
+	else
+		load();
+}
+
+void CReloader::setReloadTime(unsigned int reloadTime)
+{
+	m_reloadTime = reloadTime;
+
+	if (reloadTime > 0U && !m_started)
+		m_started = run();
+}
+
+void CReloader::stop()
+{
+	if (!m_started)
+		return;
+
+	m_stop = true;
+
+	wait();
+
+	m_started = false;
+}
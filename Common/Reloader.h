@@ -0,0 +1,66 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(RELOADER_H)
+#define	RELOADER_H
+
+#include "Thread.h"
+
+#include <string>
+#include <atomic>
+
+// A table read from a file at startup and then reloaded on a thread of its own, so that the
+// frame loops never wait on the file system. The subclasses publish each load as a CSnapshot.
+class CReloader : public CThread {
+public:
+	CReloader(const std::string& name, unsigned int reloadTime);
+	virtual ~CReloader();
+
+	// Loads the table, and starts the reload thread when there is a reload time in minutes
+	bool read();
+
+	// Starts the reload thread, which loads the table first, the table is empty until then
+	void start();
+
+	// The first load has finished, whether or not the file could be read
+	bool isLoaded() const;
+
+	virtual void entry();
+
+	// Loads the table again at the next wake up of the reload thread, or at once without one
+	void reload();
+
+	// In minutes, 0 stops the reloads, the reload thread is started when it was not running
+	void setReloadTime(unsigned int reloadTime);
+
+	// Has to be called before the table is deleted
+	void stop();
+
+protected:
+	virtual bool load() = 0;
+
+private:
+	std::string               m_name;
+	std::atomic<unsigned int> m_reloadTime;
+	bool                      m_started;
+	std::atomic<bool>         m_loaded;
+	std::atomic<bool>         m_reload;
+	std::atomic<bool>         m_stop;
+};
+
+#endif
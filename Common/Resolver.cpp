@@ -0,0 +1,374 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+#include "Resolver.h"
+#include "Log.h"
+
+#include <cassert>
+#include <cstring>
+#include <ctime>
+
+// How often the thread looks for names that are due, in ms
+const unsigned int RESOLVER_POLL = 100U;
+
+CResolver*                  CResolver::s_resolver = NULL;
+std::vector<CResolvedHost*> CResolver::s_hosts;
+CMutex                      CResolver::s_mutex;
+
+static bool parse(const std::string& name, CHostAddress& address)
+{
+	::memset(&address, 0x00, sizeof(CHostAddress));
+
+#if defined(_WIN32) || defined(_WIN64)
+	unsigned long addr = ::inet_addr(name.c_str());
+	if (addr == INADDR_NONE || addr == INADDR_ANY)
+		return false;
+
+	address.m_family = AF_INET;
+	::memcpy(address.m_address, &addr, sizeof(addr));
+	return true;
+#else
+	if (::inet_pton(AF_INET, name.c_str(), address.m_address) == 1) {
+		address.m_family = AF_INET;
+		return true;
+	}
+
+	if (::inet_pton(AF_INET6, name.c_str(), address.m_address) == 1) {
+		address.m_family = AF_INET6;
+		return true;
+	}
+
+	return false;
+#endif
+}
+
+CResolvedHost::CResolvedHost(const std::string& name) :
+m_name(name),
+m_address(INADDR_NONE),
+m_generation(0U),
+m_addresses(),
+m_mutex(),
+m_numeric(false),
+m_due(0ULL),
+m_retry(RESOLVER_RETRY)
+{
+}
+
+const std::string& CResolvedHost::getName() const
+{
+	return m_name;
+}
+
+in_addr CResolvedHost::getAddress() const
+{
+	in_addr address;
+	address.s_addr = m_address.load(std::memory_order_relaxed);
+
+	return address;
+}
+
+bool CResolvedHost::isResolved() const
+{
+	return m_address.load(std::memory_order_relaxed) != INADDR_NONE;
+}
+
+bool CResolvedHost::matches(const in_addr& address) const
+{
+	return m_address.load(std::memory_order_relaxed) == address.s_addr;
+}
+
+std::vector<CHostAddress> CResolvedHost::getAddresses() const
+{
+	m_mutex.lock();
+	std::vector<CHostAddress> addresses = m_addresses;
+	m_mutex.unlock();
+
+	return addresses;
+}
+
+unsigned int CResolvedHost::getGeneration() const
+{
+	return m_generation.load(std::memory_order_relaxed);
+}
+
+CResolver::CResolver() :
+CThread(),
+m_stop(false)
+{
+}
+
+CResolver::~CResolver()
+{
+}
+
+void CResolver::start()
+{
+	s_mutex.lock();
+
+	if (s_resolver == NULL) {
+		s_resolver = new CResolver;
+		s_resolver->run();
+	}
+
+	s_mutex.unlock();
+}
+
+void CResolver::stop()
+{
+	s_mutex.lock();
+	CResolver* resolver = s_resolver;
+	s_resolver = NULL;
+	s_mutex.unlock();
+
+	if (resolver == NULL)
+		return;
+
+	resolver->m_stop = true;
+	resolver->wait();
+
+	delete resolver;
+}
+
+CResolvedHost* CResolver::find(const std::string& name)
+{
+	assert(!name.empty());
+
+	s_mutex.lock();
+
+	for (std::vector<CResolvedHost*>::const_iterator it = s_hosts.begin(); it != s_hosts.end(); ++it) {
+		if ((*it)->m_name == name) {
+			CResolvedHost* host = *it;
+			s_mutex.unlock();
+			return host;
+		}
+	}
+
+	CResolvedHost* host = new CResolvedHost(name);
+	s_hosts.push_back(host);
+
+	CHostAddress address;
+	if (parse(name, address)) {
+		host->m_numeric = true;
+		host->m_addresses.push_back(address);
+		if (address.m_family == AF_INET) {
+			uint32_t addr;
+			::memcpy(&addr, address.m_address, sizeof(uint32_t));
+			host->m_address.store(addr);
+		}
+
+		s_mutex.unlock();
+
+		if (address.m_family != AF_INET)
+			LogWarning("Host %s has no IPv4 address, the UDP networks cannot use it", name.c_str());
+
+		return host;
+	}
+
+	bool running = s_resolver != NULL;
+
+	s_mutex.unlock();
+
+	// Without the thread the caller waits, as it did before there was one
+	if (!running)
+		update(host);
+
+	return host;
+}
+
+void CResolver::refresh(CResolvedHost* host)
+{
+	assert(host != NULL);
+
+	if (host->m_numeric)
+		return;
+
+	s_mutex.lock();
+	host->m_due = 0ULL;
+	bool running = s_resolver != NULL;
+	s_mutex.unlock();
+
+	if (!running)
+		update(host);
+}
+
+bool CResolver::resolve(const std::string& name, std::vector<CHostAddress>& addresses)
+{
+	addresses.clear();
+
+	CHostAddress address;
+	if (parse(name, address)) {
+		addresses.push_back(address);
+		return true;
+	}
+
+#if defined(_WIN32) || defined(_WIN64)
+	struct hostent* hp = ::gethostbyname(name.c_str());
+	if (hp == NULL || hp->h_addrtype != AF_INET)
+		return false;
+
+	for (unsigned int i = 0U; hp->h_addr_list[i] != NULL; i++) {
+		::memset(&address, 0x00, sizeof(CHostAddress));
+		address.m_family = AF_INET;
+		::memcpy(address.m_address, hp->h_addr_list[i], sizeof(struct in_addr));
+		addresses.push_back(address);
+	}
+#else
+	struct addrinfo hints;
+	::memset(&hints, 0x00, sizeof(struct addrinfo));
+	hints.ai_family   = AF_UNSPEC;
+	hints.ai_socktype = SOCK_DGRAM;
+
+	struct addrinfo* res = NULL;
+	if (::getaddrinfo(name.c_str(), NULL, &hints, &res) != 0)
+		return false;
+
+	for (struct addrinfo* p = res; p != NULL; p = p->ai_next) {
+		::memset(&address, 0x00, sizeof(CHostAddress));
+		address.m_family = p->ai_family;
+
+		if (p->ai_family == AF_INET)
+			::memcpy(address.m_address, &((struct sockaddr_in*)p->ai_addr)->sin_addr, sizeof(struct in_addr));
+		else if (p->ai_family == AF_INET6)
+			::memcpy(address.m_address, &((struct sockaddr_in6*)p->ai_addr)->sin6_addr, sizeof(struct in6_addr));
+		else
+			continue;
+
+		bool found = false;
+		for (std::vector<CHostAddress>::const_iterator it = addresses.begin(); it != addresses.end() && !found; ++it)
+			found = ::memcmp(&(*it), &address, sizeof(CHostAddress)) == 0;
+
+		if (!found)
+			addresses.push_back(address);
+	}
+
+	::freeaddrinfo(res);
+#endif
+
+	return !addresses.empty();
+}
+
+void CResolver::entry()
+{
+	LogInfo("Started the resolver thread");
+
+	while (!m_stop) {
+		unsigned long long t = now();
+
+		CResolvedHost* host = NULL;
+
+		s_mutex.lock();
+		for (std::vector<CResolvedHost*>::const_iterator it = s_hosts.begin(); it != s_hosts.end() && host == NULL; ++it) {
+			if (!(*it)->m_numeric && (*it)->m_due <= t)
+				host = *it;
+		}
+		s_mutex.unlock();
+
+		if (host != NULL)
+			update(host);
+		else
+			sleep(RESOLVER_POLL);
+	}
+
+	LogInfo("Stopped the resolver thread");
+}
+
+void CResolver::update(CResolvedHost* host)
+{
+	assert(host != NULL);
+
+	std::vector<CHostAddress> addresses;
+	bool ok = resolve(host->m_name, addresses);
+
+	unsigned long long t = now();
+
+	if (!ok) {
+		s_mutex.lock();
+		unsigned int retry = host->m_retry;
+		host->m_due   = t + retry * 1000ULL;
+		host->m_retry = retry * 2U > RESOLVER_TTL ? RESOLVER_TTL : retry * 2U;
+		s_mutex.unlock();
+
+		// The last answer stays in use until a new one comes
+		LogWarning("Cannot find address for host %s, retrying in %us", host->m_name.c_str(), retry);
+		return;
+	}
+
+	host->m_mutex.lock();
+	bool first = host->m_addresses.empty();
+	host->m_addresses = addresses;
+	host->m_mutex.unlock();
+
+	// A round robin name answers in a rotating order, so the address in use is kept as long as
+	// it is still among the answers, and the first one is only taken once it has gone
+	uint32_t current = host->m_address.load();
+	uint32_t address = INADDR_NONE;
+	for (std::vector<CHostAddress>::const_iterator it = addresses.begin(); it != addresses.end(); ++it) {
+		if (it->m_family == AF_INET) {
+			uint32_t candidate;
+			::memcpy(&candidate, it->m_address, sizeof(uint32_t));
+
+			if (address == INADDR_NONE)
+				address = candidate;
+
+			if (candidate == current) {
+				address = current;
+				break;
+			}
+		}
+	}
+
+	if (address == INADDR_NONE) {
+		if (first)
+			LogWarning("Host %s has no IPv4 address, the UDP networks cannot use it", host->m_name.c_str());
+	} else {
+		uint32_t old = host->m_address.exchange(address);
+		if (old != address) {
+			host->m_generation++;
+
+			char text[INET_ADDRSTRLEN];
+#if defined(_WIN32) || defined(_WIN64)
+			in_addr addr;
+			addr.s_addr = address;
+			::strncpy(text, ::inet_ntoa(addr), INET_ADDRSTRLEN - 1U);
+			text[INET_ADDRSTRLEN - 1U] = '\0';
+#else
+			::inet_ntop(AF_INET, &address, text, INET_ADDRSTRLEN);
+#endif
+			if (old == INADDR_NONE)
+				LogMessage("Host %s is at %s", host->m_name.c_str(), text);
+			else
+				LogMessage("Host %s has moved to %s", host->m_name.c_str(), text);
+		}
+	}
+
+	s_mutex.lock();
+	host->m_due   = t + RESOLVER_TTL * 1000ULL;
+	host->m_retry = RESOLVER_RETRY;
+	s_mutex.unlock();
+}
+
+unsigned long long CResolver::now()
+{
+#if defined(_WIN32) || defined(_WIN64)
+	return ::GetTickCount64();
+#else
+	struct timespec ts;
+	::clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec * 1000ULL + ts.tv_nsec / 1000000ULL;
+#endif
+}
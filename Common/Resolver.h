@@ -0,0 +1,109 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+#if !defined(RESOLVER_H)
+#define	RESOLVER_H
+
+#include "UDPSocket.h"
+#include "Thread.h"
+#include "Mutex.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// How long an answer is used before the name is looked up again, in seconds. getaddrinfo() does
+// not return the TTL of the DNS records, so this stands in for it.
+const unsigned int RESOLVER_TTL = 300U;
+
+// How soon a name that did not resolve is tried again, in seconds, doubled each time up to the TTL
+const unsigned int RESOLVER_RETRY = 5U;
+
+// One address of a host, either family
+struct CHostAddress {
+	int           m_family;		// AF_INET or AF_INET6
+	unsigned char m_address[16U];	// Network order, an IPv4 address takes the first four bytes
+};
+
+// A host named in the configuration, kept resolved by the resolver thread. The address can be
+// read from any thread at any time, a new answer replaces it in one step.
+class CResolvedHost {
+public:
+	const std::string& getName() const;
+
+	// The IPv4 address in use, INADDR_NONE until the name has resolved
+	in_addr getAddress() const;
+	bool    isResolved() const;
+	bool    matches(const in_addr& address) const;
+
+	// All the addresses, IPv6 included, in the order the system prefers them
+	std::vector<CHostAddress> getAddresses() const;
+
+	// Goes up by one every time the IPv4 address in use changes, which it only does once it is no longer in the answers
+	unsigned int getGeneration() const;
+
+private:
+	friend class CResolver;
+
+	CResolvedHost(const std::string& name);
+
+	std::string               m_name;
+	std::atomic<uint32_t>     m_address;
+	std::atomic<unsigned int> m_generation;
+	std::vector<CHostAddress> m_addresses;
+	mutable CMutex            m_mutex;
+	bool                      m_numeric;
+	unsigned long long        m_due;
+	unsigned int              m_retry;
+};
+
+// Looks the host names up with getaddrinfo() on a thread of its own, so that a slow or broken
+// resolver never holds up the frame loops, and looks them up again once the answer has aged.
+class CResolver : public CThread {
+public:
+	// Before the thread is started, or after it has stopped, names are resolved on the spot
+	static void start();
+	static void stop();
+
+	// Returns the host kept for the name, the first call queues the lookup. Numeric addresses
+	// are filled in at once. The hosts live as long as the process, the networks keep them.
+	static CResolvedHost* find(const std::string& name);
+
+	// Asks for the name to be looked up again as soon as possible, after a connect has failed
+	static void refresh(CResolvedHost* host);
+
+	// Looks a name up in the calling thread, the addresses come in the order of preference
+	static bool resolve(const std::string& name, std::vector<CHostAddress>& addresses);
+
+	virtual void entry();
+
+private:
+	CResolver();
+	virtual ~CResolver();
+
+	std::atomic<bool> m_stop;
+
+	static CResolver*                  s_resolver;
+	static std::vector<CResolvedHost*> s_hosts;
+	static CMutex                      s_mutex;
+
+	static void update(CResolvedHost* host);
+	static unsigned long long now();
+};
+
+#endif
@@ -0,0 +1,102 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(SPSCQUEUE_H)
+#define	SPSCQUEUE_H
+
+#include <atomic>
+#include <cassert>
+
+// Lock free queue between exactly one producer thread and one consumer thread
+template<class T> class CSPSCQueue {
+public:
+	CSPSCQueue(unsigned int length) :
+	m_length(length + 1U),
+	m_buffer(NULL),
+	m_head(0U),
+	m_tail(0U)
+	{
+		assert(length > 0U);
+
+		m_buffer = new T[m_length];
+	}
+
+	~CSPSCQueue()
+	{
+		delete[] m_buffer;
+	}
+
+	// Producer side, returns false when the queue is full
+	bool push(const T& item)
+	{
+		unsigned int tail = m_tail.load(std::memory_order_relaxed);
+		unsigned int next = tail + 1U;
+		if (next == m_length)
+			next = 0U;
+
+		if (next == m_head.load(std::memory_order_acquire))
+			return false;
+
+		m_buffer[tail] = item;
+		m_tail.store(next, std::memory_order_release);
+
+		return true;
+	}
+
+	// Consumer side, returns false when the queue is empty
+	bool pop(T& item)
+	{
+		unsigned int head = m_head.load(std::memory_order_relaxed);
+		if (head == m_tail.load(std::memory_order_acquire))
+			return false;
+
+		item = m_buffer[head];
+
+		unsigned int next = head + 1U;
+		if (next == m_length)
+			next = 0U;
+
+		m_head.store(next, std::memory_order_release);
+
+		return true;
+	}
+
+	bool isEmpty() const
+	{
+		return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+	}
+
+	// Producer side, the consumer can only make more room in the meantime
+	unsigned int getSpace() const
+	{
+		unsigned int head = m_head.load(std::memory_order_acquire);
+		unsigned int tail = m_tail.load(std::memory_order_relaxed);
+
+		return head > tail ? head - tail - 1U : m_length - (tail - head) - 1U;
+	}
+
+private:
+	unsigned int              m_length;
+	T*                        m_buffer;
+	// The two indexes are written by different threads, keep them on separate cache lines
+	std::atomic<unsigned int> m_head;
+	char                      m_pad[64U];
+	std::atomic<unsigned int> m_tail;
+};
+
+#endif
@@ -1,5 +1,5 @@
 /*
- *   Copyright (C) 2018 by Jonathan Naylor G4KLX
+ *   Copyright (C) 2026 by agent
  *
  *   This program is free software; you can redistribute it and/or modify
  *   it under the terms of the GNU General Public License as published by
@@ -16,37 +16,42 @@
  *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
  */
 
-#if !defined(NXDNLICH_H)
-#define  NXDNLICH_H
+#if !defined(SNAPSHOT_H)
+#define	SNAPSHOT_H
 
-class CNXDNLICH {
-public:
-	CNXDNLICH(const CNXDNLICH& lich);
-	CNXDNLICH();
-	~CNXDNLICH();
-
-	bool decode(const unsigned char* bytes);
-
-	void encode(unsigned char* bytes);
+#include "Mutex.h"
 
-	unsigned char getRFCT() const;
-	unsigned char getFCT() const;
-	unsigned char getOption() const;
-	unsigned char getDirection() const;
-	unsigned char getRaw() const;
-	
-	void setRFCT(unsigned char rfct);
-	void setFCT(unsigned char usc);
-	void setOption(unsigned char option);
-	void setDirection(unsigned char direction);
-	void setRaw(unsigned char lich);
+#include <memory>
 
-	CNXDNLICH& operator=(const CNXDNLICH& lich);
+// The current version of a table that is rebuilt on another thread. A reader keeps the version
+// it got for as long as it needs it, a reload only swaps the pointer under the lock.
+template<class T> class CSnapshot {
+public:
+	CSnapshot() :
+	m_mutex(),
+	m_current(new T)
+	{
+	}
+
+	std::shared_ptr<const T> get()
+	{
+		m_mutex.lock();
+		std::shared_ptr<const T> current = m_current;
+		m_mutex.unlock();
+
+		return current;
+	}
+
+	void set(const std::shared_ptr<const T>& table)
+	{
+		m_mutex.lock();
+		m_current = table;
+		m_mutex.unlock();
+	}
 
 private:
-	unsigned char* m_lich;
-
-	bool getParity() const;
+	CMutex                   m_mutex;
+	std::shared_ptr<const T> m_current;
 };
 
 #endif
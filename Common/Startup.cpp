@@ -1,5 +1,5 @@
 /*
- *   Copyright (C) 2015,2016 by Jonathan Naylor G4KLX
+ *   Copyright (C) 2026 by agent
  *
  *   This program is free software; you can redistribute it and/or modify
  *   it under the terms of the GNU General Public License as published by
@@ -16,27 +16,25 @@
  *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
  */
 
-#ifndef DMRFullLC_H
-#define DMRFullLC_H
+#include "Startup.h"
+#include "Log.h"
 
-#include "DMRLC.h"
-#include "DMRSlotType.h"
+CStopWatch        CStartup::s_watch;
+bool              CStartup::s_started = false;
+// Nothing is logged for a bridge that never calls start()
+std::atomic<bool> CStartup::s_frame(true);
 
-#include "BPTC19696.h"
-
-class CDMRFullLC
+void CStartup::start()
 {
-public:
-	CDMRFullLC();
-	~CDMRFullLC();
-
-	CDMRLC* decode(const unsigned char* data, unsigned char type);
-
-	void encode(const CDMRLC& lc, unsigned char* data, unsigned char type);
+	s_watch.start();
+	s_started = true;
+	s_frame   = false;
+}
 
-private:
-	CBPTC19696 m_bptc;
-};
-
-#endif
+void CStartup::reached(const char* stage)
+{
+	if (!s_started)
+		return;
 
+	LogMessage("Startup, %s after %u ms", stage, s_watch.elapsed());
+}
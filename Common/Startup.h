@@ -1,5 +1,5 @@
 /*
- *   Copyright (C) 2015,2016 by Jonathan Naylor G4KLX
+ *   Copyright (C) 2026 by agent
  *
  *   This program is free software; you can redistribute it and/or modify
  *   it under the terms of the GNU General Public License as published by
@@ -16,27 +16,35 @@
  *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
  */
 
-#ifndef DMRFullLC_H
-#define DMRFullLC_H
+#if !defined(STARTUP_H)
+#define	STARTUP_H
 
-#include "DMRLC.h"
-#include "DMRSlotType.h"
+#include "StopWatch.h"
 
-#include "BPTC19696.h"
+#include <atomic>
 
-class CDMRFullLC
-{
+// Times the stages of the startup from the top of run(), the networks come up first and
+// the tables load behind them, so each stage is logged once when it has been reached
+class CStartup {
 public:
-	CDMRFullLC();
-	~CDMRFullLC();
+	static void start();
 
-	CDMRLC* decode(const unsigned char* data, unsigned char type);
+	static void reached(const char* stage);
 
-	void encode(const CDMRLC& lc, unsigned char* data, unsigned char type);
+	// Called for every frame bridged, only the first one is logged as the time to first frame
+	static void frame()
+	{
+		if (s_frame.load(std::memory_order_relaxed))
+			return;
+
+		if (!s_frame.exchange(true))
+			reached("first frame bridged");
+	}
 
 private:
-	CBPTC19696 m_bptc;
+	static CStopWatch        s_watch;
+	static bool              s_started;
+	static std::atomic<bool> s_frame;
 };
 
 #endif
-
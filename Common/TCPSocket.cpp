@@ -17,7 +17,6 @@
  */
 
 #include "TCPSocket.h"
-#include "UDPSocket.h"
 #include "Log.h"
 
 #include <cstdio>
@@ -33,11 +32,18 @@ typedef int ssize_t;
 CTCPSocket::CTCPSocket(const std::string& address, unsigned int port) :
 m_address(address),
 m_port(port),
-m_fd(-1)
+m_fd(-1),
+m_buffer(NULL),
+m_start(0U),
+m_end(0U),
+m_bytesIn(0ULL),
+m_bytesOut(0ULL)
 {
 	assert(!address.empty());
 	assert(port > 0U);
 
+	m_buffer = new unsigned char[TCP_BUFFER_LENGTH];
+
 #if defined(_WIN32) || defined(_WIN64)
 	WSAData data;
 	int wsaRet = ::WSAStartup(MAKEWORD(2, 2), &data);
@@ -48,6 +54,8 @@ m_fd(-1)
 
 CTCPSocket::~CTCPSocket()
 {
+	delete[] m_buffer;
+
 #if defined(_WIN32) || defined(_WIN64)
 	::WSACleanup();
 #endif
@@ -61,7 +69,34 @@ bool CTCPSocket::open()
 	if (m_address.empty() || m_port == 0U)
 		return false;
 
-	m_fd = ::socket(PF_INET, SOCK_STREAM, 0);
+	CResolvedHost* host = CResolver::find(m_address);
+
+	// Only the background threads open TCP connections, they can wait on a first lookup
+	std::vector<CHostAddress> addresses = host->getAddresses();
+	if (addresses.empty() && !CResolver::resolve(m_address, addresses)) {
+		LogError("Cannot find address for host %s", m_address.c_str());
+		return false;
+	}
+
+	for (std::vector<CHostAddress>::const_iterator it = addresses.begin(); it != addresses.end(); ++it) {
+		if (connect(*it))
+			return true;
+	}
+
+	// The host may have moved
+	CResolver::refresh(host);
+
+	return false;
+}
+
+bool CTCPSocket::connect(const CHostAddress& address)
+{
+#if defined(_WIN32) || defined(_WIN64)
+	if (address.m_family != AF_INET)
+		return false;
+#endif
+
+	m_fd = ::socket(address.m_family, SOCK_STREAM, 0);
 	if (m_fd < 0) {
 #if defined(_WIN32) || defined(_WIN64)
 		LogError("Cannot create the TCP client socket, err=%d", ::GetLastError());
@@ -75,14 +110,25 @@ bool CTCPSocket::open()
 	::memset(&addr, 0x00, sizeof(struct sockaddr_in));
 	addr.sin_family = AF_INET;
 	addr.sin_port   = htons(m_port);
-	addr.sin_addr   = CUDPSocket::lookup(m_address);
+	::memcpy(&addr.sin_addr, address.m_address, sizeof(struct in_addr));
 
-	if (addr.sin_addr.s_addr == INADDR_NONE) {
-		close();
-		return false;
+	sockaddr*    to     = (sockaddr*)&addr;
+	unsigned int length = sizeof(struct sockaddr_in);
+
+#if !defined(_WIN32) && !defined(_WIN64)
+	struct sockaddr_in6 addr6;
+	if (address.m_family == AF_INET6) {
+		::memset(&addr6, 0x00, sizeof(struct sockaddr_in6));
+		addr6.sin6_family = AF_INET6;
+		addr6.sin6_port   = htons(m_port);
+		::memcpy(&addr6.sin6_addr, address.m_address, sizeof(struct in6_addr));
+
+		to     = (sockaddr*)&addr6;
+		length = sizeof(struct sockaddr_in6);
 	}
+#endif
 
-	if (::connect(m_fd, (sockaddr*)&addr, sizeof(struct sockaddr_in)) == -1) {
+	if (::connect(m_fd, to, length) == -1) {
 #if defined(_WIN32) || defined(_WIN64)
 		LogError("Cannot connect the TCP client socket, err=%d", ::GetLastError());
 #else
@@ -112,6 +158,27 @@ int CTCPSocket::read(unsigned char* buffer, unsigned int length, unsigned int se
 	assert(length > 0U);
 	assert(m_fd != -1);
 
+	// Whatever readLine() has buffered comes first
+	if (m_start < m_end) {
+		unsigned int n = m_end - m_start;
+		if (n > length)
+			n = length;
+
+		::memcpy(buffer, m_buffer + m_start, n);
+		m_start += n;
+
+		return int(n);
+	}
+
+	return receive(buffer, length, secs, msecs);
+}
+
+int CTCPSocket::receive(unsigned char* buffer, unsigned int length, unsigned int secs, unsigned int msecs)
+{
+	assert(buffer != NULL);
+	assert(length > 0U);
+	assert(m_fd != -1);
+
 	// Check that the recv() won't block
 	fd_set readFds;
 	FD_ZERO(&readFds);
@@ -156,31 +223,104 @@ int CTCPSocket::read(unsigned char* buffer, unsigned int length, unsigned int se
 		return -1;
 	}
 
+	m_bytesIn += len;
+
 	return len;
 }
 
 int CTCPSocket::readLine(std::string& line, unsigned int secs)
 {
-	// Maybe there is a better way to do this like reading blocks, pushing them for later calls
-	// Nevermind, we'll read one char at a time for the time being.
-	int resultCode;
-	int len = 0;
+	assert(m_fd != -1);
 
 	line.clear();
 
-	char c[2U];
-	c[1U] = 0x00U;
+	for (;;) {
+		const unsigned char* end = (const unsigned char*)::memchr(m_buffer + m_start, '\n', m_end - m_start);
+		if (end != NULL) {
+			unsigned int len = (end - (m_buffer + m_start)) + 1U;
+			line.assign((char*)(m_buffer + m_start), len);
+			m_start += len;
+			return int(len);
+		}
+
+		if (m_start > 0U) {
+			::memmove(m_buffer, m_buffer + m_start, m_end - m_start);
+			m_end  -= m_start;
+			m_start = 0U;
+		}
 
-	do
-	{
-		resultCode = read((unsigned char*)c, 1U, secs);
-		if (resultCode == 1){
-			line.append(c);
-			len++;
+		// A line longer than the buffer is handed over in pieces
+		if (m_end == TCP_BUFFER_LENGTH) {
+			line.assign((char*)m_buffer, m_end);
+			m_start = m_end = 0U;
+			return int(TCP_BUFFER_LENGTH);
 		}
-	} while (c[0U] != '\n' && resultCode == 1);
 
-	return resultCode <= 0 ? resultCode : len;
+		// A partial line stays in the buffer for the next call
+		int ret = receive(m_buffer + m_end, TCP_BUFFER_LENGTH - m_end, secs, 0U);
+		if (ret <= 0)
+			return ret;
+
+		m_end += ret;
+	}
+}
+
+bool CTCPSocket::hasLine() const
+{
+	return ::memchr(m_buffer + m_start, '\n', m_end - m_start) != NULL;
+}
+
+int CTCPSocket::wait(unsigned int ms, int event)
+{
+	assert(m_fd != -1);
+
+	fd_set readFds;
+	FD_ZERO(&readFds);
+#if defined(_WIN32) || defined(_WIN64)
+	// Only sockets can be selected on here, the caller polls with a short timeout instead
+	FD_SET((unsigned int)m_fd, &readFds);
+	int maxFd = m_fd;
+#else
+	FD_SET(m_fd, &readFds);
+	int maxFd = m_fd;
+	if (event >= 0) {
+		FD_SET(event, &readFds);
+		if (event > maxFd)
+			maxFd = event;
+	}
+#endif
+
+	timeval tv;
+	tv.tv_sec  = ms / 1000U;
+	tv.tv_usec = (ms % 1000U) * 1000U;
+
+	int ret = ::select(maxFd + 1, &readFds, NULL, NULL, &tv);
+	if (ret < 0) {
+#if defined(_WIN32) || defined(_WIN64)
+		LogError("Error returned from TCP client select, err=%d", ::GetLastError());
+#else
+		if (errno == EINTR)
+			return 0;
+		LogError("Error returned from TCP client select, err=%d", errno);
+#endif
+		return -1;
+	}
+
+#if defined(_WIN32) || defined(_WIN64)
+	return FD_ISSET((unsigned int)m_fd, &readFds) ? 1 : 0;
+#else
+	return FD_ISSET(m_fd, &readFds) ? 1 : 0;
+#endif
+}
+
+unsigned long long CTCPSocket::getBytesIn() const
+{
+	return m_bytesIn;
+}
+
+unsigned long long CTCPSocket::getBytesOut() const
+{
+	return m_bytesOut;
 }
 
 bool CTCPSocket::write(const unsigned char* buffer, unsigned int length)
@@ -199,6 +339,8 @@ bool CTCPSocket::write(const unsigned char* buffer, unsigned int length)
 		return false;
 	}
 
+	m_bytesOut += length;
+
 	return true;
 }
 
@@ -207,16 +349,11 @@ bool CTCPSocket::writeLine(const std::string& line)
 	std::string lineCopy(line);
 	if (lineCopy.length() > 0 && lineCopy.at(lineCopy.length() - 1) != '\n')
 		lineCopy.append("\n");
-	
-	//stupidly write one char after the other
-	size_t len = lineCopy.length();
-	bool result = true;
-	for (size_t i = 0U; i < len && result; i++){
-		unsigned char c = lineCopy.at(i);
-		result = write(&c , 1);
-	}
 
-	return result;
+	if (lineCopy.empty())
+		return true;
+
+	return write((const unsigned char*)lineCopy.c_str(), lineCopy.length());
 }
 
 void CTCPSocket::close()
@@ -229,4 +366,8 @@ void CTCPSocket::close()
 #endif
 		m_fd = -1;
 	}
+
+	// Nothing received on the old connection is of any use on the next one
+	m_start = 0U;
+	m_end   = 0U;
 }
@@ -33,13 +33,19 @@
 #include <winsock.h>
 #endif
 
+#include "Resolver.h"
+
 #include <string>
 
+// Received data is kept here until a whole line has arrived
+const unsigned int TCP_BUFFER_LENGTH = 4096U;
+
 class CTCPSocket {
 public:
 	CTCPSocket(const std::string& address, unsigned int port);
 	~CTCPSocket();
 
+	// Tries the addresses of the host in turn, IPv6 included
 	bool open();
 
 	int  read(unsigned char* buffer, unsigned int length, unsigned int secs, unsigned int msecs = 0U);
@@ -47,12 +53,29 @@ public:
 	bool write(const unsigned char* buffer, unsigned int length);
 	bool writeLine(const std::string& line);
 
+	// Waits until there is something to read or the event descriptor is signalled, returns 1 when
+	// the socket is readable, 0 on a timeout or the event, and -1 on an error
+	int  wait(unsigned int ms, int event = -1);
+	// A whole line is already in the receive buffer
+	bool hasLine() const;
+
+	unsigned long long getBytesIn() const;
+	unsigned long long getBytesOut() const;
+
 	void close();
 
 private:
-	std::string    m_address;
-	unsigned short m_port;
-	int            m_fd;
+	std::string        m_address;
+	unsigned short     m_port;
+	int                m_fd;
+	unsigned char*     m_buffer;
+	unsigned int       m_start;
+	unsigned int       m_end;
+	unsigned long long m_bytesIn;
+	unsigned long long m_bytesOut;
+
+	bool connect(const CHostAddress& address);
+	int  receive(unsigned char* buffer, unsigned int length, unsigned int secs, unsigned int msecs);
 };
 
 #endif
@@ -0,0 +1,191 @@
+/*
+*   Copyright (C) 2016,2017 by Jonathan Naylor G4KLX
+*   Copyright (C) 2018 by Manuel Sanchez EA7EE
+*   Copyright (C) 2018,2019 by Andy Uribe CA6JAU
+*   Copyright (C) 2026 by agent
+*
+*   This program is free software; you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation; either version 2 of the License, or
+*   (at your option) any later version.
+*
+*   This program is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program; if not, write to the Free Software
+*   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+*/
+
+#include "TGList.h"
+#include "Log.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cassert>
+#include <cstring>
+#include <cctype>
+
+static bool refComparison(const CTGReg* r1, const CTGReg* r2)
+{
+	assert(r1 != NULL);
+	assert(r2 != NULL);
+
+	return r1->m_key < r2->m_key;
+}
+
+static bool prefixBelow(const CTGReg* reg, const std::string& prefix)
+{
+	return reg->m_key.compare(0U, prefix.size(), prefix) < 0;
+}
+
+static bool prefixAbove(const std::string& prefix, const CTGReg* reg)
+{
+	return reg->m_key.compare(0U, prefix.size(), prefix) > 0;
+}
+
+const CTGReg* CTGTable::find(unsigned int id) const
+{
+	std::unordered_map<unsigned int, unsigned int>::const_iterator it = m_ids.find(id);
+	if (it == m_ids.end())
+		return NULL;
+
+	return &m_entries.at(it->second);
+}
+
+const CTGReg* CTGTable::findShort(const std::string& id) const
+{
+	std::unordered_map<std::string, unsigned int>::const_iterator it = m_shortIds.find(id);
+	if (it == m_shortIds.end())
+		return NULL;
+
+	return &m_entries.at(it->second);
+}
+
+void CTGTable::search(const std::string& name, unsigned int& first, unsigned int& count) const
+{
+	std::string prefix = name;
+	while (!prefix.empty() && ::isspace((unsigned char)prefix.back()))
+		prefix.pop_back();
+	std::transform(prefix.begin(), prefix.end(), prefix.begin(), ::toupper);
+
+	std::vector<const CTGReg*>::const_iterator lower = std::lower_bound(m_sorted.cbegin(), m_sorted.cend(), prefix, prefixBelow);
+	std::vector<const CTGReg*>::const_iterator upper = std::upper_bound(lower, m_sorted.cend(), prefix, prefixAbove);
+
+	first = lower - m_sorted.cbegin();
+	count = upper - lower;
+}
+
+CTGList::CTGList(const std::string& filename, bool makeUpper, bool withOpt, unsigned int reloadTime) :
+CReloader("Wires-X TG list", reloadTime),
+m_filename(filename),
+m_makeUpper(makeUpper),
+m_withOpt(withOpt),
+m_mutex(),
+m_table()
+{
+}
+
+CTGList::~CTGList()
+{
+}
+
+std::shared_ptr<const CTGTable> CTGList::get()
+{
+	return m_table.get();
+}
+
+void CTGList::setFile(const std::string& filename, bool makeUpper)
+{
+	m_mutex.lock();
+	m_filename  = filename;
+	m_makeUpper = makeUpper;
+	m_mutex.unlock();
+
+	reload();
+}
+
+bool CTGList::load()
+{
+	m_mutex.lock();
+	std::string filename = m_filename;
+	bool makeUpper       = m_makeUpper;
+	m_mutex.unlock();
+
+	FILE* fp = ::fopen(filename.c_str(), "rt");
+	if (fp == NULL) {
+		LogWarning("Cannot open the Wires-X TG list file - %s", filename.c_str());
+		return false;
+	}
+
+	std::shared_ptr<CTGTable> table(new CTGTable);
+
+	char buffer[100U];
+	while (::fgets(buffer, 100U, fp) != NULL) {
+		if (buffer[0U] == '#')
+			continue;
+
+		char* p1 = ::strtok(buffer, ";\r\n");
+		char* p2 = NULL;
+		if (m_withOpt)
+			p2 = ::strtok(NULL, ";\r\n");
+		char* p3 = ::strtok(NULL, ";\r\n");
+		char* p4 = ::strtok(NULL, "\r\n");
+
+		if (p1 != NULL && (p2 != NULL || !m_withOpt) && p3 != NULL && p4 != NULL) {
+			CTGReg tgreg;
+
+			std::string id_tmp = std::string(p1);
+
+			int n_zero = 7 - id_tmp.length();
+			if (n_zero < 0)
+				n_zero = 0;
+
+			tgreg.m_id = std::string(n_zero, '0') + id_tmp;
+			if (p2 != NULL)
+				tgreg.m_opt = std::string(p2);
+			tgreg.m_name = std::string(p3);
+			tgreg.m_desc = std::string(p4);
+
+			if (makeUpper) {
+				std::transform(tgreg.m_name.begin(), tgreg.m_name.end(), tgreg.m_name.begin(), ::toupper);
+				std::transform(tgreg.m_desc.begin(), tgreg.m_desc.end(), tgreg.m_desc.begin(), ::toupper);
+			}
+
+			tgreg.m_name.resize(16U, ' ');
+			tgreg.m_desc.resize(14U, ' ');
+
+			tgreg.m_key = tgreg.m_name;
+			std::transform(tgreg.m_key.begin(), tgreg.m_key.end(), tgreg.m_key.begin(), ::toupper);
+
+			table->m_entries.push_back(tgreg);
+		}
+	}
+
+	::fclose(fp);
+
+	// The entries do not move any more, the indexes can point into them
+	for (unsigned int i = 0U; i < table->m_entries.size(); i++) {
+		const CTGReg* tgreg = &table->m_entries.at(i);
+
+		table->m_list.push_back(tgreg);
+
+		// The first entry of an id wins, as with the old linear searches
+		table->m_ids.insert(std::make_pair((unsigned int)::atoi(tgreg->m_id.c_str()), i));
+		if (m_withOpt)
+			table->m_shortIds.insert(std::make_pair(tgreg->m_id.substr(2U, 5U), i));
+	}
+
+	// Every name starting with a given prefix sits in one run of the sorted list
+	table->m_sorted = table->m_list;
+	std::stable_sort(table->m_sorted.begin(), table->m_sorted.end(), refComparison);
+
+	LogInfo("Loaded %u talk groups for Wires-X", (unsigned int)table->m_entries.size());
+
+	m_table.set(table);
+
+	return true;
+}
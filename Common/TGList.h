@@ -0,0 +1,98 @@
+/*
+*   Copyright (C) 2016,2017 by Jonathan Naylor G4KLX
+*   Copyright (C) 2018 by Manuel Sanchez EA7EE
+*   Copyright (C) 2018,2019 by Andy Uribe CA6JAU
+*   Copyright (C) 2026 by agent
+*
+*   This program is free software; you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation; either version 2 of the License, or
+*   (at your option) any later version.
+*
+*   This program is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program; if not, write to the Free Software
+*   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+*/
+
+#if !defined(TGLIST_H)
+#define	TGLIST_H
+
+#include "Reloader.h"
+#include "Snapshot.h"
+#include "Mutex.h"
+
+#include <unordered_map>
+#include <memory>
+#include <vector>
+#include <string>
+
+class CTGReg {
+public:
+	CTGReg() :
+	m_id(),
+	m_opt(),
+	m_name(),
+	m_desc(),
+	m_key()
+	{
+	}
+
+	std::string  m_id;
+	std::string  m_opt;
+	std::string  m_name;
+	std::string  m_desc;
+	std::string  m_key;		// The name in upper case, what searches and sorting look at
+};
+
+// One load of the TG list, never changed once published
+class CTGTable {
+public:
+	CTGTable() :
+	m_entries(),
+	m_list(),
+	m_sorted(),
+	m_ids(),
+	m_shortIds()
+	{
+	}
+
+	const CTGReg* find(unsigned int id) const;
+	const CTGReg* findShort(const std::string& id) const;
+	// The names starting with the prefix are m_sorted[first] onwards
+	void search(const std::string& name, unsigned int& first, unsigned int& count) const;
+
+	std::vector<CTGReg>        m_entries;
+	std::vector<const CTGReg*> m_list;		// In file order, for the ALL pages
+	std::vector<const CTGReg*> m_sorted;	// By upper case name
+	std::unordered_map<unsigned int, unsigned int> m_ids;
+	std::unordered_map<std::string, unsigned int>  m_shortIds;	// By the five digits the radios use
+};
+
+// The Wires-X talk groups of a YSF bridge, the DMR lists carry an option field after the id
+class CTGList : public CReloader {
+public:
+	CTGList(const std::string& filename, bool makeUpper, bool withOpt, unsigned int reloadTime);
+	virtual ~CTGList();
+
+	std::shared_ptr<const CTGTable> get();
+
+	// The new file is loaded on the reload thread, the current table stays in use until then
+	void setFile(const std::string& filename, bool makeUpper);
+
+protected:
+	virtual bool load();
+
+private:
+	std::string         m_filename;
+	bool                m_makeUpper;
+	bool                m_withOpt;
+	CMutex              m_mutex;
+	CSnapshot<CTGTable> m_table;
+};
+
+#endif
@@ -59,6 +59,22 @@ void CThread::sleep(unsigned int ms)
 	::Sleep(ms);
 }
 
+bool CThread::setAffinity(unsigned int cpu)
+{
+	if (cpu >= sizeof(DWORD_PTR) * 8U)
+		return false;
+
+	return ::SetThreadAffinityMask(::GetCurrentThread(), DWORD_PTR(1) << cpu) != 0;
+}
+
+unsigned int CThread::getCPUCount()
+{
+	SYSTEM_INFO info;
+	::GetSystemInfo(&info);
+
+	return info.dwNumberOfProcessors;
+}
+
 #else
 
 #include <unistd.h>
@@ -74,7 +90,21 @@ CThread::~CThread()
 
 bool CThread::run()
 {
-  return ::pthread_create(&m_thread, NULL, helper, this) == 0;
+  // Threads start with the normal scheduling, the ones on the frame path raise themselves
+  pthread_attr_t attr;
+  ::pthread_attr_init(&attr);
+  ::pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+  ::pthread_attr_setschedpolicy(&attr, SCHED_OTHER);
+
+  struct sched_param param;
+  param.sched_priority = 0;
+  ::pthread_attr_setschedparam(&attr, &param);
+
+  bool ret = ::pthread_create(&m_thread, &attr, helper, this) == 0;
+
+  ::pthread_attr_destroy(&attr);
+
+  return ret;
 }
 
 
@@ -98,4 +128,27 @@ void CThread::sleep(unsigned int ms)
 	::usleep(ms * 1000);
 }
 
+bool CThread::setAffinity(unsigned int cpu)
+{
+#if defined(__linux__)
+	if (cpu >= CPU_SETSIZE)
+		return false;
+
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	CPU_SET(cpu, &set);
+
+	return ::pthread_setaffinity_np(::pthread_self(), sizeof(cpu_set_t), &set) == 0;
+#else
+	return false;
+#endif
+}
+
+unsigned int CThread::getCPUCount()
+{
+	long count = ::sysconf(_SC_NPROCESSORS_ONLN);
+
+	return count > 0L ? (unsigned int)count : 1U;
+}
+
 #endif
@@ -39,6 +39,11 @@ public:
 
   static void sleep(unsigned int ms);
 
+  // Pins the calling thread to one CPU, false when the host does not allow it
+  static bool setAffinity(unsigned int cpu);
+
+  static unsigned int getCPUCount();
+
 private:
 #if defined(_WIN32) || defined(_WIN64)
   HANDLE    m_handle;
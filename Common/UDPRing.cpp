@@ -0,0 +1,456 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "UDPRing.h"
+#include "Log.h"
+
+#include <atomic>
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+const unsigned int UDP_RING_RX_ENTRIES = 4U;
+
+// Every provided buffer can be waiting in a completion, plus the one that ends a multishot receive
+const unsigned int UDP_RING_RX_CQ_ENTRIES = 2U * UDP_RING_BUFFERS;
+
+// The datagrams are filed under this buffer group
+const unsigned short UDP_RING_GROUP = 0U;
+
+static std::atomic<unsigned long long> s_systemCalls(0ULL);
+
+CUDPRing::CUDPRing(int fd) :
+m_fd(fd),
+m_rx(),
+m_tx(),
+m_bufRing(NULL),
+m_buffers(NULL),
+m_recvMsg(),
+m_armed(false),
+m_slots(),
+m_mutex()
+{
+	assert(fd >= 0);
+
+	m_rx.m_fd  = -1;
+	m_rx.m_map = NULL;
+	m_tx.m_fd  = -1;
+	m_tx.m_map = NULL;
+}
+
+CUDPRing::~CUDPRing()
+{
+	close();
+}
+
+unsigned long long CUDPRing::getSystemCalls()
+{
+	return s_systemCalls.load(std::memory_order_relaxed);
+}
+
+bool CUDPRing::open()
+{
+	if (!setup(m_rx, UDP_RING_RX_ENTRIES, UDP_RING_RX_CQ_ENTRIES) || !setup(m_tx, UDP_RING_SLOTS, 0U)) {
+		close();
+		return false;
+	}
+
+	void* ring = ::mmap(NULL, UDP_RING_BUFFERS * sizeof(struct io_uring_buf), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (ring == MAP_FAILED) {
+		LogWarning("Cannot map the io_uring buffer ring, err: %d", errno);
+		close();
+		return false;
+	}
+
+	m_bufRing = (struct io_uring_buf_ring*)ring;
+	m_bufRing->tail = 0U;
+
+	m_buffers = new unsigned char[UDP_RING_BUFFERS * UDP_RING_BUFFER_LENGTH];
+
+	struct io_uring_buf_reg reg;
+	::memset(&reg, 0x00, sizeof(struct io_uring_buf_reg));
+	reg.ring_addr    = (unsigned long long)m_bufRing;
+	reg.ring_entries = UDP_RING_BUFFERS;
+	reg.bgid         = UDP_RING_GROUP;
+
+	if (::syscall(__NR_io_uring_register, m_rx.m_fd, IORING_REGISTER_PBUF_RING, &reg, 1) < 0) {
+		LogWarning("Cannot register the io_uring receive buffers, err: %d", errno);
+		close();
+		return false;
+	}
+
+	for (unsigned int i = 0U; i < UDP_RING_BUFFERS; i++)
+		recycle(i);
+
+	// Only the sender address comes with each datagram
+	::memset(&m_recvMsg, 0x00, sizeof(struct msghdr));
+	m_recvMsg.msg_namelen = sizeof(struct sockaddr_in);
+
+	for (unsigned int i = 0U; i < UDP_RING_SLOTS; i++) {
+		CSendSlot& slot = m_slots[i];
+		::memset(&slot.m_msg, 0x00, sizeof(struct msghdr));
+		slot.m_iov.iov_base     = slot.m_data;
+		slot.m_msg.msg_name     = &slot.m_addr;
+		slot.m_msg.msg_namelen  = sizeof(struct sockaddr_in);
+		slot.m_msg.msg_iov      = &slot.m_iov;
+		slot.m_msg.msg_iovlen   = 1U;
+		slot.m_busy = false;
+	}
+
+	// The receive is armed by the first read, so its completions are run by the reading thread
+	m_armed = false;
+
+	return true;
+}
+
+int CUDPRing::read(unsigned char* buffer, unsigned int length, in_addr& address, unsigned int& port)
+{
+	assert(buffer != NULL);
+	assert(length > 0U);
+
+	if (!m_armed && !arm())
+		return -1;
+
+	for (;;) {
+		unsigned int head = *m_rx.m_cqHead;
+		if (head == __atomic_load_n(m_rx.m_cqTail, __ATOMIC_ACQUIRE))
+			return 0;
+
+		const struct io_uring_cqe* cqe = &m_rx.m_cqes[head & *m_rx.m_cqMask];
+		int res            = cqe->res;
+		unsigned int flags = cqe->flags;
+
+		__atomic_store_n(m_rx.m_cqHead, head + 1U, __ATOMIC_RELEASE);
+
+		// The kernel ends a multishot receive when it runs out of buffers or hits an error
+		if ((flags & IORING_CQE_F_MORE) == 0U)
+			m_armed = false;
+
+		if (res < 0) {
+			if (res == -ENOBUFS) {
+				// The datagrams wait in the socket until the receive is armed again
+				if (!m_armed && !arm())
+					return -1;
+				continue;
+			}
+
+			LogError("Error returned from recvmsg, err: %d", -res);
+			return -1;
+		}
+
+		if ((flags & IORING_CQE_F_BUFFER) == 0U)
+			continue;
+
+		unsigned int id = flags >> IORING_CQE_BUFFER_SHIFT;
+		const unsigned char* data = m_buffers + id * UDP_RING_BUFFER_LENGTH;
+
+		const struct io_uring_recvmsg_out* out = (const struct io_uring_recvmsg_out*)data;
+		const struct sockaddr_in* addr = (const struct sockaddr_in*)(data + sizeof(struct io_uring_recvmsg_out));
+
+		unsigned int offset = sizeof(struct io_uring_recvmsg_out) + m_recvMsg.msg_namelen + m_recvMsg.msg_controllen;
+		unsigned int len = out->payloadlen;
+		if (offset + len > (unsigned int)res)
+			len = (unsigned int)res - offset;
+		if (len > length)
+			len = length;
+
+		::memcpy(buffer, data + offset, len);
+
+		address = addr->sin_addr;
+		port    = ntohs(addr->sin_port);
+
+		recycle(id);
+
+		// An empty datagram carries nothing for the networks
+		if (len == 0U)
+			continue;
+
+		return int(len);
+	}
+}
+
+bool CUDPRing::write(const unsigned char* buffer, unsigned int length, const in_addr& address, unsigned int port)
+{
+	assert(buffer != NULL);
+	assert(length > 0U);
+
+	sockaddr_in addr;
+	::memset(&addr, 0x00, sizeof(sockaddr_in));
+
+	addr.sin_family = AF_INET;
+	addr.sin_addr   = address;
+	addr.sin_port   = htons(port);
+
+	if (length > UDP_RING_BUFFER_LENGTH) {
+		s_systemCalls.fetch_add(1ULL, std::memory_order_relaxed);
+		ssize_t ret = ::sendto(m_fd, (char *)buffer, length, 0, (sockaddr *)&addr, sizeof(sockaddr_in));
+		if (ret < 0) {
+			LogError("Error returned from sendto, err: %d", errno);
+			return false;
+		}
+
+		return ret == ssize_t(length);
+	}
+
+	m_mutex.lock();
+	bool ret = send(addr, buffer, length);
+	m_mutex.unlock();
+
+	return ret;
+}
+
+bool CUDPRing::send(const sockaddr_in& addr, const unsigned char* buffer, unsigned int length)
+{
+	int result;
+	reap(UDP_RING_SLOTS, result);
+
+	unsigned int n = UDP_RING_SLOTS;
+	while (n == UDP_RING_SLOTS) {
+		for (unsigned int i = 0U; i < UDP_RING_SLOTS; i++) {
+			if (!m_slots[i].m_busy) {
+				n = i;
+				break;
+			}
+		}
+
+		// Every slot is still in the kernel, wait for one of them
+		if (n == UDP_RING_SLOTS) {
+			if (!submit(m_tx, 0U, 1U))
+				return false;
+			reap(UDP_RING_SLOTS, result);
+		}
+	}
+
+	CSendSlot& slot = m_slots[n];
+	::memcpy(slot.m_data, buffer, length);
+	slot.m_iov.iov_len = length;
+	slot.m_addr = addr;
+	slot.m_busy = true;
+
+	unsigned int tail  = *m_tx.m_sqTail;
+	unsigned int index = tail & *m_tx.m_sqMask;
+
+	struct io_uring_sqe* sqe = &m_tx.m_sqes[index];
+	::memset(sqe, 0x00, sizeof(struct io_uring_sqe));
+	sqe->opcode    = IORING_OP_SENDMSG;
+	sqe->fd        = m_fd;
+	sqe->addr      = (unsigned long long)&slot.m_msg;
+	sqe->len       = 1U;
+	sqe->user_data = n;
+
+	m_tx.m_sqArray[index] = index;
+	__atomic_store_n(m_tx.m_sqTail, tail + 1U, __ATOMIC_RELEASE);
+
+	if (!submit(m_tx, 1U, 0U)) {
+		slot.m_busy = false;
+		return false;
+	}
+
+	// A datagram is normally sent before the submit returns, otherwise its result is logged when it is reaped
+	if (!reap(n, result))
+		return true;
+
+	if (result < 0) {
+		LogError("Error returned from sendmsg, err: %d", -result);
+		return false;
+	}
+
+	return result == int(length);
+}
+
+void CUDPRing::close()
+{
+	// Closing the rings cancels the receive before its buffers go
+	release(m_rx);
+	release(m_tx);
+
+	if (m_bufRing != NULL) {
+		::munmap(m_bufRing, UDP_RING_BUFFERS * sizeof(struct io_uring_buf));
+		m_bufRing = NULL;
+	}
+
+	delete[] m_buffers;
+	m_buffers = NULL;
+
+	m_armed = false;
+}
+
+bool CUDPRing::setup(CUringQueue& queue, unsigned int entries, unsigned int cqEntries)
+{
+	struct io_uring_params params;
+	::memset(&params, 0x00, sizeof(struct io_uring_params));
+	if (cqEntries > 0U) {
+		params.flags      = IORING_SETUP_CQSIZE;
+		params.cq_entries = cqEntries;
+	}
+
+	int fd = ::syscall(__NR_io_uring_setup, entries, &params);
+	if (fd < 0) {
+		LogWarning("Cannot create the io_uring, err: %d", errno);
+		return false;
+	}
+
+	queue.m_fd = fd;
+
+	// Kernels old enough to need separate mappings also lack the multishot receive
+	if ((params.features & IORING_FEAT_SINGLE_MMAP) == 0U) {
+		LogWarning("The io_uring of this kernel is too old");
+		return false;
+	}
+
+	unsigned int sqSize = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+	unsigned int cqSize = params.cq_off.cqes  + params.cq_entries * sizeof(struct io_uring_cqe);
+	queue.m_mapSize = sqSize > cqSize ? sqSize : cqSize;
+
+	void* map = ::mmap(NULL, queue.m_mapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+	if (map == MAP_FAILED) {
+		LogWarning("Cannot map the io_uring queues, err: %d", errno);
+		return false;
+	}
+
+	queue.m_map = map;
+
+	queue.m_sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+	void* sqes = ::mmap(NULL, queue.m_sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+	if (sqes == MAP_FAILED) {
+		LogWarning("Cannot map the io_uring entries, err: %d", errno);
+		queue.m_sqes = NULL;
+		return false;
+	}
+
+	queue.m_sqes = (struct io_uring_sqe*)sqes;
+
+	unsigned char* base = (unsigned char*)map;
+	queue.m_sqHead  = (unsigned int*)(base + params.sq_off.head);
+	queue.m_sqTail  = (unsigned int*)(base + params.sq_off.tail);
+	queue.m_sqMask  = (unsigned int*)(base + params.sq_off.ring_mask);
+	queue.m_sqArray = (unsigned int*)(base + params.sq_off.array);
+	queue.m_cqHead  = (unsigned int*)(base + params.cq_off.head);
+	queue.m_cqTail  = (unsigned int*)(base + params.cq_off.tail);
+	queue.m_cqMask  = (unsigned int*)(base + params.cq_off.ring_mask);
+	queue.m_cqes    = (struct io_uring_cqe*)(base + params.cq_off.cqes);
+
+	return true;
+}
+
+void CUDPRing::release(CUringQueue& queue)
+{
+	if (queue.m_map != NULL) {
+		if (queue.m_sqes != NULL)
+			::munmap(queue.m_sqes, queue.m_sqesSize);
+		::munmap(queue.m_map, queue.m_mapSize);
+		queue.m_map = NULL;
+	}
+
+	if (queue.m_fd >= 0) {
+		::close(queue.m_fd);
+		queue.m_fd = -1;
+	}
+}
+
+bool CUDPRing::submit(CUringQueue& queue, unsigned int count, unsigned int wait)
+{
+	for (;;) {
+		s_systemCalls.fetch_add(1ULL, std::memory_order_relaxed);
+
+		int ret = ::syscall(__NR_io_uring_enter, queue.m_fd, count, wait, wait > 0U ? IORING_ENTER_GETEVENTS : 0U, NULL, 0);
+		if (ret >= 0)
+			return true;
+
+		if (errno != EINTR) {
+			LogError("Error returned from io_uring_enter, err: %d", errno);
+			return false;
+		}
+
+		// Interrupted before anything was submitted, so the same entries go again
+	}
+}
+
+bool CUDPRing::arm()
+{
+	unsigned int tail  = *m_rx.m_sqTail;
+	unsigned int index = tail & *m_rx.m_sqMask;
+
+	struct io_uring_sqe* sqe = &m_rx.m_sqes[index];
+	::memset(sqe, 0x00, sizeof(struct io_uring_sqe));
+	sqe->opcode    = IORING_OP_RECVMSG;
+	sqe->fd        = m_fd;
+	sqe->addr      = (unsigned long long)&m_recvMsg;
+	sqe->flags     = IOSQE_BUFFER_SELECT;
+	sqe->ioprio    = IORING_RECV_MULTISHOT;
+	sqe->buf_group = UDP_RING_GROUP;
+
+	m_rx.m_sqArray[index] = index;
+	__atomic_store_n(m_rx.m_sqTail, tail + 1U, __ATOMIC_RELEASE);
+
+	if (!submit(m_rx, 1U, 0U))
+		return false;
+
+	m_armed = true;
+
+	return true;
+}
+
+void CUDPRing::recycle(unsigned int id)
+{
+	assert(id < UDP_RING_BUFFERS);
+
+	unsigned short tail = m_bufRing->tail;
+
+	// C++ places the flexible array of the kernel header past an empty struct, so the entries are found from the start of the ring
+	struct io_uring_buf* buf = (struct io_uring_buf*)m_bufRing + (tail & (UDP_RING_BUFFERS - 1U));
+	buf->addr = (unsigned long long)(m_buffers + id * UDP_RING_BUFFER_LENGTH);
+	buf->len  = UDP_RING_BUFFER_LENGTH;
+	buf->bid  = id;
+
+	__atomic_store_n(&m_bufRing->tail, (unsigned short)(tail + 1U), __ATOMIC_RELEASE);
+}
+
+bool CUDPRing::reap(unsigned int slot, int& result)
+{
+	bool found = false;
+
+	for (;;) {
+		unsigned int head = *m_tx.m_cqHead;
+		if (head == __atomic_load_n(m_tx.m_cqTail, __ATOMIC_ACQUIRE))
+			return found;
+
+		const struct io_uring_cqe* cqe = &m_tx.m_cqes[head & *m_tx.m_cqMask];
+		unsigned int n = (unsigned int)cqe->user_data;
+		int res        = cqe->res;
+
+		__atomic_store_n(m_tx.m_cqHead, head + 1U, __ATOMIC_RELEASE);
+
+		if (n >= UDP_RING_SLOTS)
+			continue;
+
+		m_slots[n].m_busy = false;
+
+		if (n == slot) {
+			result = res;
+			found  = true;
+		} else if (res < 0) {
+			LogError("Error returned from sendmsg, err: %d", -res);
+		}
+	}
+}
+
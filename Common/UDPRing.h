@@ -0,0 +1,104 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(UDPRing_H)
+#define	UDPRing_H
+
+#include "Mutex.h"
+
+#include <linux/io_uring.h>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+const unsigned int UDP_RING_BUFFERS = 64U;
+const unsigned int UDP_RING_SLOTS   = 16U;
+
+// Large enough for any frame the bridges exchange, a longer datagram is truncated as recvfrom() would do
+const unsigned int UDP_RING_BUFFER_LENGTH = 1024U;
+
+// One io_uring, its submission and completion queues mapped into the process
+struct CUringQueue {
+	int                  m_fd;
+	void*                m_map;
+	unsigned int         m_mapSize;
+	struct io_uring_sqe* m_sqes;
+	unsigned int         m_sqesSize;
+	unsigned int*        m_sqHead;
+	unsigned int*        m_sqTail;
+	unsigned int*        m_sqMask;
+	unsigned int*        m_sqArray;
+	unsigned int*        m_cqHead;
+	unsigned int*        m_cqTail;
+	unsigned int*        m_cqMask;
+	struct io_uring_cqe* m_cqes;
+};
+
+// The io_uring path of one CUDPSocket. A multishot recvmsg fills a ring of
+// buffers registered with the kernel, so looking for a datagram is a read of
+// shared memory rather than a system call. Only one thread may read. Sends go
+// through a second ring under a lock, so any number of threads may write, as
+// they may to the plain socket.
+class CUDPRing {
+public:
+	CUDPRing(int fd);
+	~CUDPRing();
+
+	bool open();
+
+	int  read(unsigned char* buffer, unsigned int length, in_addr& address, unsigned int& port);
+	bool write(const unsigned char* buffer, unsigned int length, const in_addr& address, unsigned int port);
+
+	void close();
+
+	static unsigned long long getSystemCalls();
+
+private:
+	struct CSendSlot {
+		struct msghdr      m_msg;
+		struct iovec       m_iov;
+		struct sockaddr_in m_addr;
+		unsigned char      m_data[UDP_RING_BUFFER_LENGTH];
+		bool               m_busy;
+	};
+
+	int                      m_fd;
+	CUringQueue              m_rx;
+	CUringQueue              m_tx;
+	struct io_uring_buf_ring* m_bufRing;
+	unsigned char*           m_buffers;
+	struct msghdr            m_recvMsg;
+	bool                     m_armed;
+	CSendSlot                m_slots[UDP_RING_SLOTS];
+	CMutex                   m_mutex;		// The send slots and the send ring
+
+	bool setup(CUringQueue& queue, unsigned int entries, unsigned int cqEntries);
+	void release(CUringQueue& queue);
+	bool submit(CUringQueue& queue, unsigned int count, unsigned int wait);
+
+	bool send(const sockaddr_in& addr, const unsigned char* buffer, unsigned int length);
+
+	bool arm();
+	void recycle(unsigned int id);
+
+	// Frees the slots of the sends the kernel has finished with, true when the one given is among them
+	bool reap(unsigned int slot, int& result);
+};
+
+#endif
@@ -19,6 +19,15 @@
 #include "UDPSocket.h"
 #include "Log.h"
 
+#if defined(USE_IO_URING)
+#include "UDPRing.h"
+#endif
+
+#if defined(__linux__)
+#include "LocalLink.h"
+#endif
+
+#include <atomic>
 #include <cassert>
 
 #if !defined(_WIN32) && !defined(_WIN64)
@@ -26,11 +35,22 @@
 #include <cstring>
 #endif
 
+#if defined(USE_IO_URING)
+UDP_BACKEND CUDPSocket::s_backend = UDPB_IO_URING;
+#else
+UDP_BACKEND CUDPSocket::s_backend = UDPB_SELECT;
+#endif
+
+bool CUDPSocket::s_sharedMemory = false;
+
+static std::atomic<unsigned long long> s_systemCalls(0ULL);
 
 CUDPSocket::CUDPSocket(const std::string& address, unsigned int port) :
 m_address(address),
 m_port(port),
-m_fd(-1)
+m_fd(-1),
+m_ring(NULL),
+m_link(NULL)
 {
 	assert(!address.empty());
 
@@ -45,7 +65,9 @@ m_fd(-1)
 CUDPSocket::CUDPSocket(unsigned int port) :
 m_address(),
 m_port(port),
-m_fd(-1)
+m_fd(-1),
+m_ring(NULL),
+m_link(NULL)
 {
 #if defined(_WIN32) || defined(_WIN64)
 	WSAData data;
@@ -57,48 +79,16 @@ m_fd(-1)
 
 CUDPSocket::~CUDPSocket()
 {
-#if defined(_WIN32) || defined(_WIN64)
-	::WSACleanup();
+#if defined(USE_IO_URING)
+	delete m_ring;
 #endif
-}
-
-in_addr CUDPSocket::lookup(const std::string& hostname)
-{
-	in_addr addr;
-#if defined(_WIN32) || defined(_WIN64)
-	unsigned long address = ::inet_addr(hostname.c_str());
-	if (address != INADDR_NONE && address != INADDR_ANY) {
-		addr.s_addr = address;
-		return addr;
-	}
-
-	struct hostent* hp = ::gethostbyname(hostname.c_str());
-	if (hp != NULL) {
-		::memcpy(&addr, hp->h_addr_list[0], sizeof(struct in_addr));
-		return addr;
-	}
-
-	LogError("Cannot find address for host %s", hostname.c_str());
 
-	addr.s_addr = INADDR_NONE;
-	return addr;
-#else
-	in_addr_t address = ::inet_addr(hostname.c_str());
-	if (address != in_addr_t(-1)) {
-		addr.s_addr = address;
-		return addr;
-	}
-
-	struct hostent* hp = ::gethostbyname(hostname.c_str());
-	if (hp != NULL) {
-		::memcpy(&addr, hp->h_addr_list[0], sizeof(struct in_addr));
-		return addr;
-	}
-
-	LogError("Cannot find address for host %s", hostname.c_str());
+#if defined(__linux__)
+	delete m_link;
+#endif
 
-	addr.s_addr = INADDR_NONE;
-	return addr;
+#if defined(_WIN32) || defined(_WIN64)
+	::WSACleanup();
 #endif
 }
 
@@ -153,6 +143,33 @@ bool CUDPSocket::open()
 		}
 	}
 
+#if defined(USE_IO_URING)
+	delete m_ring;
+	m_ring = NULL;
+
+	if (s_backend == UDPB_IO_URING) {
+		m_ring = new CUDPRing(m_fd);
+		if (!m_ring->open()) {
+			delete m_ring;
+			m_ring = NULL;
+
+			// Said once, the sockets opened later go straight to select()
+			LogWarning("io_uring is not usable here, the UDP sockets fall back to select()");
+			s_backend = UDPB_SELECT;
+		}
+	}
+#endif
+
+#if defined(__linux__)
+	delete m_link;
+	m_link = NULL;
+
+	if (s_sharedMemory) {
+		m_link = new CLocalLink(m_fd, m_port);
+		m_link->open();
+	}
+#endif
+
 	return true;
 }
 
@@ -161,6 +178,21 @@ int CUDPSocket::read(unsigned char* buffer, unsigned int length, in_addr& addres
 	assert(buffer != NULL);
 	assert(length > 0U);
 
+#if defined(__linux__)
+	if (m_link != NULL) {
+		int len = m_link->read(buffer, length, address, port);
+		if (len > 0)
+			return len;
+	}
+#endif
+
+#if defined(USE_IO_URING)
+	if (m_ring != NULL)
+		return m_ring->read(buffer, length, address, port);
+#endif
+
+	s_systemCalls.fetch_add(1ULL, std::memory_order_relaxed);
+
 	// Check that the readfrom() won't block
 	fd_set readFds;
 	FD_ZERO(&readFds);
@@ -195,6 +227,8 @@ int CUDPSocket::read(unsigned char* buffer, unsigned int length, in_addr& addres
 	socklen_t size = sizeof(sockaddr_in);
 #endif
 
+	s_systemCalls.fetch_add(1ULL, std::memory_order_relaxed);
+
 #if defined(_WIN32) || defined(_WIN64)
 	int len = ::recvfrom(m_fd, (char*)buffer, length, 0, (sockaddr *)&addr, &size);
 #else
@@ -220,6 +254,29 @@ bool CUDPSocket::write(const unsigned char* buffer, unsigned int length, const i
 	assert(buffer != NULL);
 	assert(length > 0U);
 
+	// The name of the peer has not resolved yet
+	if (address.s_addr == INADDR_NONE)
+		return false;
+
+#if defined(__linux__)
+	if (m_link != NULL) {
+		switch (m_link->write(buffer, length, address, port)) {
+		case LR_SENT:
+			return true;
+		case LR_FULL:
+			// The peer has stopped reading, UDP would only overtake what is queued
+			return false;
+		default:
+			break;
+		}
+	}
+#endif
+
+#if defined(USE_IO_URING)
+	if (m_ring != NULL)
+		return m_ring->write(buffer, length, address, port);
+#endif
+
 	sockaddr_in addr;
 	::memset(&addr, 0x00, sizeof(sockaddr_in));
 
@@ -227,6 +284,8 @@ bool CUDPSocket::write(const unsigned char* buffer, unsigned int length, const i
 	addr.sin_addr   = address;
 	addr.sin_port   = htons(port);
 
+	s_systemCalls.fetch_add(1ULL, std::memory_order_relaxed);
+
 #if defined(_WIN32) || defined(_WIN64)
 	int ret = ::sendto(m_fd, (char *)buffer, length, 0, (sockaddr *)&addr, sizeof(sockaddr_in));
 #else
@@ -254,9 +313,86 @@ bool CUDPSocket::write(const unsigned char* buffer, unsigned int length, const i
 
 void CUDPSocket::close()
 {
+#if defined(__linux__)
+	delete m_link;
+	m_link = NULL;
+#endif
+
+#if defined(USE_IO_URING)
+	delete m_ring;
+	m_ring = NULL;
+#endif
+
 #if defined(_WIN32) || defined(_WIN64)
 	::closesocket(m_fd);
 #else
 	::close(m_fd);
 #endif
 }
+
+bool CUDPSocket::setBackend(UDP_BACKEND backend)
+{
+#if !defined(USE_IO_URING)
+	if (backend == UDPB_IO_URING)
+		return false;
+#endif
+
+	s_backend = backend;
+
+	return true;
+}
+
+UDP_BACKEND CUDPSocket::getBackend()
+{
+	return s_backend;
+}
+
+const char* CUDPSocket::getName(UDP_BACKEND backend)
+{
+	switch (backend) {
+	case UDPB_IO_URING:
+		return "io_uring";
+	default:
+		return "select";
+	}
+}
+
+void CUDPSocket::setSharedMemory(bool enabled)
+{
+#if defined(__linux__)
+	s_sharedMemory = enabled;
+#else
+	if (enabled)
+		LogWarning("Shared memory links are only available on Linux");
+#endif
+}
+
+void CUDPSocket::setSharedMemoryUser(const std::string& user)
+{
+#if defined(__linux__)
+	CLocalLink::setPeerUser(user);
+#endif
+}
+
+bool CUDPSocket::isLinked() const
+{
+#if defined(__linux__)
+	return m_link != NULL && m_link->isUp();
+#else
+	return false;
+#endif
+}
+
+unsigned long long CUDPSocket::getSystemCalls()
+{
+	unsigned long long calls = s_systemCalls.load(std::memory_order_relaxed);
+
+#if defined(USE_IO_URING)
+	calls += CUDPRing::getSystemCalls();
+#endif
+#if defined(__linux__)
+	calls += CLocalLink::getSystemCalls();
+#endif
+
+	return calls;
+}
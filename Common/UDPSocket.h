@@ -34,6 +34,14 @@
 #include <winsock.h>
 #endif
 
+enum UDP_BACKEND {
+	UDPB_SELECT,
+	UDPB_IO_URING
+};
+
+class CUDPRing;
+class CLocalLink;
+
 class CUDPSocket {
 public:
 	CUDPSocket(const std::string& address, unsigned int port = 0U);
@@ -47,12 +55,31 @@ public:
 
 	void close();
 
-	static in_addr lookup(const std::string& hostName);
+	// Sockets opened afterwards use this backend, io_uring is only there in a build made with IO_URING=1
+	static bool setBackend(UDP_BACKEND backend);
+	static UDP_BACKEND getBackend();
+	static const char* getName(UDP_BACKEND backend);
+
+	// Sockets opened afterwards offer co-located peers a shared memory link, only on Linux
+	static void setSharedMemory(bool enabled);
+	// Besides those of the same user, the processes of this user may link too
+	static void setSharedMemoryUser(const std::string& user);
+
+	// Whether the frames for the peer currently go through shared memory
+	bool isLinked() const;
+
+	// System calls made by all the sockets so far, for the benchmarks
+	static unsigned long long getSystemCalls();
 
 private:
 	std::string    m_address;
 	unsigned short m_port;
 	int            m_fd;
+	CUDPRing*      m_ring;
+	CLocalLink*    m_link;
+
+	static UDP_BACKEND s_backend;
+	static bool        s_sharedMemory;
 };
 
 #endif
@@ -0,0 +1,168 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "ViterbiACS.h"
+
+#include <cstddef>
+
+#if defined(VITERBI_ACS_X86)
+#include <immintrin.h>
+#endif
+
+#if defined(VITERBI_ACS_NEON)
+#include <arm_neon.h>
+#endif
+
+#if defined(VITERBI_ACS_NEON_TARGET)
+#define	NEON_TARGET	__attribute__((target("fpu=neon")))
+#else
+#define	NEON_TARGET
+#endif
+
+const unsigned int NUM_OF_STATES_D2 = 8U;
+
+// NULL selects the inline scalar code in the header
+CViterbiACS::ACS_FUNC CViterbiACS::s_acs = NULL;
+
+void CViterbiACS::select(CPU_KERNELS kernels)
+{
+	switch (kernels) {
+#if defined(VITERBI_ACS_X86)
+	case CPUK_SSE41:
+		s_acs = acsSSE41;
+		break;
+	case CPUK_AVX2:
+		s_acs = acsAVX2;
+		break;
+#endif
+#if defined(VITERBI_ACS_NEON)
+	case CPUK_NEON:
+		s_acs = acsNEON;
+		break;
+#endif
+	default:
+		s_acs = NULL;
+		break;
+	}
+}
+
+#if defined(VITERBI_ACS_X86)
+__attribute__((target("sse4.1")))
+uint64_t CViterbiACS::acsSSE41(const uint16_t* oldMetrics, uint16_t* newMetrics, const uint16_t* metric, uint16_t m)
+{
+	__m128i lo  = _mm_loadu_si128((const __m128i*)oldMetrics);
+	__m128i hi  = _mm_loadu_si128((const __m128i*)(oldMetrics + NUM_OF_STATES_D2));
+	__m128i met = _mm_loadu_si128((const __m128i*)metric);
+	__m128i inv = _mm_sub_epi16(_mm_set1_epi16(short(m)), met);
+
+	// The survivor is the unsigned minimum, ties go to the upper half
+	__m128i m0 = _mm_add_epi16(lo, met);
+	__m128i m1 = _mm_add_epi16(hi, inv);
+	__m128i s0 = _mm_min_epu16(m0, m1);
+	__m128i d0 = _mm_cmpeq_epi16(s0, m1);
+
+	m0 = _mm_add_epi16(lo, inv);
+	m1 = _mm_add_epi16(hi, met);
+	__m128i s1 = _mm_min_epu16(m0, m1);
+	__m128i d1 = _mm_cmpeq_epi16(s1, m1);
+
+	_mm_storeu_si128((__m128i*)newMetrics, _mm_unpacklo_epi16(s0, s1));
+	_mm_storeu_si128((__m128i*)(newMetrics + NUM_OF_STATES_D2), _mm_unpackhi_epi16(s0, s1));
+
+	__m128i d = _mm_packs_epi16(_mm_unpacklo_epi16(d0, d1), _mm_unpackhi_epi16(d0, d1));
+
+	return uint64_t(_mm_movemask_epi8(d));
+}
+
+__attribute__((target("avx2")))
+uint64_t CViterbiACS::acsAVX2(const uint16_t* oldMetrics, uint16_t* newMetrics, const uint16_t* metric, uint16_t m)
+{
+	__m128i lo  = _mm_loadu_si128((const __m128i*)oldMetrics);
+	__m128i hi  = _mm_loadu_si128((const __m128i*)(oldMetrics + NUM_OF_STATES_D2));
+	__m128i met = _mm_loadu_si128((const __m128i*)metric);
+	__m128i inv = _mm_sub_epi16(_mm_set1_epi16(short(m)), met);
+
+	// Both butterflies in one register, the low lane makes the even states and the high lane the odd ones
+	__m256i upper = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), lo, 1);
+	__m256i lower = _mm256_inserti128_si256(_mm256_castsi128_si256(hi), hi, 1);
+	__m256i bm0   = _mm256_inserti128_si256(_mm256_castsi128_si256(met), inv, 1);
+	__m256i bm1   = _mm256_inserti128_si256(_mm256_castsi128_si256(inv), met, 1);
+
+	__m256i m0 = _mm256_add_epi16(upper, bm0);
+	__m256i m1 = _mm256_add_epi16(lower, bm1);
+	__m256i s  = _mm256_min_epu16(m0, m1);
+	__m256i d  = _mm256_cmpeq_epi16(s, m1);
+
+	__m128i s0 = _mm256_castsi256_si128(s);
+	__m128i s1 = _mm256_extracti128_si256(s, 1);
+	__m128i d0 = _mm256_castsi256_si128(d);
+	__m128i d1 = _mm256_extracti128_si256(d, 1);
+
+	_mm_storeu_si128((__m128i*)newMetrics, _mm_unpacklo_epi16(s0, s1));
+	_mm_storeu_si128((__m128i*)(newMetrics + NUM_OF_STATES_D2), _mm_unpackhi_epi16(s0, s1));
+
+	__m128i dd = _mm_packs_epi16(_mm_unpacklo_epi16(d0, d1), _mm_unpackhi_epi16(d0, d1));
+
+	return uint64_t(_mm_movemask_epi8(dd));
+}
+#endif
+
+#if defined(VITERBI_ACS_NEON)
+NEON_TARGET
+uint64_t CViterbiACS::acsNEON(const uint16_t* oldMetrics, uint16_t* newMetrics, const uint16_t* metric, uint16_t m)
+{
+	static const uint16_t DECISION_WEIGHTS[] = {0x01U, 0x02U, 0x04U, 0x08U, 0x10U, 0x20U, 0x40U, 0x80U};
+
+	uint16x8_t lo  = vld1q_u16(oldMetrics);
+	uint16x8_t hi  = vld1q_u16(oldMetrics + NUM_OF_STATES_D2);
+	uint16x8_t met = vld1q_u16(metric);
+	uint16x8_t inv = vsubq_u16(vdupq_n_u16(m), met);
+
+	uint16x8_t m0 = vaddq_u16(lo, met);
+	uint16x8_t m1 = vaddq_u16(hi, inv);
+	uint16x8_t s0 = vminq_u16(m0, m1);
+	uint16x8_t d0 = vcgeq_u16(m0, m1);
+
+	m0 = vaddq_u16(lo, inv);
+	m1 = vaddq_u16(hi, met);
+	uint16x8_t s1 = vminq_u16(m0, m1);
+	uint16x8_t d1 = vcgeq_u16(m0, m1);
+
+	uint16x8x2_t s = vzipq_u16(s0, s1);
+	vst1q_u16(newMetrics, s.val[0]);
+	vst1q_u16(newMetrics + NUM_OF_STATES_D2, s.val[1]);
+
+	// There is no movemask, weight each lane by its bit and add them up
+	uint16x8x2_t d = vzipq_u16(d0, d1);
+	uint16x8_t w   = vld1q_u16(DECISION_WEIGHTS);
+	uint16x8_t b0  = vandq_u16(d.val[0], w);
+	uint16x8_t b1  = vandq_u16(d.val[1], w);
+
+#if defined(__aarch64__)
+	uint64_t decisions = uint64_t(vaddvq_u16(b0)) | (uint64_t(vaddvq_u16(b1)) << 8);
+#else
+	uint16x4_t p0 = vpadd_u16(vget_low_u16(b0), vget_high_u16(b0));
+	uint16x4_t p1 = vpadd_u16(vget_low_u16(b1), vget_high_u16(b1));
+	uint16x4_t p  = vpadd_u16(p0, p1);
+	p = vpadd_u16(p, p);
+	uint64_t decisions = uint64_t(vget_lane_u16(p, 0)) | (uint64_t(vget_lane_u16(p, 1)) << 8);
+#endif
+
+	return decisions;
+}
+#endif
@@ -0,0 +1,90 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(ViterbiACS_H)
+#define	ViterbiACS_H
+
+#include "CPUDispatch.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define	VITERBI_ACS_X86
+#endif
+
+#if defined(__GNUC__) && (defined(__aarch64__) || defined(__ARM_NEON))
+#define	VITERBI_ACS_NEON
+#elif defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 8 && defined(__arm__) && defined(__ARM_FP)
+// The stock armhf and armv6 builds leave NEON off, so this variant turns it on for
+// itself and is only picked when HWCAP reports NEON at runtime
+#define	VITERBI_ACS_NEON
+#define	VITERBI_ACS_NEON_TARGET
+#endif
+
+// The add-compare-select step shared by the 16 state, K=5 decoders in CYSFConvolution
+// and CNXDNConvolution. State i and i + 8 feed states 2i and 2i + 1, with branch
+// metrics metric[i] and m - metric[i]. All the variants wrap the 16-bit path metrics
+// exactly as the original scalar loop did, so their output is bit for bit identical.
+class CViterbiACS {
+public:
+	// Returns the decision bits, bit j is set when state j survives from the upper half
+	static uint64_t acs(const uint16_t* oldMetrics, uint16_t* newMetrics, const uint16_t* metric, uint16_t m)
+	{
+		// The scalar code stays inline, an indirect call costs it more than it saves
+		if (s_acs != NULL)
+			return s_acs(oldMetrics, newMetrics, metric, m);
+
+		uint64_t decisions = 0U;
+
+		for (unsigned int i = 0U; i < 8U; i++) {
+			unsigned int j = i * 2U;
+
+			uint16_t m0 = oldMetrics[i] + metric[i];
+			uint16_t m1 = oldMetrics[i + 8U] + (m - metric[i]);
+			uint8_t decision0 = (m0 >= m1) ? 1U : 0U;
+			newMetrics[j + 0U] = decision0 != 0U ? m1 : m0;
+
+			m0 = oldMetrics[i] + (m - metric[i]);
+			m1 = oldMetrics[i + 8U] + metric[i];
+			uint8_t decision1 = (m0 >= m1) ? 1U : 0U;
+			newMetrics[j + 1U] = decision1 != 0U ? m1 : m0;
+
+			decisions |= (uint64_t(decision1) << (j + 1U)) | (uint64_t(decision0) << (j + 0U));
+		}
+
+		return decisions;
+	}
+
+	static void select(CPU_KERNELS kernels);
+
+private:
+	typedef uint64_t (*ACS_FUNC)(const uint16_t* oldMetrics, uint16_t* newMetrics, const uint16_t* metric, uint16_t m);
+
+	static ACS_FUNC s_acs;
+
+#if defined(VITERBI_ACS_X86)
+	static uint64_t acsSSE41(const uint16_t* oldMetrics, uint16_t* newMetrics, const uint16_t* metric, uint16_t m);
+	static uint64_t acsAVX2(const uint16_t* oldMetrics, uint16_t* newMetrics, const uint16_t* metric, uint16_t m);
+#endif
+#if defined(VITERBI_ACS_NEON)
+	static uint64_t acsNEON(const uint16_t* oldMetrics, uint16_t* newMetrics, const uint16_t* metric, uint16_t m);
+#endif
+};
+
+#endif
@@ -26,7 +26,10 @@
 #include "Timer.h"
 #include "StopWatch.h"
 #include "RingBuffer.h"
+#include "TGList.h"
 
+#include <unordered_map>
+#include <memory>
 #include <vector>
 #include <string>
 
@@ -49,23 +52,29 @@ enum WXSI_STATUS {
 	WXSI_CATEGORY
 };
 
-class CTGReg {
+// A reply half that carries the sequence number or the CRC, so it is encoded again on every send
+struct CWiresXPatch {
+	unsigned int m_frame;
+	bool         m_second;
+	unsigned int m_offset;
+	bool         m_shifted;
+};
+
+class CWiresXReply {
 public:
-	CTGReg() :
-	m_id(),
-	m_name(),
-	m_desc()
+	CWiresXReply() :
+	m_frames(),
+	m_patches()
 	{
 	}
 
-	std::string  m_id;
-	std::string  m_name;
-	std::string  m_desc;
+	std::vector<unsigned char> m_frames;
+	std::vector<CWiresXPatch>  m_patches;
 };
 
 class CWiresX {
 public:
-	CWiresX(const std::string& callsign, const std::string& suffix, CYSFNetwork* network, std::string tgfile, bool makeUpper);
+	CWiresX(const std::string& callsign, const std::string& suffix, CYSFNetwork* network, CTGList* tgList);
 	~CWiresX();
 
 	bool start();
@@ -74,9 +83,6 @@ public:
 
 	unsigned int getDstID();
 
-	CTGReg* findById(unsigned int id);
-	std::vector<CTGReg*>& TGSearch(const std::string& name);
-
 	void processConnect(int reflector);
 	void processDisconnect(const unsigned char* source = NULL);
 	void setInfo(const std::string& name, unsigned int txFrequency, unsigned int rxFrequency, int reflector);
@@ -103,12 +109,12 @@ private:
 	WXSI_STATUS          m_status;
 	unsigned int         m_start;
 	std::string          m_search;
-	std::vector<CTGReg*> m_currTGList;
-	std::vector<CTGReg*> m_TGSearch;
-	std::vector<CTGReg*> m_category;
-	bool                 m_makeUpper;
+	CTGList*             m_tgList;
+	std::shared_ptr<const CTGTable> m_table;
+	std::vector<const CTGReg*> m_category;
 	CStopWatch           m_txWatch;
 	CRingBuffer<unsigned char> m_bufferTX;
+	std::unordered_map<std::string, CWiresXReply*> m_replies;
 
 	WX_STATUS processConnect(const unsigned char* source, const unsigned char* data);
 	void processDX(const unsigned char* source);
@@ -121,7 +127,12 @@ private:
 	void sendSearchNotFoundReply();
 	void sendCategoryReply();
 
+	unsigned int writeEntries(unsigned char* data, const std::vector<const CTGReg*>& list, unsigned int first, unsigned int n, bool search) const;
 	void createReply(const unsigned char* data, unsigned int length);
+	CWiresXReply* encodeReply(const unsigned char* data, unsigned int length) const;
+	void addPatch(CWiresXReply* reply, bool second, unsigned int offset, bool shifted, unsigned int length) const;
+	void patchReply(CWiresXReply* reply, const unsigned char* data) const;
+	void clearReplies();
 	void writeData(const unsigned char* data);
 	unsigned char calculateFT(unsigned int length, unsigned int offset) const;
 };
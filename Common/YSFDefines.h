@@ -40,6 +40,7 @@ const unsigned char YSF_DT_DATA_FR_MODE  = 0x01U;
 const unsigned char YSF_DT_VD_MODE2      = 0x02U;
 const unsigned char YSF_DT_VOICE_FR_MODE = 0x03U;
 
+const unsigned char YSF_CM_GROUP      = 0x00U;
 const unsigned char YSF_CM_GROUP1     = 0x00U;
 const unsigned char YSF_CM_GROUP2     = 0x01U;
 const unsigned char YSF_CM_INDIVIDUAL = 0x03U;
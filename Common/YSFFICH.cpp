@@ -55,15 +55,12 @@ const unsigned int INTERLEAVE_TABLE[] = {
   36U, 76U, 116U, 156U, 196U,
   38U, 78U, 118U, 158U, 198U};
 
-CYSFFICH::CYSFFICH() :
-m_fich(NULL)
+CYSFFICH::CYSFFICH()
 {
-	m_fich  = new unsigned char[6U];
 }
 
 CYSFFICH::~CYSFFICH()
 {
-	delete[] m_fich;
 }
 
 bool CYSFFICH::decode(const unsigned char* bytes)
@@ -59,7 +59,7 @@ public:
 	void load(const unsigned char* fich);
 
 private:
-	unsigned char* m_fich;
+	unsigned char m_fich[6U];
 };
 
 #endif
@@ -29,7 +29,7 @@ const unsigned int BUFFER_LENGTH = 200U;
 CYSFNetwork::CYSFNetwork(const std::string& address, unsigned int port, const std::string& callsign, bool debug) :
 m_socket(address, port),
 m_debug(debug),
-m_address(),
+m_address(NULL),
 m_port(0U),
 m_poll(NULL),
 m_unlink(NULL),
@@ -53,7 +53,7 @@ m_buffer(1000U, "YSF Network Buffer")
 CYSFNetwork::CYSFNetwork(unsigned int port, const std::string& callsign, bool debug) :
 m_socket(port),
 m_debug(debug),
-m_address(),
+m_address(NULL),
 m_port(0U),
 m_poll(NULL),
 m_unlink(NULL),
@@ -91,16 +91,16 @@ bool CYSFNetwork::open()
 	return m_socket.open();
 }
 
-void CYSFNetwork::setDestination(const in_addr& address, unsigned int port)
+void CYSFNetwork::setDestination(const std::string& address, unsigned int port)
 {
-	m_address = address;
+	m_address = CResolver::find(address);
 	m_port    = port;
 }
 
 void CYSFNetwork::clearDestination()
 {
-	m_address.s_addr = INADDR_NONE;
-	m_port           = 0U;
+	m_address = NULL;
+	m_port    = 0U;
 }
 
 bool CYSFNetwork::write(const unsigned char* data)
@@ -113,7 +113,7 @@ bool CYSFNetwork::write(const unsigned char* data)
 	if (m_debug)
 		CUtils::dump(1U, "YSF Network Data Sent", data, 155U);
 
-	return m_socket.write(data, 155U, m_address, m_port);
+	return m_socket.write(data, 155U, m_address->getAddress(), m_port);
 }
 
 bool CYSFNetwork::writePoll()
@@ -121,7 +121,7 @@ bool CYSFNetwork::writePoll()
 	if (m_port == 0U)
 		return true;
 
-	return m_socket.write(m_poll, 14U, m_address, m_port);
+	return m_socket.write(m_poll, 14U, m_address->getAddress(), m_port);
 }
 
 bool CYSFNetwork::writeUnlink()
@@ -129,7 +129,7 @@ bool CYSFNetwork::writeUnlink()
 	if (m_port == 0U)
 		return true;
 
-	return m_socket.write(m_unlink, 14U, m_address, m_port);
+	return m_socket.write(m_unlink, 14U, m_address->getAddress(), m_port);
 }
 
 void CYSFNetwork::clock(unsigned int ms)
@@ -145,7 +145,7 @@ void CYSFNetwork::clock(unsigned int ms)
 	if (length <= 0)
 		return;
 
-	if (address.s_addr != m_address.s_addr || port != m_port)
+	if (!m_address->matches(address) || port != m_port)
 		return;
 
 	if (m_debug)
@@ -21,6 +21,7 @@
 
 #include "YSFDefines.h"
 #include "UDPSocket.h"
+#include "Resolver.h"
 #include "RingBuffer.h"
 
 #include <cstdint>
@@ -36,7 +37,7 @@ public:
 
 	std::string getCallsign();
 
-	void setDestination(const in_addr& address, unsigned int port);
+	void setDestination(const std::string& address, unsigned int port);
 	void clearDestination();
 
 	bool write(const unsigned char* data);
@@ -54,7 +55,7 @@ private:
 	std::string                m_callsign;
 	CUDPSocket                 m_socket;
 	bool                       m_debug;
-	in_addr                    m_address;
+	CResolvedHost*             m_address;
 	unsigned int               m_port;
 	unsigned char*             m_poll;
 	unsigned char*             m_unlink;
@@ -33,7 +33,8 @@ enum SECTION {
   SECTION_DMR_NETWORK,
   SECTION_DMRID_LOOKUP,
   SECTION_NXDNID_LOOKUP,
-  SECTION_LOG
+  SECTION_LOG,
+  SECTION_CPU
 };
 
 CConf::CConf(const std::string& file) :
@@ -51,6 +52,7 @@ m_dmrRptPort(0U),
 m_dmrLocalAddress(),
 m_dmrLocalPort(0U),
 m_dmrDebug(false),
+m_dmrAMBECorrection(false),
 m_dmrIdLookupFile(),
 m_dmrIdLookupTime(0U),
 m_nxdnIdLookupFile(),
@@ -58,7 +60,11 @@ m_nxdnIdLookupTime(0U),
 m_logDisplayLevel(0U),
 m_logFileLevel(0U),
 m_logFilePath(),
-m_logFileRoot()
+m_logFileRoot(),
+m_cpuKernels("auto"),
+m_cpuRealTime(0U),
+m_cpuSharedMemory(false),
+m_cpuSharedMemoryUser()
 {
 }
 
@@ -92,6 +98,8 @@ bool CConf::read()
 		  section = SECTION_NXDNID_LOOKUP;
 	  else if (::strncmp(buffer, "[Log]", 5U) == 0)
 		  section = SECTION_LOG;
+	  else if (::strncmp(buffer, "[CPU]", 5U) == 0)
+		  section = SECTION_CPU;
 	  else
         section = SECTION_NONE;
 
@@ -144,6 +152,8 @@ bool CConf::read()
 			m_dmrLocalPort = (unsigned int)::atoi(value);
 		else if (::strcmp(key, "Debug") == 0)
 			m_dmrDebug = ::atoi(value) == 1;
+		else if (::strcmp(key, "AMBECorrection") == 0)
+			m_dmrAMBECorrection = ::atoi(value) == 1;
 	} else if (section == SECTION_DMRID_LOOKUP) {
 		if (::strcmp(key, "File") == 0)
 			m_dmrIdLookupFile = value;
@@ -163,6 +173,15 @@ bool CConf::read()
 			m_logFileLevel = (unsigned int)::atoi(value);
 		else if (::strcmp(key, "DisplayLevel") == 0)
 			m_logDisplayLevel = (unsigned int)::atoi(value);
+	} else if (section == SECTION_CPU) {
+		if (::strcmp(key, "Kernels") == 0)
+			m_cpuKernels = value;
+		else if (::strcmp(key, "RealTime") == 0)
+			m_cpuRealTime = (unsigned int)::atoi(value);
+		else if (::strcmp(key, "SharedMemory") == 0)
+			m_cpuSharedMemory = ::atoi(value) == 1;
+		else if (::strcmp(key, "SharedMemoryUser") == 0)
+			m_cpuSharedMemoryUser = value;
 	}
   }
 
@@ -236,6 +255,11 @@ bool CConf::getDMRDebug() const
 	return m_dmrDebug;
 }
 
+bool CConf::getDMRAMBECorrection() const
+{
+	return m_dmrAMBECorrection;
+}
+
 std::string CConf::getDMRIdLookupFile() const
 {
 	return m_dmrIdLookupFile;
@@ -275,3 +299,23 @@ std::string CConf::getLogFileRoot() const
 {
   return m_logFileRoot;
 }
+
+std::string CConf::getCPUKernels() const
+{
+  return m_cpuKernels;
+}
+
+unsigned int CConf::getCPURealTime() const
+{
+  return m_cpuRealTime;
+}
+
+bool CConf::getCPUSharedMemory() const
+{
+  return m_cpuSharedMemory;
+}
+
+std::string CConf::getCPUSharedMemoryUser() const
+{
+  return m_cpuSharedMemoryUser;
+}
@@ -47,6 +47,7 @@ public:
   std::string  getDMRLocalAddress() const;
   unsigned int getDMRLocalPort() const;
   bool         getDMRDebug() const;
+  bool         getDMRAMBECorrection() const;
 
   // The DMR Id section
   std::string  getDMRIdLookupFile() const;
@@ -62,6 +63,12 @@ public:
   std::string  getLogFilePath() const;
   std::string  getLogFileRoot() const;
 
+  // The CPU section
+  std::string  getCPUKernels() const;
+  unsigned int getCPURealTime() const;
+  bool         getCPUSharedMemory() const;
+  std::string  getCPUSharedMemoryUser() const;
+
 private:
   std::string  m_file;
   std::string  m_callsign;
@@ -78,6 +85,7 @@ private:
   std::string  m_dmrLocalAddress;
   unsigned int m_dmrLocalPort;
   bool         m_dmrDebug;
+  bool         m_dmrAMBECorrection;
 
   std::string  m_dmrIdLookupFile;
   unsigned int m_dmrIdLookupTime;
@@ -90,6 +98,11 @@ private:
   std::string  m_logFilePath;
   std::string  m_logFileRoot;
 
+  std::string  m_cpuKernels;
+  unsigned int m_cpuRealTime;
+  bool         m_cpuSharedMemory;
+  std::string  m_cpuSharedMemoryUser;
+
 };
 
 #endif
@@ -18,6 +18,9 @@
 */
 
 #include "DMR2NXDN.h"
+#include "CPUDispatch.h"
+#include "RealTime.h"
+#include "Resolver.h"
 
 #if defined(_WIN32) || defined(_WIN64)
 #include <Windows.h>
@@ -103,7 +106,9 @@ m_dmrNetwork(NULL),
 m_nxdnNetwork(NULL),
 m_dmrlookup(NULL),
 m_nxdnlookup(NULL),
+m_idIndex(NULL),
 m_conv(),
+m_nxdnCall(),
 m_colorcode(1U),
 m_defsrcid(1U),
 m_dstid(1U),
@@ -178,7 +183,14 @@ int CDMR2NXDN::run()
 			::fprintf(stderr, "Couldn't cd /, exiting\n");
 			return -1;
 		}
+	}
+
+	// Locking the memory and raising the real-time limits need root, so they come before it is given up
+	unsigned int realTime = m_conf.getCPURealTime();
+	CRealTime::prepare(realTime);
 
+	// Only a daemon gives up root, once the limits above have been raised
+	if (m_daemon) {
 		// If we are currently root...
 		if (getuid() == 0) {
 			struct passwd* user = ::getpwnam("mmdvm");
@@ -229,6 +241,15 @@ int CDMR2NXDN::run()
 	LogInfo(HEADER3);
 	LogInfo(HEADER4);
 
+	CCPUDispatch::init(m_conf.getCPUKernels());
+	CUDPSocket::setSharedMemory(m_conf.getCPUSharedMemory());
+	CUDPSocket::setSharedMemoryUser(m_conf.getCPUSharedMemoryUser());
+
+	// The networks below only queue their host names, nothing waits on DNS from here on
+	CResolver::start();
+
+	m_conv.setAMBECorrection(m_conf.getDMRAMBECorrection());
+
 	m_defsrcid = m_conf.getDMRId();
 
 	std::string gatewayAddress = m_conf.getDstAddress();
@@ -238,7 +259,7 @@ int CDMR2NXDN::run()
 
 	m_defaultID = m_conf.getDefaultID();
 
-	m_nxdnNetwork = new CNXDNNetwork(localAddress, localPort, gatewayAddress, gatewayPort, false);
+	m_nxdnNetwork = new CNXDNGatewayNetwork(localAddress, localPort, gatewayAddress, gatewayPort, false);
 	m_nxdnNetwork->enable(true);
 
 	ret = m_nxdnNetwork->open();
@@ -284,6 +305,12 @@ int CDMR2NXDN::run()
 	m_nxdnlookup = new CNXDNLookup(lookupFile, reloadTime);
 	m_nxdnlookup->read();
 
+	// Polls the two files every minute when either of them is reloaded
+	bool reloads = m_conf.getDMRIdLookupTime() > 0U || reloadTime > 0U;
+
+	m_idIndex = new CIdIndex(m_conf.getDMRIdLookupFile(), lookupFile, m_defaultID, reloads ? 1U : 0U);
+	m_idIndex->read();
+
 	m_dmrflco = FLCO_GROUP;
 
 	CTimer networkWatchdog(100U, 0U, 1500U);
@@ -300,11 +327,17 @@ int CDMR2NXDN::run()
 
 	LogMessage("Starting DMR2NXDN-%s", VERSION);
 
+	// Counts the passes that took longer than the shortest frame period
+	CLoopWatchdog watchdog("DMR2NXDN", DMR_FRAME_PER);
+
+	CRealTime::enter("main");
+
 	for (; m_killed == 0;) {
 		unsigned char buffer[2000U];
 
 		CDMRData tx_dmrdata;
 		unsigned int ms = stopWatch.elapsed();
+		watchdog.clock(ms);
 
 		while (m_nxdnNetwork->read(buffer)) {
 			CNXDNLICH lich;
@@ -595,108 +628,24 @@ int CDMR2NXDN::run()
 				m_nxdnSrc = findNXDNID(m_dmrSrc);
 				m_nxdnTG = m_dmrDst;
 
-				CNXDNLICH lich;
-				lich.setRFCT(NXDN_LICH_RFCT_RDCH);
-				lich.setFCT(NXDN_LICH_USC_SACCH_NS);
-				lich.setOption(NXDN_LICH_STEAL_FACCH);
-				lich.setDirection(NXDN_LICH_DIRECTION_INBOUND);
-				m_nxdnFrame[0U] = lich.getRaw();
-
-				CNXDNSACCH sacch;
-				sacch.setRAN(0x01);
-				sacch.setStructure(NXDN_SR_SINGLE);
-				sacch.setData(SACCH_IDLE);
-				sacch.getRaw(m_nxdnFrame + 1U);
-
-				unsigned char layer3data[25U];
-				CNXDNLayer3 layer3;
-				layer3.setMessageType(NXDN_MESSAGE_TYPE_VCALL);
-				layer3.setSourceUnitId(m_nxdnSrc & 0xFFFF);
-				layer3.setDestinationGroupId(m_nxdnTG & 0xFFFF);
-				layer3.setGroup(true);
-				layer3.setDataBlocks(0U);
-				layer3.getData(layer3data);
-
-				::memcpy(m_nxdnFrame + 5U, layer3data, 14U);
-				::memcpy(m_nxdnFrame + 5U + 14U, layer3data, 14U);
+				m_nxdnCall.setCall(m_nxdnSrc, m_nxdnTG);
+				m_nxdnCall.getHeader(m_nxdnFrame);
 
 				m_nxdnNetwork->write(m_nxdnFrame, NNMT_VOICE_HEADER);
 
 				nxdnWatch.start();
 			}
 			else if (nxdnFrameType == TAG_EOT) {
-				CNXDNLICH lich;
-				lich.setRFCT(NXDN_LICH_RFCT_RDCH);
-				lich.setFCT(NXDN_LICH_USC_SACCH_NS);
-				lich.setOption(NXDN_LICH_STEAL_FACCH);
-				lich.setDirection(NXDN_LICH_DIRECTION_INBOUND);
-				m_nxdnFrame[0U] = lich.getRaw();
-
-				CNXDNSACCH sacch;
-				sacch.setRAN(0x01);
-				sacch.setStructure(NXDN_SR_SINGLE);
-				sacch.setData(SACCH_IDLE);
-				sacch.getRaw(m_nxdnFrame + 1U);
-
-				unsigned char layer3data[25U];
-				CNXDNLayer3 layer3;
-				layer3.setMessageType(NXDN_MESSAGE_TYPE_TX_REL);
-				layer3.setSourceUnitId(m_nxdnSrc & 0xFFFF);
-				layer3.setDestinationGroupId(m_nxdnTG & 0xFFFF);
-				layer3.setGroup(true);
-				layer3.setDataBlocks(0U);
-				layer3.getData(layer3data);
-
-				::memcpy(m_nxdnFrame + 5U, layer3data, 14U);
-				::memcpy(m_nxdnFrame + 5U + 14U, layer3data, 14U);
+				m_nxdnCall.setCall(m_nxdnSrc, m_nxdnTG);
+				m_nxdnCall.getTerminator(m_nxdnFrame);
 
 				m_nxdnNetwork->write(m_nxdnFrame, NNMT_VOICE_TRAILER);
 
 				nxdn_cnt = 0U;
 			}
 			else if (nxdnFrameType == TAG_DATA) {
-				CNXDNLICH lich;
-				lich.setRFCT(NXDN_LICH_RFCT_RDCH);
-				lich.setFCT(NXDN_LICH_USC_SACCH_SS);
-				lich.setOption(NXDN_LICH_STEAL_NONE);
-				lich.setDirection(NXDN_LICH_DIRECTION_INBOUND);
-				m_nxdnFrame[0U] = lich.getRaw();
-
-				CNXDNSACCH sacch;
-				CNXDNLayer3 layer3;
-				unsigned char message[3U];
-
-				layer3.setMessageType(NXDN_MESSAGE_TYPE_VCALL);
-				layer3.setSourceUnitId(m_nxdnSrc & 0xFFFF);
-				layer3.setDestinationGroupId(m_nxdnTG & 0xFFFF);
-				layer3.setGroup(true);
-				layer3.setDataBlocks(0U);
-
-				switch (nxdn_cnt % 4) {
-					case 0:
-						sacch.setStructure(NXDN_SR_1_4);
-						layer3.encode(message, 18U, 0U);
-						sacch.setData(message);
-						break;
-					case 1:
-						sacch.setStructure(NXDN_SR_2_4);
-						layer3.encode(message, 18U, 18U);
-						sacch.setData(message);
-						break;
-					case 2:
-						sacch.setStructure(NXDN_SR_3_4);
-						layer3.encode(message, 18U, 36U);
-						sacch.setData(message);
-						break;
-					case 3:
-						sacch.setStructure(NXDN_SR_4_4);
-						layer3.encode(message, 18U, 54U);
-						sacch.setData(message);
-						break;
-				}
-
-				sacch.setRAN(0x01);
-				sacch.getRaw(m_nxdnFrame + 1U);
+				m_nxdnCall.setCall(m_nxdnSrc, m_nxdnTG);
+				m_nxdnCall.getVoice(m_nxdnFrame, nxdn_cnt);
 
 				// Send data to MMDVMHost
 				m_nxdnNetwork->write(m_nxdnFrame, NNMT_VOICE_BODY);
@@ -715,11 +664,18 @@ int CDMR2NXDN::run()
 			CThread::sleep(5U);
 	}
 
+	watchdog.report();
+
 	m_nxdnNetwork->close();
 	m_dmrNetwork->close();
 	delete m_dmrNetwork;
 	delete m_nxdnNetwork;
 
+	m_idIndex->stop();
+	delete m_idIndex;
+
+	CResolver::stop();
+
 	::LogFinalise();
 
 	return 0;
@@ -727,43 +683,24 @@ int CDMR2NXDN::run()
 
 unsigned int CDMR2NXDN::findNXDNID(unsigned int dmrid)
 {
-	std::string dmrCS = m_dmrlookup->findCS(dmrid);
-	unsigned int nxdnID = m_nxdnlookup->findID(dmrCS);
-
-	if (nxdnID == 0)
-		nxdnID = truncID(dmrid);
-	else
-		LogMessage("NXDN ID of %s: %u", dmrCS.c_str(), nxdnID);
+	unsigned int nxdnID;
+	if (m_idIndex->findNXDNID(dmrid, nxdnID))
+		LogMessage("NXDN ID of DMR ID %u: %u", dmrid, nxdnID);
 
 	return nxdnID;
 }
 
 unsigned int CDMR2NXDN::findDMRID(unsigned int nxdnid)
 {
-	std::string nxdnCS = m_nxdnlookup->findCS(nxdnid);
-	unsigned int dmrID = m_dmrlookup->findID(nxdnCS);
-
-	if (dmrID == 0)
-		dmrID = m_defsrcid;
+	unsigned int dmrID;
+	if (m_idIndex->findDMRID(nxdnid, dmrID))
+		LogMessage("DMR ID of NXDN ID %u: %u", nxdnid, dmrID);
 	else
-		LogMessage("DMR ID of %s: %u", nxdnCS.c_str(), dmrID);
+		dmrID = m_defsrcid;
 
 	return dmrID;
 }
 
-unsigned int CDMR2NXDN::truncID(unsigned int id)
-{
-	char temp[20];
-
-	snprintf(temp, 8, "%07d", id);
-	unsigned int newid = atoi(temp + 2);
-
-	if (newid > 65519 || newid == 0)
-		newid = m_defaultID;
-
-	return newid;
-}
-
 bool CDMR2NXDN::createMMDVM()
 {
 	std::string rptAddress   = m_conf.getDMRRptAddress();
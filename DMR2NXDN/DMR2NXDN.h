@@ -29,13 +29,15 @@
 #include "DMRFullLC.h"
 #include "DMREMB.h"
 #include "DMRLookup.h"
+#include "IdIndex.h"
 #include "NXDNConvolution.h"
+#include "NXDNCallTemplate.h"
 #include "NXDNCRC.h"
 #include "NXDNLayer3.h"
 #include "NXDNLICH.h"
 #include "NXDNLookup.h"
 #include "NXDNSACCH.h"
-#include "NXDNNetwork.h"
+#include "NXDNGatewayNetwork.h"
 #include "UDPSocket.h"
 #include "StopWatch.h"
 #include "Version.h"
@@ -61,10 +63,12 @@ private:
 	unsigned int     m_nxdnTG;
 	CConf            m_conf;
 	CMMDVMNetwork*   m_dmrNetwork;
-	CNXDNNetwork*    m_nxdnNetwork;
+	CNXDNGatewayNetwork* m_nxdnNetwork;
 	CDMRLookup*      m_dmrlookup;
 	CNXDNLookup*     m_nxdnlookup;
+	CIdIndex*        m_idIndex;
 	CModeConv        m_conv;
+	CNXDNCallTemplate m_nxdnCall;
 	unsigned int     m_colorcode;
 	unsigned int     m_defsrcid;
 	unsigned int     m_dstid;
@@ -87,7 +91,6 @@ private:
 
 	unsigned int findNXDNID(unsigned int dmrid);
 	unsigned int findDMRID(unsigned int nxdnid);
-	unsigned int truncID(unsigned int id);
 	bool createMMDVM();
 
 };
@@ -18,6 +18,7 @@
  */
 
 #include "Defines.h"
+#include "AMBEConv.h"
 #include "RingBuffer.h"
 
 #if !defined(MODECONV_H)
@@ -39,13 +40,15 @@ public:
 	unsigned int getNXDN(unsigned char* data);
 	unsigned int getDMR(unsigned char* data);
 
+	void setAMBECorrection(bool on);
+
 private:
+	bool m_ambeCorrection;
 	unsigned int m_nxdnN;
 	unsigned int m_dmrN;
 	CRingBuffer<unsigned char> m_NXDN;
 	CRingBuffer<unsigned char> m_DMR;
-	void encode(const unsigned char* in, unsigned char* out, unsigned int offset) const;
-	void decode(const unsigned char* in, unsigned char* out, unsigned int offset) const;
+	unsigned char m_silence[AMBE_VECTOR_LENGTH];
 };
 
 #endif
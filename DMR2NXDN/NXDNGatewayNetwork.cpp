@@ -17,7 +17,7 @@
  */
 
 #include "NXDNDefines.h"
-#include "NXDNNetwork.h"
+#include "NXDNGatewayNetwork.h"
 #include "Defines.h"
 #include "Utils.h"
 #include "Log.h"
@@ -28,9 +28,9 @@
 
 const unsigned int BUFFER_LENGTH = 200U;
 
-CNXDNNetwork::CNXDNNetwork(const std::string& localAddress, unsigned int localPort, const std::string& gatewayAddress, unsigned int gatewayPort, bool debug) :
+CNXDNGatewayNetwork::CNXDNGatewayNetwork(const std::string& localAddress, unsigned int localPort, const std::string& gatewayAddress, unsigned int gatewayPort, bool debug) :
 m_socket(localAddress, localPort),
-m_address(),
+m_address(NULL),
 m_port(gatewayPort),
 m_debug(debug),
 m_enabled(false),
@@ -39,24 +39,21 @@ m_buffer(1000U, "NXDN Network")
 	assert(gatewayPort > 0U);
 	assert(!gatewayAddress.empty());
 
-	m_address = CUDPSocket::lookup(gatewayAddress);
+	m_address = CResolver::find(gatewayAddress);
 }
 
-CNXDNNetwork::~CNXDNNetwork()
+CNXDNGatewayNetwork::~CNXDNGatewayNetwork()
 {
 }
 
-bool CNXDNNetwork::open()
+bool CNXDNGatewayNetwork::open()
 {
 	LogMessage("Opening NXDN network connection");
 
-	if (m_address.s_addr == INADDR_NONE)
-		return false;
-
 	return m_socket.open();
 }
 
-bool CNXDNNetwork::write(const unsigned char* data, NXDN_NETWORK_MESSAGE_TYPE type)
+bool CNXDNGatewayNetwork::write(const unsigned char* data, NXDN_NETWORK_MESSAGE_TYPE type)
 {
 	assert(data != NULL);
 
@@ -100,10 +97,10 @@ bool CNXDNNetwork::write(const unsigned char* data, NXDN_NETWORK_MESSAGE_TYPE ty
 	if (m_debug)
 		CUtils::dump(1U, "NXDN Network Data Sent", buffer, 102U);
 
-	return m_socket.write(buffer, 102U, m_address, m_port);
+	return m_socket.write(buffer, 102U, m_address->getAddress(), m_port);
 }
 
-void CNXDNNetwork::clock(unsigned int ms)
+void CNXDNGatewayNetwork::clock(unsigned int ms)
 {
 	unsigned char buffer[BUFFER_LENGTH];
 
@@ -114,8 +111,8 @@ void CNXDNNetwork::clock(unsigned int ms)
 		return;
 
 	// Check if the data is for us
-	if (m_address.s_addr != address.s_addr || port != m_port) {
-		LogMessage("NXDN packet received from an invalid source, %08X != %08X and/or %u != %u", m_address.s_addr, address.s_addr, m_port, port);
+	if (!m_address->matches(address) || port != m_port) {
+		LogMessage("NXDN packet received from an invalid source, %08X != %08X and/or %u != %u", m_address->getAddress().s_addr, address.s_addr, m_port, port);
 		return;
 	}
 
@@ -135,7 +132,7 @@ void CNXDNNetwork::clock(unsigned int ms)
 	m_buffer.addData(buffer + 40U, 33U);
 }
 
-bool CNXDNNetwork::read(unsigned char* data)
+bool CNXDNGatewayNetwork::read(unsigned char* data)
 {
 	assert(data != NULL);
 
@@ -147,18 +144,18 @@ bool CNXDNNetwork::read(unsigned char* data)
 	return true;
 }
 
-void CNXDNNetwork::reset()
+void CNXDNGatewayNetwork::reset()
 {
 }
 
-void CNXDNNetwork::close()
+void CNXDNGatewayNetwork::close()
 {
 	m_socket.close();
 
 	LogMessage("Closing NXDN network connection");
 }
 
-void CNXDNNetwork::enable(bool enabled)
+void CNXDNGatewayNetwork::enable(bool enabled)
 {
 	if (enabled && !m_enabled)
 		reset();
@@ -16,12 +16,13 @@
  *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
  */
 
-#ifndef	NXDNNetwork_H
-#define	NXDNNetwork_H
+#ifndef	NXDNGatewayNetwork_H
+#define	NXDNGatewayNetwork_H
 
 #include "NXDNDefines.h"
 #include "RingBuffer.h"
 #include "UDPSocket.h"
+#include "Resolver.h"
 #include "Timer.h"
 
 #include <cstdint>
@@ -36,10 +37,10 @@ enum NXDN_NETWORK_MESSAGE_TYPE {
 	NNMT_DATA_TRAILER
 };
 
-class CNXDNNetwork {
+class CNXDNGatewayNetwork {
 public:
-	CNXDNNetwork(const std::string& localAddress, unsigned int localPort, const std::string& gatewayAddress, unsigned int gatewayPort, bool debug);
-	~CNXDNNetwork();
+	CNXDNGatewayNetwork(const std::string& localAddress, unsigned int localPort, const std::string& gatewayAddress, unsigned int gatewayPort, bool debug);
+	~CNXDNGatewayNetwork();
 
 	bool open();
 
@@ -57,7 +58,7 @@ public:
 
 private:
 	CUDPSocket                 m_socket;
-	in_addr                    m_address;
+	CResolvedHost*             m_address;
 	unsigned int               m_port;
 	bool                       m_debug;
 	bool                       m_enabled;
@@ -32,7 +32,8 @@ enum SECTION {
   SECTION_YSF_NETWORK,
   SECTION_DMR_NETWORK,
   SECTION_DMRID_LOOKUP,
-  SECTION_LOG
+  SECTION_LOG,
+  SECTION_CPU
 };
 
 CConf::CConf(const std::string& file) :
@@ -70,7 +71,11 @@ m_dmrIdLookupTime(0U),
 m_logDisplayLevel(0U),
 m_logFileLevel(0U),
 m_logFilePath(),
-m_logFileRoot()
+m_logFileRoot(),
+m_cpuKernels("auto"),
+m_cpuRealTime(0U),
+m_cpuSharedMemory(false),
+m_cpuSharedMemoryUser()
 {
 }
 
@@ -102,6 +107,8 @@ bool CConf::read()
 		  section = SECTION_DMRID_LOOKUP;
 	  else if (::strncmp(buffer, "[Log]", 5U) == 0)
 		  section = SECTION_LOG;
+	  else if (::strncmp(buffer, "[CPU]", 5U) == 0)
+		  section = SECTION_CPU;
 	  else
         section = SECTION_NONE;
 
@@ -202,6 +209,15 @@ bool CConf::read()
 			m_logFileLevel = (unsigned int)::atoi(value);
 		else if (::strcmp(key, "DisplayLevel") == 0)
 			m_logDisplayLevel = (unsigned int)::atoi(value);
+	} else if (section == SECTION_CPU) {
+		if (::strcmp(key, "Kernels") == 0)
+			m_cpuKernels = value;
+		else if (::strcmp(key, "RealTime") == 0)
+			m_cpuRealTime = (unsigned int)::atoi(value);
+		else if (::strcmp(key, "SharedMemory") == 0)
+			m_cpuSharedMemory = ::atoi(value) == 1;
+		else if (::strcmp(key, "SharedMemoryUser") == 0)
+			m_cpuSharedMemoryUser = value;
 	}
   }
 
@@ -379,3 +395,23 @@ std::string CConf::getLogFileRoot() const
 {
   return m_logFileRoot;
 }
+
+std::string CConf::getCPUKernels() const
+{
+  return m_cpuKernels;
+}
+
+unsigned int CConf::getCPURealTime() const
+{
+  return m_cpuRealTime;
+}
+
+bool CConf::getCPUSharedMemory() const
+{
+  return m_cpuSharedMemory;
+}
+
+std::string CConf::getCPUSharedMemoryUser() const
+{
+  return m_cpuSharedMemoryUser;
+}
@@ -73,6 +73,12 @@ public:
   std::string  getLogFilePath() const;
   std::string  getLogFileRoot() const;
 
+  // The CPU section
+  std::string  getCPUKernels() const;
+  unsigned int getCPURealTime() const;
+  bool         getCPUSharedMemory() const;
+  std::string  getCPUSharedMemoryUser() const;
+
 private:
   std::string  m_file;
   std::string  m_callsign;
@@ -112,6 +118,11 @@ private:
   unsigned int m_logFileLevel;
   std::string  m_logFilePath;
   std::string  m_logFileRoot;
+
+  std::string  m_cpuKernels;
+  unsigned int m_cpuRealTime;
+  bool         m_cpuSharedMemory;
+  std::string  m_cpuSharedMemoryUser;
 };
 
 #endif
@@ -18,6 +18,10 @@
 */
 
 #include "DMR2YSF.h"
+#include "CPUDispatch.h"
+#include "RealTime.h"
+#include "Resolver.h"
+#include "Startup.h"
 
 #if defined(_WIN32) || defined(_WIN64)
 #include <Windows.h>
@@ -116,6 +120,7 @@ m_dmrpc(false),
 m_netSrc(),
 m_netDst(),
 m_ysfSrc(),
+m_callsigns(),
 m_dmrLastDT(0U),
 m_ysfFrame(NULL),
 m_dmrFrame(NULL),
@@ -128,8 +133,7 @@ m_config(NULL),
 m_configLen(0U),
 m_command(NULL),
 m_tgUnlink(4000U),
-m_currTGList(),
-m_FCSList(),
+m_tgList(NULL),
 m_lastTG(0U)
 {
 	m_ysfFrame = new unsigned char[200U];
@@ -151,6 +155,8 @@ CDMR2YSF::~CDMR2YSF()
 
 int CDMR2YSF::run()
 {
+	CStartup::start();
+
 	bool ret = m_conf.read();
 	if (!ret) {
 		::fprintf(stderr, "DMR2YSF: cannot read the .ini file\n");
@@ -188,7 +194,14 @@ int CDMR2YSF::run()
 			::fprintf(stderr, "Couldn't cd /, exiting\n");
 			return -1;
 		}
+	}
 
+	// Locking the memory and raising the real-time limits need root, so they come before it is given up
+	unsigned int realTime = m_conf.getCPURealTime();
+	CRealTime::prepare(realTime);
+
+	// Only a daemon gives up root, once the limits above have been raised
+	if (m_daemon) {
 		// If we are currently root...
 		if (getuid() == 0) {
 			struct passwd* user = ::getpwnam("mmdvm");
@@ -246,16 +259,27 @@ int CDMR2YSF::run()
 	LogInfo(HEADER3);
 	LogInfo(HEADER4);
 
+	CCPUDispatch::init(m_conf.getCPUKernels());
+	CUDPSocket::setSharedMemory(m_conf.getCPUSharedMemory());
+	CUDPSocket::setSharedMemoryUser(m_conf.getCPUSharedMemoryUser());
+
+	// The networks below only queue their host names, nothing waits on DNS from here on
+	CResolver::start();
+
 	LogInfo("General Parameters");
 	LogInfo("    Default Dst TG: %u", m_dstid);
 	LogInfo("    Unlink TG: %u", m_tgUnlink);
 	LogInfo("    FCS Rooms File: %s", fcsFile.c_str());
 	LogInfo("    TG File: %s", tgFile.c_str());
 
-	readFCSRoomsFile(fcsFile);
-	readTGList(tgFile);
+	// The tables load on their own threads while MMDVMHost connects, until then a lookup finds nothing
+	m_tgList = new CTGYSFList(tgFile, fcsFile, 60U);
+	m_tgList->start();
+
+	m_lookup = new CDMRLookup(m_conf.getDMRIdLookupFile(), m_conf.getDMRIdLookupTime());
+	m_lookup->start();
 
-	in_addr dstAddress       = CUDPSocket::lookup(m_conf.getDstAddress());
+	std::string dstAddress   = m_conf.getDstAddress();
 	unsigned int dstPort     = m_conf.getDstPort();
 	std::string localAddress = m_conf.getLocalAddress();
 	unsigned int localPort   = m_conf.getLocalPort();
@@ -287,19 +311,13 @@ int CDMR2YSF::run()
 		CThread::sleep(10U);
 	}
 
-	if (m_killed) {
-		m_dmrNetwork->close();
-		delete m_dmrNetwork;
-		return 0;
+	// A kill while waiting skips the loop below, the shutdown after it stops the table threads too
+	if (!m_killed) {
+		LogMessage("MMDVM has connected");
+		CStartup::reached("MMDVMHost connected");
 	}
 
-	LogMessage("MMDVM has connected");
-	
-	std::string lookupFile  = m_conf.getDMRIdLookupFile();
-	unsigned int reloadTime = m_conf.getDMRIdLookupTime();
-
-	m_lookup = new CDMRLookup(lookupFile, reloadTime);
-	m_lookup->read();
+	m_callsigns.setLookup(m_lookup);
 
 	if (m_dmrpc)
 		m_dmrflco = FLCO_USER_USER;
@@ -322,13 +340,34 @@ int CDMR2YSF::run()
 
 	unsigned char gps_buffer[20U];
 
-	LogMessage("Starting DMR2YSF-%s", VERSION);
+	if (!m_killed)
+		LogMessage("Starting DMR2YSF-%s", VERSION);
+
+	// Counts the passes that took longer than the shortest frame period
+	CLoopWatchdog watchdog("DMR2YSF", DMR_FRAME_PER);
+
+	// Each table is logged once its first load has finished
+	bool idsLoaded = false;
+	bool tgLoaded  = false;
+
+	CRealTime::enter("main");
 
 	for (; m_killed == 0;) {
 		unsigned char buffer[2000U];
 
 		CDMRData tx_dmrdata;
 		unsigned int ms = stopWatch.elapsed();
+		watchdog.clock(ms);
+
+		if (!idsLoaded && m_lookup->isLoaded()) {
+			CStartup::reached("DMR Ids loaded");
+			idsLoaded = true;
+		}
+
+		if (!tgLoaded && m_tgList->isLoaded()) {
+			CStartup::reached("TG lists loaded");
+			tgLoaded = true;
+		}
 
 		while (m_ysfNetwork->read(buffer) > 0U) {
 			CYSFFICH fich;
@@ -351,7 +390,7 @@ int CDMR2YSF::run()
 								std::string ysfSrc = ysfPayload.getSource();
 								std::string ysfDst = ysfPayload.getDest();
 								LogMessage("Received YSF Header: Src: %s Dst: %s", ysfSrc.c_str(), ysfDst.c_str());
-								m_srcid = findYSFID(ysfSrc, true);
+								m_srcid = findYSFID((const unsigned char*)ysfSrc.data(), true);
 								m_conv.putYSFHeader();
 								m_ysfFrames = 0U;
 							}
@@ -403,6 +442,8 @@ int CDMR2YSF::run()
 				rx_dmrdata.setData(m_dmrFrame);
 				//CUtils::dump(1U, "DMR data:", m_dmrFrame, 33U);
 
+				CStartup::frame();
+
 				for (unsigned int i = 0U; i < 3U; i++) {
 					rx_dmrdata.setSeqNo(dmr_cnt);
 					m_dmrNetwork->write(rx_dmrdata);
@@ -519,6 +560,7 @@ int CDMR2YSF::run()
 				
 				//CUtils::dump(1U, "DMR data:", m_dmrFrame, 33U);
 				m_dmrNetwork->write(rx_dmrdata);
+				CStartup::frame();
 
 				dmr_cnt++;
 				dmrWatch.start();
@@ -673,6 +715,7 @@ int CDMR2YSF::run()
 				payload.writeHeader(m_ysfFrame + 35U, csd1, csd2);
 
 				m_ysfNetwork->write(m_ysfFrame);
+				CStartup::frame();
 
 				ysf_cnt++;
 				ysfWatch.start();
@@ -787,6 +830,7 @@ int CDMR2YSF::run()
 
 				// Send data
 				m_ysfNetwork->write(m_ysfFrame);
+				CStartup::frame();
 
 				ysf_cnt++;
 				ysfWatch.start();
@@ -808,118 +852,35 @@ int CDMR2YSF::run()
 			CThread::sleep(5U);
 	}
 
+	watchdog.report();
+	m_callsigns.report();
+
 	m_ysfNetwork->close();
 	m_dmrNetwork->close();
 
 	delete m_dmrNetwork;
 	delete m_ysfNetwork;
 
-	::LogFinalise();
+	m_tgList->stop();
+	delete m_tgList;
 
-	return 0;
-}
-
-void CDMR2YSF::readTGList(std::string filename)
-{
-	// Load file with TG List
-	FILE* fp = ::fopen(filename.c_str(), "rt");
-
-	unsigned int count = 0U;
-
-	if (fp != NULL) {
-		char buffer[100U];
-		while (::fgets(buffer, 100U, fp) != NULL) {
-			if (buffer[0U] == '#')
-				continue;
-
-			char* p1 = ::strtok(buffer, ";\r\n");
-			char* p2 = ::strtok(NULL, ";\r\n");
-
-			if (p1 != NULL && p2 != NULL) {
-				CTGReg* tgreg = new CTGReg;
-
-				tgreg->m_tg = atoi(p1);
-				int ysf_id = atoi(p2);
-
-				if (ysf_id) {
-					tgreg->m_ysf = ysf_id;
-				} else {
-					for (std::vector<CFCSReg*>::iterator it = m_FCSList.begin(); it != m_FCSList.end(); ++it) {
-						std::string fcsname = p2;
-						if (fcsname == (*it)->m_fcs) {
-							LogInfo("FCS: %d, %s", (*it)->m_id, (*it)->m_fcs.c_str());
-							tgreg->m_ysf = (*it)->m_id;
-						}
-					}
-				}
+	m_lookup->stop();
+	delete m_lookup;
 
-				m_currTGList.push_back(tgreg);
+	CResolver::stop();
 
-				count++;
-			}
-		}
-
-		::fclose(fp);
-	}
+	::LogFinalise();
 
-	LogInfo("Loaded %u DMR-TG / YSF-ID pairs", count);
+	return 0;
 }
 
-void CDMR2YSF::readFCSRoomsFile(const std::string& filename)
+unsigned int CDMR2YSF::findYSFID(const unsigned char* source, bool showdst)
 {
-	FILE* fp = ::fopen(filename.c_str(), "rt");
-	if (fp == NULL)
-		return;
-
-	unsigned int count = 0U;
-
-	char buffer[200U];
-	while (::fgets(buffer, 200, fp) != NULL) {
-		if (buffer[0U] == '#')
-			continue;
-
-		char* p1 = ::strtok(buffer, ";");
-
-		if (p1 != NULL) {
-			CFCSReg* fcsreg = new CFCSReg;
-
-			fcsreg->m_id = count + 10U;
-			fcsreg->m_fcs = p1;
-
-			m_FCSList.push_back(fcsreg);
+	const CCallsignEntry& entry = m_callsigns.find(source);
 
-			count++;
-		}
-	}
-
-	::fclose(fp);
-
-	LogInfo("Loaded %u FCS room descriptions", count);
-}
-
-unsigned int CDMR2YSF::findYSFID(std::string cs, bool showdst)
-{
-	std::string cstrim;
+	unsigned int id = entry.m_id;
 	bool dmrpc = false;
 
-	int first = cs.find_first_not_of(' ');
-	int mid1 = cs.find_last_of('-');
-	int mid2 = cs.find_last_of('/');
-	int last = cs.find_last_not_of(' ');
-
-	if (mid1 == -1 && mid2 == -1 && first == -1 && last == -1)
-		cstrim = "N0CALL";
-	else if (mid1 == -1 && mid2 == -1)
-		cstrim = cs.substr(first, (last - first + 1));
-	else if (mid1 > first)
-		cstrim = cs.substr(first, (mid1 - first));
-	else if (mid2 > first)
-		cstrim = cs.substr(first, (mid2 - first));
-	else
-		cstrim = "N0CALL";
-
-	unsigned int id = m_lookup->findID(cstrim);
-
 	if (m_dmrflco == FLCO_USER_USER)
 		dmrpc = true;
 	else if (m_dmrflco == FLCO_GROUP)
@@ -934,9 +895,9 @@ unsigned int CDMR2YSF::findYSFID(std::string cs, bool showdst)
 	}
 	else {
 		if (showdst)
-			LogMessage("DMR ID of %s: %u, DstID: %s%u", cstrim.c_str(), id, dmrpc ? "" : "TG ", m_dstid);
+			LogMessage("DMR ID of %s: %u, DstID: %s%u", entry.m_callsign, id, dmrpc ? "" : "TG ", m_dstid);
 		else
-			LogMessage("DMR ID of %s: %u", cstrim.c_str(), id);
+			LogMessage("DMR ID of %s: %u", entry.m_callsign, id);
 	}
 
 	return id;
@@ -963,11 +924,10 @@ void CDMR2YSF::connectYSF(unsigned int id)
 	if (id == m_tgUnlink)
 		sendYSFDisc();
 
-	for (std::vector<CTGReg*>::iterator it = m_currTGList.begin(); it != m_currTGList.end(); ++it) {
-		if (id == (*it)->m_tg) {
-			sendYSFConn((*it)->m_ysf);
-			return;
-		}
+	unsigned int ysf = 0U;
+	if (m_tgList->find(id, ysf)) {
+		sendYSFConn(ysf);
+		return;
 	}
 
 	LogMessage("DMR TG not found in TGList");
@@ -28,6 +28,7 @@
 #include "DMRFullLC.h"
 #include "DMREMB.h"
 #include "DMRLookup.h"
+#include "TGYSFList.h"
 #include "UDPSocket.h"
 #include "StopWatch.h"
 #include "Version.h"
@@ -39,35 +40,12 @@
 #include "Sync.h"
 #include "Utils.h"
 #include "Conf.h"
+#include "CallsignCache.h"
 #include "Log.h"
 #include "CRC.h"
 
 #include <string>
 
-class CTGReg {
-public:
-	CTGReg() :
-	m_tg(),
-	m_ysf()
-	{
-	}
-
-	unsigned int m_tg;
-	unsigned int m_ysf;
-};
-
-class CFCSReg {
-public:
-	CFCSReg() :
-	m_id(),
-	m_fcs()
-	{
-	}
-
-	unsigned int m_id;
-	std::string  m_fcs;
-};
-
 class CDMR2YSF
 {
 public:
@@ -91,6 +69,7 @@ private:
 	std::string            m_netSrc;
 	std::string            m_netDst;
 	std::string            m_ysfSrc;
+	CCallsignCache<CDMRLookup> m_callsigns;
 	unsigned char          m_dmrLastDT;
 	unsigned char*         m_ysfFrame;
 	unsigned char*         m_dmrFrame;
@@ -103,13 +82,10 @@ private:
 	unsigned int           m_configLen;
 	unsigned char*         m_command;
 	unsigned int           m_tgUnlink;
-	std::vector<CTGReg*>   m_currTGList;
-	std::vector<CFCSReg*>  m_FCSList;
+	CTGYSFList*            m_tgList;
 	unsigned int           m_lastTG;
 
-	void readTGList(std::string filename);
-	void readFCSRoomsFile(const std::string& filename);
-	unsigned int findYSFID(std::string cs, bool showdst);
+	unsigned int findYSFID(const unsigned char* source, bool showdst);
 	std::string getSrcYSF(const unsigned char* source);
 	void connectYSF(unsigned int id);
 	void sendYSFConn(unsigned int id);
@@ -41,8 +41,6 @@ public:
 	unsigned int getDMR(unsigned char* bytes);
 
 private:
-	void putAMBE2YSF(unsigned int a, unsigned int b, unsigned int dat_c);
-	void putAMBE2DMR(unsigned int dat_a, unsigned int dat_b, unsigned int dat_c);
 	unsigned int m_ysfN;
 	unsigned int m_dmrN;
 	CRingBuffer<unsigned char> m_YSF;
@@ -0,0 +1,131 @@
+/*
+ *   Copyright (C) 2016,2017 by Jonathan Naylor G4KLX
+ *   Copyright (C) 2018 by Andy Uribe CA6JAU
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "TGYSFList.h"
+#include "Log.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+CTGYSFList::CTGYSFList(const std::string& tgFile, const std::string& fcsFile, unsigned int reloadTime) :
+CReloader("TG list", reloadTime),
+m_tgFile(tgFile),
+m_fcsFile(fcsFile),
+m_table()
+{
+}
+
+CTGYSFList::~CTGYSFList()
+{
+}
+
+bool CTGYSFList::find(unsigned int tg, unsigned int& id)
+{
+	std::shared_ptr<const CTGYSFTable> table = m_table.get();
+
+	std::unordered_map<unsigned int, unsigned int>::const_iterator it = table->m_rooms.find(tg);
+	if (it == table->m_rooms.end())
+		return false;
+
+	id = it->second;
+
+	return true;
+}
+
+bool CTGYSFList::load()
+{
+	FILE* fp = ::fopen(m_tgFile.c_str(), "rt");
+	if (fp == NULL) {
+		LogWarning("Cannot open the TG list file - %s", m_tgFile.c_str());
+		return false;
+	}
+
+	// The FCS rooms are only needed to resolve the names in the TG list
+	std::unordered_map<std::string, unsigned int> fcsRooms;
+	loadFCSRooms(fcsRooms);
+
+	std::shared_ptr<CTGYSFTable> table(new CTGYSFTable);
+
+	unsigned int count = 0U;
+
+	char buffer[100U];
+	while (::fgets(buffer, 100U, fp) != NULL) {
+		if (buffer[0U] == '#')
+			continue;
+
+		char* p1 = ::strtok(buffer, ";\r\n");
+		char* p2 = ::strtok(NULL, ";\r\n");
+
+		if (p1 != NULL && p2 != NULL) {
+			unsigned int tg = atoi(p1);
+			unsigned int ysf = atoi(p2);
+
+			if (ysf == 0U) {
+				std::unordered_map<std::string, unsigned int>::const_iterator it = fcsRooms.find(p2);
+				if (it != fcsRooms.end()) {
+					LogInfo("FCS: %u, %s", it->second, it->first.c_str());
+					ysf = it->second;
+				}
+			}
+
+			// The first entry of a TG wins, as with the old linear search
+			table->m_rooms.insert(std::make_pair(tg, ysf));
+
+			count++;
+		}
+	}
+
+	::fclose(fp);
+
+	LogInfo("Loaded %u DMR-TG / YSF-ID pairs", count);
+
+	m_table.set(table);
+
+	return true;
+}
+
+void CTGYSFList::loadFCSRooms(std::unordered_map<std::string, unsigned int>& rooms) const
+{
+	FILE* fp = ::fopen(m_fcsFile.c_str(), "rt");
+	if (fp == NULL)
+		return;
+
+	unsigned int count = 0U;
+
+	char buffer[200U];
+	while (::fgets(buffer, 200, fp) != NULL) {
+		if (buffer[0U] == '#')
+			continue;
+
+		char* p1 = ::strtok(buffer, ";");
+
+		if (p1 != NULL) {
+			// A name listed twice resolves to its last id, as before
+			rooms[p1] = count + 10U;
+
+			count++;
+		}
+	}
+
+	::fclose(fp);
+
+	LogInfo("Loaded %u FCS room descriptions", count);
+}
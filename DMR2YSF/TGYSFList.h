@@ -0,0 +1,59 @@
+/*
+ *   Copyright (C) 2016,2017 by Jonathan Naylor G4KLX
+ *   Copyright (C) 2018 by Andy Uribe CA6JAU
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(TGYSFLIST_H)
+#define	TGYSFLIST_H
+
+#include "Reloader.h"
+#include "Snapshot.h"
+
+#include <unordered_map>
+#include <string>
+
+// One load of the TG list and the FCS rooms, never changed once published
+class CTGYSFTable {
+public:
+	CTGYSFTable() :
+	m_rooms()
+	{
+	}
+
+	std::unordered_map<unsigned int, unsigned int> m_rooms;		// DMR TG to YSF reflector id
+};
+
+class CTGYSFList : public CReloader {
+public:
+	CTGYSFList(const std::string& tgFile, const std::string& fcsFile, unsigned int reloadTime);
+	virtual ~CTGYSFList();
+
+	bool find(unsigned int tg, unsigned int& id);
+
+protected:
+	virtual bool load();
+
+private:
+	std::string            m_tgFile;
+	std::string            m_fcsFile;
+	CSnapshot<CTGYSFTable> m_table;
+
+	void loadFCSRooms(std::unordered_map<std::string, unsigned int>& rooms) const;
+};
+
+#endif
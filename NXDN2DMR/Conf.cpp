@@ -32,9 +32,11 @@ enum SECTION {
   SECTION_INFO,
   SECTION_NXDN_NETWORK,
   SECTION_DMR_NETWORK,
+  SECTION_SLOT1,
   SECTION_DMRID_LOOKUP,
   SECTION_NXDNID_LOOKUP,
-  SECTION_LOG
+  SECTION_LOG,
+  SECTION_CPU
 };
 
 CConf::CConf(const std::string& file) :
@@ -70,6 +72,15 @@ m_dmrNetworkOptions(),
 m_dmrNetworkDebug(false),
 m_dmrNetworkJitterEnabled(true),
 m_dmrNetworkJitter(500U),
+m_dmrNetworkAMBECorrection(false),
+m_slot1Enabled(false),
+m_slot1TG(20U),
+m_slot1DstAddress(),
+m_slot1DstPort(0U),
+m_slot1LocalAddress(),
+m_slot1LocalPort(0U),
+m_slot1DstId(9990U),
+m_slot1PC(false),
 m_dmrIdLookupFile(),
 m_dmrIdLookupTime(0U),
 m_nxdnIdLookupFile(),
@@ -77,7 +88,11 @@ m_nxdnIdLookupTime(0U),
 m_logDisplayLevel(0U),
 m_logFileLevel(0U),
 m_logFilePath(),
-m_logFileRoot()
+m_logFileRoot(),
+m_cpuKernels("auto"),
+m_cpuRealTime(0U),
+m_cpuSharedMemory(false),
+m_cpuSharedMemoryUser()
 {
 }
 
@@ -108,12 +123,16 @@ bool CConf::read()
 				section = SECTION_NXDN_NETWORK;
 			else if (::strncmp(buffer, "[DMR Network]", 13U) == 0)
 				section = SECTION_DMR_NETWORK;
+			else if (::strncmp(buffer, "[Slot 1]", 8U) == 0)
+				section = SECTION_SLOT1;
 			else if (::strncmp(buffer, "[DMR Id Lookup]", 15U) == 0)
 				section = SECTION_DMRID_LOOKUP;
 			else if (::strncmp(buffer, "[NXDN Id Lookup]", 16U) == 0)
 				section = SECTION_NXDNID_LOOKUP;
 			else if (::strncmp(buffer, "[Log]", 5U) == 0)
 				section = SECTION_LOG;
+			else if (::strncmp(buffer, "[CPU]", 5U) == 0)
+				section = SECTION_CPU;
 			else
 				section = SECTION_NONE;
 
@@ -206,6 +225,25 @@ bool CConf::read()
 				m_dmrNetworkJitterEnabled = ::atoi(value) == 1;
 			else if (::strcmp(key, "Jitter") == 0)
 				m_dmrNetworkJitter = (unsigned int)::atoi(value);
+			else if (::strcmp(key, "AMBECorrection") == 0)
+				m_dmrNetworkAMBECorrection = ::atoi(value) == 1;
+		} else if (section == SECTION_SLOT1) {
+			if (::strcmp(key, "Enable") == 0)
+				m_slot1Enabled = ::atoi(value) == 1;
+			else if (::strcmp(key, "TG") == 0)
+				m_slot1TG = (unsigned int)::atoi(value);
+			else if (::strcmp(key, "DstAddress") == 0)
+				m_slot1DstAddress = value;
+			else if (::strcmp(key, "DstPort") == 0)
+				m_slot1DstPort = (unsigned int)::atoi(value);
+			else if (::strcmp(key, "LocalAddress") == 0)
+				m_slot1LocalAddress = value;
+			else if (::strcmp(key, "LocalPort") == 0)
+				m_slot1LocalPort = (unsigned int)::atoi(value);
+			else if (::strcmp(key, "StartupDstId") == 0)
+				m_slot1DstId = (unsigned int)::atoi(value);
+			else if (::strcmp(key, "StartupPC") == 0)
+				m_slot1PC = ::atoi(value) == 1;
 		} else if (section == SECTION_DMRID_LOOKUP) {
 			if (::strcmp(key, "File") == 0)
 				m_dmrIdLookupFile = value;
@@ -225,6 +263,15 @@ bool CConf::read()
 				m_logFileLevel = (unsigned int)::atoi(value);
 			else if (::strcmp(key, "DisplayLevel") == 0)
 				m_logDisplayLevel = (unsigned int)::atoi(value);
+		} else if (section == SECTION_CPU) {
+			if (::strcmp(key, "Kernels") == 0)
+				m_cpuKernels = value;
+			else if (::strcmp(key, "RealTime") == 0)
+				m_cpuRealTime = (unsigned int)::atoi(value);
+			else if (::strcmp(key, "SharedMemory") == 0)
+				m_cpuSharedMemory = ::atoi(value) == 1;
+			else if (::strcmp(key, "SharedMemoryUser") == 0)
+				m_cpuSharedMemoryUser = value;
 		}
 	}
 
@@ -388,6 +435,51 @@ unsigned int CConf::getDMRNetworkJitter() const
 	return m_dmrNetworkJitter;
 }
 
+bool CConf::getDMRNetworkAMBECorrection() const
+{
+	return m_dmrNetworkAMBECorrection;
+}
+
+bool CConf::getSlot1Enabled() const
+{
+  return m_slot1Enabled;
+}
+
+unsigned int CConf::getSlot1TG() const
+{
+  return m_slot1TG;
+}
+
+std::string CConf::getSlot1DstAddress() const
+{
+  return m_slot1DstAddress;
+}
+
+unsigned int CConf::getSlot1DstPort() const
+{
+  return m_slot1DstPort;
+}
+
+std::string CConf::getSlot1LocalAddress() const
+{
+  return m_slot1LocalAddress;
+}
+
+unsigned int CConf::getSlot1LocalPort() const
+{
+  return m_slot1LocalPort;
+}
+
+unsigned int CConf::getSlot1DstId() const
+{
+  return m_slot1DstId;
+}
+
+bool CConf::getSlot1PC() const
+{
+  return m_slot1PC;
+}
+
 std::string CConf::getDMRIdLookupFile() const
 {
 	return m_dmrIdLookupFile;
@@ -427,3 +519,23 @@ std::string CConf::getLogFileRoot() const
 {
   return m_logFileRoot;
 }
+
+std::string CConf::getCPUKernels() const
+{
+  return m_cpuKernels;
+}
+
+unsigned int CConf::getCPURealTime() const
+{
+  return m_cpuRealTime;
+}
+
+bool CConf::getCPUSharedMemory() const
+{
+  return m_cpuSharedMemory;
+}
+
+std::string CConf::getCPUSharedMemoryUser() const
+{
+  return m_cpuSharedMemoryUser;
+}
@@ -67,6 +67,17 @@ public:
   bool         getDMRNetworkDebug() const;
   bool         getDMRNetworkJitterEnabled() const;
   unsigned int getDMRNetworkJitter() const;
+  bool         getDMRNetworkAMBECorrection() const;
+
+  // The Slot 1 section
+  bool         getSlot1Enabled() const;
+  unsigned int getSlot1TG() const;
+  std::string  getSlot1DstAddress() const;
+  unsigned int getSlot1DstPort() const;
+  std::string  getSlot1LocalAddress() const;
+  unsigned int getSlot1LocalPort() const;
+  unsigned int getSlot1DstId() const;
+  bool         getSlot1PC() const;
 
   // The DMR Id section
   std::string  getDMRIdLookupFile() const;
@@ -82,6 +93,12 @@ public:
   std::string  getLogFilePath() const;
   std::string  getLogFileRoot() const;
 
+  // The CPU section
+  std::string  getCPUKernels() const;
+  unsigned int getCPURealTime() const;
+  bool         getCPUSharedMemory() const;
+  std::string  getCPUSharedMemoryUser() const;
+
 private:
   std::string  m_file;
   std::string  m_callsign;
@@ -117,6 +134,16 @@ private:
   bool         m_dmrNetworkDebug;
   bool         m_dmrNetworkJitterEnabled;
   unsigned int m_dmrNetworkJitter;
+  bool         m_dmrNetworkAMBECorrection;
+
+  bool         m_slot1Enabled;
+  unsigned int m_slot1TG;
+  std::string  m_slot1DstAddress;
+  unsigned int m_slot1DstPort;
+  std::string  m_slot1LocalAddress;
+  unsigned int m_slot1LocalPort;
+  unsigned int m_slot1DstId;
+  bool         m_slot1PC;
 
   std::string  m_dmrIdLookupFile;
   unsigned int m_dmrIdLookupTime;
@@ -129,6 +156,11 @@ private:
   std::string  m_logFilePath;
   std::string  m_logFileRoot;
 
+  std::string  m_cpuKernels;
+  unsigned int m_cpuRealTime;
+  bool         m_cpuSharedMemory;
+  std::string  m_cpuSharedMemoryUser;
+
 };
 
 #endif
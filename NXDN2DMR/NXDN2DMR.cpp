@@ -18,6 +18,9 @@
 */
 
 #include "NXDN2DMR.h"
+#include "CPUDispatch.h"
+#include "RealTime.h"
+#include "Resolver.h"
 
 #if defined(_WIN32) || defined(_WIN64)
 #include <Windows.h>
@@ -29,11 +32,6 @@
 #include <pwd.h>
 #endif
 
-#define DMR_FRAME_PER       55U
-#define NXDN_FRAME_PER      75U
-
-#define NXDNGW_DSTID_DEF    20U
-
 #define XLX_SLOT            2U
 #define XLX_COLOR_CODE      3U
 
@@ -103,49 +101,34 @@ int main(int argc, char** argv)
 
 CNXDN2DMR::CNXDN2DMR(const std::string& configFile) :
 m_callsign(),
-m_nxdnTG(1U),
 m_conf(configFile),
 m_dmrNetwork(NULL),
-m_nxdnNetwork(NULL),
 m_dmrlookup(NULL),
 m_nxdnlookup(NULL),
-m_conv(),
+m_idIndex(NULL),
 m_colorcode(1U),
 m_srcHS(1U),
 m_defsrcid(1U),
 m_dstid(1U),
 m_dmrpc(false),
-m_dmrSrc(1U),
-m_dmrDst(1U),
-m_nxdnSrc(1U),
-m_nxdnDst(1U),
-m_dmrLastDT(0U),
-m_nxdnFrame(NULL),
-m_dmrFrame(NULL),
-m_dmrFrames(0U),
-m_nxdnFrames(0U),
-m_EmbeddedLC(),
-m_dmrflco(FLCO_GROUP),
-m_dmrinfo(false),
-m_nxdninfo(false),
 m_xlxmodule(),
 m_xlxConnected(false),
 m_xlxReflectors(NULL),
 m_xlxrefl(0U),
-m_defaultID(65519U),
-m_firstSync(false)
+m_defaultID(65519U)
 {
-	m_nxdnFrame = new unsigned char[200U];
-	m_dmrFrame  = new unsigned char[50U];
-
-	::memset(m_nxdnFrame, 0U, 200U);
-	::memset(m_dmrFrame, 0U, 50U);
+	for (unsigned int i = 0U; i < 2U; i++) {
+		m_nxdnNetwork[i] = NULL;
+		m_session[i]     = NULL;
+	}
 }
 
 CNXDN2DMR::~CNXDN2DMR()
 {
-	delete[] m_nxdnFrame;
-	delete[] m_dmrFrame;
+	for (unsigned int i = 0U; i < 2U; i++) {
+		delete m_session[i];
+		delete m_nxdnNetwork[i];
+	}
 }
 
 int CNXDN2DMR::run()
@@ -187,7 +170,14 @@ int CNXDN2DMR::run()
 			::fprintf(stderr, "Couldn't cd /, exiting\n");
 			return -1;
 		}
+	}
 
+	// Locking the memory and raising the real-time limits need root, so they come before it is given up
+	unsigned int realTime = m_conf.getCPURealTime();
+	CRealTime::prepare(realTime);
+
+	// Only a daemon gives up root, once the limits above have been raised
+	if (m_daemon) {
 		// If we are currently root...
 		if (getuid() == 0) {
 			struct passwd* user = ::getpwnam("mmdvm");
@@ -238,32 +228,45 @@ int CNXDN2DMR::run()
 	LogInfo(HEADER3);
 	LogInfo(HEADER4);
 
-	m_callsign = m_conf.getCallsign();
-	m_nxdnTG = m_conf.getTG();
+	CCPUDispatch::init(m_conf.getCPUKernels());
+	CUDPSocket::setSharedMemory(m_conf.getCPUSharedMemory());
+	CUDPSocket::setSharedMemoryUser(m_conf.getCPUSharedMemoryUser());
+
+	// The networks below only queue their host names, nothing waits on DNS from here on
+	CResolver::start();
 
-	bool debug               = m_conf.getDMRNetworkDebug();
-	in_addr dstAddress       = CUDPSocket::lookup(m_conf.getDstAddress());
-	unsigned int dstPort     = m_conf.getDstPort();
-	std::string localAddress = m_conf.getLocalAddress();
-	unsigned int localPort   = m_conf.getLocalPort();
+	m_callsign = m_conf.getCallsign();
 
 	m_defaultID = m_conf.getDefaultID();
 
 	std::string fileName    = m_conf.getDMRXLXFile();
 	m_xlxReflectors = new CReflectors(fileName, 60U);
-	m_xlxReflectors->load();
-
-	m_nxdnNetwork = new CNXDNNetwork(localAddress, localPort, m_callsign, debug);
-	m_nxdnNetwork->setDestination(dstAddress, dstPort);
+	m_xlxReflectors->read();
 
-	ret = m_nxdnNetwork->open();
-	if (!ret) {
+	// Slot 2 carries the conversation of the [NXDN Network] section, slot 1 the optional [Slot 1] one
+	m_nxdnNetwork[1U] = createNXDNNetwork(m_conf.getDstAddress(), m_conf.getDstPort(), m_conf.getLocalAddress(), m_conf.getLocalPort());
+	if (m_nxdnNetwork[1U] == NULL) {
 		::LogError("Cannot open the NXDN network port");
 		::LogFinalise();
 		return 1;
 	}
 
-	ret = createDMRNetwork();
+	bool slot1 = m_conf.getSlot1Enabled();
+	if (slot1 && !m_conf.getDMRXLXModule().empty()) {
+		LogWarning("Slot 1 is not available when linked to an XLX module, disabling it");
+		slot1 = false;
+	}
+
+	if (slot1) {
+		m_nxdnNetwork[0U] = createNXDNNetwork(m_conf.getSlot1DstAddress(), m_conf.getSlot1DstPort(), m_conf.getSlot1LocalAddress(), m_conf.getSlot1LocalPort());
+		if (m_nxdnNetwork[0U] == NULL) {
+			::LogError("Cannot open the slot 1 NXDN network port");
+			::LogFinalise();
+			return 1;
+		}
+	}
+
+	ret = createDMRNetwork(slot1);
 	if (!ret) {
 		::LogError("Cannot open DMR Network");
 		::LogFinalise();
@@ -282,41 +285,49 @@ int CNXDN2DMR::run()
 	m_nxdnlookup = new CNXDNLookup(lookupFile, reloadTime);
 	m_nxdnlookup->read();
 
-	if (m_dmrpc)
-		m_dmrflco = FLCO_USER_USER;
-	else
-		m_dmrflco = FLCO_GROUP;
+	// Polls the two files every minute when either of them is reloaded
+	bool reloads = m_conf.getDMRIdLookupTime() > 0U || reloadTime > 0U;
+
+	m_idIndex = new CIdIndex(m_conf.getDMRIdLookupFile(), lookupFile, m_defaultID, reloads ? 1U : 0U);
+	m_idIndex->read();
+
+	bool ambeCorrection = m_conf.getDMRNetworkAMBECorrection();
+
+	m_session[1U] = new CSlotSession(2U, m_nxdnNetwork[1U], m_conf.getTG(), m_dstid, m_dmrpc, ambeCorrection);
+	if (slot1) {
+		m_session[0U] = new CSlotSession(1U, m_nxdnNetwork[0U], m_conf.getSlot1TG(), m_conf.getSlot1DstId(), m_conf.getSlot1PC(), ambeCorrection);
 
-	CTimer networkWatchdog(100U, 0U, 1500U);
-	CTimer pollTimer(1000U, 5U);
+		LogMessage("Slot 1 Parameters");
+		LogMessage("    TG: %u", m_conf.getSlot1TG());
+		LogMessage("    Startup DstID: %s%u", m_conf.getSlot1PC() ? "" : "TG ", m_conf.getSlot1DstId());
+	}
 
-	std::string name = m_conf.getDescription();
+	for (unsigned int i = 0U; i < 2U; i++) {
+		if (m_session[i] != NULL) {
+			m_session[i]->setDMR(m_dmrNetwork, m_colorcode, m_defsrcid);
+			m_session[i]->setLookups(m_dmrlookup, m_nxdnlookup, m_idIndex);
+		}
+	}
 
 	CStopWatch stopWatch;
-	CStopWatch nxdnWatch;
-	CStopWatch dmrWatch;
 	stopWatch.start();
-	nxdnWatch.start();
-	dmrWatch.start();
-	pollTimer.start();
-
-	unsigned char nxdn_cnt = 0;
-	unsigned char dmr_cnt = 0;
-
-	// Link to reflector at startup (not NXDNGateway operation)
-	if (m_nxdnTG != NXDNGW_DSTID_DEF) {
-		m_nxdnNetwork->writePoll(m_nxdnTG);
-		m_nxdnNetwork->writePoll(m_nxdnTG);
-		m_nxdnNetwork->writePoll(m_nxdnTG);
+
+	for (unsigned int i = 0U; i < 2U; i++) {
+		if (m_session[i] != NULL)
+			m_session[i]->link();
 	}
 
 	LogMessage("Starting NXDN2DMR-%s", VERSION);
 
-	for (; end == 0;) {
-		unsigned char buffer[2000U];
+	// Counts the passes that took longer than the shortest frame period
+	CLoopWatchdog watchdog("NXDN2DMR", DMR_FRAME_PER);
+
+	CRealTime::enter("main");
 
+	for (; end == 0;) {
 		CDMRData tx_dmrdata;
 		unsigned int ms = stopWatch.elapsed();
+		watchdog.clock(ms);
 
 		if (m_dmrNetwork->isConnected() && !m_xlxmodule.empty() && !m_xlxConnected) {
 			writeXLXLink(m_defsrcid, m_dstid, m_dmrNetwork);
@@ -324,497 +335,83 @@ int CNXDN2DMR::run()
 			m_xlxConnected = true;
 		}
 
-		unsigned int len = 0;
-		while ((len = m_nxdnNetwork->read(buffer)) > 0U) {
-			if (::memcmp(buffer, "NXDND", 5U) == 0U && len == 43U) {
-				CNXDNLICH lich;
-				m_nxdnSrc = (buffer[5U] << 8) | buffer[6U];
-				m_nxdnDst = (buffer[7U] << 8) | buffer[8U];
-				bool end = (buffer[9U] & 0x08) == 0x08;
-				bool grp = (buffer[9U] & 0x01) == 0x01;
-
-				lich.setRaw(buffer[10U]);
-				unsigned char usc = lich.getFCT();
-				unsigned char opt = lich.getOption();
-
-				if (usc == NXDN_LICH_USC_SACCH_NS) {
-					if (end) {
-						LogMessage("NXDN received end of voice transmission, %.1f seconds", float(m_nxdnFrames) / 12.5F);
-						m_conv.putNXDNEOT();
-						m_nxdnFrames = 0U;
-						m_nxdninfo = false;
-					} else {
-						std::string netSrc = m_nxdnlookup->findCS(m_nxdnSrc);
-						std::string netDst = m_nxdnlookup->findCS(m_nxdnDst);
-						LogMessage("Received NXDN header from %s to %s%s", netSrc.c_str(), grp ? "TG " : "", netDst.c_str());
-
-						m_dmrNetwork->reset(2U);	// OE1KBC fix
-
-						m_conv.putNXDNHeader();
-						m_nxdnFrames = 0U;
-						m_nxdninfo = true;
-					}
-				} else {
-					if (opt == NXDN_LICH_STEAL_NONE) {
-						if (!m_nxdninfo) {
-							std::string netSrc = m_nxdnlookup->findCS(m_nxdnSrc);
-							std::string netDst = m_nxdnlookup->findCS(m_nxdnDst);
-							LogMessage("Received NXDN late entry from %s to %s%s", netSrc.c_str(), grp ? "TG " : "", netDst.c_str());
-
-							m_dmrNetwork->reset(2U);	// OE1KBC fix
-
-							m_conv.putNXDNHeader();
-							m_nxdninfo = true;
-						}
-
-						m_conv.putNXDN(buffer + 10U);
-						m_nxdnFrames++;
-					}
-				}
-			}
-			else if (::memcmp(buffer, "NXDNP", 5U) == 0 && len == 17U && m_nxdnTG == NXDNGW_DSTID_DEF) {
-					// Return the poll
-					m_nxdnNetwork->write(buffer, len);
-			}
-		}
-
-		if (dmrWatch.elapsed() > DMR_FRAME_PER) {
-			unsigned int dmrFrameType = m_conv.getDMR(m_dmrFrame);
-
-			if(dmrFrameType == TAG_HEADER) {
-				CDMRData rx_dmrdata;
-				dmr_cnt = 0U;
-				m_dmrSrc = findDMRID(m_nxdnSrc);
-
-				rx_dmrdata.setSlotNo(2U);
-				rx_dmrdata.setSrcId(m_dmrSrc);
-				rx_dmrdata.setDstId(m_dstid);
-				rx_dmrdata.setFLCO(m_dmrflco);
-				rx_dmrdata.setN(0U);
-				rx_dmrdata.setSeqNo(0U);
-				rx_dmrdata.setBER(0U);
-				rx_dmrdata.setRSSI(0U);
-				rx_dmrdata.setDataType(DT_VOICE_LC_HEADER);
-
-				// Add sync
-				CSync::addDMRDataSync(m_dmrFrame, 0);
-
-				// Add SlotType
-				CDMRSlotType slotType;
-				slotType.setColorCode(m_colorcode);
-				slotType.setDataType(DT_VOICE_LC_HEADER);
-				slotType.getData(m_dmrFrame);
-
-				// Full LC
-				CDMRLC dmrLC = CDMRLC(m_dmrflco, m_dmrSrc, m_dstid);
-				CDMRFullLC fullLC;
-				fullLC.encode(dmrLC, m_dmrFrame, DT_VOICE_LC_HEADER);
-				m_EmbeddedLC.setLC(dmrLC);
-				
-				rx_dmrdata.setData(m_dmrFrame);
-				//CUtils::dump(1U, "DMR data:", m_dmrFrame, 33U);
-
-				for (unsigned int i = 0U; i < 3U; i++) {
-					rx_dmrdata.setSeqNo(dmr_cnt);
-					m_dmrNetwork->write(rx_dmrdata);
-					dmr_cnt++;
-				}
-
-				dmrWatch.start();
-			}
-			else if(dmrFrameType == TAG_EOT) {
-				CDMRData rx_dmrdata;
-				unsigned int n_dmr = (dmr_cnt - 3U) % 6U;
-				unsigned int fill = (6U - n_dmr);
-				
-				if (n_dmr) {
-					for (unsigned int i = 0U; i < fill; i++) {
-
-						CDMREMB emb;
-						CDMRData rx_dmrdata;
-
-						rx_dmrdata.setSlotNo(2U);
-						rx_dmrdata.setSrcId(m_dmrSrc);
-						rx_dmrdata.setDstId(m_dstid);
-						rx_dmrdata.setFLCO(m_dmrflco);
-						rx_dmrdata.setN(n_dmr);
-						rx_dmrdata.setSeqNo(dmr_cnt);
-						rx_dmrdata.setBER(0U);
-						rx_dmrdata.setRSSI(0U);
-						rx_dmrdata.setDataType(DT_VOICE);
-
-						::memcpy(m_dmrFrame, DMR_SILENCE_DATA, DMR_FRAME_LENGTH_BYTES);
-
-						// Generate the Embedded LC
-						unsigned char lcss = m_EmbeddedLC.getData(m_dmrFrame, n_dmr);
-
-						// Generate the EMB
-						emb.setColorCode(m_colorcode);
-						emb.setLCSS(lcss);
-						emb.getData(m_dmrFrame);
-
-						rx_dmrdata.setData(m_dmrFrame);
-
-						//CUtils::dump(1U, "DMR data:", m_dmrFrame, 33U);
-						m_dmrNetwork->write(rx_dmrdata);
-
-						n_dmr++;
-						dmr_cnt++;
-					}
-				}
-
-				rx_dmrdata.setSlotNo(2U);
-				rx_dmrdata.setSrcId(m_dmrSrc);
-				rx_dmrdata.setDstId(m_dstid);
-				rx_dmrdata.setFLCO(m_dmrflco);
-				rx_dmrdata.setN(n_dmr);
-				rx_dmrdata.setSeqNo(dmr_cnt);
-				rx_dmrdata.setBER(0U);
-				rx_dmrdata.setRSSI(0U);
-				rx_dmrdata.setDataType(DT_TERMINATOR_WITH_LC);
-
-				// Add sync
-				CSync::addDMRDataSync(m_dmrFrame, 0);
-
-				// Add SlotType
-				CDMRSlotType slotType;
-				slotType.setColorCode(m_colorcode);
-				slotType.setDataType(DT_TERMINATOR_WITH_LC);
-				slotType.getData(m_dmrFrame);
-
-				// Full LC
-				CDMRLC dmrLC = CDMRLC(m_dmrflco, m_dmrSrc, m_dstid);
-				CDMRFullLC fullLC;
-				fullLC.encode(dmrLC, m_dmrFrame, DT_TERMINATOR_WITH_LC);
-
-				rx_dmrdata.setData(m_dmrFrame);
-				//CUtils::dump(1U, "DMR data:", m_dmrFrame, 33U);
-				m_dmrNetwork->write(rx_dmrdata);
-
-				dmrWatch.start();
-			}
-			else if(dmrFrameType == TAG_DATA) {
-				CDMREMB emb;
-				CDMRData rx_dmrdata;
-				unsigned int n_dmr = (dmr_cnt - 3U) % 6U;
-
-				rx_dmrdata.setSlotNo(2U);
-				rx_dmrdata.setSrcId(m_dmrSrc);
-				rx_dmrdata.setDstId(m_dstid);
-				rx_dmrdata.setFLCO(m_dmrflco);
-				rx_dmrdata.setN(n_dmr);
-				rx_dmrdata.setSeqNo(dmr_cnt);
-				rx_dmrdata.setBER(0U);
-				rx_dmrdata.setRSSI(0U);
-			
-				if (!n_dmr) {
-					rx_dmrdata.setDataType(DT_VOICE_SYNC);
-					// Add sync
-					CSync::addDMRAudioSync(m_dmrFrame, 0U);
-					// Prepare Full LC data
-					CDMRLC dmrLC = CDMRLC(m_dmrflco, m_dmrSrc, m_dstid);
-					// Configure the Embedded LC
-					m_EmbeddedLC.setLC(dmrLC);
-				}
-				else {
-					rx_dmrdata.setDataType(DT_VOICE);
-					// Generate the Embedded LC
-					unsigned char lcss = m_EmbeddedLC.getData(m_dmrFrame, n_dmr);
-					// Generate the EMB
-					emb.setColorCode(m_colorcode);
-					emb.setLCSS(lcss);
-					emb.getData(m_dmrFrame);
-				}
-
-				rx_dmrdata.setData(m_dmrFrame);
-				
-				//CUtils::dump(1U, "DMR data:", m_dmrFrame, 33U);
-				m_dmrNetwork->write(rx_dmrdata);
-
-				dmr_cnt++;
-				dmrWatch.start();
+		for (unsigned int i = 0U; i < 2U; i++) {
+			if (m_session[i] != NULL) {
+				m_session[i]->readNXDN();
+				m_session[i]->writeDMR();
 			}
 		}
 
 		while (m_dmrNetwork->read(tx_dmrdata) > 0U) {
-			m_dmrSrc = tx_dmrdata.getSrcId();
-			m_dmrDst = tx_dmrdata.getDstId();
-			
-			FLCO netflco = tx_dmrdata.getFLCO();
-			unsigned char DataType = tx_dmrdata.getDataType();
-
-			if (!tx_dmrdata.isMissing()) {
-				networkWatchdog.start();
-
-				if(DataType == DT_TERMINATOR_WITH_LC) {
-					if (m_dmrFrames == 0U) {
-						m_dmrNetwork->reset(2U);
-						networkWatchdog.stop();
-						m_dmrinfo = false;
-						m_firstSync = false;
-						break;
-					}
-
-					LogMessage("DMR received end of voice transmission, %.1f seconds", float(m_dmrFrames) / 16.667F);
-
-					m_conv.putDMREOT();
-					m_dmrNetwork->reset(2U);
-					networkWatchdog.stop();
-					m_dmrFrames = 0U;
-					m_dmrinfo = false;
-					m_firstSync = false;
-				}
-
-				if((DataType == DT_VOICE_LC_HEADER) && (DataType != m_dmrLastDT)) {
-					std::string netSrc = m_dmrlookup->findCS(m_dmrSrc);
-					std::string netDst = (netflco == FLCO_GROUP ? "TG " : "") + m_dmrlookup->findCS(m_dmrDst);
-
-					m_conv.putDMRHeader();
-					LogMessage("DMR header received from %s to %s", netSrc.c_str(), netDst.c_str());
-
-					m_dmrinfo = true;
-
-					m_dmrFrames = 0U;
-					m_firstSync = false;
-				}
-
-				if(DataType == DT_VOICE_SYNC)
-					m_firstSync = true;
-
-				if((DataType == DT_VOICE_SYNC || DataType == DT_VOICE) && m_firstSync) {
-					unsigned char dmr_frame[50];
-					tx_dmrdata.getData(dmr_frame);
-
-					if (!m_dmrinfo) {
-						std::string netSrc = m_dmrlookup->findCS(m_dmrSrc);
-						std::string netDst = (netflco == FLCO_GROUP ? "TG " : "") + m_dmrlookup->findCS(m_dmrDst);
-
-						m_conv.putDMRHeader();
-						LogMessage("DMR late entry from %s to %s", netSrc.c_str(), netDst.c_str());
-
-						m_dmrinfo = true;
-					}
-
-					m_conv.putDMR(dmr_frame); // Add DMR frame for NXDN conversion
-					m_dmrFrames++;
-				}
-			}
-			else {
-				if(DataType == DT_VOICE_SYNC || DataType == DT_VOICE) {
-					unsigned char dmr_frame[50];
-					tx_dmrdata.getData(dmr_frame);
-					m_conv.putDMR(dmr_frame); // Add DMR frame for NXDN conversion
-					m_dmrFrames++;
-				}
-
-				networkWatchdog.clock(ms);
-				if (networkWatchdog.hasExpired()) {
-					LogDebug("Network watchdog has expired, %.1f seconds", float(m_dmrFrames) / 16.667F);
-					m_dmrNetwork->reset(2U);
-					networkWatchdog.stop();
-					m_dmrFrames = 0U;
-					m_dmrinfo = false;
-				}
-			}
-			
-			m_dmrLastDT = DataType;
+			CSlotSession* session = m_session[tx_dmrdata.getSlotNo() - 1U];
+			if (session != NULL)
+				session->readDMR(tx_dmrdata, ms);
 		}
 
-		if (nxdnWatch.elapsed() > NXDN_FRAME_PER) {
-			unsigned int nxdnFrameType = m_conv.getNXDN(m_nxdnFrame);
-
-			if(nxdnFrameType == TAG_HEADER) {
-				nxdn_cnt = 0U;
-				m_nxdnSrc = findNXDNID(m_dmrSrc);
-
-				CNXDNLICH lich;
-				lich.setRFCT(NXDN_LICH_RFCT_RDCH);
-				lich.setFCT(NXDN_LICH_USC_SACCH_NS);
-				lich.setOption(NXDN_LICH_STEAL_FACCH);
-				lich.setDirection(NXDN_LICH_DIRECTION_INBOUND);
-				m_nxdnFrame[0U] = lich.getRaw();
-
-				CNXDNSACCH sacch;
-				sacch.setRAN(0x01);
-				sacch.setStructure(NXDN_SR_SINGLE);
-				sacch.setData(SACCH_IDLE);
-				sacch.getRaw(m_nxdnFrame + 1U);
-
-				unsigned char layer3data[25U];
-				CNXDNLayer3 layer3;
-				layer3.setMessageType(NXDN_MESSAGE_TYPE_VCALL);
-				layer3.setSourceUnitId(m_nxdnSrc & 0xFFFF);
-				layer3.setDestinationGroupId(m_nxdnTG & 0xFFFF);
-				layer3.setGroup(true);
-				layer3.setDataBlocks(0U);
-				layer3.getData(layer3data);
-
-				::memcpy(m_nxdnFrame + 5U, layer3data, 14U);
-				::memcpy(m_nxdnFrame + 5U + 14U, layer3data, 14U);
-
-				m_nxdnNetwork->write(m_nxdnFrame, m_nxdnSrc, m_nxdnTG, true);
-
-				nxdnWatch.start();
-			}
-			else if (nxdnFrameType == TAG_EOT) {
-				CNXDNLICH lich;
-				lich.setRFCT(NXDN_LICH_RFCT_RDCH);
-				lich.setFCT(NXDN_LICH_USC_SACCH_NS);
-				lich.setOption(NXDN_LICH_STEAL_FACCH);
-				lich.setDirection(NXDN_LICH_DIRECTION_INBOUND);
-				m_nxdnFrame[0U] = lich.getRaw();
-
-				CNXDNSACCH sacch;
-				sacch.setRAN(0x01);
-				sacch.setStructure(NXDN_SR_SINGLE);
-				sacch.setData(SACCH_IDLE);
-				sacch.getRaw(m_nxdnFrame + 1U);
-
-				unsigned char layer3data[25U];
-				CNXDNLayer3 layer3;
-				layer3.setMessageType(NXDN_MESSAGE_TYPE_TX_REL);
-				layer3.setSourceUnitId(m_nxdnSrc & 0xFFFF);
-				layer3.setDestinationGroupId(m_nxdnTG & 0xFFFF);
-				layer3.setGroup(true);
-				layer3.setDataBlocks(0U);
-				layer3.getData(layer3data);
-
-				::memcpy(m_nxdnFrame + 5U, layer3data, 14U);
-				::memcpy(m_nxdnFrame + 5U + 14U, layer3data, 14U);
-
-				m_nxdnNetwork->write(m_nxdnFrame, m_nxdnSrc, m_nxdnTG, true);
-
-				nxdn_cnt = 0U;
-			}
-			else if (nxdnFrameType == TAG_DATA) {
-				CNXDNLICH lich;
-				lich.setRFCT(NXDN_LICH_RFCT_RDCH);
-				lich.setFCT(NXDN_LICH_USC_SACCH_SS);
-				lich.setOption(NXDN_LICH_STEAL_NONE);
-				lich.setDirection(NXDN_LICH_DIRECTION_INBOUND);
-				m_nxdnFrame[0U] = lich.getRaw();
-
-				CNXDNSACCH sacch;
-				CNXDNLayer3 layer3;
-				unsigned char message[3U];
-
-				layer3.setMessageType(NXDN_MESSAGE_TYPE_VCALL);
-				layer3.setSourceUnitId(m_nxdnSrc & 0xFFFF);
-				layer3.setDestinationGroupId(m_nxdnTG & 0xFFFF);
-				layer3.setGroup(true);
-				layer3.setDataBlocks(0U);
-
-				switch (nxdn_cnt % 4) {
-					case 0:
-						sacch.setStructure(NXDN_SR_1_4);
-						layer3.encode(message, 18U, 0U);
-						sacch.setData(message);
-						break;
-					case 1:
-						sacch.setStructure(NXDN_SR_2_4);
-						layer3.encode(message, 18U, 18U);
-						sacch.setData(message);
-						break;
-					case 2:
-						sacch.setStructure(NXDN_SR_3_4);
-						layer3.encode(message, 18U, 36U);
-						sacch.setData(message);
-						break;
-					case 3:
-						sacch.setStructure(NXDN_SR_4_4);
-						layer3.encode(message, 18U, 54U);
-						sacch.setData(message);
-						break;
-				}
-
-				sacch.setRAN(0x01);
-				sacch.getRaw(m_nxdnFrame + 1U);
-
-				// Send data to MMDVMHost
-				m_nxdnNetwork->write(m_nxdnFrame, m_nxdnSrc, m_nxdnTG, true);
-				
-				nxdn_cnt++;
-				nxdnWatch.start();
-			}
+		for (unsigned int i = 0U; i < 2U; i++) {
+			if (m_session[i] != NULL)
+				m_session[i]->writeNXDN();
 		}
 
 		stopWatch.start();
 
 		m_dmrNetwork->clock(ms);
 
-		if (m_xlxReflectors != NULL)
-			m_xlxReflectors->clock(ms);
 
-		pollTimer.clock(ms);
-		if (pollTimer.isRunning() && pollTimer.hasExpired() && m_nxdnTG != NXDNGW_DSTID_DEF) {
-			m_nxdnNetwork->writePoll(m_nxdnTG);
-			pollTimer.start();
+		for (unsigned int i = 0U; i < 2U; i++) {
+			if (m_session[i] != NULL)
+				m_session[i]->clock(ms);
 		}
 
 		if (ms < 5U)
 			CThread::sleep(5U);
 	}
 
-	// Unlink reflector at exit (not NXDNGateway operation)
-	if (m_nxdnTG != NXDNGW_DSTID_DEF) {
-		m_nxdnNetwork->writeUnlink(m_nxdnTG);
-		m_nxdnNetwork->writeUnlink(m_nxdnTG);
-		m_nxdnNetwork->writeUnlink(m_nxdnTG);
+	watchdog.report();
+
+	for (unsigned int i = 0U; i < 2U; i++) {
+		if (m_session[i] != NULL)
+			m_session[i]->unlink();
+
+		if (m_nxdnNetwork[i] != NULL)
+			m_nxdnNetwork[i]->close();
 	}
 
-	m_nxdnNetwork->close();
 	m_dmrNetwork->close();
 	delete m_dmrNetwork;
-	delete m_nxdnNetwork;
 
-	if (m_xlxReflectors != NULL)
+	if (m_xlxReflectors != NULL) {
+		m_xlxReflectors->stop();
 		delete m_xlxReflectors;
+	}
 
-	::LogFinalise();
-
-	return 0;
-}
-
-unsigned int CNXDN2DMR::findNXDNID(unsigned int dmrid)
-{
-	std::string dmrCS = m_dmrlookup->findCS(dmrid);
-	unsigned int nxdnID = m_nxdnlookup->findID(dmrCS);
-
-	if (nxdnID == 0)
-		nxdnID = truncID(dmrid);
-	else
-		LogMessage("NXDN ID of %s: %u", dmrCS.c_str(), nxdnID);
-
-	return nxdnID;
-}
+	m_idIndex->stop();
+	delete m_idIndex;
 
-unsigned int CNXDN2DMR::findDMRID(unsigned int nxdnid)
-{
-	std::string nxdnCS = m_nxdnlookup->findCS(nxdnid);
-	unsigned int dmrID = m_dmrlookup->findID(nxdnCS);
+	CResolver::stop();
 
-	if (dmrID == 0)
-		dmrID = m_defsrcid;
-	else
-		LogMessage("DMR ID of %s: %u", nxdnCS.c_str(), dmrID);
+	::LogFinalise();
 
-	return dmrID;
+	return 0;
 }
 
-unsigned int CNXDN2DMR::truncID(unsigned int id)
+CNXDNNetwork* CNXDN2DMR::createNXDNNetwork(const std::string& dstAddress, unsigned int dstPort, const std::string& localAddress, unsigned int localPort)
 {
-	char temp[20];
+	bool debug = m_conf.getDMRNetworkDebug();
 
-	snprintf(temp, 8, "%07d", id);
-	unsigned int newid = atoi(temp + 2);
+	CNXDNNetwork* network = new CNXDNNetwork(localAddress, localPort, m_callsign, debug);
+	network->setDestination(dstAddress, dstPort);
 
-	if (newid > 65519 || newid == 0)
-		newid = m_defaultID;
+	bool ret = network->open();
+	if (!ret) {
+		delete network;
+		return NULL;
+	}
 
-	return newid;
+	return network;
 }
 
-bool CNXDN2DMR::createDMRNetwork()
+bool CNXDN2DMR::createDMRNetwork(bool slot1)
 {
 	std::string address   = m_conf.getDMRNetworkAddress();
 	m_xlxmodule           = m_conf.getDMRXLXModule();
@@ -824,9 +421,9 @@ bool CNXDN2DMR::createDMRNetwork()
 	std::string password  = m_conf.getDMRNetworkPassword();
 	bool debug            = m_conf.getDMRNetworkDebug();
 	unsigned int jitter   = m_conf.getDMRNetworkJitter();
-	bool slot1            = false;
 	bool slot2            = true;
-	bool duplex           = false;
+	// Slot 1 is only carried by a duplex login
+	bool duplex           = slot1;
 	HW_TYPE hwType        = HWT_MMDVM;
 
 	m_srcHS = m_conf.getDMRId();
@@ -841,11 +438,11 @@ bool CNXDN2DMR::createDMRNetwork()
 		m_dstid = 4000 + xlxmod[0] - 64;
 		m_dmrpc = 0;
 
-		CReflector* reflector = m_xlxReflectors->find(m_xlxrefl);
-		if (reflector == NULL)
+		CReflector reflector;
+		if (!m_xlxReflectors->find(m_xlxrefl, reflector))
 			return false;
 		
-		address = reflector->m_address;
+		address = reflector.m_address;
 	}
 
 	if (m_srcHS > 99999999U)
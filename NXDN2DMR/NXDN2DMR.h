@@ -30,12 +30,14 @@
 #include "DMREMB.h"
 #include "DMRLookup.h"
 #include "NXDNConvolution.h"
+#include "NXDNCallTemplate.h"
 #include "NXDNCRC.h"
 #include "NXDNLayer3.h"
 #include "NXDNLICH.h"
 #include "NXDNLookup.h"
 #include "NXDNSACCH.h"
 #include "NXDNNetwork.h"
+#include "SlotSession.h"
 #include "Reflectors.h"
 #include "UDPSocket.h"
 #include "StopWatch.h"
@@ -67,42 +69,26 @@ public:
 
 private:
 	std::string      m_callsign;
-	unsigned int     m_nxdnTG;
 	CConf            m_conf;
 	CDMRNetwork*     m_dmrNetwork;
-	CNXDNNetwork*    m_nxdnNetwork;
+	CNXDNNetwork*    m_nxdnNetwork[2U];
+	CSlotSession*    m_session[2U];
 	CDMRLookup*      m_dmrlookup;
 	CNXDNLookup*     m_nxdnlookup;
-	CModeConv        m_conv;
+	CIdIndex*        m_idIndex;
 	unsigned int     m_colorcode;
 	unsigned int     m_srcHS;
 	unsigned int     m_defsrcid;
 	unsigned int     m_dstid;
 	bool             m_dmrpc;
-	unsigned int     m_dmrSrc;
-	unsigned int     m_dmrDst;
-	unsigned int     m_nxdnSrc;
-	unsigned int     m_nxdnDst;
-	unsigned char    m_dmrLastDT;
-	unsigned char*   m_nxdnFrame;
-	unsigned char*   m_dmrFrame;
-	unsigned int     m_dmrFrames;
-	unsigned int     m_nxdnFrames;
-	CDMREmbeddedData m_EmbeddedLC;
-	FLCO             m_dmrflco;
-	bool             m_dmrinfo;
-	bool             m_nxdninfo;
 	std::string      m_xlxmodule;
 	bool             m_xlxConnected;
 	CReflectors*     m_xlxReflectors;
 	unsigned int     m_xlxrefl;
 	unsigned int     m_defaultID;
-	bool             m_firstSync;
 
-	bool createDMRNetwork();
-	unsigned int findNXDNID(unsigned int dmrid);
-	unsigned int findDMRID(unsigned int nxdnid);
-	unsigned int truncID(unsigned int id);
+	CNXDNNetwork* createNXDNNetwork(const std::string& dstAddress, unsigned int dstPort, const std::string& localAddress, unsigned int localPort);
+	bool createDMRNetwork(bool slot1);
 	void writeXLXLink(unsigned int srcId, unsigned int dstId, CDMRNetwork* network);
 };
 
@@ -0,0 +1,516 @@
+/*
+ *   Copyright (C) 2016,2017 by Jonathan Naylor G4KLX
+ *   Copyright (C) 2018 by Andy Uribe CA6JAU
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "SlotSession.h"
+#include "DMRSlotType.h"
+#include "DMRFullLC.h"
+#include "DMREMB.h"
+#include "DMRLC.h"
+#include "NXDNLICH.h"
+#include "Sync.h"
+#include "Log.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cassert>
+
+#define NXDNGW_DSTID_DEF    20U
+
+CSlotSession::CSlotSession(unsigned int slotNo, CNXDNNetwork* nxdnNetwork, unsigned int nxdnTG, unsigned int dstId, bool pc, bool ambeCorrection) :
+m_slotNo(slotNo),
+m_nxdnNetwork(nxdnNetwork),
+m_dmrNetwork(NULL),
+m_dmrLookup(NULL),
+m_nxdnLookup(NULL),
+m_idIndex(NULL),
+m_nxdnTG(nxdnTG),
+m_dstId(dstId),
+m_dmrFLCO(pc ? FLCO_USER_USER : FLCO_GROUP),
+m_colorCode(1U),
+m_defSrcId(1U),
+m_conv(),
+m_nxdnCall(),
+m_embeddedLC(),
+m_dmrSrc(1U),
+m_dmrDst(1U),
+m_nxdnSrc(1U),
+m_nxdnDst(1U),
+m_dmrLastDT(0U),
+m_nxdnFrame(NULL),
+m_dmrFrame(NULL),
+m_dmrFrames(0U),
+m_nxdnFrames(0U),
+m_dmrCount(0U),
+m_nxdnCount(0U),
+m_dmrInfo(false),
+m_nxdnInfo(false),
+m_firstSync(false),
+m_dmrWatch(),
+m_nxdnWatch(),
+m_networkWatchdog(100U, 0U, 1500U),
+m_pollTimer(1000U, 5U)
+{
+	assert(slotNo == 1U || slotNo == 2U);
+	assert(nxdnNetwork != NULL);
+
+	m_nxdnFrame = new unsigned char[200U];
+	m_dmrFrame  = new unsigned char[50U];
+
+	::memset(m_nxdnFrame, 0U, 200U);
+	::memset(m_dmrFrame, 0U, 50U);
+
+	m_conv.setAMBECorrection(ambeCorrection);
+
+	m_dmrWatch.start();
+	m_nxdnWatch.start();
+	m_pollTimer.start();
+}
+
+CSlotSession::~CSlotSession()
+{
+	delete[] m_nxdnFrame;
+	delete[] m_dmrFrame;
+}
+
+void CSlotSession::setDMR(CDMRNetwork* network, unsigned int colorCode, unsigned int defSrcId)
+{
+	assert(network != NULL);
+
+	m_dmrNetwork = network;
+	m_colorCode  = colorCode;
+	m_defSrcId   = defSrcId;
+}
+
+void CSlotSession::setLookups(CDMRLookup* dmrLookup, CNXDNLookup* nxdnLookup, CIdIndex* idIndex)
+{
+	assert(dmrLookup != NULL);
+	assert(nxdnLookup != NULL);
+	assert(idIndex != NULL);
+
+	m_dmrLookup  = dmrLookup;
+	m_nxdnLookup = nxdnLookup;
+	m_idIndex    = idIndex;
+}
+
+unsigned int CSlotSession::getSlotNo() const
+{
+	return m_slotNo;
+}
+
+unsigned int CSlotSession::getDstId() const
+{
+	return m_dstId;
+}
+
+void CSlotSession::link()
+{
+	// Link to reflector at startup (not NXDNGateway operation)
+	if (m_nxdnTG != NXDNGW_DSTID_DEF) {
+		m_nxdnNetwork->writePoll(m_nxdnTG);
+		m_nxdnNetwork->writePoll(m_nxdnTG);
+		m_nxdnNetwork->writePoll(m_nxdnTG);
+	}
+}
+
+void CSlotSession::unlink()
+{
+	// Unlink reflector at exit (not NXDNGateway operation)
+	if (m_nxdnTG != NXDNGW_DSTID_DEF) {
+		m_nxdnNetwork->writeUnlink(m_nxdnTG);
+		m_nxdnNetwork->writeUnlink(m_nxdnTG);
+		m_nxdnNetwork->writeUnlink(m_nxdnTG);
+	}
+}
+
+void CSlotSession::readNXDN()
+{
+	unsigned char buffer[2000U];
+
+	unsigned int len = 0;
+	while ((len = m_nxdnNetwork->read(buffer)) > 0U) {
+		if (::memcmp(buffer, "NXDND", 5U) == 0U && len == 43U) {
+			CNXDNLICH lich;
+			m_nxdnSrc = (buffer[5U] << 8) | buffer[6U];
+			m_nxdnDst = (buffer[7U] << 8) | buffer[8U];
+			bool end = (buffer[9U] & 0x08) == 0x08;
+			bool grp = (buffer[9U] & 0x01) == 0x01;
+
+			lich.setRaw(buffer[10U]);
+			unsigned char usc = lich.getFCT();
+			unsigned char opt = lich.getOption();
+
+			if (usc == NXDN_LICH_USC_SACCH_NS) {
+				if (end) {
+					LogMessage("Slot %u, NXDN received end of voice transmission, %.1f seconds", m_slotNo, float(m_nxdnFrames) / 12.5F);
+					m_conv.putNXDNEOT();
+					m_nxdnFrames = 0U;
+					m_nxdnInfo = false;
+				} else {
+					std::string netSrc = m_nxdnLookup->findCS(m_nxdnSrc);
+					std::string netDst = m_nxdnLookup->findCS(m_nxdnDst);
+					LogMessage("Slot %u, received NXDN header from %s to %s%s", m_slotNo, netSrc.c_str(), grp ? "TG " : "", netDst.c_str());
+
+					m_dmrNetwork->reset(m_slotNo);	// OE1KBC fix
+
+					m_conv.putNXDNHeader();
+					m_nxdnFrames = 0U;
+					m_nxdnInfo = true;
+				}
+			} else {
+				if (opt == NXDN_LICH_STEAL_NONE) {
+					if (!m_nxdnInfo) {
+						std::string netSrc = m_nxdnLookup->findCS(m_nxdnSrc);
+						std::string netDst = m_nxdnLookup->findCS(m_nxdnDst);
+						LogMessage("Slot %u, received NXDN late entry from %s to %s%s", m_slotNo, netSrc.c_str(), grp ? "TG " : "", netDst.c_str());
+
+						m_dmrNetwork->reset(m_slotNo);	// OE1KBC fix
+
+						m_conv.putNXDNHeader();
+						m_nxdnInfo = true;
+					}
+
+					m_conv.putNXDN(buffer + 10U);
+					m_nxdnFrames++;
+				}
+			}
+		}
+		else if (::memcmp(buffer, "NXDNP", 5U) == 0 && len == 17U && m_nxdnTG == NXDNGW_DSTID_DEF) {
+				// Return the poll
+				m_nxdnNetwork->write(buffer, len);
+		}
+	}
+}
+
+void CSlotSession::writeDMR()
+{
+	if (m_dmrWatch.elapsed() <= DMR_FRAME_PER)
+		return;
+
+	unsigned int dmrFrameType = m_conv.getDMR(m_dmrFrame);
+
+	if(dmrFrameType == TAG_HEADER) {
+		CDMRData rx_dmrdata;
+		m_dmrCount = 0U;
+		m_dmrSrc = findDMRID(m_nxdnSrc);
+
+		rx_dmrdata.setSlotNo(m_slotNo);
+		rx_dmrdata.setSrcId(m_dmrSrc);
+		rx_dmrdata.setDstId(m_dstId);
+		rx_dmrdata.setFLCO(m_dmrFLCO);
+		rx_dmrdata.setN(0U);
+		rx_dmrdata.setSeqNo(0U);
+		rx_dmrdata.setBER(0U);
+		rx_dmrdata.setRSSI(0U);
+		rx_dmrdata.setDataType(DT_VOICE_LC_HEADER);
+
+		// Add sync
+		CSync::addDMRDataSync(m_dmrFrame, 0);
+
+		// Add SlotType
+		CDMRSlotType slotType;
+		slotType.setColorCode(m_colorCode);
+		slotType.setDataType(DT_VOICE_LC_HEADER);
+		slotType.getData(m_dmrFrame);
+
+		// Full LC
+		CDMRLC dmrLC = CDMRLC(m_dmrFLCO, m_dmrSrc, m_dstId);
+		CDMRFullLC fullLC;
+		fullLC.encode(dmrLC, m_dmrFrame, DT_VOICE_LC_HEADER);
+		m_embeddedLC.setLC(dmrLC);
+
+		rx_dmrdata.setData(m_dmrFrame);
+		//CUtils::dump(1U, "DMR data:", m_dmrFrame, 33U);
+
+		for (unsigned int i = 0U; i < 3U; i++) {
+			rx_dmrdata.setSeqNo(m_dmrCount);
+			m_dmrNetwork->write(rx_dmrdata);
+			m_dmrCount++;
+		}
+
+		m_dmrWatch.start();
+	}
+	else if(dmrFrameType == TAG_EOT) {
+		CDMRData rx_dmrdata;
+		unsigned int n_dmr = (m_dmrCount - 3U) % 6U;
+		unsigned int fill = (6U - n_dmr);
+
+		if (n_dmr) {
+			for (unsigned int i = 0U; i < fill; i++) {
+
+				CDMREMB emb;
+				CDMRData rx_dmrdata;
+
+				rx_dmrdata.setSlotNo(m_slotNo);
+				rx_dmrdata.setSrcId(m_dmrSrc);
+				rx_dmrdata.setDstId(m_dstId);
+				rx_dmrdata.setFLCO(m_dmrFLCO);
+				rx_dmrdata.setN(n_dmr);
+				rx_dmrdata.setSeqNo(m_dmrCount);
+				rx_dmrdata.setBER(0U);
+				rx_dmrdata.setRSSI(0U);
+				rx_dmrdata.setDataType(DT_VOICE);
+
+				::memcpy(m_dmrFrame, DMR_SILENCE_DATA, DMR_FRAME_LENGTH_BYTES);
+
+				// Generate the Embedded LC
+				unsigned char lcss = m_embeddedLC.getData(m_dmrFrame, n_dmr);
+
+				// Generate the EMB
+				emb.setColorCode(m_colorCode);
+				emb.setLCSS(lcss);
+				emb.getData(m_dmrFrame);
+
+				rx_dmrdata.setData(m_dmrFrame);
+
+				//CUtils::dump(1U, "DMR data:", m_dmrFrame, 33U);
+				m_dmrNetwork->write(rx_dmrdata);
+
+				n_dmr++;
+				m_dmrCount++;
+			}
+		}
+
+		rx_dmrdata.setSlotNo(m_slotNo);
+		rx_dmrdata.setSrcId(m_dmrSrc);
+		rx_dmrdata.setDstId(m_dstId);
+		rx_dmrdata.setFLCO(m_dmrFLCO);
+		rx_dmrdata.setN(n_dmr);
+		rx_dmrdata.setSeqNo(m_dmrCount);
+		rx_dmrdata.setBER(0U);
+		rx_dmrdata.setRSSI(0U);
+		rx_dmrdata.setDataType(DT_TERMINATOR_WITH_LC);
+
+		// Add sync
+		CSync::addDMRDataSync(m_dmrFrame, 0);
+
+		// Add SlotType
+		CDMRSlotType slotType;
+		slotType.setColorCode(m_colorCode);
+		slotType.setDataType(DT_TERMINATOR_WITH_LC);
+		slotType.getData(m_dmrFrame);
+
+		// Full LC
+		CDMRLC dmrLC = CDMRLC(m_dmrFLCO, m_dmrSrc, m_dstId);
+		CDMRFullLC fullLC;
+		fullLC.encode(dmrLC, m_dmrFrame, DT_TERMINATOR_WITH_LC);
+
+		rx_dmrdata.setData(m_dmrFrame);
+		//CUtils::dump(1U, "DMR data:", m_dmrFrame, 33U);
+		m_dmrNetwork->write(rx_dmrdata);
+
+		m_dmrWatch.start();
+	}
+	else if(dmrFrameType == TAG_DATA) {
+		CDMREMB emb;
+		CDMRData rx_dmrdata;
+		unsigned int n_dmr = (m_dmrCount - 3U) % 6U;
+
+		rx_dmrdata.setSlotNo(m_slotNo);
+		rx_dmrdata.setSrcId(m_dmrSrc);
+		rx_dmrdata.setDstId(m_dstId);
+		rx_dmrdata.setFLCO(m_dmrFLCO);
+		rx_dmrdata.setN(n_dmr);
+		rx_dmrdata.setSeqNo(m_dmrCount);
+		rx_dmrdata.setBER(0U);
+		rx_dmrdata.setRSSI(0U);
+
+		if (!n_dmr) {
+			rx_dmrdata.setDataType(DT_VOICE_SYNC);
+			// Add sync
+			CSync::addDMRAudioSync(m_dmrFrame, 0U);
+			// Prepare Full LC data
+			CDMRLC dmrLC = CDMRLC(m_dmrFLCO, m_dmrSrc, m_dstId);
+			// Configure the Embedded LC
+			m_embeddedLC.setLC(dmrLC);
+		}
+		else {
+			rx_dmrdata.setDataType(DT_VOICE);
+			// Generate the Embedded LC
+			unsigned char lcss = m_embeddedLC.getData(m_dmrFrame, n_dmr);
+			// Generate the EMB
+			emb.setColorCode(m_colorCode);
+			emb.setLCSS(lcss);
+			emb.getData(m_dmrFrame);
+		}
+
+		rx_dmrdata.setData(m_dmrFrame);
+
+		//CUtils::dump(1U, "DMR data:", m_dmrFrame, 33U);
+		m_dmrNetwork->write(rx_dmrdata);
+
+		m_dmrCount++;
+		m_dmrWatch.start();
+	}
+}
+
+void CSlotSession::readDMR(const CDMRData& tx_dmrdata, unsigned int ms)
+{
+	assert(tx_dmrdata.getSlotNo() == m_slotNo);
+
+	m_dmrSrc = tx_dmrdata.getSrcId();
+	m_dmrDst = tx_dmrdata.getDstId();
+
+	FLCO netflco = tx_dmrdata.getFLCO();
+	unsigned char DataType = tx_dmrdata.getDataType();
+
+	if (!tx_dmrdata.isMissing()) {
+		m_networkWatchdog.start();
+
+		if(DataType == DT_TERMINATOR_WITH_LC) {
+			if (m_dmrFrames == 0U) {
+				m_dmrNetwork->reset(m_slotNo);
+				m_networkWatchdog.stop();
+				m_dmrInfo = false;
+				m_firstSync = false;
+				return;
+			}
+
+			LogMessage("Slot %u, DMR received end of voice transmission, %.1f seconds", m_slotNo, float(m_dmrFrames) / 16.667F);
+
+			m_conv.putDMREOT();
+			m_dmrNetwork->reset(m_slotNo);
+			m_networkWatchdog.stop();
+			m_dmrFrames = 0U;
+			m_dmrInfo = false;
+			m_firstSync = false;
+		}
+
+		if((DataType == DT_VOICE_LC_HEADER) && (DataType != m_dmrLastDT)) {
+			std::string netSrc = m_dmrLookup->findCS(m_dmrSrc);
+			std::string netDst = (netflco == FLCO_GROUP ? "TG " : "") + m_dmrLookup->findCS(m_dmrDst);
+
+			m_conv.putDMRHeader();
+			LogMessage("Slot %u, DMR header received from %s to %s", m_slotNo, netSrc.c_str(), netDst.c_str());
+
+			m_dmrInfo = true;
+
+			m_dmrFrames = 0U;
+			m_firstSync = false;
+		}
+
+		if(DataType == DT_VOICE_SYNC)
+			m_firstSync = true;
+
+		if((DataType == DT_VOICE_SYNC || DataType == DT_VOICE) && m_firstSync) {
+			unsigned char dmr_frame[50];
+			tx_dmrdata.getData(dmr_frame);
+
+			if (!m_dmrInfo) {
+				std::string netSrc = m_dmrLookup->findCS(m_dmrSrc);
+				std::string netDst = (netflco == FLCO_GROUP ? "TG " : "") + m_dmrLookup->findCS(m_dmrDst);
+
+				m_conv.putDMRHeader();
+				LogMessage("Slot %u, DMR late entry from %s to %s", m_slotNo, netSrc.c_str(), netDst.c_str());
+
+				m_dmrInfo = true;
+			}
+
+			m_conv.putDMR(dmr_frame); // Add DMR frame for NXDN conversion
+			m_dmrFrames++;
+		}
+	}
+	else {
+		if(DataType == DT_VOICE_SYNC || DataType == DT_VOICE) {
+			unsigned char dmr_frame[50];
+			tx_dmrdata.getData(dmr_frame);
+			m_conv.putDMR(dmr_frame); // Add DMR frame for NXDN conversion
+			m_dmrFrames++;
+		}
+
+		m_networkWatchdog.clock(ms);
+		if (m_networkWatchdog.hasExpired()) {
+			LogDebug("Slot %u, network watchdog has expired, %.1f seconds", m_slotNo, float(m_dmrFrames) / 16.667F);
+			m_dmrNetwork->reset(m_slotNo);
+			m_networkWatchdog.stop();
+			m_dmrFrames = 0U;
+			m_dmrInfo = false;
+		}
+	}
+
+	m_dmrLastDT = DataType;
+}
+
+void CSlotSession::writeNXDN()
+{
+	if (m_nxdnWatch.elapsed() <= NXDN_FRAME_PER)
+		return;
+
+	unsigned int nxdnFrameType = m_conv.getNXDN(m_nxdnFrame);
+
+	if(nxdnFrameType == TAG_HEADER) {
+		m_nxdnCount = 0U;
+		m_nxdnSrc = findNXDNID(m_dmrSrc);
+
+		m_nxdnCall.setCall(m_nxdnSrc, m_nxdnTG);
+		m_nxdnCall.getHeader(m_nxdnFrame);
+
+		m_nxdnNetwork->write(m_nxdnFrame, m_nxdnSrc, m_nxdnTG, true);
+
+		m_nxdnWatch.start();
+	}
+	else if (nxdnFrameType == TAG_EOT) {
+		m_nxdnCall.setCall(m_nxdnSrc, m_nxdnTG);
+		m_nxdnCall.getTerminator(m_nxdnFrame);
+
+		m_nxdnNetwork->write(m_nxdnFrame, m_nxdnSrc, m_nxdnTG, true);
+
+		m_nxdnCount = 0U;
+	}
+	else if (nxdnFrameType == TAG_DATA) {
+		m_nxdnCall.setCall(m_nxdnSrc, m_nxdnTG);
+		m_nxdnCall.getVoice(m_nxdnFrame, m_nxdnCount);
+
+		// Send data to MMDVMHost
+		m_nxdnNetwork->write(m_nxdnFrame, m_nxdnSrc, m_nxdnTG, true);
+
+		m_nxdnCount++;
+		m_nxdnWatch.start();
+	}
+}
+
+void CSlotSession::clock(unsigned int ms)
+{
+	m_pollTimer.clock(ms);
+	if (m_pollTimer.isRunning() && m_pollTimer.hasExpired() && m_nxdnTG != NXDNGW_DSTID_DEF) {
+		m_nxdnNetwork->writePoll(m_nxdnTG);
+		m_pollTimer.start();
+	}
+}
+
+unsigned int CSlotSession::findNXDNID(unsigned int dmrid)
+{
+	unsigned int nxdnID;
+	if (m_idIndex->findNXDNID(dmrid, nxdnID))
+		LogMessage("NXDN ID of DMR ID %u: %u", dmrid, nxdnID);
+
+	return nxdnID;
+}
+
+unsigned int CSlotSession::findDMRID(unsigned int nxdnid)
+{
+	unsigned int dmrID;
+	if (m_idIndex->findDMRID(nxdnid, dmrID))
+		LogMessage("DMR ID of NXDN ID %u: %u", nxdnid, dmrID);
+	else
+		dmrID = m_defSrcId;
+
+	return dmrID;
+}
@@ -0,0 +1,105 @@
+/*
+ *   Copyright (C) 2016,2017 by Jonathan Naylor G4KLX
+ *   Copyright (C) 2018 by Andy Uribe CA6JAU
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(SLOTSESSION_H)
+#define SLOTSESSION_H
+
+#include "DMRDefines.h"
+#include "ModeConv.h"
+#include "DMRNetwork.h"
+#include "DMREmbeddedData.h"
+#include "DMRLookup.h"
+#include "IdIndex.h"
+#include "NXDNCallTemplate.h"
+#include "NXDNLookup.h"
+#include "NXDNNetwork.h"
+#include "StopWatch.h"
+#include "Timer.h"
+
+// Pacing of the converted frames, also what the main loop has to keep up with
+#define DMR_FRAME_PER       55U
+#define NXDN_FRAME_PER      75U
+
+// One NXDN to DMR conversation, carried on one slot of the shared DMR login
+class CSlotSession
+{
+public:
+	CSlotSession(unsigned int slotNo, CNXDNNetwork* nxdnNetwork, unsigned int nxdnTG, unsigned int dstId, bool pc, bool ambeCorrection);
+	~CSlotSession();
+
+	void setDMR(CDMRNetwork* network, unsigned int colorCode, unsigned int defSrcId);
+	void setLookups(CDMRLookup* dmrLookup, CNXDNLookup* nxdnLookup, CIdIndex* idIndex);
+
+	unsigned int getSlotNo() const;
+	unsigned int getDstId() const;
+
+	void link();
+	void unlink();
+
+	// Drains the NXDN socket into the converter
+	void readNXDN();
+	// One frame received on this slot of the DMR network
+	void readDMR(const CDMRData& data, unsigned int ms);
+
+	// Paced output of the converted frames
+	void writeDMR();
+	void writeNXDN();
+
+	void clock(unsigned int ms);
+
+private:
+	unsigned int      m_slotNo;
+	CNXDNNetwork*     m_nxdnNetwork;
+	CDMRNetwork*      m_dmrNetwork;
+	CDMRLookup*       m_dmrLookup;
+	CNXDNLookup*      m_nxdnLookup;
+	CIdIndex*         m_idIndex;
+	unsigned int      m_nxdnTG;
+	unsigned int      m_dstId;
+	FLCO              m_dmrFLCO;
+	unsigned int      m_colorCode;
+	unsigned int      m_defSrcId;
+	CModeConv         m_conv;
+	CNXDNCallTemplate m_nxdnCall;
+	CDMREmbeddedData  m_embeddedLC;
+	unsigned int      m_dmrSrc;
+	unsigned int      m_dmrDst;
+	unsigned int      m_nxdnSrc;
+	unsigned int      m_nxdnDst;
+	unsigned char     m_dmrLastDT;
+	unsigned char*    m_nxdnFrame;
+	unsigned char*    m_dmrFrame;
+	unsigned int      m_dmrFrames;
+	unsigned int      m_nxdnFrames;
+	unsigned char     m_dmrCount;
+	unsigned char     m_nxdnCount;
+	bool              m_dmrInfo;
+	bool              m_nxdnInfo;
+	bool              m_firstSync;
+	CStopWatch        m_dmrWatch;
+	CStopWatch        m_nxdnWatch;
+	CTimer            m_networkWatchdog;
+	CTimer            m_pollTimer;
+
+	unsigned int findNXDNID(unsigned int dmrid);
+	unsigned int findDMRID(unsigned int nxdnid);
+};
+
+#endif
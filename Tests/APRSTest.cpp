@@ -0,0 +1,243 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "Tests.h"
+
+#include "APRSWriterThread.h"
+#include "TCPSocket.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+const unsigned int LONG_LINE_LENGTH = 5000U;
+
+// How long the stub waits on the client, far longer than any of the cases should take
+const unsigned int STUB_TIMEOUT = 5000U;
+
+// A frame queued on a connected thread has to go out well before the 10 s the thread sleeps for
+const unsigned int WAKE_LIMIT = 1000U;
+
+static const char* BANNER    = "# aprsc 2.1.10-gd72a17c";
+static const char* LOGRESP   = "# logresp N0CALL verified, server T2TEST";
+static const char* KEEPALIVE = "# aprsc 2.1.10-gd72a17c 18 Oct 2026 12:00:00 GMT T2TEST 127.0.0.1:14580";
+static const char* PACKET    = "G4KLX-9>APDR15,TCPIP*,qAC,T2TEST:=5130.00N/00007.00W>";
+static const char* REPORT    = "N0CALL-7>APDG03,TCPIP*,qAC,N0CALL:!5130.00N/00007.00W[";
+
+// Sends lines cut in the middle and one longer than the client buffer, then hangs up
+class CLineServer : public CStubServer {
+public:
+	CLineServer() :
+	CStubServer("127.0.0.1")
+	{
+	}
+
+protected:
+	virtual void serve(int fd)
+	{
+		send(fd, std::string(BANNER) + "\r\n" + PACKET + "\r\nN0CALL>APRS:tw");
+		CThread::sleep(200U);
+		send(fd, "o\r\n" + std::string(LONG_LINE_LENGTH - 1U, 'x') + "\n");
+	}
+};
+
+// Plays an APRS-IS server: banner, login, a keepalive and a packet, then waits for a report
+class CAPRSServer : public CStubServer {
+public:
+	CAPRSServer() :
+	CStubServer("127.0.0.1"),
+	m_mutex(),
+	m_login(),
+	m_report(),
+	m_received(0ULL)
+	{
+	}
+
+	std::string getLogin()
+	{
+		m_mutex.lock();
+		std::string login = m_login;
+		m_mutex.unlock();
+
+		return login;
+	}
+
+	std::string getReport(unsigned long long& received)
+	{
+		m_mutex.lock();
+		std::string report = m_report;
+		received = m_received;
+		m_mutex.unlock();
+
+		return report;
+	}
+
+protected:
+	virtual void serve(int fd)
+	{
+		send(fd, std::string(BANNER) + "\r\n");
+
+		std::string line;
+		if (!readLine(fd, line, STUB_TIMEOUT))
+			return;
+
+		m_mutex.lock();
+		m_login = line;
+		m_mutex.unlock();
+
+		send(fd, std::string(LOGRESP) + "\r\n");
+		send(fd, std::string(KEEPALIVE) + "\r\n");
+		send(fd, std::string(PACKET) + "\r\n");
+
+		if (!readLine(fd, line, STUB_TIMEOUT))
+			return;
+
+		m_mutex.lock();
+		m_report   = line;
+		m_received = CTests::now();
+		m_mutex.unlock();
+
+		// Until the client hangs up
+		while (readLine(fd, line, STUB_TIMEOUT))
+			;
+	}
+
+private:
+	CMutex             m_mutex;
+	std::string        m_login;
+	std::string        m_report;
+	unsigned long long m_received;
+};
+
+static CMutex                   s_mutex;
+static std::vector<std::string> s_lines;
+
+static void readAPRS(const std::string& line)
+{
+	s_mutex.lock();
+	s_lines.push_back(line);
+	s_mutex.unlock();
+}
+
+static unsigned int countLines()
+{
+	s_mutex.lock();
+	unsigned int n = s_lines.size();
+	s_mutex.unlock();
+
+	return n;
+}
+
+static bool testReadLine()
+{
+	CLineServer server;
+	TEST_CHECK(server.start());
+
+	CTCPSocket socket("127.0.0.1", server.getPort());
+	bool ok = socket.open();
+
+	std::string banner, packet, split, first, rest, last;
+	int n1 = ok ? socket.readLine(banner, 2U) : -1;
+	int n2 = ok ? socket.readLine(packet, 2U) : -1;
+	// The rest of this one is 200 ms behind
+	int n3 = ok ? socket.readLine(split, 2U) : -1;
+	int n4 = ok ? socket.readLine(first, 2U) : -1;
+	int n5 = ok ? socket.readLine(rest, 2U) : -1;
+	int n6 = ok ? socket.readLine(last, 2U) : -1;
+
+	unsigned long long bytesIn = socket.getBytesIn();
+	socket.close();
+	server.stop();
+
+	TEST_CHECK(ok);
+	TEST_CHECK(n1 == int(::strlen(BANNER) + 2U) && banner == std::string(BANNER) + "\r\n");
+	TEST_CHECK(n2 == int(::strlen(PACKET) + 2U) && packet == std::string(PACKET) + "\r\n");
+	TEST_CHECK(n3 == 17 && split == "N0CALL>APRS:two\r\n");
+	// A line longer than the buffer comes in two pieces
+	TEST_CHECK(n4 == int(TCP_BUFFER_LENGTH) && first == std::string(TCP_BUFFER_LENGTH, 'x'));
+	TEST_CHECK(n5 == int(LONG_LINE_LENGTH - TCP_BUFFER_LENGTH) && rest == std::string(LONG_LINE_LENGTH - TCP_BUFFER_LENGTH - 1U, 'x') + "\n");
+	// The server has hung up
+	TEST_CHECK(n6 == -2 && last.empty());
+	TEST_CHECK(bytesIn == (unsigned long long)(n1 + n2 + n3 + n4 + n5));
+
+	return true;
+}
+
+static bool testWriterThread()
+{
+	CAPRSServer server;
+	TEST_CHECK(server.start());
+
+	s_mutex.lock();
+	s_lines.clear();
+	s_mutex.unlock();
+
+	CAPRSWriterThread writer("n0call", "12345", "127.0.0.1", server.getPort(), "r/51.5/-0.1/50", "Tests");
+	writer.setReadAPRSCallback(readAPRS);
+	writer.start();
+
+	unsigned long long start = CTests::now();
+	while ((!writer.isConnected() || countLines() == 0U) && CTests::now() - start < STUB_TIMEOUT)
+		CThread::sleep(10U);
+
+	bool connected = writer.isConnected();
+
+	// By now the thread is asleep on the socket, only the event can wake it before the next keepalive
+	CThread::sleep(500U);
+
+	unsigned long long queued = CTests::now();
+	writer.write(REPORT);
+
+	unsigned long long received = 0ULL;
+	std::string report;
+	while ((report = server.getReport(received)).empty() && CTests::now() - queued < STUB_TIMEOUT)
+		CThread::sleep(1U);
+
+	unsigned long long stopping = CTests::now();
+	writer.stop();
+	unsigned long long stopped = CTests::now();
+
+	server.stop();
+
+	TEST_CHECK(connected);
+	TEST_CHECK(server.getLogin() == "user N0CALL pass 12345 vers Tests filter r/51.5/-0.1/50");
+
+	// The keepalive and the login response are not APRS frames
+	s_mutex.lock();
+	std::vector<std::string> lines = s_lines;
+	s_mutex.unlock();
+	TEST_CHECK(lines.size() == 1U);
+	TEST_CHECK(lines.at(0U) == std::string(PACKET) + "\r\n");
+
+	TEST_CHECK(report == REPORT);
+	TEST_CHECK(received - queued < WAKE_LIMIT);
+	TEST_CHECK(stopped - stopping < WAKE_LIMIT);
+	TEST_CHECK(server.getConnections() == 1U);
+
+	return true;
+}
+
+static const CTestCase APRS_CASES[] = {
+	{"CTCPSocket::readLine split and long lines",      testReadLine},
+	{"CAPRSWriterThread login, keepalive and wake-up", testWriterThread}
+};
+
+void addAPRSTests(CTests& tests)
+{
+	tests.add("aprs", APRS_CASES, sizeof(APRS_CASES) / sizeof(CTestCase));
+}
@@ -0,0 +1,337 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "Tests.h"
+
+#include "HTTPClient.h"
+#include "JSONFields.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+// How long the stub waits for the next request on a kept connection
+const unsigned int STUB_IDLE = 2000U;
+
+// Gives the client time to read what has been sent, so that the next piece arrives on its own
+const unsigned int PIECE_DELAY = 20U;
+
+static const char* const FIELDS[] = {"lat", "lng"};
+
+// An aprs.fi loc reply, with a field before the wanted ones that has the same name as a value
+static std::string reply(unsigned int n)
+{
+	char text[300U];
+	::sprintf(text, "{\"command\":\"get\",\"result\":\"ok\",\"what\":\"loc\",\"found\":1,\"entries\":[{\"name\":\"lat\",\"type\":\"l\","
+		"\"lat\":\"51.5%04u\",\"lng\":-0.1%04u,\"comment\":\"lat \\\"lng\\\"\"}]}", n, n);
+
+	return text;
+}
+
+// Answers GET /length/n, /chunked/n, /close/n and anything else with a 404, each in several pieces
+class CHTTPServer : public CStubServer {
+public:
+	CHTTPServer() :
+	CStubServer("127.0.0.1")
+	{
+	}
+
+protected:
+	virtual void serve(int fd)
+	{
+		for (;;) {
+			std::string request;
+			if (!readLine(fd, request, STUB_IDLE))
+				return;
+
+			std::string line;
+			do {
+				if (!readLine(fd, line, STUB_IDLE))
+					return;
+			} while (!line.empty());
+
+			std::string path;
+			std::string::size_type start = request.find(' ');
+			std::string::size_type end   = request.find(' ', start + 1U);
+			if (start != std::string::npos && end != std::string::npos)
+				path = request.substr(start + 1U, end - start - 1U);
+
+			std::string::size_type slash = path.rfind('/');
+			unsigned int n = slash != std::string::npos ? ::atoi(path.c_str() + slash + 1U) : 0U;
+			std::string body = reply(n);
+
+			// The pieces end inside a field name and inside a value
+			std::string::size_type name  = body.find("\"lat\":\"") + 2U;
+			std::string::size_type value = body.find("\"lng\":") + 8U;
+
+			if (path.compare(0U, 8U, "/length/") == 0) {
+				char header[100U];
+				::sprintf(header, "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: %u\r\n\r\n", (unsigned int)body.length());
+
+				sendPiece(fd, header + body.substr(0U, name));
+				sendPiece(fd, body.substr(name, value - name));
+				sendPiece(fd, body.substr(value));
+			} else if (path.compare(0U, 9U, "/chunked/") == 0) {
+				sendPiece(fd, "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n");
+				sendPiece(fd, chunk(body.substr(0U, name)));
+				sendPiece(fd, chunk(body.substr(name, value - name)) + chunk(body.substr(value)));
+				sendPiece(fd, "0\r\n\r\n");
+			} else if (path.compare(0U, 7U, "/close/") == 0) {
+				// No length, the body ends when the connection does
+				sendPiece(fd, "HTTP/1.1 200 OK\r\nConnection: close\r\n\r\n" + body.substr(0U, name));
+				sendPiece(fd, body.substr(name, value - name));
+				send(fd, body.substr(value));
+				return;
+			} else {
+				sendPiece(fd, "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n\r\n");
+			}
+		}
+	}
+
+private:
+	void sendPiece(int fd, const std::string& data)
+	{
+		send(fd, data);
+		CThread::sleep(PIECE_DELAY);
+	}
+
+	static std::string chunk(const std::string& data)
+	{
+		char size[20U];
+		::sprintf(size, "%X\r\n", (unsigned int)data.length());
+
+		return size + data + "\r\n";
+	}
+};
+
+// Counts the pieces the body arrives in as well
+class CCountingFields : public CJSONFields {
+public:
+	CCountingFields() :
+	CJSONFields(FIELDS, 2U),
+	m_pieces(0U)
+	{
+	}
+
+	void clear()
+	{
+		reset();
+		m_pieces = 0U;
+	}
+
+	virtual void body(const unsigned char* data, unsigned int length)
+	{
+		m_pieces++;
+		CJSONFields::body(data, length);
+	}
+
+	unsigned int m_pieces;
+};
+
+static bool checkFields(const CJSONFields& fields, unsigned int n)
+{
+	char lat[20U], lng[20U];
+	::sprintf(lat, "51.5%04u", n);
+	::sprintf(lng, "-0.1%04u", n);
+
+	return fields.has(0U) && fields.get(0U) == lat && fields.has(1U) && fields.get(1U) == lng;
+}
+
+static bool testFieldsSplit()
+{
+	std::string body = reply(42U);
+	const unsigned char* data = (const unsigned char*)body.c_str();
+	unsigned int length = body.length();
+
+	CJSONFields fields(FIELDS, 2U);
+
+	// Every place the body can be cut in two
+	for (unsigned int i = 0U; i <= length; i++) {
+		fields.reset();
+		fields.body(data, i);
+		fields.body(data + i, length - i);
+		TEST_CHECK(checkFields(fields, 42U));
+	}
+
+	// A byte at a time
+	fields.reset();
+	for (unsigned int i = 0U; i < length; i++)
+		fields.body(data + i, 1U);
+	TEST_CHECK(checkFields(fields, 42U));
+
+	// An escaped quote does not end a string, and a string too long to be a name is never one
+	const char* tricky = "{\"a\\\"lat\":\"1\",\"latitude_of_a_place_far_too_long_to_keep\":\"2\",\"lat\":3,\"lng\":\"4\"}";
+	fields.reset();
+	fields.body((const unsigned char*)tricky, ::strlen(tricky));
+	TEST_CHECK(fields.has(0U) && fields.get(0U) == "3");
+	TEST_CHECK(fields.has(1U) && fields.get(1U) == "4");
+
+	return true;
+}
+
+static bool testContentLength()
+{
+	CHTTPServer server;
+	TEST_CHECK(server.start());
+
+	CHTTPClient client("127.0.0.1", server.getPort(), "Tests");
+	CCountingFields fields;
+
+	bool sent = client.get("/length/1");
+	int status = sent ? client.read(fields) : -1;
+
+	client.close();
+	server.stop();
+
+	TEST_CHECK(sent);
+	TEST_CHECK(status == 200);
+	TEST_CHECK(checkFields(fields, 1U));
+	TEST_CHECK(fields.m_pieces >= 2U);
+
+	return true;
+}
+
+static bool testChunked()
+{
+	CHTTPServer server;
+	TEST_CHECK(server.start());
+
+	CHTTPClient client("127.0.0.1", server.getPort(), "Tests");
+	CCountingFields fields;
+
+	bool sent = client.get("/chunked/2");
+	int status = sent ? client.read(fields) : -1;
+
+	client.close();
+	server.stop();
+
+	TEST_CHECK(sent);
+	TEST_CHECK(status == 200);
+	TEST_CHECK(checkFields(fields, 2U));
+	// One call per chunk at least
+	TEST_CHECK(fields.m_pieces >= 3U);
+
+	return true;
+}
+
+static bool testCloseDelimited()
+{
+	CHTTPServer server;
+	TEST_CHECK(server.start());
+
+	CHTTPClient client("127.0.0.1", server.getPort(), "Tests");
+	CCountingFields fields;
+
+	bool sent1 = client.get("/close/3");
+	int status1 = sent1 ? client.read(fields) : -1;
+	bool ok1 = checkFields(fields, 3U);
+
+	// The server has hung up, so the next request needs a new connection
+	fields.clear();
+	bool sent2 = client.get("/length/4");
+	int status2 = sent2 ? client.read(fields) : -1;
+	bool ok2 = checkFields(fields, 4U);
+
+	client.close();
+	server.stop();
+
+	TEST_CHECK(sent1 && status1 == 200 && ok1);
+	TEST_CHECK(sent2 && status2 == 200 && ok2);
+	TEST_CHECK(client.getRequests() == 2U);
+	TEST_CHECK(client.getConnections() == 2U);
+	TEST_CHECK(server.getConnections() == 2U);
+
+	return true;
+}
+
+static bool testKeepAlive()
+{
+	CHTTPServer server;
+	TEST_CHECK(server.start());
+
+	CHTTPClient client("127.0.0.1", server.getPort(), "Tests");
+	CCountingFields fields;
+
+	const char* paths[] = {"/length/5", "/chunked/6", "/missing/7", "/length/8"};
+	const int   status[] = {200, 200, 404, 200};
+
+	bool ok = true;
+	for (unsigned int i = 0U; i < 4U && ok; i++) {
+		fields.clear();
+		ok = client.get(paths[i]) && client.read(fields) == status[i];
+		if (ok && status[i] == 200)
+			ok = checkFields(fields, 5U + i);
+	}
+
+	client.close();
+	server.stop();
+
+	TEST_CHECK(ok);
+	TEST_CHECK(client.getRequests() == 4U);
+	TEST_CHECK(client.getConnections() == 1U);
+	TEST_CHECK(server.getConnections() == 1U);
+
+	return true;
+}
+
+static bool testPipelined()
+{
+	CHTTPServer server;
+	TEST_CHECK(server.start());
+
+	CHTTPClient client("127.0.0.1", server.getPort(), "Tests");
+	CCountingFields fields;
+
+	// All the requests go out before the first response is read
+	bool sent = client.get("/length/9") && client.get("/chunked/10") && client.get("/length/11");
+
+	bool ok = sent;
+	for (unsigned int i = 0U; i < 3U && ok; i++) {
+		fields.clear();
+		ok = client.read(fields) == 200 && checkFields(fields, 9U + i);
+	}
+
+	// Nothing is outstanding any more
+	int extra = client.read(fields);
+
+	client.close();
+	server.stop();
+
+	TEST_CHECK(sent);
+	TEST_CHECK(ok);
+	TEST_CHECK(extra == -1);
+	TEST_CHECK(client.getRequests() == 3U);
+	TEST_CHECK(client.getConnections() == 1U);
+
+	return true;
+}
+
+static const CTestCase HTTP_CASES[] = {
+	{"CJSONFields fields split across body() calls",    testFieldsSplit},
+	{"CHTTPClient Content-Length body",                 testContentLength},
+	{"CHTTPClient chunked body",                        testChunked},
+	{"CHTTPClient close-delimited body and reconnect",  testCloseDelimited},
+	{"CHTTPClient keep-alive reuse",                    testKeepAlive},
+	{"CHTTPClient pipelined requests",                  testPipelined}
+};
+
+void addHTTPTests(CTests& tests)
+{
+	tests.add("http", HTTP_CASES, sizeof(HTTP_CASES) / sizeof(CTestCase));
+}
@@ -0,0 +1,326 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "Tests.h"
+
+#include "Resolver.h"
+#include "TCPSocket.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+
+// The resolver thread is given this long to get round to a name that is due
+const unsigned int RESOLVE_LIMIT = 2000U;
+
+// A stub resolver. The test binary defines getaddrinfo() itself, so the resolver in the library
+// gets the answers below instead of asking the hosts file or a DNS server. Only the names given
+// to it here exist.
+struct CStubName {
+	std::vector<std::string> m_answers;
+	bool                     m_fail;
+	unsigned int             m_lookups;
+};
+
+static CMutex                           s_mutex;
+static std::map<std::string, CStubName> s_names;
+
+static void setAnswers(const std::string& name, const char* first, const char* second = NULL)
+{
+	s_mutex.lock();
+	CStubName& entry = s_names[name];
+	entry.m_answers.clear();
+	entry.m_answers.push_back(first);
+	if (second != NULL)
+		entry.m_answers.push_back(second);
+	entry.m_fail = false;
+	s_mutex.unlock();
+}
+
+static void setFailing(const std::string& name)
+{
+	s_mutex.lock();
+	s_names[name].m_fail = true;
+	s_mutex.unlock();
+}
+
+static unsigned int getLookups(const std::string& name)
+{
+	s_mutex.lock();
+	unsigned int n = s_names[name].m_lookups;
+	s_mutex.unlock();
+
+	return n;
+}
+
+int getaddrinfo(const char* node, const char* service, const struct addrinfo* hints, struct addrinfo** res)
+{
+	*res = NULL;
+
+	if (node == NULL)
+		return EAI_NONAME;
+
+	s_mutex.lock();
+
+	std::map<std::string, CStubName>::iterator it = s_names.find(node);
+	if (it == s_names.end()) {
+		s_mutex.unlock();
+		return EAI_NONAME;
+	}
+
+	it->second.m_lookups++;
+
+	if (it->second.m_fail) {
+		s_mutex.unlock();
+		return EAI_AGAIN;
+	}
+
+	std::vector<std::string> answers = it->second.m_answers;
+
+	s_mutex.unlock();
+
+	struct addrinfo** next = res;
+	for (std::vector<std::string>::const_iterator a = answers.begin(); a != answers.end(); ++a) {
+		struct addrinfo* ai = (struct addrinfo*)::calloc(1U, sizeof(struct addrinfo) + sizeof(struct sockaddr_storage));
+		struct sockaddr_storage* addr = (struct sockaddr_storage*)(ai + 1);
+
+		if (::inet_pton(AF_INET, a->c_str(), &((struct sockaddr_in*)addr)->sin_addr) == 1) {
+			addr->ss_family = AF_INET;
+			ai->ai_addrlen  = sizeof(struct sockaddr_in);
+		} else {
+			::inet_pton(AF_INET6, a->c_str(), &((struct sockaddr_in6*)addr)->sin6_addr);
+			addr->ss_family = AF_INET6;
+			ai->ai_addrlen  = sizeof(struct sockaddr_in6);
+		}
+
+		ai->ai_family   = addr->ss_family;
+		ai->ai_socktype = hints != NULL ? hints->ai_socktype : 0;
+		ai->ai_addr     = (struct sockaddr*)addr;
+
+		*next = ai;
+		next  = &ai->ai_next;
+	}
+
+	return 0;
+}
+
+void freeaddrinfo(struct addrinfo* res) throw()
+{
+	while (res != NULL) {
+		struct addrinfo* next = res->ai_next;
+		::free(res);
+		res = next;
+	}
+}
+
+static in_addr address(const char* text)
+{
+	in_addr addr;
+	::inet_pton(AF_INET, text, &addr);
+
+	return addr;
+}
+
+// A server on the loopback that only takes the connection
+class CAcceptServer : public CStubServer {
+public:
+	CAcceptServer(const std::string& address) :
+	CStubServer(address)
+	{
+	}
+
+protected:
+	virtual void serve(int fd)
+	{
+	}
+};
+
+static bool testIPv6Only()
+{
+	CAcceptServer server("::1");
+	if (!server.start()) {
+		CTests::skip("no IPv6 loopback on this host");
+		return true;
+	}
+
+	setAnswers("v6only.stub", "::1");
+
+	// Without the thread the lookup happens in find()
+	CResolvedHost* host = CResolver::find("v6only.stub");
+	std::vector<CHostAddress> addresses = host->getAddresses();
+
+	CTCPSocket socket("v6only.stub", server.getPort());
+	bool ok = socket.open();
+	socket.close();
+
+	unsigned long long start = CTests::now();
+	while (server.getConnections() == 0U && CTests::now() - start < RESOLVE_LIMIT)
+		CThread::sleep(10U);
+
+	server.stop();
+
+	TEST_CHECK(addresses.size() == 1U && addresses.at(0U).m_family == AF_INET6);
+	// There is nothing the UDP networks could send to
+	TEST_CHECK(!host->isResolved());
+	TEST_CHECK(ok);
+	TEST_CHECK(server.getConnections() == 1U);
+
+	return true;
+}
+
+static bool testFallback()
+{
+	CAcceptServer server("127.0.0.1");
+	TEST_CHECK(server.start());
+
+	// The IPv6 address comes first, and nothing listens there
+	setAnswers("fallback.stub", "::1", "127.0.0.1");
+
+	CResolvedHost* host = CResolver::find("fallback.stub");
+
+	CTCPSocket socket("fallback.stub", server.getPort());
+	bool ok = socket.open();
+	socket.close();
+
+	unsigned long long start = CTests::now();
+	while (server.getConnections() == 0U && CTests::now() - start < RESOLVE_LIMIT)
+		CThread::sleep(10U);
+
+	server.stop();
+
+	TEST_CHECK(ok);
+	TEST_CHECK(server.getConnections() == 1U);
+	TEST_CHECK(host->getAddresses().size() == 2U);
+	// The UDP networks get the IPv4 address whatever its place in the answer
+	TEST_CHECK(host->isResolved() && host->matches(address("127.0.0.1")));
+	TEST_CHECK(getLookups("fallback.stub") == 1U);
+
+	return true;
+}
+
+static bool testReresolve()
+{
+	CAcceptServer server("127.0.0.1");
+	TEST_CHECK(server.start());
+
+	CResolver::start();
+
+	// The cached answer is where the server used to be, nothing listens on 127.0.0.2
+	setAnswers("moved.stub", "127.0.0.2");
+
+	// With the thread running, find() does not wait for the answer
+	CResolvedHost* host = CResolver::find("moved.stub");
+
+	unsigned long long start = CTests::now();
+	while (!host->isResolved() && CTests::now() - start < RESOLVE_LIMIT)
+		CThread::sleep(10U);
+
+	bool first = host->matches(address("127.0.0.2"));
+	unsigned int generation = host->getGeneration();
+
+	// The name has moved, but until a connection fails the answer is good for five minutes
+	setAnswers("moved.stub", "127.0.0.1");
+	CThread::sleep(300U);
+	unsigned int cached = getLookups("moved.stub");
+	bool kept = host->matches(address("127.0.0.2"));
+
+	CTCPSocket socket("moved.stub", server.getPort());
+	bool failed = !socket.open();
+
+	start = CTests::now();
+	while (host->getGeneration() == generation && CTests::now() - start < RESOLVE_LIMIT)
+		CThread::sleep(10U);
+
+	bool moved = host->matches(address("127.0.0.1"));
+	unsigned int lookups = getLookups("moved.stub");
+
+	bool ok = socket.open();
+	socket.close();
+
+	CResolver::stop();
+
+	start = CTests::now();
+	while (server.getConnections() == 0U && CTests::now() - start < RESOLVE_LIMIT)
+		CThread::sleep(10U);
+
+	server.stop();
+
+	TEST_CHECK(first);
+	TEST_CHECK(cached == 1U && kept);
+	TEST_CHECK(failed);
+	TEST_CHECK(host->getGeneration() == generation + 1U);
+	TEST_CHECK(moved && lookups == 2U);
+	TEST_CHECK(ok);
+	TEST_CHECK(server.getConnections() == 1U);
+
+	return true;
+}
+
+static bool testFailedLookup()
+{
+	CResolver::start();
+
+	setAnswers("flaky.stub", "127.0.0.1");
+
+	CResolvedHost* host = CResolver::find("flaky.stub");
+
+	unsigned long long start = CTests::now();
+	while (!host->isResolved() && CTests::now() - start < RESOLVE_LIMIT)
+		CThread::sleep(10U);
+
+	unsigned int generation = host->getGeneration();
+
+	// The name stops resolving, a refresh asks again at once
+	setFailing("flaky.stub");
+	CResolver::refresh(host);
+
+	start = CTests::now();
+	while (getLookups("flaky.stub") < 2U && CTests::now() - start < RESOLVE_LIMIT)
+		CThread::sleep(10U);
+
+	unsigned int lookups = getLookups("flaky.stub");
+
+	CResolver::stop();
+
+	TEST_CHECK(lookups == 2U);
+	// The last answer stays in use
+	TEST_CHECK(host->isResolved() && host->matches(address("127.0.0.1")));
+	TEST_CHECK(host->getGeneration() == generation);
+	TEST_CHECK(host->getAddresses().size() == 1U);
+
+	return true;
+}
+
+static const CTestCase RESOLVER_CASES[] = {
+	{"CTCPSocket to a host with only an IPv6 address",  testIPv6Only},
+	{"CTCPSocket falls back from IPv6 to IPv4",         testFallback},
+	{"CResolver looks up again after a failed connect", testReresolve},
+	{"CResolver keeps the last answer on a failure",    testFailedLookup}
+};
+
+void addResolverTests(CTests& tests)
+{
+	tests.add("resolver", RESOLVER_CASES, sizeof(RESOLVER_CASES) / sizeof(CTestCase));
+}
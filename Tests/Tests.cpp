@@ -0,0 +1,259 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "Tests.h"
+#include "Log.h"
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <poll.h>
+#include <unistd.h>
+
+// How often the server thread looks for a stop while nobody connects, in ms
+const unsigned int STUB_POLL = 50U;
+
+int main(int argc, char** argv)
+{
+	// The classes under test log their progress, -v shows it
+	bool verbose = argc > 1 && ::strcmp(argv[1], "-v") == 0;
+	::LogInitialise(".", "Tests", 0U, verbose ? 1U : 0U);
+
+	CTests tests;
+	addAPRSTests(tests);
+	addHTTPTests(tests);
+	addResolverTests(tests);
+
+	unsigned int failed = tests.run();
+
+	::LogFinalise();
+
+	if (failed > 0U) {
+		::fprintf(stderr, "Tests: %u case(s) failed\n", failed);
+		return 1;
+	}
+
+	return 0;
+}
+
+CTests::CTests() :
+m_suites()
+{
+}
+
+CTests::~CTests()
+{
+}
+
+void CTests::add(const std::string& suite, const CTestCase* cases, unsigned int count)
+{
+	assert(cases != NULL);
+
+	CTestSuite s;
+	s.m_name  = suite;
+	s.m_cases = cases;
+	s.m_count = count;
+
+	m_suites.push_back(s);
+}
+
+unsigned int CTests::run()
+{
+	unsigned int failed = 0U;
+
+	for (std::vector<CTestSuite>::const_iterator it = m_suites.begin(); it != m_suites.end(); ++it) {
+		for (unsigned int i = 0U; i < it->m_count; i++) {
+			const CTestCase& c = it->m_cases[i];
+
+			unsigned long long start = now();
+			bool ok = c.m_run();
+			unsigned long long elapsed = now() - start;
+
+			if (!ok)
+				failed++;
+
+			::fprintf(stderr, "%-9s %-52s %6llu ms %s\n", it->m_name.c_str(), c.m_name, elapsed, ok ? "ok" : "FAILED");
+		}
+	}
+
+	return failed;
+}
+
+bool CTests::check(bool ok, const char* expression, const char* file, int line)
+{
+	if (!ok)
+		::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+
+	return ok;
+}
+
+void CTests::skip(const char* reason)
+{
+	assert(reason != NULL);
+
+	::fprintf(stderr, "skipped: %s\n", reason);
+}
+
+unsigned long long CTests::now()
+{
+	struct timespec ts;
+	::clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (unsigned long long)ts.tv_sec * 1000ULL + (unsigned long long)ts.tv_nsec / 1000000ULL;
+}
+
+CStubServer::CStubServer(const std::string& address) :
+CThread(),
+m_address(address),
+m_port(0U),
+m_fd(-1),
+m_connections(0U),
+m_stop(false)
+{
+}
+
+CStubServer::~CStubServer()
+{
+	if (m_fd >= 0)
+		::close(m_fd);
+}
+
+bool CStubServer::start()
+{
+	struct sockaddr_storage addr;
+	::memset(&addr, 0x00, sizeof(struct sockaddr_storage));
+
+	socklen_t length;
+	if (::inet_pton(AF_INET, m_address.c_str(), &((struct sockaddr_in*)&addr)->sin_addr) == 1) {
+		addr.ss_family = AF_INET;
+		length = sizeof(struct sockaddr_in);
+	} else if (::inet_pton(AF_INET6, m_address.c_str(), &((struct sockaddr_in6*)&addr)->sin6_addr) == 1) {
+		addr.ss_family = AF_INET6;
+		length = sizeof(struct sockaddr_in6);
+	} else {
+		return false;
+	}
+
+	m_fd = ::socket(addr.ss_family, SOCK_STREAM, 0);
+	if (m_fd < 0)
+		return false;
+
+	int reuse = 1;
+	::setsockopt(m_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+	// Port 0, the kernel picks one
+	if (::bind(m_fd, (struct sockaddr*)&addr, length) == -1 || ::listen(m_fd, 4) == -1 || ::getsockname(m_fd, (struct sockaddr*)&addr, &length) == -1) {
+		::close(m_fd);
+		m_fd = -1;
+		return false;
+	}
+
+	if (addr.ss_family == AF_INET)
+		m_port = ntohs(((struct sockaddr_in*)&addr)->sin_port);
+	else
+		m_port = ntohs(((struct sockaddr_in6*)&addr)->sin6_port);
+
+	return run();
+}
+
+unsigned int CStubServer::getPort() const
+{
+	return m_port;
+}
+
+unsigned int CStubServer::getConnections() const
+{
+	return m_connections;
+}
+
+void CStubServer::stop()
+{
+	m_stop = true;
+
+	wait();
+}
+
+void CStubServer::entry()
+{
+	while (!m_stop) {
+		struct pollfd pfd;
+		pfd.fd      = m_fd;
+		pfd.events  = POLLIN;
+		pfd.revents = 0;
+
+		if (::poll(&pfd, 1, STUB_POLL) <= 0)
+			continue;
+
+		int fd = ::accept(m_fd, NULL, NULL);
+		if (fd < 0)
+			continue;
+
+		m_connections++;
+
+		serve(fd);
+
+		::close(fd);
+	}
+}
+
+bool CStubServer::readLine(int fd, std::string& line, unsigned int ms)
+{
+	line.clear();
+
+	unsigned long long end = CTests::now() + ms;
+
+	// A byte at a time, whatever follows the line stays in the socket for the next call
+	for (;;) {
+		unsigned long long t = CTests::now();
+		if (t >= end || m_stop)
+			return false;
+
+		struct pollfd pfd;
+		pfd.fd      = fd;
+		pfd.events  = POLLIN;
+		pfd.revents = 0;
+
+		unsigned long long left = end - t;
+		if (::poll(&pfd, 1, int(left < STUB_POLL ? left : STUB_POLL)) <= 0)
+			continue;
+
+		char c;
+		if (::recv(fd, &c, 1U, 0) != 1)
+			return false;
+
+		if (c == '\n')
+			break;
+
+		line += c;
+	}
+
+	if (!line.empty() && line.at(line.length() - 1U) == '\r')
+		line.erase(line.length() - 1U);
+
+	return true;
+}
+
+bool CStubServer::send(int fd, const std::string& data)
+{
+	return ::send(fd, data.c_str(), data.length(), MSG_NOSIGNAL) == ssize_t(data.length());
+}
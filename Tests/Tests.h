@@ -0,0 +1,98 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(TESTS_H)
+#define	TESTS_H
+
+#include "Thread.h"
+#include "Mutex.h"
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+struct CTestCase {
+	const char* m_name;		// Class and behaviour under test
+	bool      (*m_run)();		// Returns false on the first failed check
+};
+
+class CTests {
+public:
+	CTests();
+	~CTests();
+
+	void add(const std::string& suite, const CTestCase* cases, unsigned int count);
+
+	// Returns the number of failed cases
+	unsigned int run();
+
+	static bool check(bool ok, const char* expression, const char* file, int line);
+	static void skip(const char* reason);
+
+	// Monotonic time in ms
+	static unsigned long long now();
+
+private:
+	struct CTestSuite {
+		std::string      m_name;
+		const CTestCase* m_cases;
+		unsigned int     m_count;
+	};
+
+	std::vector<CTestSuite> m_suites;
+};
+
+#define	TEST_CHECK(x)	do { if (!CTests::check((x), #x, __FILE__, __LINE__)) return false; } while (0)
+
+// A TCP server on the loopback for the client classes to talk to. Connections are accepted one at
+// a time on the server thread and handed to serve(), which plays the remote end.
+class CStubServer : public CThread {
+public:
+	CStubServer(const std::string& address);
+	virtual ~CStubServer();
+
+	// Listens on a free port, false when the address cannot be used on this host
+	bool start();
+
+	unsigned int getPort() const;
+	unsigned int getConnections() const;
+
+	void stop();
+
+	virtual void entry();
+
+protected:
+	std::string               m_address;
+	unsigned int              m_port;
+	int                       m_fd;
+	std::atomic<unsigned int> m_connections;
+	std::atomic<bool>         m_stop;
+
+	virtual void serve(int fd) = 0;
+
+	// Reads up to and without the end of line, false on a timeout or when the client has gone
+	bool readLine(int fd, std::string& line, unsigned int ms);
+	bool send(int fd, const std::string& data);
+};
+
+// Suite registration, one per source file
+extern void addAPRSTests(CTests& tests);
+extern void addHTTPTests(CTests& tests);
+extern void addResolverTests(CTests& tests);
+
+#endif
@@ -34,8 +34,12 @@ enum SECTION {
   SECTION_YSF_NETWORK,
   SECTION_DMR_NETWORK,
   SECTION_DMRID_LOOKUP,
+  SECTION_NXDN_NETWORK,
+  SECTION_NXDNID_LOOKUP,
   SECTION_LOG,
-  SECTION_APRS_FI
+  SECTION_APRS_FI,
+  SECTION_CPU,
+  SECTION_SESSIONS
 };
 
 CConf::CConf(const std::string& file) :
@@ -90,10 +94,29 @@ m_dmrNetworkIDUnlink(4000U),
 m_dmrNetworkPCUnlink(false),
 m_dmrIdLookupFile(),
 m_dmrIdLookupTime(0U),
+m_nxdnNetworkEnabled(false),
+m_nxdnTG(20U),
+m_nxdnDstAddress(),
+m_nxdnDstPort(0U),
+m_nxdnLocalAddress(),
+m_nxdnLocalPort(0U),
+m_nxdnDefaultID(65519U),
+m_nxdnNetworkDebug(false),
+m_nxdnIdLookupFile(),
+m_nxdnIdLookupTime(0U),
 m_logDisplayLevel(0U),
 m_logFileLevel(0U),
 m_logFilePath(),
 m_logFileRoot(),
+m_cpuKernels("auto"),
+m_cpuRealTime(0U),
+m_cpuSharedMemory(false),
+m_cpuSharedMemoryUser(),
+m_sessions(),
+m_sessionsReport(0U),
+m_sessionsWorkers(0U),
+m_sessionsAffinity(false),
+m_sessionsPipeline(false),
 m_aprsEnabled(false),
 m_aprsServer(),
 m_aprsPort(0U),
@@ -133,8 +156,16 @@ bool CConf::read()
 		  section = SECTION_DMR_NETWORK;
 	  else if (::strncmp(buffer, "[DMR Id Lookup]", 15U) == 0)
 		  section = SECTION_DMRID_LOOKUP;
+	  else if (::strncmp(buffer, "[NXDN Network]", 14U) == 0)
+		  section = SECTION_NXDN_NETWORK;
+	  else if (::strncmp(buffer, "[NXDN Id Lookup]", 16U) == 0)
+		  section = SECTION_NXDNID_LOOKUP;
 	  else if (::strncmp(buffer, "[Log]", 5U) == 0)
 		  section = SECTION_LOG;
+	  else if (::strncmp(buffer, "[CPU]", 5U) == 0)
+		  section = SECTION_CPU;
+	  else if (::strncmp(buffer, "[Sessions]", 10U) == 0)
+		  section = SECTION_SESSIONS;
 	  else if (::strncmp(buffer, "[aprs.fi]", 5U) == 0)
 		  section = SECTION_APRS_FI;	  
 	  else
@@ -289,6 +320,28 @@ bool CConf::read()
 			m_dmrIdLookupTime = (unsigned int)::atoi(value);
 		if (::strcmp(key, "DropUnknown") == 0)
 			m_dmrDropUnknown = ::atoi(value) == 1;
+	} else if (section == SECTION_NXDN_NETWORK) {
+		if (::strcmp(key, "Enable") == 0)
+			m_nxdnNetworkEnabled = ::atoi(value) == 1;
+		else if (::strcmp(key, "TG") == 0)
+			m_nxdnTG = (unsigned int)::atoi(value);
+		else if (::strcmp(key, "DstAddress") == 0)
+			m_nxdnDstAddress = value;
+		else if (::strcmp(key, "DstPort") == 0)
+			m_nxdnDstPort = (unsigned int)::atoi(value);
+		else if (::strcmp(key, "LocalAddress") == 0)
+			m_nxdnLocalAddress = value;
+		else if (::strcmp(key, "LocalPort") == 0)
+			m_nxdnLocalPort = (unsigned int)::atoi(value);
+		else if (::strcmp(key, "DefaultID") == 0)
+			m_nxdnDefaultID = (unsigned int)::atoi(value);
+		else if (::strcmp(key, "Debug") == 0)
+			m_nxdnNetworkDebug = ::atoi(value) == 1;
+	} else if (section == SECTION_NXDNID_LOOKUP) {
+		if (::strcmp(key, "File") == 0)
+			m_nxdnIdLookupFile = value;
+		else if (::strcmp(key, "Time") == 0)
+			m_nxdnIdLookupTime = (unsigned int)::atoi(value);
 	} else if (section == SECTION_LOG) {
 		if (::strcmp(key, "FilePath") == 0)
 			m_logFilePath = value;
@@ -298,6 +351,43 @@ bool CConf::read()
 			m_logFileLevel = (unsigned int)::atoi(value);
 		else if (::strcmp(key, "DisplayLevel") == 0)
 			m_logDisplayLevel = (unsigned int)::atoi(value);
+	} else if (section == SECTION_CPU) {
+		if (::strcmp(key, "Kernels") == 0)
+			m_cpuKernels = value;
+		else if (::strcmp(key, "RealTime") == 0)
+			m_cpuRealTime = (unsigned int)::atoi(value);
+		else if (::strcmp(key, "SharedMemory") == 0)
+			m_cpuSharedMemory = ::atoi(value) == 1;
+		else if (::strcmp(key, "SharedMemoryUser") == 0)
+			m_cpuSharedMemoryUser = value;
+	} else if (section == SECTION_SESSIONS) {
+		if (::strcmp(key, "Session") == 0) {
+			char* p1 = ::strtok(value, ", ");
+			char* p2 = ::strtok(NULL, ", ");
+			char* p3 = ::strtok(NULL, ", ");
+			char* p4 = ::strtok(NULL, ", ");
+			char* p5 = ::strtok(NULL, ", ");
+			char* p6 = ::strtok(NULL, ", ");
+			char* p7 = ::strtok(NULL, ", \r\n");
+			if (p1 != NULL && p2 != NULL && p3 != NULL && p4 != NULL && p5 != NULL && p6 != NULL && p7 != NULL) {
+				CSessionStruct session;
+				session.m_localPort  = (unsigned int)::atoi(p1);
+				session.m_dstAddress = p2;
+				session.m_dstPort    = (unsigned int)::atoi(p3);
+				session.m_dmrId      = (unsigned int)::atoi(p4);
+				session.m_slotNo     = (unsigned int)::atoi(p5);
+				session.m_dstId      = (unsigned int)::atoi(p6);
+				session.m_pc         = ::atoi(p7) == 1;
+				m_sessions.push_back(session);
+			}
+		} else if (::strcmp(key, "Report") == 0)
+			m_sessionsReport = (unsigned int)::atoi(value);
+		else if (::strcmp(key, "Workers") == 0)
+			m_sessionsWorkers = (unsigned int)::atoi(value);
+		else if (::strcmp(key, "Affinity") == 0)
+			m_sessionsAffinity = ::atoi(value) == 1;
+		else if (::strcmp(key, "Pipeline") == 0)
+			m_sessionsPipeline = ::atoi(value) == 1;
 	} else if (section == SECTION_APRS_FI) {
 		if (::strcmp(key, "AprsCallsign") == 0) {
 			// Convert the callsign to upper case
@@ -326,6 +416,11 @@ bool CConf::read()
   return true;
 }
 
+std::string CConf::getFile() const
+{
+  return m_file;
+}
+
 std::string CConf::getCallsign() const
 {
   return m_callsign;
@@ -546,6 +641,31 @@ unsigned int CConf::getAPRSRefresh() const
 	return m_aprsRefresh;
 }
 
+std::vector<CSessionStruct> CConf::getSessions() const
+{
+	return m_sessions;
+}
+
+unsigned int CConf::getSessionsReport() const
+{
+	return m_sessionsReport;
+}
+
+unsigned int CConf::getSessionsWorkers() const
+{
+	return m_sessionsWorkers;
+}
+
+bool CConf::getSessionsAffinity() const
+{
+	return m_sessionsAffinity;
+}
+
+bool CConf::getSessionsPipeline() const
+{
+	return m_sessionsPipeline;
+}
+
 std::string CConf::getAPRSDescription() const
 {
 	return m_aprsDescription;
@@ -626,6 +746,56 @@ bool CConf::getDMRDropUnknown() const
 	return m_dmrDropUnknown;
 }
 
+bool CConf::getNXDNNetworkEnabled() const
+{
+	return m_nxdnNetworkEnabled;
+}
+
+unsigned int CConf::getNXDNTG() const
+{
+	return m_nxdnTG;
+}
+
+std::string CConf::getNXDNDstAddress() const
+{
+	return m_nxdnDstAddress;
+}
+
+unsigned int CConf::getNXDNDstPort() const
+{
+	return m_nxdnDstPort;
+}
+
+std::string CConf::getNXDNLocalAddress() const
+{
+	return m_nxdnLocalAddress;
+}
+
+unsigned int CConf::getNXDNLocalPort() const
+{
+	return m_nxdnLocalPort;
+}
+
+unsigned int CConf::getNXDNDefaultID() const
+{
+	return m_nxdnDefaultID;
+}
+
+bool CConf::getNXDNNetworkDebug() const
+{
+	return m_nxdnNetworkDebug;
+}
+
+std::string CConf::getNXDNIdLookupFile() const
+{
+	return m_nxdnIdLookupFile;
+}
+
+unsigned int CConf::getNXDNIdLookupTime() const
+{
+	return m_nxdnIdLookupTime;
+}
+
 unsigned int CConf::getLogDisplayLevel() const
 {
 	return m_logDisplayLevel;
@@ -645,3 +815,56 @@ std::string CConf::getLogFileRoot() const
 {
   return m_logFileRoot;
 }
+
+std::string CConf::getCPUKernels() const
+{
+  return m_cpuKernels;
+}
+
+unsigned int CConf::getCPURealTime() const
+{
+  return m_cpuRealTime;
+}
+
+bool CConf::getCPUSharedMemory() const
+{
+  return m_cpuSharedMemory;
+}
+
+std::string CConf::getCPUSharedMemoryUser() const
+{
+  return m_cpuSharedMemoryUser;
+}
+
+CConfReader::CConfReader(const std::string& file) :
+CThread(),
+m_conf(file),
+m_valid(false),
+m_done(false)
+{
+}
+
+CConfReader::~CConfReader()
+{
+}
+
+void CConfReader::entry()
+{
+  m_valid = m_conf.read();
+  m_done  = true;
+}
+
+bool CConfReader::isDone() const
+{
+  return m_done;
+}
+
+bool CConfReader::isValid() const
+{
+  return m_valid;
+}
+
+CConf& CConfReader::getConf()
+{
+  return m_conf;
+}
@@ -21,8 +21,21 @@
 #if !defined(CONF_H)
 #define	CONF_H
 
+#include "Thread.h"
+
 #include <string>
 #include <vector>
+#include <atomic>
+
+struct CSessionStruct {
+  unsigned int m_localPort;
+  std::string  m_dstAddress;
+  unsigned int m_dstPort;
+  unsigned int m_dmrId;			// 0 for the [DMR Network] login
+  unsigned int m_slotNo;
+  unsigned int m_dstId;
+  bool         m_pc;
+};
 
 class CConf
 {
@@ -32,6 +45,8 @@ public:
 
   bool read();
 
+  std::string  getFile() const;
+
   // The YSF Network section
   std::string  getCallsign() const;
   std::string  getSuffix() const;
@@ -92,12 +107,39 @@ public:
   unsigned int getDMRIdLookupTime() const;
   bool         getDMRDropUnknown() const;
 
+  // The NXDN Network section
+  bool         getNXDNNetworkEnabled() const;
+  unsigned int getNXDNTG() const;
+  std::string  getNXDNDstAddress() const;
+  unsigned int getNXDNDstPort() const;
+  std::string  getNXDNLocalAddress() const;
+  unsigned int getNXDNLocalPort() const;
+  unsigned int getNXDNDefaultID() const;
+  bool         getNXDNNetworkDebug() const;
+
+  // The NXDN Id section
+  std::string  getNXDNIdLookupFile() const;
+  unsigned int getNXDNIdLookupTime() const;
+
   // The Log section
   unsigned int getLogDisplayLevel() const;
   unsigned int getLogFileLevel() const;
   std::string  getLogFilePath() const;
   std::string  getLogFileRoot() const;
 
+  // The CPU section
+  std::string  getCPUKernels() const;
+  unsigned int getCPURealTime() const;
+  bool         getCPUSharedMemory() const;
+  std::string  getCPUSharedMemoryUser() const;
+
+  // The Sessions section
+  std::vector<CSessionStruct> getSessions() const;
+  unsigned int getSessionsReport() const;
+  unsigned int getSessionsWorkers() const;
+  bool         getSessionsAffinity() const;
+  bool         getSessionsPipeline() const;
+
   // The aprs.fi section
   bool         getAPRSEnabled() const;
   std::string  getAPRSServer() const;
@@ -166,11 +208,34 @@ private:
   unsigned int m_dmrIdLookupTime;
   bool         m_dmrDropUnknown;
 
+  bool         m_nxdnNetworkEnabled;
+  unsigned int m_nxdnTG;
+  std::string  m_nxdnDstAddress;
+  unsigned int m_nxdnDstPort;
+  std::string  m_nxdnLocalAddress;
+  unsigned int m_nxdnLocalPort;
+  unsigned int m_nxdnDefaultID;
+  bool         m_nxdnNetworkDebug;
+
+  std::string  m_nxdnIdLookupFile;
+  unsigned int m_nxdnIdLookupTime;
+
   unsigned int m_logDisplayLevel;
   unsigned int m_logFileLevel;
   std::string  m_logFilePath;
   std::string  m_logFileRoot;
 
+  std::string  m_cpuKernels;
+  unsigned int m_cpuRealTime;
+  bool         m_cpuSharedMemory;
+  std::string  m_cpuSharedMemoryUser;
+
+  std::vector<CSessionStruct> m_sessions;
+  unsigned int m_sessionsReport;
+  unsigned int m_sessionsWorkers;
+  bool         m_sessionsAffinity;
+  bool         m_sessionsPipeline;
+
   bool         m_aprsEnabled;
   std::string  m_aprsServer;
   unsigned int m_aprsPort;
@@ -181,4 +246,25 @@ private:
   std::string  m_aprsDescription;
 };
 
+// Reads the file again on a thread of its own, the bridge loop only looks at the result once it is done
+class CConfReader : public CThread
+{
+public:
+  CConfReader(const std::string& file);
+  virtual ~CConfReader();
+
+  virtual void entry();
+
+  bool isDone() const;
+
+  // Only once done, false when the file could not be read
+  bool   isValid() const;
+  CConf& getConf();
+
+private:
+  CConf             m_conf;
+  bool              m_valid;
+  std::atomic<bool> m_done;
+};
+
 #endif
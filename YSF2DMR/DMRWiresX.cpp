@@ -18,7 +18,7 @@
 *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
 */
 
-#include "WiresX.h"
+#include "DMRWiresX.h"
 #include "YSFPayload.h"
 #include "YSFFICH.h"
 #include "Utils.h"
@@ -27,7 +27,6 @@
 #include "Log.h"
 
 #include <algorithm>
-#include <functional>
 #include <cstdio>
 #include <cstdlib>
 #include <cassert>
@@ -49,7 +48,12 @@ const unsigned char DEFAULT_FICH[] = {0x20U, 0x00U, 0x01U, 0x00U};
 
 const unsigned char NET_HEADER[] = "YSFD                    ALL      ";
 
-CWiresX::CWiresX(const std::string& callsign, const std::string& suffix, CYSFNetwork* network, std::string tgfile, bool makeUpper) :
+const unsigned int WIRESX_FRAME_LENGTH = 155U;
+
+// Encoded replies kept before the cache is started again
+const unsigned int WIRESX_MAX_REPLIES = 32U;
+
+CDMRWiresX::CDMRWiresX(const std::string& callsign, const std::string& suffix, CYSFNetwork* network, CTGList* tgList) :
 m_callsign(callsign),
 m_node(),
 m_id(),
@@ -68,11 +72,16 @@ m_csd3(NULL),
 m_status(WXSI_NONE),
 m_start(0U),
 m_search(),
+m_tgList(tgList),
+m_table(),
 m_category(),
-m_makeUpper(makeUpper),
-m_bufferTX(10000U, "YSF Wires-X TX Buffer")
+m_bufferTX(10000U, "YSF Wires-X TX Buffer"),
+m_ring(NULL),
+m_record(),
+m_replies()
 {
 	assert(network != NULL);
+	assert(tgList != NULL);
 
 	m_node = callsign;
 	if (suffix.size() > 0U) {
@@ -90,53 +99,15 @@ m_bufferTX(10000U, "YSF Wires-X TX Buffer")
 	m_csd2   = new unsigned char[20U];
 	m_csd3   = new unsigned char[20U];
 
-	// Load file with TG List
-	FILE* fp = ::fopen(tgfile.c_str(), "rt");
-	if (fp != NULL) {
-		char buffer[100U];
-		while (::fgets(buffer, 100U, fp) != NULL) {
-			if (buffer[0U] == '#')
-				continue;
-
-			char* p1 = ::strtok(buffer, ";\r\n");
-			char* p2 = ::strtok(NULL, ";\r\n");
-			char* p3 = ::strtok(NULL, ";\r\n");
-			char* p4 = ::strtok(NULL, "\r\n");
-
-			if (p1 != NULL && p2 != NULL && p3 != NULL && p4 != NULL ) {
-				CTGReg* tgreg = new CTGReg;
-
-				std::string id_tmp = std::string(p1);
-
-				int n_zero = 7 - id_tmp.length();
-				if (n_zero < 0)
-					n_zero = 0;
-
-				tgreg->m_id = std::string(n_zero, '0') + id_tmp;
-				tgreg->m_opt = std::string(p2);
-				tgreg->m_name = std::string(p3);
-				tgreg->m_desc = std::string(p4);
-
-				if (m_makeUpper) {
-					std::transform(tgreg->m_name.begin(), tgreg->m_name.end(), tgreg->m_name.begin(), ::toupper);
-					std::transform(tgreg->m_desc.begin(), tgreg->m_desc.end(), tgreg->m_desc.begin(), ::toupper);
-				}
-
-				tgreg->m_name.resize(16U, ' ');
-				tgreg->m_desc.resize(14U, ' ');
-
-				m_currTGList.push_back(tgreg);
-			}
-		}
-
-		::fclose(fp);
-	}
+	m_table = m_tgList->get();
 
 	m_txWatch.start();
 }
 
-CWiresX::~CWiresX()
+CDMRWiresX::~CDMRWiresX()
 {
+	clearReplies();
+
 	delete[] m_csd3;
 	delete[] m_csd2;
 	delete[] m_csd1;
@@ -144,7 +115,7 @@ CWiresX::~CWiresX()
 	delete[] m_command;
 }
 
-void CWiresX::setInfo(const std::string& name, unsigned int txFrequency, unsigned int rxFrequency, int dstID)
+void CDMRWiresX::setInfo(const std::string& name, unsigned int txFrequency, unsigned int rxFrequency, int dstID)
 {
 	assert(txFrequency > 0U);
 	assert(rxFrequency > 0U);
@@ -156,6 +127,9 @@ void CWiresX::setInfo(const std::string& name, unsigned int txFrequency, unsigne
 
 	m_name.resize(14U, ' ');
 
+	// The header and the CSD of every cached reply carry the node information
+	clearReplies();
+
 	unsigned int hash = 0U;
 
 	for (unsigned int i = 0U; i < name.size(); i++) {
@@ -202,7 +176,7 @@ void CWiresX::setInfo(const std::string& name, unsigned int txFrequency, unsigne
 }
 
 
-WX_STATUS CWiresX::process(const unsigned char* data, const unsigned char* source, unsigned char fi, unsigned char dt, unsigned char fn, unsigned char ft)
+WX_STATUS CDMRWiresX::process(const unsigned char* data, const unsigned char* source, unsigned char fi, unsigned char dt, unsigned char fn, unsigned char ft)
 {
 	assert(data != NULL);
 	assert(source != NULL);
@@ -249,6 +223,9 @@ WX_STATUS CWiresX::process(const unsigned char* data, const unsigned char* sourc
 		if (!valid)
 			return WXS_NONE;
 
+		// A request and its reply look at one version of the TG list
+		m_table = m_tgList->get();
+
 		if (::memcmp(m_command + 1U, DX_REQ, 3U) == 0) {
 			processDX(source);
 			return WXS_DX;
@@ -272,26 +249,24 @@ WX_STATUS CWiresX::process(const unsigned char* data, const unsigned char* sourc
 	return WXS_NONE;
 }
 
-unsigned int CWiresX::getDstID()
+unsigned int CDMRWiresX::getDstID()
 {
 	return m_dstID;
 }
 
-unsigned int CWiresX::getOpt(unsigned int id)
+unsigned int CDMRWiresX::getOpt(unsigned int id)
 {
 	char dstid[20];
-	std::string opt;
 
 	sprintf(dstid, "%05d", id);
 	dstid[5U] = 0;
 
-	for (std::vector<CTGReg*>::iterator it = m_currTGList.begin(); it != m_currTGList.end(); ++it) {
-		std::string tgid = (*it)->m_id;
-		if (dstid == tgid.substr(2, 5)) {
-			opt = (*it)->m_opt;
-			m_fulldstID = atoi(tgid.c_str());
-			return atoi(opt.c_str());;
-		}
+	std::shared_ptr<const CTGTable> table = m_tgList->get();
+
+	const CTGReg* tgreg = table->findShort(dstid);
+	if (tgreg != NULL) {
+		m_fulldstID = atoi(tgreg->m_id.c_str());
+		return atoi(tgreg->m_opt.c_str());
 	}
 
 	m_fulldstID = id;
@@ -299,20 +274,22 @@ unsigned int CWiresX::getOpt(unsigned int id)
 	return 0U;
 }
 
-unsigned int CWiresX::getFullDstID()
+unsigned int CDMRWiresX::getFullDstID()
 {
 	return m_fulldstID;
 }
 
-void CWiresX::processDX(const unsigned char* source)
+void CDMRWiresX::processDX(const unsigned char* source)
 {
 	::LogDebug("Received DX from %10.10s", source);
 
 	m_status = WXSI_DX;
-	m_timer.start();
+
+	// The radio wants the DX reply a little later than the others
+	m_timer.start(1U, 100U);
 }
 
-void CWiresX::processCategory(const unsigned char* source, const unsigned char* data)
+void CDMRWiresX::processCategory(const unsigned char* source, const unsigned char* data)
 {
 	::LogDebug("Received CATEGORY request from %10.10s", source);
 
@@ -336,16 +313,16 @@ void CWiresX::processCategory(const unsigned char* source, const unsigned char*
 
 		unsigned int id = atoi(buffer);
 
-		CTGReg* refl = findById(id);
+		const CTGReg* refl = m_table->find(id);
 		if (refl)
 			m_category.push_back(refl);
 	}
 
 	m_status = WXSI_CATEGORY;
-	m_timer.start();
+	m_timer.start(1U);
 }
 
-void CWiresX::processAll(const unsigned char* source, const unsigned char* data)
+void CDMRWiresX::processAll(const unsigned char* source, const unsigned char* data)
 {
 	char buffer[4U];
 	::memcpy(buffer, data + 2U, 3U);
@@ -360,7 +337,7 @@ void CWiresX::processAll(const unsigned char* source, const unsigned char* data)
 
 		m_status = WXSI_ALL;
 
-		m_timer.start();
+		m_timer.start(1U);
 	} else if (data[0U] == '1' && data[1U] == '1') {
 		::LogDebug("Received SEARCH for \"%16.16s\" from %10.10s", data + 5U, source);
 
@@ -372,11 +349,11 @@ void CWiresX::processAll(const unsigned char* source, const unsigned char* data)
 
 		m_status = WXSI_SEARCH;
 
-		m_timer.start();
+		m_timer.start(1U);
 	}
 }
 
-WX_STATUS CWiresX::processConnect(const unsigned char* source, const unsigned char* data)
+WX_STATUS CDMRWiresX::processConnect(const unsigned char* source, const unsigned char* data)
 {
 	//::LogDebug("Received Connect to %6.6s from %10.10s", data, source);
 
@@ -387,29 +364,29 @@ WX_STATUS CWiresX::processConnect(const unsigned char* source, const unsigned ch
 		return WXS_NONE;
 
 	m_status = WXSI_CONNECT;
-	m_timer.start();
+	m_timer.start(1U);
 
 	return WXS_CONNECT;
 }
 
-void CWiresX::processConnect(int dstID)
+void CDMRWiresX::processConnect(int dstID)
 {
 	m_dstID = dstID;
 
 	m_status = WXSI_CONNECT;
-	m_timer.start();
+	m_timer.start(1U);
 }
 
-void CWiresX::processDisconnect(const unsigned char* source)
+void CDMRWiresX::processDisconnect(const unsigned char* source)
 {
 	if (source != NULL)
 		::LogDebug("Received Disconect from %10.10s", source);
 
 	m_status = WXSI_DISCONNECT;
-	m_timer.start();
+	m_timer.start(1U);
 }
 
-void CWiresX::clock(unsigned int ms)
+void CDMRWiresX::clock(unsigned int ms)
 {
 	unsigned char buffer[200U];
 
@@ -417,7 +394,6 @@ void CWiresX::clock(unsigned int ms)
 	if (m_timer.isRunning() && m_timer.hasExpired()) {
 		switch (m_status) {
 		case WXSI_DX:
-			CThread::sleep(100U);
 			sendDXReply();
 			break;
 		case WXSI_ALL:
@@ -442,23 +418,70 @@ void CWiresX::clock(unsigned int ms)
 	}
 
 	if (m_txWatch.elapsed() > 90U) {
-		if (!m_bufferTX.isEmpty() && m_bufferTX.dataSize() >= 155U) {
+		// A full ring keeps the frame here until the TX stage has caught up
+		if (!m_bufferTX.isEmpty() && m_bufferTX.dataSize() >= 155U && (m_ring == NULL || m_ring->getSpace() > 0U)) {
 			unsigned char len = 0U;
 			m_bufferTX.getData(&len, 1U);
 			if (len == 155U) {
 				m_bufferTX.getData(buffer, 155U);
-				m_network->write(buffer);
+
+				if (m_ring == NULL) {
+					m_network->write(buffer);
+				} else {
+					m_record.m_type   = FRAME_YSF;
+					m_record.m_action = FA_FRAME;
+					m_record.m_burst  = false;
+					m_record.m_length = 155U;
+					::memcpy(m_record.m_data, buffer, 155U);
+					m_ring->push(m_record);
+				}
 			}
 		}
 		m_txWatch.start();
 	}
 }
 
-void CWiresX::createReply(const unsigned char* data, unsigned int length)
+void CDMRWiresX::setRing(CFrameRing* ring)
+{
+	m_ring = ring;
+}
+
+void CDMRWiresX::createReply(const unsigned char* data, unsigned int length)
+{
+	assert(data != NULL);
+	assert(length > 1U);
+
+	// Only the sequence number in front and the CRC at the end change between two sends of the same reply
+	std::string key((const char*)(data + 1U), length - 2U);
+
+	CWiresXReply* reply = NULL;
+
+	std::unordered_map<std::string, CWiresXReply*>::const_iterator it = m_replies.find(key);
+	if (it != m_replies.end()) {
+		reply = it->second;
+		patchReply(reply, data);
+	} else {
+		if (m_replies.size() >= WIRESX_MAX_REPLIES)
+			clearReplies();
+
+		reply = encodeReply(data, length);
+		m_replies[key] = reply;
+	}
+
+	unsigned int count = reply->m_frames.size() / WIRESX_FRAME_LENGTH;
+	for (unsigned int i = 0U; i < count; i++)
+		writeData(&reply->m_frames[i * WIRESX_FRAME_LENGTH]);
+}
+
+CWiresXReply* CDMRWiresX::encodeReply(const unsigned char* data, unsigned int length) const
 {
 	assert(data != NULL);
 	assert(length > 0U);
 
+	CWiresXReply* reply = new CWiresXReply;
+
+	unsigned int crcLength = length;
+
 	unsigned char bt = 0U;
 
 	if (length > 260U) {
@@ -500,7 +523,7 @@ void CWiresX::createReply(const unsigned char* data, unsigned int length)
 	buffer[34U] = seqNo;
 	seqNo += 2U;
 
-	writeData(buffer);
+	reply->m_frames.insert(reply->m_frames.end(), buffer, buffer + WIRESX_FRAME_LENGTH);
 
 	fich.setFI(YSF_FI_COMMUNICATIONS);
 
@@ -520,6 +543,7 @@ void CWiresX::createReply(const unsigned char* data, unsigned int length)
 			payload.writeDataFRModeData1(m_csd3, buffer + 35U);
 			if (bn == 0U) {
 				payload.writeDataFRModeData2(data + offset, buffer + 35U);
+				addPatch(reply, true, offset, false, crcLength);
 				offset += 20U;
 			} else {
 				// All subsequent entries start with 0x00U
@@ -527,13 +551,16 @@ void CWiresX::createReply(const unsigned char* data, unsigned int length)
 				::memcpy(temp + 1U, data + offset, 19U);
 				temp[0U] = 0x00U;
 				payload.writeDataFRModeData2(temp, buffer + 35U);
+				addPatch(reply, true, offset, true, crcLength);
 				offset += 19U;
 			}
 			break;
 		default:
 			payload.writeDataFRModeData1(data + offset, buffer + 35U);
+			addPatch(reply, false, offset, false, crcLength);
 			offset += 20U;
 			payload.writeDataFRModeData2(data + offset, buffer + 35U);
+			addPatch(reply, true, offset, false, crcLength);
 			offset += 20U;
 			break;
 		}
@@ -547,7 +574,7 @@ void CWiresX::createReply(const unsigned char* data, unsigned int length)
 		buffer[34U] = seqNo;
 		seqNo += 2U;
 
-		writeData(buffer);
+		reply->m_frames.insert(reply->m_frames.end(), buffer, buffer + WIRESX_FRAME_LENGTH);
 
 		fn++;
 		if (fn >= 8U) {
@@ -567,10 +594,63 @@ void CWiresX::createReply(const unsigned char* data, unsigned int length)
 
 	buffer[34U] = seqNo | 0x01U;
 
-	writeData(buffer);
+	reply->m_frames.insert(reply->m_frames.end(), buffer, buffer + WIRESX_FRAME_LENGTH);
+
+	return reply;
+}
+
+void CDMRWiresX::addPatch(CWiresXReply* reply, bool second, unsigned int offset, bool shifted, unsigned int length) const
+{
+	assert(reply != NULL);
+
+	// The half being written goes into the frame after the ones already stored
+	unsigned int end = offset + (shifted ? 19U : 20U);
+	if (offset > 0U && (length - 1U < offset || length - 1U >= end))
+		return;
+
+	CWiresXPatch patch;
+	patch.m_frame   = reply->m_frames.size() / WIRESX_FRAME_LENGTH;
+	patch.m_second  = second;
+	patch.m_offset  = offset;
+	patch.m_shifted = shifted;
+
+	reply->m_patches.push_back(patch);
+}
+
+void CDMRWiresX::patchReply(CWiresXReply* reply, const unsigned char* data) const
+{
+	assert(reply != NULL);
+	assert(data != NULL);
+
+	CYSFPayload payload;
+
+	for (std::vector<CWiresXPatch>::const_iterator it = reply->m_patches.cbegin(); it != reply->m_patches.cend(); ++it) {
+		unsigned char* buffer = &reply->m_frames[it->m_frame * WIRESX_FRAME_LENGTH];
+
+		unsigned char temp[20U];
+		if (it->m_shifted) {
+			::memcpy(temp + 1U, data + it->m_offset, 19U);
+			temp[0U] = 0x00U;
+		} else {
+			::memcpy(temp, data + it->m_offset, 20U);
+		}
+
+		if (it->m_second)
+			payload.writeDataFRModeData2(temp, buffer + 35U);
+		else
+			payload.writeDataFRModeData1(temp, buffer + 35U);
+	}
+}
+
+void CDMRWiresX::clearReplies()
+{
+	for (std::unordered_map<std::string, CWiresXReply*>::iterator it = m_replies.begin(); it != m_replies.end(); ++it)
+		delete it->second;
+
+	m_replies.clear();
 }
 
-void CWiresX::writeData(const unsigned char* buffer)
+void CDMRWiresX::writeData(const unsigned char* buffer)
 {
 	// Send host Wires-X reply using ring buffer
 	unsigned char len = 155U;
@@ -578,7 +658,7 @@ void CWiresX::writeData(const unsigned char* buffer)
 	m_bufferTX.addData(buffer, len);
 }
 
-unsigned char CWiresX::calculateFT(unsigned int length, unsigned int offset) const
+unsigned char CDMRWiresX::calculateFT(unsigned int length, unsigned int offset) const
 {
 	length -= offset;
 
@@ -597,7 +677,7 @@ unsigned char CWiresX::calculateFT(unsigned int length, unsigned int offset) con
 	return 1U;
 }
 
-void CWiresX::sendDXReply()
+void CDMRWiresX::sendDXReply()
 {
 	unsigned char data[150U];
 	::memset(data, 0x00U, 150U);
@@ -689,7 +769,7 @@ void CWiresX::sendDXReply()
 	m_seqNo++;
 }
 
-void CWiresX::sendConnectReply(unsigned int dstID)
+void CDMRWiresX::sendConnectReply(unsigned int dstID)
 {
 	m_dstID = dstID;
 	assert(m_dstID != 0);
@@ -761,7 +841,7 @@ void CWiresX::sendConnectReply(unsigned int dstID)
 	m_seqNo++;
 }
 
-void CWiresX::sendDisconnectReply()
+void CDMRWiresX::sendDisconnectReply()
 {
 	unsigned char data[110U];
 	::memset(data, 0x00U, 110U);
@@ -798,7 +878,7 @@ void CWiresX::sendDisconnectReply()
 	m_seqNo++;
 }
 
-void CWiresX::sendAllReply()
+void CDMRWiresX::sendAllReply()
 {
 	unsigned char data[1100U];
 	::memset(data, 0x00U, 1100U);
@@ -817,7 +897,7 @@ void CWiresX::sendAllReply()
 	for (unsigned int i = 0U; i < 10U; i++)
 		data[i + 12U] = m_node.at(i);
 
-	unsigned int total = m_currTGList.size();
+	unsigned int total = m_table->m_list.size();
 	if (total > 999U) total = 999U;
 
 	unsigned int n = total - m_start;
@@ -827,31 +907,7 @@ void CWiresX::sendAllReply()
 
 	data[28U] = 0x0DU;
 
-	unsigned int offset = 29U;
-	for (unsigned int j = 0U; j < n; j++, offset += 50U) {
-		CTGReg* tgreg = m_currTGList.at(j + m_start);
-
-		::memset(data + offset, ' ', 50U);
-
-		data[offset + 0U] = '5';
-
-		for (unsigned int i = 0U; i < 5U; i++)
-			data[i + offset + 1U] = tgreg->m_id.at(i + 2U);
-
-		for (unsigned int i = 0U; i < 16U; i++)
-			data[i + offset + 6U] = tgreg->m_name.at(i);
-
-		for (unsigned int i = 0U; i < 3U; i++)
-			data[i + offset + 22U] = '0';
-
-		for (unsigned int i = 0U; i < 10U; i++)
-			data[i + offset + 25U] = ' ';
-
-		for (unsigned int i = 0U; i < 14U; i++)
-			data[i + offset + 35U] = tgreg->m_desc.at(i);
-
-		data[offset + 49U] = 0x0DU;
-	}
+	unsigned int offset = writeEntries(data, m_table->m_list, m_start, n, false);
 
 	unsigned int k = 1029U - offset;
 	for(unsigned int i = 0U; i < k; i++)
@@ -869,15 +925,17 @@ void CWiresX::sendAllReply()
 	m_seqNo++;
 }
 
-void CWiresX::sendSearchReply()
+void CDMRWiresX::sendSearchReply()
 {
 	if (m_search.size() == 0U) {
 		sendSearchNotFoundReply();
 		return;
 	}
 
-	std::vector<CTGReg*> search = TGSearch(m_search);
-	if (search.size() == 0U) {
+	unsigned int first = 0U;
+	unsigned int count = 0U;
+	m_table->search(m_search, first, count);
+	if (count == 0U) {
 		sendSearchNotFoundReply();
 		return;
 	}
@@ -901,44 +959,17 @@ void CWiresX::sendSearchReply()
 
 	data[22U] = '1';
 
-	unsigned int total = search.size();
+	unsigned int total = count;
 	if (total > 999U) total = 999U;
 
-	unsigned int n = search.size() - m_start;
+	unsigned int n = count - m_start;
 	if (n > 20U) n = 20U;
 
 	::sprintf((char*)(data + 23U), "%02u%03u", n, total);
 
 	data[28U] = 0x0DU;
 
-	unsigned int offset = 29U;
-	for (unsigned int j = 0U; j < n; j++, offset += 50U) {
-		CTGReg* tgreg = search.at(j + m_start);
-
-		::memset(data + offset, ' ', 50U);
-
-		data[offset + 0U] = '1';
-
-		std::string tgname = tgreg->m_name;
-		std::transform(tgname.begin(), tgname.end(), tgname.begin(), ::toupper);
-
-		for (unsigned int i = 0U; i < 5U; i++)
-			data[i + offset + 1U] = tgreg->m_id.at(i + 2U);
-
-		for (unsigned int i = 0U; i < 16U; i++)
-			data[i + offset + 6U] = tgname.at(i);
-
-		for (unsigned int i = 0U; i < 3U; i++)
-			data[i + offset + 22U] = '0';
-
-		for (unsigned int i = 0U; i < 10U; i++)
-			data[i + offset + 25U] = ' ';
-
-		for (unsigned int i = 0U; i < 14U; i++)
-			data[i + offset + 35U] = tgreg->m_desc.at(i);
-
-		data[offset + 49U] = 0x0DU;
-	}
+	unsigned int offset = writeEntries(data, m_table->m_sorted, first + m_start, n, true);
 
 	unsigned int k = 1029U - offset;
 	for(unsigned int i = 0U; i < k; i++)
@@ -956,58 +987,41 @@ void CWiresX::sendSearchReply()
 	m_seqNo++;
 }
 
-static bool refComparison(const CTGReg* r1, const CTGReg* r2)
+unsigned int CDMRWiresX::writeEntries(unsigned char* data, const std::vector<const CTGReg*>& list, unsigned int first, unsigned int n, bool search) const
 {
-	assert(r1 != NULL);
-	assert(r2 != NULL);
-
-	std::string name1 = r1->m_name;
-	std::string name2 = r2->m_name;
+	assert(data != NULL);
 
-	for (unsigned int i = 0U; i < 16U; i++) {
-		int c = ::toupper(name1.at(i)) - ::toupper(name2.at(i));
-		if (c != 0)
-			return c < 0;
-	}
+	unsigned int offset = 29U;
+	for (unsigned int j = 0U; j < n; j++, offset += 50U) {
+		const CTGReg* tgreg = list.at(j + first);
 
-	return false;
-}
+		::memset(data + offset, ' ', 50U);
 
-CTGReg* CWiresX::findById(unsigned int id)
-{
-	for (std::vector<CTGReg*>::const_iterator it = m_currTGList.cbegin(); it != m_currTGList.cend(); ++it) {
-		if (id == (unsigned int)atoi((*it)->m_id.c_str()))
-			return *it;
-	}
+		data[offset + 0U] = search ? '1' : '5';
 
-	return NULL;
-}
+		for (unsigned int i = 0U; i < 5U; i++)
+			data[i + offset + 1U] = tgreg->m_id.at(i + 2U);
 
-std::vector<CTGReg*>& CWiresX::TGSearch(const std::string& name)
-{
-	m_TGSearch.clear();
+		const std::string& name = search ? tgreg->m_key : tgreg->m_name;
+		for (unsigned int i = 0U; i < 16U; i++)
+			data[i + offset + 6U] = name.at(i);
 
-	std::string trimmed = name;
-	trimmed.erase(std::find_if(trimmed.rbegin(), trimmed.rend(), std::not1(std::ptr_fun<int, int>(std::isspace))).base(), trimmed.end());
-	std::transform(trimmed.begin(), trimmed.end(), trimmed.begin(), ::toupper);
+		for (unsigned int i = 0U; i < 3U; i++)
+			data[i + offset + 22U] = '0';
 
-	unsigned int len = trimmed.size();
+		for (unsigned int i = 0U; i < 10U; i++)
+			data[i + offset + 25U] = ' ';
 
-	for (std::vector<CTGReg*>::iterator it = m_currTGList.begin(); it != m_currTGList.end(); ++it) {
-		std::string tgname = (*it)->m_name;
-		tgname.erase(std::find_if(tgname.rbegin(), tgname.rend(), std::not1(std::ptr_fun<int, int>(std::isspace))).base(), tgname.end());
-		std::transform(tgname.begin(), tgname.end(), tgname.begin(), ::toupper);
+		for (unsigned int i = 0U; i < 14U; i++)
+			data[i + offset + 35U] = tgreg->m_desc.at(i);
 
-		if (trimmed == tgname.substr(0U, len))
-			m_TGSearch.push_back(*it);
+		data[offset + 49U] = 0x0DU;
 	}
 
-	std::sort(m_TGSearch.begin(), m_TGSearch.end(), refComparison);
-
-	return m_TGSearch;
+	return offset;
 }
 
-void CWiresX::sendSearchNotFoundReply()
+void CDMRWiresX::sendSearchNotFoundReply()
 {
 	unsigned char data[70U];
 	::memset(data, 0x00U, 70U);
@@ -1045,7 +1059,7 @@ void CWiresX::sendSearchNotFoundReply()
 	m_seqNo++;
 }
 
-void CWiresX::sendCategoryReply()
+void CDMRWiresX::sendCategoryReply()
 {
 	unsigned char data[1100U];
 	::memset(data, 0x00U, 1100U);
@@ -1072,31 +1086,7 @@ void CWiresX::sendCategoryReply()
 
 	data[28U] = 0x0DU;
 
-	unsigned int offset = 29U;
-	for (unsigned int j = 0U; j < n; j++, offset += 50U) {
-		CTGReg* tgreg = m_category.at(j);
-
-		::memset(data + offset, ' ', 50U);
-
-		data[offset + 0U] = '5';
-
-		for (unsigned int i = 0U; i < 5U; i++)
-			data[i + offset + 1U] = tgreg->m_id.at(i + 2U);
-
-		for (unsigned int i = 0U; i < 16U; i++)
-			data[i + offset + 6U] = tgreg->m_name.at(i);
-
-		for (unsigned int i = 0U; i < 3U; i++)
-			data[i + offset + 22U] = '0';
-
-		for (unsigned int i = 0U; i < 10U; i++)
-			data[i + offset + 25U] = ' ';
-
-		for (unsigned int i = 0U; i < 14U; i++)
-			data[i + offset + 35U] = tgreg->m_desc.at(i);
-
-		data[offset + 49U] = 0x0DU;
-	}
+	unsigned int offset = writeEntries(data, m_category, 0U, n, false);
 
 	unsigned int k = 1029U - offset;
 	for(unsigned int i = 0U; i < k; i++)
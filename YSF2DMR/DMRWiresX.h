@@ -18,58 +18,28 @@
 *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
 */
 
-#if !defined(WIRESX_H)
-#define	WIRESX_H
+#if !defined(DMRWIRESX_H)
+#define	DMRWIRESX_H
 
 #include "YSFNetwork.h"
+#include "WiresX.h"
 #include "DMRNetwork.h"
+#include "Pipeline.h"
 #include "Thread.h"
 #include "Timer.h"
 #include "StopWatch.h"
 #include "RingBuffer.h"
 
+#include <unordered_map>
+#include <memory>
 #include <vector>
 #include <string>
 
-enum WX_STATUS {
-	WXS_NONE,
-	WXS_CONNECT,
-	WXS_DISCONNECT,
-	WXS_DX,
-	WXS_ALL,
-	WXS_FAIL
-};
-
-enum WXSI_STATUS {
-	WXSI_NONE,
-	WXSI_DX,
-	WXSI_CONNECT,
-	WXSI_DISCONNECT,
-	WXSI_ALL,
-	WXSI_SEARCH,
-	WXSI_CATEGORY
-};
-
-class CTGReg {
-public:
-	CTGReg() :
-	m_id(),
-	m_opt(),
-	m_name(),
-	m_desc()
-	{
-	}
-
-	std::string  m_id;
-	std::string  m_opt;
-	std::string  m_name;
-	std::string  m_desc;
-};
-
-class CWiresX {
+// The Wires-X replies of YSF2DMR, they name the DMR talk groups and go out through the TX stage
+class CDMRWiresX {
 public:
-	CWiresX(const std::string& callsign, const std::string& suffix, CYSFNetwork* network, std::string tgfile, bool makeUpper);
-	~CWiresX();
+	CDMRWiresX(const std::string& callsign, const std::string& suffix, CYSFNetwork* network, CTGList* tgList);
+	~CDMRWiresX();
 
 	bool start();
 
@@ -79,9 +49,6 @@ public:
 	unsigned int getOpt(unsigned int id);
 	unsigned int getFullDstID();
 
-	CTGReg* findById(unsigned int id);
-	std::vector<CTGReg*>& TGSearch(const std::string& name);
-
 	void processConnect(int reflector);
 	void processDisconnect(const unsigned char* source = NULL);
 	void setInfo(const std::string& name, unsigned int txFrequency, unsigned int rxFrequency, int reflector);
@@ -89,6 +56,9 @@ public:
 	void sendDisconnectReply();
 	void clock(unsigned int ms);
 
+	// The replies go out through the TX stage on this ring rather than straight to the network
+	void setRing(CFrameRing* ring);
+
 private:
 	std::string          m_callsign;
 	std::string          m_node;
@@ -109,12 +79,14 @@ private:
 	WXSI_STATUS          m_status;
 	unsigned int         m_start;
 	std::string          m_search;
-	std::vector<CTGReg*> m_currTGList;
-	std::vector<CTGReg*> m_TGSearch;
-	std::vector<CTGReg*> m_category;
-	bool                 m_makeUpper;
+	CTGList*             m_tgList;
+	std::shared_ptr<const CTGTable> m_table;
+	std::vector<const CTGReg*> m_category;
 	CStopWatch           m_txWatch;
 	CRingBuffer<unsigned char> m_bufferTX;
+	CFrameRing*          m_ring;
+	CFrameRecord         m_record;
+	std::unordered_map<std::string, CWiresXReply*> m_replies;
 
 	WX_STATUS processConnect(const unsigned char* source, const unsigned char* data);
 	void processDX(const unsigned char* source);
@@ -127,7 +99,12 @@ private:
 	void sendSearchNotFoundReply();
 	void sendCategoryReply();
 
+	unsigned int writeEntries(unsigned char* data, const std::vector<const CTGReg*>& list, unsigned int first, unsigned int n, bool search) const;
 	void createReply(const unsigned char* data, unsigned int length);
+	CWiresXReply* encodeReply(const unsigned char* data, unsigned int length) const;
+	void addPatch(CWiresXReply* reply, bool second, unsigned int offset, bool shifted, unsigned int length) const;
+	void patchReply(CWiresXReply* reply, const unsigned char* data) const;
+	void clearReplies();
 	void writeData(const unsigned char* data);
 	unsigned char calculateFT(unsigned int length, unsigned int offset) const;
 };
@@ -20,6 +20,7 @@
 #include "Defines.h"
 #include "YSFDefines.h"
 #include "RingBuffer.h"
+#include "AMBEFanout.h"
 
 #if !defined(MODECONV_H)
 #define MODECONV_H
@@ -41,13 +42,17 @@ public:
 	unsigned int getYSF(unsigned char* bytes);
 	unsigned int getDMR(unsigned char* bytes);
 
+	// Adds an NXDN destination to the YSF stream, fed from the same decoded vectors
+	void enableNXDN();
+	unsigned int getNXDN(unsigned char* bytes);
+
 private:
-	void putAMBE2YSF(unsigned int a, unsigned int b, unsigned int dat_c);
-	void putAMBE2DMR(unsigned int dat_a, unsigned int dat_b, unsigned int dat_c);
 	unsigned int m_ysfN;
-	unsigned int m_dmrN;
 	CRingBuffer<unsigned char> m_YSF;
-	CRingBuffer<unsigned char> m_DMR;
+	CAMBEFanout  m_fanout;
+	unsigned int m_dmrTap;
+	unsigned int m_nxdnTap;
+	bool         m_nxdn;
 
 };
 
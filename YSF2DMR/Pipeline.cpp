@@ -0,0 +1,442 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "Pipeline.h"
+#include "RealTime.h"
+#include "Log.h"
+
+#include <cassert>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+// The TX stage looks for new frames at least this often
+const unsigned long long TX_POLL_NS = 1000000ULL;
+
+// Frames sent later than this after their due time are counted as late
+const unsigned long long TX_LATE_NS = 1000000ULL;
+
+// Reloads waiting for the TX stage
+const unsigned int TX_COMMAND_DEPTH = 8U;
+
+void CLoginSettings::apply(CDMRNetwork* network) const
+{
+	assert(network != NULL);
+
+	network->setPassword(m_password);
+	network->setOptions(m_options);
+	network->setConfig(m_callsign, m_rxFrequency, m_txFrequency, m_power, m_colorCode, m_latitude, m_longitude, m_height, m_location, m_description, m_url);
+
+	if (m_master)
+		network->setMaster(m_address, m_port);
+	else
+		network->login();
+}
+
+CRXStage::CRXStage(unsigned int number, int cpu) :
+CThread(),
+m_number(number),
+m_cpu(cpu),
+m_rooms(),
+m_nxdnNetwork(NULL),
+m_polls(NULL),
+m_ring(PIPELINE_RX_DEPTH),
+m_record(),
+m_stopWatch(),
+m_stopped(false),
+m_overruns(0U)
+{
+}
+
+CRXStage::~CRXStage()
+{
+}
+
+void CRXStage::addRoom(CYSFNetwork* network)
+{
+	assert(network != NULL);
+
+	m_rooms.push_back(network);
+}
+
+void CRXStage::setNXDN(CNXDNNetwork* network, CFrameRing* polls)
+{
+	m_nxdnNetwork = network;
+	m_polls       = polls;
+}
+
+CFrameRing& CRXStage::getRing()
+{
+	return m_ring;
+}
+
+void CRXStage::stop()
+{
+	m_stopped = true;
+}
+
+void CRXStage::entry()
+{
+	if (m_cpu >= 0 && !CThread::setAffinity(m_cpu))
+		LogWarning("Worker %u, unable to pin the RX stage to CPU %d", m_number, m_cpu);
+
+	char name[20U];
+	::sprintf(name, "worker %u RX", m_number);
+	CRealTime::enter(name);
+
+	m_stopWatch.start();
+
+	while (!m_stopped) {
+		unsigned int ms = m_stopWatch.elapsed();
+		m_stopWatch.start();
+
+		for (unsigned int i = 0U; i < m_rooms.size(); i++) {
+			m_rooms[i]->clock(ms);
+
+			unsigned int len = 0U;
+			while ((len = m_rooms[i]->read(m_record.m_data)) > 0U) {
+				m_record.m_type   = FRAME_YSF;
+				m_record.m_index  = i;
+				m_record.m_length = len;
+				queue();
+			}
+		}
+
+		// Only the outbound direction is bridged to NXDN, the inbound traffic is dropped
+		if (m_nxdnNetwork != NULL) {
+			unsigned int len = 0U;
+			while ((len = m_nxdnNetwork->read(m_record.m_data)) > 0U) {
+				if (::memcmp(m_record.m_data, "NXDNP", 5U) == 0 && len == 17U && m_polls != NULL) {
+					m_record.m_type   = FRAME_NXDN;
+					m_record.m_action = FA_RAW;
+					m_record.m_burst  = false;
+					m_record.m_length = len;
+					if (!m_polls->push(m_record))
+						m_overruns++;
+				}
+			}
+		}
+
+		CThread::sleep(1U);
+	}
+
+	if (m_overruns > 0U)
+		LogWarning("Worker %u, the RX stage dropped %u frame(s) on a full ring", m_number, m_overruns);
+}
+
+void CRXStage::queue()
+{
+	if (!m_ring.push(m_record))
+		m_overruns++;
+}
+
+CTXStage::CTXStage(unsigned int number, int cpu) :
+CThread(),
+m_number(number),
+m_cpu(cpu),
+m_logins(),
+m_streams(),
+m_ring(PIPELINE_RX_DEPTH),
+m_record(),
+m_commands(TX_COMMAND_DEPTH),
+m_clocked(0ULL),
+m_stopped(false),
+m_sent(0U),
+m_late(0U),
+m_worst(0ULL),
+m_overruns(0U)
+{
+}
+
+CTXStage::~CTXStage()
+{
+	for (std::vector<CTXStream*>::iterator it = m_streams.begin(); it != m_streams.end(); ++it) {
+		delete (*it)->m_ring;
+		delete *it;
+	}
+}
+
+void CTXStage::addLogin(CDMRNetwork* network)
+{
+	assert(network != NULL);
+
+	m_logins.push_back(network);
+}
+
+CFrameRing& CTXStage::getRing()
+{
+	return m_ring;
+}
+
+bool CTXStage::post(const std::shared_ptr<const CLoginSettings>& login)
+{
+	return m_commands.push(login);
+}
+
+CFrameRing* CTXStage::addStream(CYSFNetwork* network, unsigned int period)
+{
+	assert(network != NULL);
+
+	CFrameRing* ring = addStream(FRAME_YSF, period);
+	m_streams.back()->m_ysfNetwork = network;
+
+	return ring;
+}
+
+CFrameRing* CTXStage::addStream(CDMRNetwork* network, unsigned int period)
+{
+	assert(network != NULL);
+
+	CFrameRing* ring = addStream(FRAME_DMR, period);
+	m_streams.back()->m_dmrNetwork = network;
+
+	return ring;
+}
+
+CFrameRing* CTXStage::addStream(CNXDNNetwork* network, unsigned int period)
+{
+	assert(network != NULL);
+
+	CFrameRing* ring = addStream(FRAME_NXDN, period);
+	m_streams.back()->m_nxdnNetwork = network;
+
+	return ring;
+}
+
+CFrameRing* CTXStage::addStream(FRAME_TYPE type, unsigned int period)
+{
+	CTXStream* stream = new CTXStream;
+
+	stream->m_type        = type;
+	stream->m_ysfNetwork  = NULL;
+	stream->m_dmrNetwork  = NULL;
+	stream->m_nxdnNetwork = NULL;
+	stream->m_period      = period * 1000000ULL;
+	stream->m_ring        = new CFrameRing(PIPELINE_TX_DEPTH);
+	stream->m_pending     = false;
+	stream->m_due         = 0ULL;
+	stream->m_next        = 0ULL;
+
+	m_streams.push_back(stream);
+
+	return stream->m_ring;
+}
+
+void CTXStage::stop()
+{
+	m_stopped = true;
+}
+
+void CTXStage::entry()
+{
+	if (m_cpu >= 0 && !CThread::setAffinity(m_cpu))
+		LogWarning("Worker %u, unable to pin the TX stage to CPU %d", m_number, m_cpu);
+
+	char name[20U];
+	::sprintf(name, "worker %u TX", m_number);
+	CRealTime::enter(name);
+
+	m_clocked = now();
+
+	while (!m_stopped) {
+		unsigned long long time = now();
+
+		clockLogins(time);
+
+		unsigned long long wake = time + TX_POLL_NS;
+
+		for (std::vector<CTXStream*>::iterator it = m_streams.begin(); it != m_streams.end(); ++it) {
+			CTXStream& stream = **it;
+
+			service(stream, time);
+
+			if (stream.m_pending && stream.m_due < wake)
+				wake = stream.m_due;
+		}
+
+		sleepUntil(wake);
+	}
+
+	LogMessage("Worker %u, TX stage sent %u frame(s), %u more than 1 ms late, worst %llu us late", m_number, m_sent, m_late, m_worst / 1000ULL);
+
+	if (m_overruns > 0U)
+		LogWarning("Worker %u, the TX stage dropped %u DMR frame(s) on a full ring", m_number, m_overruns);
+}
+
+void CTXStage::clockLogins(unsigned long long time)
+{
+	std::shared_ptr<const CLoginSettings> login;
+	while (m_commands.pop(login)) {
+		for (std::vector<CDMRNetwork*>::iterator it = m_logins.begin(); it != m_logins.end(); ++it)
+			login->apply(*it);
+	}
+
+	// Clocked on whole milliseconds, the remainder is carried over to the next pass
+	unsigned int ms = (unsigned int)((time - m_clocked) / 1000000ULL);
+	if (ms == 0U)
+		return;
+
+	m_clocked += ms * 1000000ULL;
+
+	for (unsigned int i = 0U; i < m_logins.size(); i++) {
+		m_logins[i]->clock(ms);
+
+		while (m_logins[i]->read(m_record.m_dmr)) {
+			m_record.m_type   = FRAME_DMR;
+			m_record.m_index  = i;
+			m_record.m_length = DMR_FRAME_LENGTH_BYTES;
+
+			if (!m_ring.push(m_record))
+				m_overruns++;
+		}
+	}
+}
+
+void CTXStage::service(CTXStream& stream, unsigned long long time)
+{
+	if (!stream.m_pending) {
+		while (stream.m_ring->pop(stream.m_record)) {
+			// A frame that arrives after its slot goes out straight away
+			if (stream.m_record.m_action == FA_FRAME) {
+				stream.m_pending = true;
+				stream.m_due     = stream.m_next > time ? stream.m_next : time;
+				break;
+			}
+
+			send(stream);
+		}
+
+		if (!stream.m_pending)
+			return;
+	}
+
+	if (time < stream.m_due)
+		return;
+
+	unsigned long long late = time - stream.m_due;
+	if (late > TX_LATE_NS)
+		m_late++;
+	if (late > m_worst)
+		m_worst = late;
+
+	send(stream);
+
+	stream.m_next    = stream.m_due + stream.m_period;
+	stream.m_pending = false;
+
+	// The rest of a header or terminator burst follows at once, as do the unpaced records
+	while (stream.m_ring->pop(stream.m_record)) {
+		if (stream.m_record.m_action == FA_FRAME && !stream.m_record.m_burst) {
+			stream.m_pending = true;
+			stream.m_due     = stream.m_next > time ? stream.m_next : time;
+			break;
+		}
+
+		send(stream);
+	}
+}
+
+void CTXStage::send(CTXStream& stream)
+{
+	const CFrameRecord& record = stream.m_record;
+
+	switch (stream.m_type) {
+		case FRAME_YSF:
+			if (record.m_action == FA_POLL)
+				stream.m_ysfNetwork->writePoll();
+			else
+				stream.m_ysfNetwork->write(record.m_data);
+			break;
+		case FRAME_DMR:
+			if (record.m_action == FA_RESET)
+				stream.m_dmrNetwork->reset(record.m_dmr.getSlotNo());
+			else
+				stream.m_dmrNetwork->write(record.m_dmr);
+			break;
+		case FRAME_NXDN:
+			if (record.m_action == FA_POLL)
+				stream.m_nxdnNetwork->writePoll(record.m_dstId);
+			else if (record.m_action == FA_RAW)
+				stream.m_nxdnNetwork->write(record.m_data, record.m_length);
+			else
+				stream.m_nxdnNetwork->write(record.m_data, record.m_srcId, record.m_dstId, true);
+			break;
+		default:
+			break;
+	}
+
+	m_sent++;
+}
+
+#if defined(_WIN32) || defined(_WIN64)
+
+unsigned long long CTXStage::now()
+{
+	LARGE_INTEGER frequency;
+	::QueryPerformanceFrequency(&frequency);
+
+	LARGE_INTEGER now;
+	::QueryPerformanceCounter(&now);
+
+	return (unsigned long long)(double(now.QuadPart) * 1.0E9 / double(frequency.QuadPart));
+}
+
+// Windows has no absolute timer here, so this is only as good as its millisecond sleep
+void CTXStage::sleepUntil(unsigned long long ns)
+{
+	unsigned long long time = now();
+	unsigned int ms = ns > time ? (unsigned int)((ns - time) / 1000000ULL) : 0U;
+
+	CThread::sleep(ms > 0U ? ms : 1U);
+}
+
+#else
+
+unsigned long long CTXStage::now()
+{
+	struct timespec ts;
+	::clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (unsigned long long)ts.tv_sec * 1000000000ULL + (unsigned long long)ts.tv_nsec;
+}
+
+void CTXStage::sleepUntil(unsigned long long ns)
+{
+#if defined(__linux__)
+	struct timespec ts;
+	ts.tv_sec  = ns / 1000000000ULL;
+	ts.tv_nsec = ns % 1000000000ULL;
+
+	// An absolute deadline does not drift with the time spent sending
+	while (::clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+		;
+#else
+	unsigned long long time = now();
+	if (ns <= time)
+		return;
+
+	struct timespec ts;
+	ts.tv_sec  = (ns - time) / 1000000000ULL;
+	ts.tv_nsec = (ns - time) % 1000000000ULL;
+
+	::nanosleep(&ts, NULL);
+#endif
+}
+
+#endif
@@ -0,0 +1,191 @@
+/*
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(PIPELINE_H)
+#define	PIPELINE_H
+
+#include "DMRNetwork.h"
+#include "NXDNNetwork.h"
+#include "YSFNetwork.h"
+#include "SPSCQueue.h"
+#include "StopWatch.h"
+#include "DMRData.h"
+#include "Thread.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Large enough for any datagram the YSF and NXDN networks hand back
+const unsigned int FRAME_RECORD_LENGTH = 200U;
+
+// Frames waiting between the RX or the TX stage and the transcode stage of a shard
+const unsigned int PIPELINE_RX_DEPTH   = 256U;
+// Frames waiting in each output stream for the TX stage
+const unsigned int PIPELINE_TX_DEPTH   = 32U;
+
+enum FRAME_TYPE {
+	FRAME_YSF,
+	FRAME_DMR,
+	FRAME_NXDN
+};
+
+// What the TX stage does with a record of a stream
+enum FRAME_ACTION {
+	FA_FRAME,		// Writes the frame at the pace of the stream
+	FA_RAW,			// Writes m_length bytes as they are, straight away
+	FA_POLL,		// Writes the keep alive of the network, straight away
+	FA_RESET		// Resets the DMR slot of m_dmr, straight away
+};
+
+// Every frame handed between the stages is copied into one of these, so the rings never allocate
+struct CFrameRecord {
+	FRAME_TYPE     m_type;
+	unsigned int   m_index;		// Received frames, the session (YSF) or login (DMR) it came in on
+	FRAME_ACTION   m_action;	// Sent frames, how it goes out
+	bool           m_burst;		// Sent frames, goes out right behind the previous one of its stream
+	unsigned int   m_length;
+	unsigned char  m_data[FRAME_RECORD_LENGTH];
+	CDMRData       m_dmr;
+	unsigned short m_srcId;		// NXDN addressing
+	unsigned short m_dstId;
+};
+
+typedef CSPSCQueue<CFrameRecord> CFrameRing;
+
+// The DMR login details after a reload, applied by the thread that owns the logins
+struct CLoginSettings {
+	std::string  m_password;
+	std::string  m_options;
+	std::string  m_callsign;
+	unsigned int m_rxFrequency;
+	unsigned int m_txFrequency;
+	unsigned int m_power;
+	unsigned int m_colorCode;
+	float        m_latitude;
+	float        m_longitude;
+	int          m_height;
+	std::string  m_location;
+	std::string  m_description;
+	std::string  m_url;
+	bool         m_master;		// Connects to m_address:m_port rather than logging in again
+	std::string  m_address;
+	unsigned int m_port;
+
+	void apply(CDMRNetwork* network) const;
+};
+
+// The only thread that clocks and reads the YSF and NXDN networks of a shard
+class CRXStage : public CThread
+{
+public:
+	CRXStage(unsigned int number, int cpu);
+	virtual ~CRXStage();
+
+	void addRoom(CYSFNetwork* network);
+	// The polls of an NXDN gateway are returned through the TX stage, on the ring given
+	void setNXDN(CNXDNNetwork* network, CFrameRing* polls);
+
+	// Emptied by the transcode stage
+	CFrameRing& getRing();
+
+	void stop();
+
+	virtual void entry();
+
+private:
+	unsigned int              m_number;
+	int                       m_cpu;
+	std::vector<CYSFNetwork*> m_rooms;
+	CNXDNNetwork*             m_nxdnNetwork;
+	CFrameRing*               m_polls;
+	CFrameRing                m_ring;
+	CFrameRecord              m_record;
+	CStopWatch                m_stopWatch;
+	std::atomic<bool>         m_stopped;
+	unsigned int              m_overruns;
+
+	void queue();
+};
+
+// The only thread that writes the networks of a shard, and the owner of its DMR
+// logins, which it also clocks and reads. The converted frames go out at the frame
+// rate of their stream, the polls, poll returns and resets as soon as they are seen.
+// Woken by an absolute deadline timer rather than by the transcode stage.
+class CTXStage : public CThread
+{
+public:
+	CTXStage(unsigned int number, int cpu);
+	virtual ~CTXStage();
+
+	void addLogin(CDMRNetwork* network);
+
+	// The frames received on the logins, emptied by the transcode stage
+	CFrameRing& getRing();
+
+	// Reloaded login details, taken up on the next pass
+	bool post(const std::shared_ptr<const CLoginSettings>& login);
+
+	// Returns the ring a session fills for that network, frames go out at most once every period ms
+	CFrameRing* addStream(CYSFNetwork* network, unsigned int period);
+	CFrameRing* addStream(CDMRNetwork* network, unsigned int period);
+	CFrameRing* addStream(CNXDNNetwork* network, unsigned int period);
+
+	void stop();
+
+	virtual void entry();
+
+private:
+	struct CTXStream {
+		FRAME_TYPE         m_type;
+		CYSFNetwork*       m_ysfNetwork;
+		CDMRNetwork*       m_dmrNetwork;
+		CNXDNNetwork*      m_nxdnNetwork;
+		unsigned long long m_period;
+		CFrameRing*        m_ring;
+		CFrameRecord       m_record;
+		bool               m_pending;
+		unsigned long long m_due;
+		unsigned long long m_next;
+	};
+
+	unsigned int              m_number;
+	int                       m_cpu;
+	std::vector<CDMRNetwork*> m_logins;
+	std::vector<CTXStream*>   m_streams;
+	CFrameRing                m_ring;
+	CFrameRecord              m_record;
+	CSPSCQueue<std::shared_ptr<const CLoginSettings> > m_commands;
+	unsigned long long        m_clocked;
+	std::atomic<bool>         m_stopped;
+	unsigned int              m_sent;
+	unsigned int              m_late;
+	unsigned long long        m_worst;
+	unsigned int              m_overruns;
+
+	CFrameRing* addStream(FRAME_TYPE type, unsigned int period);
+	void clockLogins(unsigned long long now);
+	void service(CTXStream& stream, unsigned long long now);
+	void send(CTXStream& stream);
+
+	static unsigned long long now();
+	static void sleepUntil(unsigned long long ns);
+};
+
+#endif
@@ -0,0 +1,1211 @@
+/*
+ *   Copyright (C) 2016,2017 by Jonathan Naylor G4KLX
+ *   Copyright (C) 2018,2019 by Andy Uribe CA6JAU
+ *   Copyright (C) 2018 by Manuel Sanchez EA7EE
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "Session.h"
+#include "DMRSlotType.h"
+#include "DMRFullLC.h"
+#include "DMREMB.h"
+#include "DMRLC.h"
+#include "YSFPayload.h"
+#include "YSFFICH.h"
+#include "Startup.h"
+#include "Sync.h"
+#include "Log.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cassert>
+#include <cctype>
+
+// DT1 and DT2, suggested by Manuel EA7EE
+const unsigned char dt1_temp[] = {0x31, 0x22, 0x62, 0x5F, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00};
+const unsigned char dt2_temp[] = {0x00, 0x00, 0x00, 0x00, 0x6C, 0x20, 0x1C, 0x20, 0x03, 0x08};
+
+// Room left in a TX ring before a frame is taken from the converter, the largest burst is a terminator after five fill frames
+#define TX_RING_SPACE       6U
+
+#define NXDNGW_DSTID_DEF    20U
+
+// Time without a YSF frame written before a session counts as between calls
+const unsigned int CONFIG_IDLE_TIME = 500U;
+
+CSession::CSession(unsigned int number, CConf& conf, CYSFNetwork* ysfNetwork, CDMRNetwork* dmrNetwork, unsigned int slotNo, unsigned int dstId, bool pc) :
+m_number(number),
+m_conf(conf),
+m_ysfNetwork(ysfNetwork),
+m_dmrNetwork(dmrNetwork),
+m_slotNo(slotNo),
+m_lookup(NULL),
+m_APRS(NULL),
+m_wiresX(NULL),
+m_dtmf(NULL),
+m_gps(NULL),
+m_nxdnNetwork(NULL),
+m_nxdnLookup(NULL),
+m_conv(),
+m_nxdnCall(),
+m_EmbeddedLC(),
+m_colorcode(1U),
+m_srcid(1U),
+m_defsrcid(1U),
+m_dstid(dstId),
+m_dmrflco(pc ? FLCO_USER_USER : FLCO_GROUP),
+m_ptt_dstid(1U),
+m_ptt_pc(false),
+m_nxdnSrc(1U),
+m_nxdnTG(20U),
+m_nxdnDefaultID(65519U),
+m_configs(NULL),
+m_config(),
+m_netSrc(),
+m_netDst(),
+m_ysfSrc(),
+m_ysfSrcRaw(),
+m_callsigns(),
+m_dmrLastDT(0U),
+m_dmrStreamId(0U),
+m_ysfFrame(NULL),
+m_dmrFrame(NULL),
+m_nxdnFrame(NULL),
+m_dmrFrames(0U),
+m_ysfFrames(0U),
+m_ysfCount(0U),
+m_dmrCount(0U),
+m_nxdnCount(0U),
+m_dmrinfo(false),
+m_firstSync(false),
+m_tgConnectState(NONE),
+m_unlinkReceived(false),
+m_tgChange(),
+m_ysfWatch(),
+m_dmrWatch(),
+m_nxdnWatch(),
+m_networkWatchdog(100U, 0U, 1500U),
+m_ysfWatchdog(1000U, 0U, 500U),
+m_pollTimer(1000U, 5U),
+m_metrics(),
+m_ysfRing(NULL),
+m_dmrRing(NULL),
+m_nxdnRing(NULL),
+m_record()
+{
+	assert(ysfNetwork != NULL);
+	assert(dmrNetwork != NULL);
+	assert(slotNo == 1U || slotNo == 2U);
+
+	// Everything a call needs is allocated here, once for the life of the session
+	m_ysfFrame  = new unsigned char[200U];
+	m_dmrFrame  = new unsigned char[50U];
+	m_nxdnFrame = new unsigned char[200U];
+
+	::memset(m_ysfFrame, 0U, 200U);
+	::memset(m_dmrFrame, 0U, 50U);
+	::memset(m_nxdnFrame, 0U, 200U);
+	::memset(m_gpsBuffer, 0U, 20U);
+
+	::memset(&m_metrics, 0x00U, sizeof(CSessionMetrics));
+
+	m_ysfWatch.start();
+	m_dmrWatch.start();
+	m_nxdnWatch.start();
+	m_pollTimer.start();
+	m_ysfWatchdog.stop();
+}
+
+CSession::~CSession()
+{
+	delete[] m_ysfFrame;
+	delete[] m_dmrFrame;
+	delete[] m_nxdnFrame;
+
+	delete m_wiresX;
+	delete m_dtmf;
+}
+
+void CSession::setIds(unsigned int colorCode, unsigned int defSrcId)
+{
+	m_colorcode = colorCode;
+	m_defsrcid  = defSrcId;
+	m_srcid     = defSrcId;
+}
+
+void CSession::setConfig(CSnapshot<CSessionConfig>& config)
+{
+	m_configs = &config;
+	m_config  = config.get();
+}
+
+void CSession::setLookups(CDMRLookup* lookup, CAPRSReader* aprs)
+{
+	assert(lookup != NULL);
+
+	m_lookup = lookup;
+	m_APRS   = aprs;
+
+	m_callsigns.setLookup(lookup);
+}
+
+void CSession::setWiresX(const std::string& callsign, const std::string& suffix, CTGList* tgList)
+{
+	m_wiresX = new CDMRWiresX(callsign, suffix, m_ysfNetwork, tgList);
+	m_dtmf   = new CDTMF;
+
+	std::string name = m_conf.getDescription();
+	unsigned int rxFrequency = m_conf.getRxFrequency();
+	unsigned int txFrequency = m_conf.getTxFrequency();
+
+	m_wiresX->setInfo(name, txFrequency, rxFrequency, m_dstid);
+}
+
+void CSession::setGPS(CGPS* gps)
+{
+	m_gps = gps;
+}
+
+void CSession::setNXDN(CNXDNNetwork* network, CNXDNLookup* lookup, unsigned int tg, unsigned int defaultID)
+{
+	assert(network != NULL);
+	assert(lookup != NULL);
+
+	m_nxdnNetwork   = network;
+	m_nxdnLookup    = lookup;
+	m_nxdnTG        = tg;
+	m_nxdnDefaultID = defaultID;
+
+	m_conv.enableNXDN();
+}
+
+void CSession::setPipeline(CTXStage& tx)
+{
+	m_ysfRing = tx.addStream(m_ysfNetwork, YSF_FRAME_PER);
+	m_dmrRing = tx.addStream(m_dmrNetwork, DMR_FRAME_PER);
+
+	if (m_nxdnNetwork != NULL)
+		m_nxdnRing = tx.addStream(m_nxdnNetwork, NXDN_FRAME_PER);
+
+	if (m_wiresX != NULL)
+		m_wiresX->setRing(m_ysfRing);
+}
+
+unsigned int CSession::getNumber() const
+{
+	return m_number;
+}
+
+unsigned int CSession::getSlotNo() const
+{
+	return m_slotNo;
+}
+
+unsigned int CSession::getSrcId() const
+{
+	return m_srcid;
+}
+
+unsigned int CSession::getDstId() const
+{
+	return m_dstid;
+}
+
+CYSFNetwork* CSession::getYSFNetwork() const
+{
+	return m_ysfNetwork;
+}
+
+bool CSession::owns(const CDMRNetwork* network, unsigned int slotNo) const
+{
+	return m_dmrNetwork == network && m_slotNo == slotNo;
+}
+
+void CSession::processTG()
+{
+	if (m_wiresX == NULL)
+		return;
+
+	switch (m_tgConnectState) {
+		case WAITING_UNLINK:
+			if (m_unlinkReceived) {
+				//LogMessage("Unlink Received");
+				m_tgChange.start();
+				m_tgConnectState = SEND_REPLY;
+				m_unlinkReceived = false;
+			}
+			break;
+		case SEND_REPLY:
+			if (m_tgChange.elapsed() > 600) {
+				m_tgChange.start();
+				m_tgConnectState = SEND_PTT;
+				m_wiresX->sendConnectReply(m_dstid);
+			}
+			break;
+		case SEND_PTT:
+			if (m_tgChange.elapsed() > 600) {
+				m_tgChange.start();
+				m_tgConnectState = NONE;
+				if (m_ptt_dstid) {
+					LogMessage("Session %u, sending PTT: Src: %s Dst: %s%d", m_number, m_ysfSrc.c_str(), m_ptt_pc ? "" : "TG ", m_ptt_dstid);
+					SendDummyDMR(m_srcid, m_ptt_dstid, m_ptt_pc ? FLCO_USER_USER : FLCO_GROUP);
+				}
+			}
+			break;
+		default:
+			break;
+	}
+
+	if ((m_tgConnectState != NONE) && (m_tgChange.elapsed() > 12000)) {
+		LogMessage("Session %u, timeout changing TG", m_number);
+		m_tgConnectState = NONE;
+	}
+}
+
+void CSession::processWiresX(WX_STATUS status, unsigned int dstId, bool dtmf)
+{
+	const char* via = dtmf ? " via DTMF" : "";
+
+	switch (status) {
+		case WXS_CONNECT: {
+			m_srcid = findYSFID(m_ysfSrcRaw, false);
+
+			m_ptt_dstid = dstId;
+			unsigned int tglistOpt = m_wiresX->getOpt(m_ptt_dstid);
+
+			switch (tglistOpt) {
+				case 0:
+					m_ptt_pc = false;
+					m_dstid = m_wiresX->getFullDstID();
+					m_ptt_dstid = m_dstid;
+					m_dmrflco = FLCO_GROUP;
+					LogMessage("Session %u, connect to TG %d has been requested by %s", m_number, m_dstid, m_ysfSrc.c_str());
+					break;
+
+				case 1:
+					m_ptt_pc = true;
+					m_dstid = 9U;
+					m_dmrflco = FLCO_GROUP;
+					LogMessage("Session %u, connect to REF %d has been requested by %s", m_number, m_ptt_dstid, m_ysfSrc.c_str());
+					break;
+
+				case 2:
+					m_ptt_dstid = 0;
+					m_ptt_pc = true;
+					m_dstid = m_wiresX->getFullDstID();
+					m_dmrflco = FLCO_USER_USER;
+					LogMessage("Session %u, connect to %d has been requested by %s", m_number, m_dstid, m_ysfSrc.c_str());
+					break;
+
+				default:
+					m_ptt_pc = false;
+					m_dstid = m_wiresX->getFullDstID();
+					m_ptt_dstid = m_dstid;
+					m_dmrflco = FLCO_GROUP;
+					LogMessage("Session %u, connect to TG %d has been requested by %s", m_number, m_dstid, m_ysfSrc.c_str());
+					break;
+			}
+
+			if (dtmf)
+				LogMessage("Session %u, connect to %s%d via DTMF has been requested by %s", m_number, m_ptt_pc ? "" : "TG ", m_ptt_dstid, m_ysfSrc.c_str());
+
+			if (m_config->m_enableUnlink && (tglistOpt != 2) && (m_ptt_dstid != m_config->m_idUnlink) && (m_ptt_dstid != 5000)) {
+				LogMessage("Session %u, sending DMR Disconnect: Src: %s Dst: %s%d", m_number, m_ysfSrc.c_str(), m_config->m_flcoUnlink == FLCO_GROUP ? "TG " : "", m_config->m_idUnlink);
+
+				SendDummyDMR(m_srcid, m_config->m_idUnlink, m_config->m_flcoUnlink);
+
+				m_unlinkReceived = false;
+				m_tgConnectState = WAITING_UNLINK;
+			} else
+				m_tgConnectState = SEND_REPLY;
+
+			m_metrics.m_tgChanges++;
+			m_tgChange.start();
+			}
+			break;
+
+		case WXS_DISCONNECT:
+			LogMessage("Session %u, disconnect%s has been requested by %s", m_number, via, m_ysfSrc.c_str());
+
+			m_srcid = findYSFID(m_ysfSrcRaw, false);
+			m_ptt_dstid = 9U;
+			m_ptt_pc = false;
+			m_dstid = 9U;
+			m_dmrflco = FLCO_GROUP;
+
+			SendDummyDMR(m_srcid, m_config->m_idUnlink, m_config->m_flcoUnlink);
+
+			m_tgConnectState = WAITING_UNLINK;
+
+			m_metrics.m_tgChanges++;
+			m_tgChange.start();
+			break;
+
+		default:
+			break;
+	}
+}
+
+void CSession::readYSF()
+{
+	unsigned char buffer[2000U];
+
+	while (m_ysfNetwork->read(buffer) > 0U)
+		readYSF(buffer);
+}
+
+void CSession::readYSF(unsigned char* buffer)
+{
+	assert(buffer != NULL);
+
+	CYSFFICH fich;
+	bool valid = fich.decode(buffer + 35U);
+
+	if (valid) {
+		unsigned char fi = fich.getFI();
+		unsigned char dt = fich.getDT();
+		unsigned char fn = fich.getFN();
+		unsigned char ft = fich.getFT();
+
+		if (m_wiresX != NULL) {
+			WX_STATUS status = m_wiresX->process(buffer + 35U, buffer + 14U, fi, dt, fn, ft);
+			readSrcYSF(buffer);
+
+			if (status == WXS_CONNECT || status == WXS_DISCONNECT)
+				processWiresX(status, m_wiresX->getDstID(), false);
+
+			status = WXS_NONE;
+
+			if (dt == YSF_DT_VD_MODE2)
+				status = m_dtmf->decodeVDMode2(buffer + 35U, (buffer[34U] & 0x01U) == 0x01U);
+
+			if (status == WXS_CONNECT || status == WXS_DISCONNECT)
+				processWiresX(status, m_dtmf->getDstID(), true);
+		}
+
+		if ((::memcmp(buffer, "YSFD", 4U) == 0U) && (dt == YSF_DT_VD_MODE2)) {
+			CYSFPayload ysfPayload;
+
+			if (fi == YSF_FI_HEADER) {
+				if (ysfPayload.processHeaderData(buffer + 35U)) {
+					m_ysfWatchdog.start();
+					std::string ysfSrc = ysfPayload.getSource();
+					std::string ysfDst = ysfPayload.getDest();
+					LogMessage("Session %u, received YSF Header: Src: %s Dst: %s", m_number, ysfSrc.c_str(), ysfDst.c_str());
+
+					resetDMR();	// OE1KBC fix
+
+					// The header may carry no source at all, the lookup always reads a full callsign
+					unsigned char source[YSF_CALLSIGN_LENGTH];
+					::memset(source, ' ', YSF_CALLSIGN_LENGTH);
+					ysfSrc.copy((char*)source, YSF_CALLSIGN_LENGTH);
+
+					m_srcid = findYSFID(source, true);
+					if (m_config->m_dropUnknown == 0 || m_srcid != 0) {
+						if (m_nxdnNetwork != NULL)
+							m_nxdnSrc = findNXDNID(m_srcid);
+						m_ysfWatchdog.start();
+						resetDMR();	// OE1KBC fix
+						m_conv.putYSFHeader();
+						m_ysfFrames = 0U;
+						m_metrics.m_ysfCalls++;
+					}
+					else
+					{
+						LogMessage("Session %u, dropped source without DMR ID: %s", m_number, ysfSrc.c_str());
+						m_metrics.m_dropped++;
+					}
+				}
+			} else if (fi == YSF_FI_TERMINATOR) {
+				if (m_config->m_dropUnknown == 0 || m_srcid != 0) {
+					m_ysfWatchdog.stop();
+					int extraFrames = (m_config->m_hangTime / 100U) - m_ysfFrames - 2U;
+					for (int i = 0U; i < extraFrames; i++)
+						m_conv.putDummyYSF();
+					LogMessage("Session %u, YSF received end of voice transmission, %.1f seconds", m_number, float(m_ysfFrames) / 10.0F);
+					m_conv.putYSFEOT();
+					m_ysfFrames = 0U;
+				}
+			} else if (fi == YSF_FI_COMMUNICATIONS) {
+				if (m_config->m_dropUnknown == 0 || m_srcid != 0) {
+					m_ysfWatchdog.start();
+					m_conv.putYSF(buffer + 35U);
+					m_ysfFrames++;
+					m_metrics.m_ysfFrames++;
+				}
+			}
+		}
+
+		if (m_gps != NULL)
+			m_gps->data(buffer + 14U, buffer + 35U, fi, dt, fn, ft, m_dstid);
+	}
+
+	if ((buffer[34U] & 0x01U) == 0x01U) {
+		if (m_gps != NULL)
+			m_gps->reset();
+		if (m_dtmf != NULL)
+			m_dtmf->reset();
+	}
+}
+
+void CSession::writeDMR()
+{
+	// With a TX stage the frames are paced there, only keep a whole burst of room
+	if (m_dmrRing != NULL) {
+		if (m_dmrRing->getSpace() < TX_RING_SPACE)
+			return;
+	} else if (m_dmrWatch.elapsed() <= DMR_FRAME_PER) {
+		return;
+	}
+
+	unsigned int dmrFrameType = m_conv.getDMR(m_dmrFrame);
+
+	if(dmrFrameType == TAG_HEADER) {
+		CDMRData rx_dmrdata;
+		m_dmrCount = 0U;
+
+		rx_dmrdata.setSlotNo(m_slotNo);
+		rx_dmrdata.setSrcId(m_srcid);
+		rx_dmrdata.setDstId(m_dstid);
+		rx_dmrdata.setFLCO(m_dmrflco);
+		rx_dmrdata.setN(0U);
+		rx_dmrdata.setSeqNo(0U);
+		rx_dmrdata.setBER(0U);
+		rx_dmrdata.setRSSI(0U);
+		rx_dmrdata.setDataType(DT_VOICE_LC_HEADER);
+
+		// Add sync
+		CSync::addDMRDataSync(m_dmrFrame, 0);
+
+		// Add SlotType
+		CDMRSlotType slotType;
+		slotType.setColorCode(m_colorcode);
+		slotType.setDataType(DT_VOICE_LC_HEADER);
+		slotType.getData(m_dmrFrame);
+
+		// Full LC
+		CDMRLC dmrLC = CDMRLC(m_dmrflco, m_srcid, m_dstid);
+		CDMRFullLC fullLC;
+		fullLC.encode(dmrLC, m_dmrFrame, DT_VOICE_LC_HEADER);
+		m_EmbeddedLC.setLC(dmrLC);
+
+		rx_dmrdata.setData(m_dmrFrame);
+		//CUtils::dump(1U, "DMR data:", m_dmrFrame, 33U);
+
+		for (unsigned int i = 0U; i < 3U; i++) {
+			rx_dmrdata.setSeqNo(m_dmrCount);
+			sendDMR(rx_dmrdata, i > 0U);
+			m_dmrCount++;
+		}
+
+		m_dmrWatch.start();
+	}
+	else if(dmrFrameType == TAG_EOT) {
+		CDMRData rx_dmrdata;
+		unsigned int n_dmr = (m_dmrCount - 3U) % 6U;
+		unsigned int fill = (6U - n_dmr);
+		bool burst = false;
+
+		if (n_dmr) {
+			for (unsigned int i = 0U; i < fill; i++) {
+
+				CDMREMB emb;
+				CDMRData rx_dmrdata;
+
+				rx_dmrdata.setSlotNo(m_slotNo);
+				rx_dmrdata.setSrcId(m_srcid);
+				rx_dmrdata.setDstId(m_dstid);
+				rx_dmrdata.setFLCO(m_dmrflco);
+				rx_dmrdata.setN(n_dmr);
+				rx_dmrdata.setSeqNo(m_dmrCount);
+				rx_dmrdata.setBER(0U);
+				rx_dmrdata.setRSSI(0U);
+				rx_dmrdata.setDataType(DT_VOICE);
+
+				::memcpy(m_dmrFrame, DMR_SILENCE_DATA, DMR_FRAME_LENGTH_BYTES);
+
+				// Generate the Embedded LC
+				unsigned char lcss = m_EmbeddedLC.getData(m_dmrFrame, n_dmr);
+
+				// Generate the EMB
+				emb.setColorCode(m_colorcode);
+				emb.setLCSS(lcss);
+				emb.getData(m_dmrFrame);
+
+				rx_dmrdata.setData(m_dmrFrame);
+
+				//CUtils::dump(1U, "DMR data:", m_dmrFrame, 33U);
+				sendDMR(rx_dmrdata, burst);
+				burst = true;
+
+				n_dmr++;
+				m_dmrCount++;
+			}
+		}
+
+		rx_dmrdata.setSlotNo(m_slotNo);
+		rx_dmrdata.setSrcId(m_srcid);
+		rx_dmrdata.setDstId(m_dstid);
+		rx_dmrdata.setFLCO(m_dmrflco);
+		rx_dmrdata.setN(n_dmr);
+		rx_dmrdata.setSeqNo(m_dmrCount);
+		rx_dmrdata.setBER(0U);
+		rx_dmrdata.setRSSI(0U);
+		rx_dmrdata.setDataType(DT_TERMINATOR_WITH_LC);
+
+		// Add sync
+		CSync::addDMRDataSync(m_dmrFrame, 0);
+
+		// Add SlotType
+		CDMRSlotType slotType;
+		slotType.setColorCode(m_colorcode);
+		slotType.setDataType(DT_TERMINATOR_WITH_LC);
+		slotType.getData(m_dmrFrame);
+
+		// Full LC
+		CDMRLC dmrLC = CDMRLC(m_dmrflco, m_srcid, m_dstid);
+		CDMRFullLC fullLC;
+		fullLC.encode(dmrLC, m_dmrFrame, DT_TERMINATOR_WITH_LC);
+
+		rx_dmrdata.setData(m_dmrFrame);
+		//CUtils::dump(1U, "DMR data:", m_dmrFrame, 33U);
+		sendDMR(rx_dmrdata, burst);
+
+		m_dmrWatch.start();
+	}
+	else if(dmrFrameType == TAG_DATA) {
+		CDMREMB emb;
+		CDMRData rx_dmrdata;
+		unsigned int n_dmr = (m_dmrCount - 3U) % 6U;
+
+		rx_dmrdata.setSlotNo(m_slotNo);
+		rx_dmrdata.setSrcId(m_srcid);
+		rx_dmrdata.setDstId(m_dstid);
+		rx_dmrdata.setFLCO(m_dmrflco);
+		rx_dmrdata.setN(n_dmr);
+		rx_dmrdata.setSeqNo(m_dmrCount);
+		rx_dmrdata.setBER(0U);
+		rx_dmrdata.setRSSI(0U);
+
+		if (!n_dmr) {
+			rx_dmrdata.setDataType(DT_VOICE_SYNC);
+			// Add sync
+			CSync::addDMRAudioSync(m_dmrFrame, 0U);
+			// Prepare Full LC data
+			CDMRLC dmrLC = CDMRLC(m_dmrflco, m_srcid, m_dstid);
+			// Configure the Embedded LC
+			m_EmbeddedLC.setLC(dmrLC);
+		}
+		else {
+			rx_dmrdata.setDataType(DT_VOICE);
+			// Generate the Embedded LC
+			unsigned char lcss = m_EmbeddedLC.getData(m_dmrFrame, n_dmr);
+			// Generate the EMB
+			emb.setColorCode(m_colorcode);
+			emb.setLCSS(lcss);
+			emb.getData(m_dmrFrame);
+		}
+
+		rx_dmrdata.setData(m_dmrFrame);
+
+		//CUtils::dump(1U, "DMR data:", m_dmrFrame, 33U);
+		sendDMR(rx_dmrdata, false);
+
+		m_dmrCount++;
+		m_dmrWatch.start();
+	}
+}
+
+void CSession::writeNXDN()
+{
+	// The NXDN destination reads the same decoded YSF voice as the DMR one
+	if (m_nxdnNetwork == NULL)
+		return;
+
+	if (m_nxdnRing != NULL) {
+		if (m_nxdnRing->getSpace() == 0U)
+			return;
+	} else if (m_nxdnWatch.elapsed() <= NXDN_FRAME_PER) {
+		return;
+	}
+
+	unsigned int nxdnFrameType = m_conv.getNXDN(m_nxdnFrame);
+
+	if(nxdnFrameType == TAG_HEADER) {
+		m_nxdnCount = 0U;
+
+		m_nxdnCall.setCall(m_nxdnSrc, m_nxdnTG);
+		m_nxdnCall.getHeader(m_nxdnFrame);
+
+		sendNXDN();
+
+		m_nxdnWatch.start();
+	}
+	else if (nxdnFrameType == TAG_EOT) {
+		m_nxdnCall.setCall(m_nxdnSrc, m_nxdnTG);
+		m_nxdnCall.getTerminator(m_nxdnFrame);
+
+		sendNXDN();
+
+		m_nxdnCount = 0U;
+	}
+	else if (nxdnFrameType == TAG_DATA) {
+		m_nxdnCall.setCall(m_nxdnSrc, m_nxdnTG);
+		m_nxdnCall.getVoice(m_nxdnFrame, m_nxdnCount);
+
+		sendNXDN();
+
+		m_nxdnCount++;
+		m_nxdnWatch.start();
+	}
+}
+
+void CSession::readDMR(const CDMRData& tx_dmrdata, unsigned int ms)
+{
+	assert(tx_dmrdata.getSlotNo() == m_slotNo);
+
+	unsigned int SrcId = tx_dmrdata.getSrcId();
+	unsigned int DstId = tx_dmrdata.getDstId();
+
+	FLCO netflco = tx_dmrdata.getFLCO();
+	unsigned char DataType = tx_dmrdata.getDataType();
+
+	if (!tx_dmrdata.isMissing()) {
+		m_networkWatchdog.start();
+
+		unsigned int streamId = tx_dmrdata.getStreamId();
+		if (streamId != m_dmrStreamId) {
+			m_dmrStreamId = streamId;
+			m_metrics.m_dmrCalls++;
+		}
+
+		if(DataType == DT_TERMINATOR_WITH_LC) {
+			if (m_dmrFrames == 0U) {
+				resetDMR();
+				m_networkWatchdog.stop();
+				m_dmrinfo = false;
+				m_firstSync = false;
+				return;
+			}
+
+			LogMessage("Session %u, DMR received end of voice transmission, %.1f seconds", m_number, float(m_dmrFrames) / 16.667F);
+
+			if (SrcId == 4000)
+				m_unlinkReceived = true;
+
+			m_conv.putDMREOT();
+			resetDMR();
+			m_networkWatchdog.stop();
+			m_dmrFrames = 0U;
+			m_dmrinfo = false;
+			m_firstSync = false;
+		}
+
+		if((DataType == DT_VOICE_LC_HEADER) && (DataType != m_dmrLastDT)) {
+
+			// DT1 & DT2 without GPS info
+			::memcpy(m_gpsBuffer, dt1_temp, 10U);
+			::memcpy(m_gpsBuffer + 10U, dt2_temp, 10U);
+
+			m_conv.putDMRHeader();
+			findDMRSource(SrcId, DstId, netflco, "received");
+
+			m_dmrinfo = true;
+
+			m_dmrFrames = 0U;
+			m_firstSync = false;
+		}
+
+		if(DataType == DT_VOICE_SYNC)
+			m_firstSync = true;
+
+		if((DataType == DT_VOICE_SYNC || DataType == DT_VOICE) && m_firstSync) {
+			unsigned char dmr_frame[50];
+
+			tx_dmrdata.getData(dmr_frame);
+
+			if (!m_dmrinfo) {
+				findDMRSource(SrcId, DstId, netflco, "late entry received");
+
+				m_dmrinfo = true;
+			}
+
+			m_conv.putDMR(dmr_frame); // Add DMR frame for YSF conversion
+			m_dmrFrames++;
+			m_metrics.m_dmrFrames++;
+		}
+	}
+	else {
+		if(DataType == DT_VOICE_SYNC || DataType == DT_VOICE) {
+			unsigned char dmr_frame[50];
+			tx_dmrdata.getData(dmr_frame);
+			m_conv.putDMR(dmr_frame); // Add DMR frame for YSF conversion
+			m_dmrFrames++;
+			m_metrics.m_dmrMissing++;
+		}
+
+		m_networkWatchdog.clock(ms);
+		if (m_networkWatchdog.hasExpired()) {
+			LogDebug("Session %u, network watchdog has expired, %.1f seconds", m_number, float(m_dmrFrames) / 16.667F);
+			resetDMR();
+			m_networkWatchdog.stop();
+			m_dmrFrames = 0U;
+			m_dmrinfo = false;
+		}
+	}
+
+	m_dmrLastDT = DataType;
+}
+
+void CSession::findDMRSource(unsigned int srcId, unsigned int dstId, FLCO flco, const char* type)
+{
+	if (srcId == 9990U)
+		m_netSrc = "PARROT";
+	else if (srcId == 9U)
+		m_netSrc = "LOCAL";
+	else if (srcId == 4000U)
+		m_netSrc = "UNLINK";
+	else
+		m_netSrc = m_lookup->findCS(srcId);
+
+	m_netDst = (flco == FLCO_GROUP ? "TG " : "") + m_lookup->findCS(dstId);
+
+	LogMessage("Session %u, DMR audio %s from %s to %s", m_number, type, m_netSrc.c_str(), m_netDst.c_str());
+
+	if (m_lookup->exists(srcId) && (m_APRS != NULL)) {
+		int lat, lon, resp;
+		resp = m_APRS->findCall(m_netSrc, &lat, &lon);
+
+		//LogMessage("Searching GPS Position of %s in aprs.fi", m_netSrc.c_str());
+
+		if (resp) {
+			LogMessage("GPS Position of %s Lat: %0.3f, Lon: %0.3f", m_netSrc.c_str(), (float)lat / 1000.0, (float)lon / 1000.0);
+			m_APRS->formatGPS(m_gpsBuffer, lat, lon);
+		}
+		// else
+		//	LogMessage("GPS Position not available");
+	}
+
+	m_netSrc.resize(YSF_CALLSIGN_LENGTH, ' ');
+	m_netDst.resize(YSF_CALLSIGN_LENGTH, ' ');
+}
+
+void CSession::writeYSFHeader(unsigned char fi, unsigned char counter)
+{
+	::memcpy(m_ysfFrame + 0U, "YSFD", 4U);
+	::memcpy(m_ysfFrame + 4U, m_ysfNetwork->getCallsign().c_str(), YSF_CALLSIGN_LENGTH);
+	::memcpy(m_ysfFrame + 14U, m_netSrc.c_str(), YSF_CALLSIGN_LENGTH);
+	::memcpy(m_ysfFrame + 24U, "ALL       ", YSF_CALLSIGN_LENGTH);
+	m_ysfFrame[34U] = counter; // Net frame counter
+
+	CSync::addYSFSync(m_ysfFrame + 35U);
+
+	// Set the FICH
+	CYSFFICH fich;
+	fich.setFI(fi);
+	fich.setCS(m_config->m_fichCallSign);
+	fich.setCM(m_config->m_fichCallMode);
+	fich.setBN(0U);
+	fich.setBT(0U);
+	fich.setFN(0U);
+	fich.setFT(m_config->m_fichFrameTotal);
+	fich.setDev(0U);
+	fich.setMR(m_config->m_fichMessageRoute);
+	fich.setVoIP(m_config->m_fichVOIP);
+	fich.setDT(m_config->m_fichDataType);
+	fich.setSQL(m_config->m_fichSQLType);
+	fich.setSQ(m_config->m_fichSQLCode);
+	fich.encode(m_ysfFrame + 35U);
+
+	unsigned char csd1[20U], csd2[20U];
+	memset(csd1, '*', YSF_CALLSIGN_LENGTH/2);
+	memcpy(csd1 + YSF_CALLSIGN_LENGTH/2, m_config->m_ysfRadioID, YSF_CALLSIGN_LENGTH/2);
+	memcpy(csd1 + YSF_CALLSIGN_LENGTH, m_netSrc.c_str(), YSF_CALLSIGN_LENGTH);
+	memset(csd2, ' ', YSF_CALLSIGN_LENGTH + YSF_CALLSIGN_LENGTH);
+
+	CYSFPayload payload;
+	payload.writeHeader(m_ysfFrame + 35U, csd1, csd2);
+
+	sendYSF();
+}
+
+void CSession::writeYSF()
+{
+	if (m_ysfRing != NULL) {
+		if (m_ysfRing->getSpace() == 0U)
+			return;
+	} else if (m_ysfWatch.elapsed() <= YSF_FRAME_PER) {
+		return;
+	}
+
+	unsigned int ysfFrameType = m_conv.getYSF(m_ysfFrame + 35U);
+
+	if(ysfFrameType == TAG_HEADER) {
+		m_ysfCount = 0U;
+
+		writeYSFHeader(YSF_FI_HEADER, 0U);
+
+		m_ysfCount++;
+		m_ysfWatch.start();
+	}
+	else if (ysfFrameType == TAG_EOT) {
+		writeYSFHeader(YSF_FI_TERMINATOR, m_ysfCount);
+	}
+	else if (ysfFrameType == TAG_DATA) {
+		CYSFFICH fich;
+		CYSFPayload ysfPayload;
+		unsigned char dch[10U];
+
+		unsigned int fn = (m_ysfCount - 1U) % (m_config->m_fichFrameTotal + 1);
+
+		::memcpy(m_ysfFrame + 0U, "YSFD", 4U);
+		::memcpy(m_ysfFrame + 4U, m_ysfNetwork->getCallsign().c_str(), YSF_CALLSIGN_LENGTH);
+		::memcpy(m_ysfFrame + 14U, m_netSrc.c_str(), YSF_CALLSIGN_LENGTH);
+		::memcpy(m_ysfFrame + 24U, "ALL       ", YSF_CALLSIGN_LENGTH);
+
+		// Add the YSF Sync
+		CSync::addYSFSync(m_ysfFrame + 35U);
+
+		switch (fn) {
+			case 0:
+				memset(dch, '*', YSF_CALLSIGN_LENGTH/2);
+				memcpy(dch + YSF_CALLSIGN_LENGTH/2, m_config->m_ysfRadioID, YSF_CALLSIGN_LENGTH/2);
+				ysfPayload.writeVDMode2Data(m_ysfFrame + 35U, dch);
+				break;
+			case 1:
+				ysfPayload.writeVDMode2Data(m_ysfFrame + 35U, (const unsigned char*)m_netSrc.c_str());
+				break;
+			case 2:
+				ysfPayload.writeVDMode2Data(m_ysfFrame + 35U, (const unsigned char*)m_netDst.c_str());
+				break;
+			case 5:
+				memset(dch, ' ', YSF_CALLSIGN_LENGTH/2);
+				memcpy(dch + YSF_CALLSIGN_LENGTH/2, m_config->m_ysfRadioID, YSF_CALLSIGN_LENGTH/2);
+				ysfPayload.writeVDMode2Data(m_ysfFrame + 35U, dch);	// Rem3/4
+				break;
+			case 6:
+				ysfPayload.writeVDMode2Data(m_ysfFrame + 35U, m_config->m_ysfDT1);
+				break;
+			case 7:
+				ysfPayload.writeVDMode2Data(m_ysfFrame + 35U, m_config->m_ysfDT2);
+				break;
+			default:
+				ysfPayload.writeVDMode2Data(m_ysfFrame + 35U, (const unsigned char*)"          ");
+		}
+
+		// Set the FICH
+		fich.setFI(YSF_FI_COMMUNICATIONS);
+		fich.setCS(m_config->m_fichCallSign);
+		fich.setCM(m_config->m_fichCallMode);
+		fich.setBN(0U);
+		fich.setBT(0U);
+		fich.setFN(fn);
+		fich.setFT(m_config->m_fichFrameTotal);
+		fich.setDev(0U);
+		fich.setMR(m_config->m_fichMessageRoute);
+		fich.setVoIP(m_config->m_fichVOIP);
+		fich.setDT(m_config->m_fichDataType);
+		fich.setSQL(m_config->m_fichSQLType);
+		fich.setSQ(m_config->m_fichSQLCode);
+		fich.encode(m_ysfFrame + 35U);
+
+		// Net frame counter
+		m_ysfFrame[34U] = (m_ysfCount & 0x7FU) << 1;
+
+		// Send data to MMDVMHost
+		sendYSF();
+
+		m_ysfCount++;
+		m_ysfWatch.start();
+	}
+}
+
+void CSession::clock(unsigned int ms)
+{
+	if (m_wiresX != NULL)
+		m_wiresX->clock(ms);
+
+	m_pollTimer.clock(ms);
+	if (m_pollTimer.isRunning() && m_pollTimer.hasExpired()) {
+		sendPolls();
+		m_pollTimer.start();
+	}
+
+	m_ysfWatchdog.clock(ms);
+	if (m_ysfWatchdog.isRunning() && m_ysfWatchdog.hasExpired()) {
+		int extraFrames = (m_config->m_hangTime / 100U) - m_ysfFrames;
+		for (int i = 0U; i < extraFrames; i++)
+			m_conv.putDummyYSF();
+		m_ysfWatchdog.stop();
+	}
+
+	// A reloaded configuration is only taken up once no call is running and the converted YSF stream has drained
+	if (!m_ysfWatchdog.isRunning() && !m_networkWatchdog.isRunning() && m_tgConnectState == NONE && m_ysfWatch.elapsed() >= CONFIG_IDLE_TIME)
+		m_config = m_configs->get();
+}
+
+void CSession::getReport(CSessionReport& report) const
+{
+	report.m_number  = m_number;
+	report.m_slotNo  = m_slotNo;
+	report.m_dstId   = m_dstid;
+	report.m_pc      = m_dmrflco != FLCO_GROUP;
+	report.m_metrics = m_metrics;
+	report.m_metrics.m_csLookups = m_callsigns.getLookups();
+	report.m_metrics.m_csHits    = m_callsigns.getHits();
+}
+
+void CSession::report(const CSessionReport& report)
+{
+	const CSessionMetrics& m = report.m_metrics;
+
+	LogMessage("Session %u, slot %u, %s%u: YSF %u calls %u frames, DMR %u calls %u frames %u missing, %u dropped, %u TG changes, %u/%u callsign cache hits", report.m_number, report.m_slotNo,
+		report.m_pc ? "" : "TG ", report.m_dstId, m.m_ysfCalls, m.m_ysfFrames, m.m_dmrCalls, m.m_dmrFrames, m.m_dmrMissing, m.m_dropped, m.m_tgChanges, m.m_csHits, m.m_csLookups);
+}
+
+void CSession::sendDMR(const CDMRData& data, bool burst)
+{
+	CStartup::frame();
+
+	queueDMR(data, burst);
+}
+
+void CSession::queueDMR(const CDMRData& data, bool burst)
+{
+	if (m_dmrRing == NULL) {
+		m_dmrNetwork->write(data);
+		return;
+	}
+
+	m_record.m_type   = FRAME_DMR;
+	m_record.m_action = FA_FRAME;
+	m_record.m_burst  = burst;
+	m_record.m_dmr    = data;
+
+	m_dmrRing->push(m_record);
+}
+
+void CSession::resetDMR()
+{
+	if (m_dmrRing == NULL) {
+		m_dmrNetwork->reset(m_slotNo);
+		return;
+	}
+
+	m_record.m_type   = FRAME_DMR;
+	m_record.m_action = FA_RESET;
+	m_record.m_burst  = false;
+	m_record.m_dmr.setSlotNo(m_slotNo);
+
+	m_dmrRing->push(m_record);
+}
+
+void CSession::sendNXDN()
+{
+	if (m_nxdnRing == NULL) {
+		m_nxdnNetwork->write(m_nxdnFrame, m_nxdnSrc, m_nxdnTG, true);
+		return;
+	}
+
+	m_record.m_type   = FRAME_NXDN;
+	m_record.m_action = FA_FRAME;
+	m_record.m_burst  = false;
+	m_record.m_length = 33U;
+	m_record.m_srcId  = m_nxdnSrc;
+	m_record.m_dstId  = m_nxdnTG;
+	::memcpy(m_record.m_data, m_nxdnFrame, 33U);
+
+	m_nxdnRing->push(m_record);
+}
+
+void CSession::sendYSF()
+{
+	CStartup::frame();
+
+	if (m_ysfRing == NULL) {
+		m_ysfNetwork->write(m_ysfFrame);
+		return;
+	}
+
+	m_record.m_type   = FRAME_YSF;
+	m_record.m_action = FA_FRAME;
+	m_record.m_burst  = false;
+	m_record.m_length = 155U;
+	::memcpy(m_record.m_data, m_ysfFrame, 155U);
+
+	m_ysfRing->push(m_record);
+}
+
+void CSession::sendPolls()
+{
+	bool nxdn = m_nxdnNetwork != NULL && m_nxdnTG != NXDNGW_DSTID_DEF;
+
+	if (m_ysfRing == NULL) {
+		m_ysfNetwork->writePoll();
+		if (nxdn)
+			m_nxdnNetwork->writePoll(m_nxdnTG);
+		return;
+	}
+
+	m_record.m_action = FA_POLL;
+	m_record.m_burst  = false;
+	m_record.m_length = 0U;
+
+	m_record.m_type = FRAME_YSF;
+	m_ysfRing->push(m_record);
+
+	if (nxdn) {
+		m_record.m_type  = FRAME_NXDN;
+		m_record.m_dstId = m_nxdnTG;
+		m_nxdnRing->push(m_record);
+	}
+}
+
+void CSession::close()
+{
+	m_ysfNetwork->close();
+}
+
+void CSession::SendDummyDMR(unsigned int srcid,unsigned int dstid, FLCO dmr_flco)
+{
+	CDMRData dmrdata;
+	CDMRSlotType slotType;
+	CDMRFullLC fullLC;
+
+	int dmr_cnt = 0U;
+
+	// Generate DMR LC for header and TermLC frames
+	CDMRLC dmrLC = CDMRLC(dmr_flco, srcid, dstid);
+
+	// Build DMR header
+	dmrdata.setSlotNo(m_slotNo);
+	dmrdata.setSrcId(srcid);
+	dmrdata.setDstId(dstid);
+	dmrdata.setFLCO(dmr_flco);
+	dmrdata.setN(0U);
+	dmrdata.setSeqNo(0U);
+	dmrdata.setBER(0U);
+	dmrdata.setRSSI(0U);
+	dmrdata.setDataType(DT_VOICE_LC_HEADER);
+
+	// Add sync
+	CSync::addDMRDataSync(m_dmrFrame, 0);
+
+	// Add SlotType
+	slotType.setColorCode(m_colorcode);
+	slotType.setDataType(DT_VOICE_LC_HEADER);
+	slotType.getData(m_dmrFrame);
+
+	// Full LC
+	fullLC.encode(dmrLC, m_dmrFrame, DT_VOICE_LC_HEADER);
+
+	dmrdata.setData(m_dmrFrame);
+
+	// Send DMR header
+	for (unsigned int i = 0U; i < 3U; i++) {
+		dmrdata.setSeqNo(dmr_cnt);
+		queueDMR(dmrdata, i > 0U);
+		dmr_cnt++;
+	}
+
+	// Build DMR TermLC
+	dmrdata.setSeqNo(dmr_cnt);
+	dmrdata.setDataType(DT_TERMINATOR_WITH_LC);
+
+	// Add sync
+	CSync::addDMRDataSync(m_dmrFrame, 0);
+
+	// Add SlotType
+	slotType.setColorCode(m_colorcode);
+	slotType.setDataType(DT_TERMINATOR_WITH_LC);
+	slotType.getData(m_dmrFrame);
+
+	// Full LC for TermLC frame
+	fullLC.encode(dmrLC, m_dmrFrame, DT_TERMINATOR_WITH_LC);
+
+	dmrdata.setData(m_dmrFrame);
+
+	// Send DMR TermLC
+	queueDMR(dmrdata, true);
+}
+
+unsigned int CSession::findNXDNID(unsigned int dmrid)
+{
+	std::string dmrCS = m_lookup->findCS(dmrid);
+	unsigned int nxdnID = m_nxdnLookup->findID(dmrCS);
+
+	if (nxdnID == 0)
+		nxdnID = truncID(dmrid);
+	else
+		LogMessage("NXDN ID of %s: %u", dmrCS.c_str(), nxdnID);
+
+	return nxdnID;
+}
+
+unsigned int CSession::truncID(unsigned int id)
+{
+	char temp[20];
+
+	snprintf(temp, 8, "%07d", id);
+	unsigned int newid = atoi(temp + 2);
+
+	if (newid > 65519 || newid == 0)
+		newid = m_nxdnDefaultID;
+
+	return newid;
+}
+
+unsigned int CSession::findYSFID(const unsigned char* source, bool showdst)
+{
+	const CCallsignEntry& entry = m_callsigns.find(source);
+
+	unsigned int id = entry.m_id;
+	bool dmrpc = false;
+
+	if (m_dmrflco == FLCO_USER_USER)
+		dmrpc = true;
+	else if (m_dmrflco == FLCO_GROUP)
+		dmrpc = false;
+
+	if (id == 0) {
+		// Every source is unknown until the table has loaded, so none is dropped for that
+		if (m_config->m_dropUnknown == 0 || !m_lookup->isLoaded()) id = m_defsrcid;
+		if (showdst)
+			LogMessage("Not DMR ID found, using default ID: %u, DstID: %s%u", id, dmrpc ? "" : "TG ", m_dstid);
+		else
+			LogMessage("Not DMR ID found, using default ID: %u", id);
+	}
+	else {
+		if (showdst)
+			LogMessage("DMR ID of %s: %u, DstID: %s%u", entry.m_callsign, id, dmrpc ? "" : "TG ", m_dstid);
+		else
+			LogMessage("DMR ID of %s: %u", entry.m_callsign, id);
+	}
+
+	return id;
+}
+
+void CSession::readSrcYSF(const unsigned char* buffer)
+{
+	// Every frame of a Wires-X request carries the same source, only a new one is looked at
+	if (::memcmp(m_ysfSrcRaw, buffer + 14U, YSF_CALLSIGN_LENGTH) == 0)
+		return;
+
+	::memcpy(m_ysfSrcRaw, buffer + 14U, YSF_CALLSIGN_LENGTH);
+	m_ysfSrc = m_callsigns.find(m_ysfSrcRaw).m_source;
+}
@@ -0,0 +1,224 @@
+/*
+ *   Copyright (C) 2016,2017 by Jonathan Naylor G4KLX
+ *   Copyright (C) 2018,2019 by Andy Uribe CA6JAU
+ *   Copyright (C) 2018 by Manuel Sanchez EA7EE
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(SESSION_H)
+#define SESSION_H
+
+#include "DMRDefines.h"
+#include "ModeConv.h"
+#include "DMRNetwork.h"
+#include "DMREmbeddedData.h"
+#include "DMRLookup.h"
+#include "NXDNNetwork.h"
+#include "NXDNLookup.h"
+#include "NXDNCallTemplate.h"
+#include "YSFNetwork.h"
+#include "Pipeline.h"
+#include "APRSReader.h"
+#include "CallsignCache.h"
+#include "StopWatch.h"
+#include "Snapshot.h"
+#include "DMRWiresX.h"
+#include "Timer.h"
+#include "Conf.h"
+#include "DTMF.h"
+#include "GPS.h"
+
+#include <string>
+#include <memory>
+
+// Pacing of the converted frames, also what the worker loops have to keep up with
+#define DMR_FRAME_PER       55U
+#define YSF_FRAME_PER       90U
+#define NXDN_FRAME_PER      75U
+
+// Sessions and DMR logins are created once at startup, never while bridging
+const unsigned int SESSION_POOL_SIZE = 16U;
+
+enum TG_STATUS {
+	NONE,
+	WAITING_UNLINK,
+	SEND_REPLY,
+	SEND_PTT
+};
+
+// The settings a reload of the configuration can change, each session takes up a new version between calls
+struct CSessionConfig {
+	unsigned int  m_hangTime;
+	bool          m_dropUnknown;
+	bool          m_enableUnlink;
+	unsigned int  m_idUnlink;
+	FLCO          m_flcoUnlink;
+	unsigned char m_fichCallSign;
+	unsigned char m_fichCallMode;
+	unsigned char m_fichFrameTotal;
+	unsigned char m_fichMessageRoute;
+	unsigned char m_fichVOIP;
+	unsigned char m_fichDataType;
+	unsigned char m_fichSQLType;
+	unsigned char m_fichSQLCode;
+	unsigned char m_ysfDT1[10U];
+	unsigned char m_ysfDT2[10U];
+	char          m_ysfRadioID[5U];
+};
+
+// Counters kept for the whole life of a session
+struct CSessionMetrics {
+	unsigned int m_ysfCalls;		// Calls received from the YSF side
+	unsigned int m_dmrCalls;		// DMR streams received on the slot
+	unsigned int m_ysfFrames;		// YSF voice frames received
+	unsigned int m_dmrFrames;		// DMR voice frames received
+	unsigned int m_dmrMissing;		// DMR frames filled in by the jitter buffer
+	unsigned int m_dropped;			// YSF calls dropped for an unknown source
+	unsigned int m_tgChanges;		// Wires-X and DTMF connect and disconnect requests
+	unsigned int m_csLookups;		// YSF sources resolved to a DMR Id
+	unsigned int m_csHits;			// Of which found in the callsign cache
+};
+
+// A copy of the counters that can be handed to another thread
+struct CSessionReport {
+	unsigned int    m_number;
+	unsigned int    m_slotNo;
+	unsigned int    m_dstId;
+	bool            m_pc;
+	CSessionMetrics m_metrics;
+};
+
+// One YSF room bridged to one slot of a DMR login, holds everything about the calls in progress
+class CSession
+{
+public:
+	CSession(unsigned int number, CConf& conf, CYSFNetwork* ysfNetwork, CDMRNetwork* dmrNetwork, unsigned int slotNo, unsigned int dstId, bool pc);
+	~CSession();
+
+	void setIds(unsigned int colorCode, unsigned int defSrcId);
+	void setConfig(CSnapshot<CSessionConfig>& config);
+	void setLookups(CDMRLookup* lookup, CAPRSReader* aprs);
+	void setWiresX(const std::string& callsign, const std::string& suffix, CTGList* tgList);
+	void setGPS(CGPS* gps);
+	void setNXDN(CNXDNNetwork* network, CNXDNLookup* lookup, unsigned int tg, unsigned int defaultID);
+	// Hands the converted frames to the TX stage instead of writing them out here
+	void setPipeline(CTXStage& tx);
+
+	unsigned int getNumber() const;
+	unsigned int getSlotNo() const;
+	unsigned int getSrcId() const;
+	unsigned int getDstId() const;
+	CYSFNetwork* getYSFNetwork() const;
+	bool         owns(const CDMRNetwork* network, unsigned int slotNo) const;
+
+	// The Wires-X and DTMF talkgroup change in progress
+	void processTG();
+
+	void readYSF();
+	void readYSF(unsigned char* buffer);
+	void readDMR(const CDMRData& data, unsigned int ms);
+
+	// Paced output of the converted frames
+	void writeDMR();
+	void writeNXDN();
+	void writeYSF();
+
+	void clock(unsigned int ms);
+
+	void getReport(CSessionReport& report) const;
+	static void report(const CSessionReport& report);
+
+	void close();
+
+private:
+	unsigned int      m_number;
+	CConf&            m_conf;
+	CYSFNetwork*      m_ysfNetwork;
+	CDMRNetwork*      m_dmrNetwork;
+	unsigned int      m_slotNo;
+	CDMRLookup*       m_lookup;
+	CAPRSReader*      m_APRS;
+	CDMRWiresX*       m_wiresX;
+	CDTMF*            m_dtmf;
+	CGPS*             m_gps;
+	CNXDNNetwork*     m_nxdnNetwork;
+	CNXDNLookup*      m_nxdnLookup;
+	CModeConv         m_conv;
+	CNXDNCallTemplate m_nxdnCall;
+	CDMREmbeddedData  m_EmbeddedLC;
+	unsigned int      m_colorcode;
+	unsigned int      m_srcid;
+	unsigned int      m_defsrcid;
+	unsigned int      m_dstid;
+	FLCO              m_dmrflco;
+	unsigned int      m_ptt_dstid;
+	bool              m_ptt_pc;
+	unsigned int      m_nxdnSrc;
+	unsigned int      m_nxdnTG;
+	unsigned int      m_nxdnDefaultID;
+	CSnapshot<CSessionConfig>*            m_configs;
+	std::shared_ptr<const CSessionConfig> m_config;
+	std::string       m_netSrc;
+	std::string       m_netDst;
+	std::string       m_ysfSrc;
+	unsigned char     m_ysfSrcRaw[YSF_CALLSIGN_LENGTH];
+	CCallsignCache<CDMRLookup> m_callsigns;
+	unsigned char     m_dmrLastDT;
+	unsigned int      m_dmrStreamId;
+	unsigned char*    m_ysfFrame;
+	unsigned char*    m_dmrFrame;
+	unsigned char*    m_nxdnFrame;
+	unsigned char     m_gpsBuffer[20U];
+	unsigned int      m_dmrFrames;
+	unsigned int      m_ysfFrames;
+	unsigned char     m_ysfCount;
+	unsigned char     m_dmrCount;
+	unsigned char     m_nxdnCount;
+	bool              m_dmrinfo;
+	bool              m_firstSync;
+	TG_STATUS         m_tgConnectState;
+	bool              m_unlinkReceived;
+	CStopWatch        m_tgChange;
+	CStopWatch        m_ysfWatch;
+	CStopWatch        m_dmrWatch;
+	CStopWatch        m_nxdnWatch;
+	CTimer            m_networkWatchdog;
+	CTimer            m_ysfWatchdog;
+	CTimer            m_pollTimer;
+	CSessionMetrics   m_metrics;
+	CFrameRing*       m_ysfRing;
+	CFrameRing*       m_dmrRing;
+	CFrameRing*       m_nxdnRing;
+	CFrameRecord      m_record;
+
+	void processWiresX(WX_STATUS status, unsigned int dstId, bool dtmf);
+	void findDMRSource(unsigned int srcId, unsigned int dstId, FLCO flco, const char* type);
+	void SendDummyDMR(unsigned int srcid, unsigned int dstid, FLCO dmr_flco);
+	void writeYSFHeader(unsigned char fi, unsigned char counter);
+	void sendDMR(const CDMRData& data, bool burst);
+	void queueDMR(const CDMRData& data, bool burst);
+	void resetDMR();
+	void sendNXDN();
+	void sendYSF();
+	void sendPolls();
+	unsigned int findYSFID(const unsigned char* source, bool showdst);
+	void readSrcYSF(const unsigned char* buffer);
+	unsigned int findNXDNID(unsigned int dmrid);
+	unsigned int truncID(unsigned int id);
+};
+
+#endif
@@ -0,0 +1,442 @@
+/*
+ *   Copyright (C) 2016,2017 by Jonathan Naylor G4KLX
+ *   Copyright (C) 2018,2019 by Andy Uribe CA6JAU
+ *   Copyright (C) 2018 by Manuel Sanchez EA7EE
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "SessionWorker.h"
+#include "DMRSlotType.h"
+#include "DMRFullLC.h"
+#include "DMRLC.h"
+#include "Sync.h"
+#include "Log.h"
+
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <cassert>
+
+#define NXDNGW_DSTID_DEF    20U
+
+#define XLX_SLOT            2U
+#define XLX_COLOR_CODE      3U
+
+CSessionWorker::CSessionWorker(unsigned int number, int cpu) :
+CThread(),
+m_number(number),
+m_cpu(cpu),
+m_logins(),
+m_sessions(),
+m_nxdnNetwork(NULL),
+m_nxdnTG(NXDNGW_DSTID_DEF),
+m_gps(NULL),
+m_xlxrefl(0U),
+m_xlxmodule(),
+m_xlxConnected(false),
+m_stopWatch(),
+m_stopped(false),
+m_commands(8U),
+m_reports(2U * SESSION_POOL_SIZE),
+m_pipeline(false),
+m_rxCpu(-1),
+m_txCpu(-1),
+m_rxStage(NULL),
+m_txStage(NULL),
+m_xlxRing(NULL),
+m_record(),
+m_watchdog("Worker " + std::to_string(number), DMR_FRAME_PER)
+{
+	m_stopWatch.start();
+}
+
+CSessionWorker::~CSessionWorker()
+{
+	delete m_rxStage;
+	delete m_txStage;
+}
+
+void CSessionWorker::addLogin(CDMRNetwork* network)
+{
+	assert(network != NULL);
+
+	m_logins.push_back(network);
+}
+
+void CSessionWorker::addSession(CSession* session)
+{
+	assert(session != NULL);
+
+	m_sessions.push_back(session);
+}
+
+void CSessionWorker::setNXDN(CNXDNNetwork* network, unsigned int tg)
+{
+	m_nxdnNetwork = network;
+	m_nxdnTG      = tg;
+}
+
+void CSessionWorker::setGPS(CGPS* gps)
+{
+	m_gps = gps;
+}
+
+void CSessionWorker::setXLX(unsigned int reflector, const std::string& module)
+{
+	m_xlxrefl   = reflector;
+	m_xlxmodule = module;
+}
+
+void CSessionWorker::setPipeline(int rxCpu, int txCpu)
+{
+	m_pipeline = true;
+	m_rxCpu    = rxCpu;
+	m_txCpu    = txCpu;
+}
+
+unsigned int CSessionWorker::getLogins() const
+{
+	return m_logins.size();
+}
+
+unsigned int CSessionWorker::getSessions() const
+{
+	return m_sessions.size();
+}
+
+const CLoopWatchdog& CSessionWorker::getWatchdog() const
+{
+	return m_watchdog;
+}
+
+void CSessionWorker::startPipeline()
+{
+	if (!m_pipeline)
+		return;
+
+	m_rxStage = new CRXStage(m_number, m_rxCpu);
+	m_txStage = new CTXStage(m_number, m_txCpu);
+
+	for (std::vector<CDMRNetwork*>::iterator it = m_logins.begin(); it != m_logins.end(); ++it)
+		m_txStage->addLogin(*it);
+
+	// The RX stage numbers the rooms in the same order as the sessions here
+	for (std::vector<CSession*>::iterator it = m_sessions.begin(); it != m_sessions.end(); ++it) {
+		m_rxStage->addRoom((*it)->getYSFNetwork());
+		(*it)->setPipeline(*m_txStage);
+	}
+
+	// The polls of the gateway are returned by the TX stage, the only thread writing the network
+	CFrameRing* polls = NULL;
+	if (m_nxdnNetwork != NULL && m_nxdnTG == NXDNGW_DSTID_DEF)
+		polls = m_txStage->addStream(m_nxdnNetwork, 0U);
+	m_rxStage->setNXDN(m_nxdnNetwork, polls);
+
+	if (!m_xlxmodule.empty())
+		m_xlxRing = m_txStage->addStream(m_logins[0U], DMR_FRAME_PER);
+
+	m_rxStage->run();
+	m_txStage->run();
+
+	LogMessage("Worker %u, RX and TX stages started", m_number);
+}
+
+void CSessionWorker::stopPipeline()
+{
+	if (m_rxStage == NULL)
+		return;
+
+	m_rxStage->stop();
+	m_rxStage->wait();
+
+	m_txStage->stop();
+	m_txStage->wait();
+}
+
+bool CSessionWorker::post(WORKER_COMMAND command)
+{
+	CWorkerCommand entry;
+	entry.m_command = command;
+
+	return m_commands.push(entry);
+}
+
+bool CSessionWorker::post(const std::shared_ptr<const CLoginSettings>& login)
+{
+	assert(login);
+
+	CWorkerCommand entry;
+	entry.m_command = WC_LOGIN;
+	entry.m_login   = login;
+
+	return m_commands.push(entry);
+}
+
+bool CSessionWorker::getReport(CSessionReport& report)
+{
+	return m_reports.pop(report);
+}
+
+void CSessionWorker::entry()
+{
+	if (m_cpu >= 0) {
+		if (CThread::setAffinity(m_cpu))
+			LogMessage("Worker %u, pinned to CPU %d", m_number, m_cpu);
+		else
+			LogWarning("Worker %u, unable to pin to CPU %d", m_number, m_cpu);
+	}
+
+	LogMessage("Worker %u, started with %u login(s) and %u session(s)", m_number, getLogins(), getSessions());
+
+	char name[20U];
+	::sprintf(name, "worker %u", m_number);
+	CRealTime::enter(name);
+
+	// The TX stage only paces what it has been given, so hand frames over promptly
+	unsigned int idle = m_pipeline ? 1U : 5U;
+
+	while (!m_stopped) {
+		unsigned int ms = process();
+
+		if (ms < idle)
+			CThread::sleep(idle);
+	}
+
+	LogMessage("Worker %u, stopped", m_number);
+}
+
+void CSessionWorker::commands()
+{
+	CWorkerCommand command;
+	while (m_commands.pop(command)) {
+		switch (command.m_command) {
+			case WC_REPORT:
+				for (std::vector<CSession*>::const_iterator it = m_sessions.begin(); it != m_sessions.end(); ++it) {
+					CSessionReport report;
+					(*it)->getReport(report);
+					m_reports.push(report);
+				}
+				m_watchdog.report();
+				break;
+			case WC_LOGIN:
+				// With the pipeline on the logins belong to the TX stage
+				if (m_txStage != NULL) {
+					if (!m_txStage->post(command.m_login))
+						LogWarning("Worker %u, the TX stage is busy, its logins keep the old details", m_number);
+				} else {
+					for (std::vector<CDMRNetwork*>::iterator it = m_logins.begin(); it != m_logins.end(); ++it)
+						command.m_login->apply(*it);
+				}
+				break;
+			case WC_STOP:
+				m_stopped = true;
+				break;
+			default:
+				break;
+		}
+	}
+}
+
+unsigned int CSessionWorker::process()
+{
+	unsigned int ms = m_stopWatch.elapsed();
+	m_watchdog.clock(ms);
+
+	commands();
+
+	linkXLX();
+
+	if (m_rxStage != NULL)
+		transcode(ms);
+	else
+		bridge(ms);
+
+	m_stopWatch.start();
+
+	// The RX and TX stages clock the networks themselves
+	if (m_rxStage == NULL) {
+		for (std::vector<CDMRNetwork*>::iterator it = m_logins.begin(); it != m_logins.end(); ++it)
+			(*it)->clock(ms);
+
+		for (std::vector<CSession*>::iterator it = m_sessions.begin(); it != m_sessions.end(); ++it)
+			(*it)->getYSFNetwork()->clock(ms);
+	}
+
+	for (std::vector<CSession*>::iterator it = m_sessions.begin(); it != m_sessions.end(); ++it)
+		(*it)->clock(ms);
+
+	if (m_gps != NULL)
+		m_gps->clock(ms);
+
+	return ms;
+}
+
+void CSessionWorker::linkXLX()
+{
+	if (m_xlxmodule.empty())
+		return;
+
+	// XLX is only reached through the main session, on the first login of this shard
+	if (m_logins[0U]->isConnected() && !m_xlxConnected) {
+		writeXLXLink(m_sessions[0U]->getSrcId(), m_sessions[0U]->getDstId());
+		LogMessage("XLX, Linking to reflector XLX%03u, module %s", m_xlxrefl, m_xlxmodule.c_str());
+		m_xlxConnected = true;
+	}
+	else if (!m_logins[0U]->isConnected() && m_xlxConnected) {
+		LogMessage("XLX, Disconnected from reflector XLX%03u, module %s", m_xlxrefl, m_xlxmodule.c_str());
+		m_xlxConnected = false;
+	}
+}
+
+void CSessionWorker::bridge(unsigned int ms)
+{
+	unsigned char buffer[2000U];
+
+	CDMRData tx_dmrdata;
+
+	for (std::vector<CSession*>::iterator it = m_sessions.begin(); it != m_sessions.end(); ++it) {
+		(*it)->processTG();
+		(*it)->readYSF();
+		(*it)->writeDMR();
+		(*it)->writeNXDN();
+	}
+
+	// Only the outbound direction is bridged to NXDN, the inbound traffic is dropped
+	if (m_nxdnNetwork != NULL) {
+		unsigned int len = 0U;
+		while ((len = m_nxdnNetwork->read(buffer)) > 0U) {
+			if (::memcmp(buffer, "NXDNP", 5U) == 0 && len == 17U && m_nxdnTG == NXDNGW_DSTID_DEF) {
+				// Return the poll
+				m_nxdnNetwork->write(buffer, len);
+			}
+		}
+	}
+
+	// Each login carries up to two sessions, one per slot
+	for (std::vector<CDMRNetwork*>::iterator it = m_logins.begin(); it != m_logins.end(); ++it) {
+		while ((*it)->read(tx_dmrdata) > 0U) {
+			unsigned int slotNo = tx_dmrdata.getSlotNo();
+
+			for (std::vector<CSession*>::iterator jt = m_sessions.begin(); jt != m_sessions.end(); ++jt) {
+				if ((*jt)->owns(*it, slotNo)) {
+					(*jt)->readDMR(tx_dmrdata, ms);
+					break;
+				}
+			}
+		}
+	}
+
+	for (std::vector<CSession*>::iterator it = m_sessions.begin(); it != m_sessions.end(); ++it)
+		(*it)->writeYSF();
+}
+
+void CSessionWorker::transcode(unsigned int ms)
+{
+	CFrameRing& rooms = m_rxStage->getRing();
+	while (rooms.pop(m_record))
+		m_sessions[m_record.m_index]->readYSF(m_record.m_data);
+
+	CFrameRing& logins = m_txStage->getRing();
+	while (logins.pop(m_record)) {
+		CDMRNetwork* login = m_logins[m_record.m_index];
+		unsigned int slotNo = m_record.m_dmr.getSlotNo();
+
+		for (std::vector<CSession*>::iterator it = m_sessions.begin(); it != m_sessions.end(); ++it) {
+			if ((*it)->owns(login, slotNo)) {
+				(*it)->readDMR(m_record.m_dmr, ms);
+				break;
+			}
+		}
+	}
+
+	// The converted frames go into the TX rings, the TX stage decides when they leave
+	for (std::vector<CSession*>::iterator it = m_sessions.begin(); it != m_sessions.end(); ++it) {
+		(*it)->processTG();
+		(*it)->writeDMR();
+		(*it)->writeNXDN();
+		(*it)->writeYSF();
+	}
+}
+
+void CSessionWorker::writeXLXLink(unsigned int srcId, unsigned int dstId)
+{
+	unsigned int streamId = ::rand() + 1U;
+
+	CDMRData data;
+
+	data.setSlotNo(XLX_SLOT);
+	data.setFLCO(FLCO_USER_USER);
+	data.setSrcId(srcId);
+	data.setDstId(dstId);
+	data.setDataType(DT_VOICE_LC_HEADER);
+	data.setN(0U);
+	data.setStreamId(streamId);
+
+	unsigned char buffer[DMR_FRAME_LENGTH_BYTES];
+
+	CDMRLC lc;
+	lc.setSrcId(srcId);
+	lc.setDstId(dstId);
+	lc.setFLCO(FLCO_USER_USER);
+
+	CDMRFullLC fullLC;
+	fullLC.encode(lc, buffer, DT_VOICE_LC_HEADER);
+
+	CDMRSlotType slotType;
+	slotType.setColorCode(XLX_COLOR_CODE);
+	slotType.setDataType(DT_VOICE_LC_HEADER);
+	slotType.getData(buffer);
+
+	CSync::addDMRDataSync(buffer, true);
+
+	data.setData(buffer);
+
+	for (unsigned int i = 0U; i < 3U; i++) {
+		data.setSeqNo(i);
+		writeXLX(data, i > 0U);
+	}
+
+	data.setDataType(DT_TERMINATOR_WITH_LC);
+
+	fullLC.encode(lc, buffer, DT_TERMINATOR_WITH_LC);
+
+	slotType.setDataType(DT_TERMINATOR_WITH_LC);
+	slotType.getData(buffer);
+
+	data.setData(buffer);
+
+	for (unsigned int i = 0U; i < 2U; i++) {
+		data.setSeqNo(i + 3U);
+		writeXLX(data, true);
+	}
+}
+
+void CSessionWorker::writeXLX(const CDMRData& data, bool burst)
+{
+	if (m_xlxRing == NULL) {
+		m_logins[0U]->write(data);
+		return;
+	}
+
+	m_record.m_type   = FRAME_DMR;
+	m_record.m_action = FA_FRAME;
+	m_record.m_burst  = burst;
+	m_record.m_dmr    = data;
+
+	m_xlxRing->push(m_record);
+}
+
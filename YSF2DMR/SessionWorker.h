@@ -0,0 +1,125 @@
+/*
+ *   Copyright (C) 2016,2017 by Jonathan Naylor G4KLX
+ *   Copyright (C) 2018,2019 by Andy Uribe CA6JAU
+ *   Copyright (C) 2018 by Manuel Sanchez EA7EE
+ *   Copyright (C) 2026 by agent
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(SESSIONWORKER_H)
+#define	SESSIONWORKER_H
+
+#include "DMRNetwork.h"
+#include "NXDNNetwork.h"
+#include "Pipeline.h"
+#include "SPSCQueue.h"
+#include "StopWatch.h"
+#include "RealTime.h"
+#include "Session.h"
+#include "Thread.h"
+#include "GPS.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+enum WORKER_COMMAND {
+	WC_REPORT,
+	WC_LOGIN,
+	WC_STOP
+};
+
+struct CWorkerCommand {
+	WORKER_COMMAND                        m_command;
+	std::shared_ptr<const CLoginSettings> m_login;		// WC_LOGIN only
+};
+
+// Runs the bridge loop for a shard of DMR logins and the sessions on them.
+// The control thread only talks to it through the two queues, and never
+// touches the networks itself. With the pipeline on, the YSF and NXDN
+// sockets are read by an RX stage, the DMR logins belong to a TX stage which
+// is the only writer of every socket, and this loop is left with the
+// transcoding.
+class CSessionWorker : public CThread
+{
+public:
+	CSessionWorker(unsigned int number, int cpu);
+	virtual ~CSessionWorker();
+
+	void addLogin(CDMRNetwork* network);
+	void addSession(CSession* session);
+
+	// Only for the shard holding the main session
+	void setNXDN(CNXDNNetwork* network, unsigned int tg);
+	void setGPS(CGPS* gps);
+	void setXLX(unsigned int reflector, const std::string& module);
+
+	// A cpu of -1 leaves the stage unpinned
+	void setPipeline(int rxCpu, int txCpu);
+
+	unsigned int getLogins() const;
+	unsigned int getSessions() const;
+
+	// Only read by the worker, or once it has stopped
+	const CLoopWatchdog& getWatchdog() const;
+
+	// Before the first pass and after the last one
+	void startPipeline();
+	void stopPipeline();
+
+	// Control thread side
+	bool post(WORKER_COMMAND command);
+	bool post(const std::shared_ptr<const CLoginSettings>& login);
+	bool getReport(CSessionReport& report);
+
+	// One pass over the shard, returns the ms since the previous one
+	unsigned int process();
+
+	virtual void entry();
+
+private:
+	unsigned int                     m_number;
+	int                              m_cpu;
+	std::vector<CDMRNetwork*>        m_logins;
+	std::vector<CSession*>           m_sessions;
+	CNXDNNetwork*                    m_nxdnNetwork;
+	unsigned int                     m_nxdnTG;
+	CGPS*                            m_gps;
+	unsigned int                     m_xlxrefl;
+	std::string                      m_xlxmodule;
+	bool                             m_xlxConnected;
+	CStopWatch                       m_stopWatch;
+	bool                             m_stopped;
+	CSPSCQueue<CWorkerCommand>       m_commands;
+	CSPSCQueue<CSessionReport>       m_reports;
+	bool                             m_pipeline;
+	int                              m_rxCpu;
+	int                              m_txCpu;
+	CRXStage*                        m_rxStage;
+	CTXStage*                        m_txStage;
+	CFrameRing*                      m_xlxRing;
+	CFrameRecord                     m_record;
+	CLoopWatchdog                    m_watchdog;
+
+	void commands();
+	void linkXLX();
+	void bridge(unsigned int ms);
+	void transcode(unsigned int ms);
+	void writeXLXLink(unsigned int srcId, unsigned int dstId);
+	void writeXLX(const CDMRData& data, bool burst);
+};
+
+#endif
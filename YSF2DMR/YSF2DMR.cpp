@@ -19,6 +19,10 @@
 */
 
 #include "YSF2DMR.h"
+#include "CPUDispatch.h"
+#include "RealTime.h"
+#include "Resolver.h"
+#include "Startup.h"
 
 #if defined(_WIN32) || defined(_WIN64)
 #include <Windows.h>
@@ -28,17 +32,18 @@
 #include <signal.h>
 #include <fcntl.h>
 #include <pwd.h>
+#include <climits>
+#include <cstdlib>
 #endif
 
-// DT1 and DT2, suggested by Manuel EA7EE
-const unsigned char dt1_temp[] = {0x31, 0x22, 0x62, 0x5F, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00};
-const unsigned char dt2_temp[] = {0x00, 0x00, 0x00, 0x00, 0x6C, 0x20, 0x1C, 0x20, 0x03, 0x08};
-
-#define DMR_FRAME_PER       55U
-#define YSF_FRAME_PER       90U
+#define NXDNGW_DSTID_DEF    20U
 
-#define XLX_SLOT            2U
-#define XLX_COLOR_CODE      3U
+// The stages of the startup still to be logged
+const unsigned int STARTUP_LOGIN    = 0x01U;
+const unsigned int STARTUP_DMR_IDS  = 0x02U;
+const unsigned int STARTUP_NXDN_IDS = 0x04U;
+const unsigned int STARTUP_TG_LIST  = 0x08U;
+const unsigned int STARTUP_XLX      = 0x10U;
 
 #if defined(_WIN32) || defined(_WIN64)
 const char* DEFAULT_INI_FILE = "YSF2DMR.ini";
@@ -60,6 +65,7 @@ const char* HEADER4 = "Copyright(C) 2018,2019 by CA6JAU, EA7EE, G4KLX and others
 #include <cctype>
 
 int end = 0;
+int reload = 0;
 
 #if !defined(_WIN32) && !defined(_WIN64)
 void sig_handler(int signo)
@@ -67,6 +73,8 @@ void sig_handler(int signo)
 	if (signo == SIGTERM) {
 		end = 1;
 		::fprintf(stdout, "Received SIGTERM\n");
+	} else if (signo == SIGHUP) {
+		reload = 1;
 	}
 }
 #endif
@@ -93,6 +101,15 @@ int main(int argc, char** argv)
 	// Capture SIGTERM to finish gracelessly
 	if (signal(SIGTERM, sig_handler) == SIG_ERR) 
 		::fprintf(stdout, "Can't catch SIGTERM\n");
+
+	// Capture SIGHUP to read the configuration again
+	if (signal(SIGHUP, sig_handler) == SIG_ERR)
+		::fprintf(stdout, "Can't catch SIGHUP\n");
+
+	// The daemon changes to the root directory, a reload still has to find the file
+	char path[PATH_MAX];
+	if (::realpath(iniFile, path) != NULL)
+		iniFile = path;
 #endif
 
 	CYSF2DMR* gateway = new CYSF2DMR(std::string(iniFile));
@@ -108,60 +125,54 @@ CYSF2DMR::CYSF2DMR(const std::string& configFile) :
 m_callsign(),
 m_suffix(),
 m_conf(configFile),
-m_wiresX(NULL),
-m_dmrNetwork(NULL),
-m_ysfNetwork(NULL),
+m_reader(NULL),
+m_dmrCount(0U),
+m_sessionCount(0U),
+m_workerCount(0U),
 m_lookup(NULL),
-m_conv(),
+m_nxdnNetwork(NULL),
+m_nxdnLookup(NULL),
 m_colorcode(1U),
 m_srcHS(1U),
-m_srcid(1U),
 m_defsrcid(1U),
 m_dstid(1U),
-m_ptt_dstid(1U),
-m_ptt_pc(false),
+m_nxdnTG(20U),
+m_nxdnDefaultID(65519U),
 m_dmrpc(false),
-m_netSrc(),
-m_netDst(),
-m_ysfSrc(),
-m_dmrLastDT(0U),
-m_ysfFrame(NULL),
-m_dmrFrame(NULL),
 m_gps(NULL),
-m_dtmf(NULL),
 m_APRS(NULL),
-m_dmrFrames(0U),
-m_ysfFrames(0U),
-m_EmbeddedLC(),
 m_TGList(),
-m_dmrflco(FLCO_GROUP),
-m_dmrinfo(false),
-m_idUnlink(4000U),
-m_flcoUnlink(FLCO_GROUP),
+m_tgList(NULL),
 m_enableWiresX(false),
 m_xlxmodule(),
-m_xlxConnected(false),
 m_xlxReflectors(NULL),
 m_xlxrefl(0U),
 m_remoteGateway(false),
-m_hangTime(1000U),
-m_firstSync(false)
+m_dmrAddress(),
+m_reportTimer(1000U),
+m_sessionConf(),
+m_sessionSettings(),
+m_startup(0U)
 {
-	m_ysfFrame = new unsigned char[200U];
-	m_dmrFrame = new unsigned char[50U];
-
-	::memset(m_ysfFrame, 0U, 200U);
-	::memset(m_dmrFrame, 0U, 50U);
+	for (unsigned int i = 0U; i < SESSION_POOL_SIZE; i++) {
+		m_dmrNetworks[i] = NULL;
+		m_dmrIds[i]      = 0U;
+		m_dmrDuplex[i]   = false;
+		m_sessions[i]    = NULL;
+		m_ysfNetworks[i] = NULL;
+		m_sessionLogins[i] = 0U;
+		m_workers[i]     = NULL;
+	}
 }
 
 CYSF2DMR::~CYSF2DMR()
 {
-	delete[] m_ysfFrame;
-	delete[] m_dmrFrame;
 }
 
 int CYSF2DMR::run()
 {
+	CStartup::start();
+
 	bool ret = m_conf.read();
 	if (!ret) {
 		::fprintf(stderr, "YSF2DMR: cannot read the .ini file\n");
@@ -199,7 +210,14 @@ int CYSF2DMR::run()
 			::fprintf(stderr, "Couldn't cd /, exiting\n");
 			return -1;
 		}
+	}
+
+	// Locking the memory and raising the real-time limits need root, so they come before it is given up
+	unsigned int realTime = m_conf.getCPURealTime();
+	CRealTime::prepare(realTime);
 
+	// Only a daemon gives up root, once the limits above have been raised
+	if (m_daemon) {
 		// If we are currently root...
 		if (getuid() == 0) {
 			struct passwd* user = ::getpwnam("mmdvm");
@@ -250,866 +268,216 @@ int CYSF2DMR::run()
 	LogInfo(HEADER3);
 	LogInfo(HEADER4);
 
+	CCPUDispatch::init(m_conf.getCPUKernels());
+	CUDPSocket::setSharedMemory(m_conf.getCPUSharedMemory());
+	CUDPSocket::setSharedMemoryUser(m_conf.getCPUSharedMemoryUser());
+
+	// The networks below only queue their host names, nothing waits on DNS from here on
+	CResolver::start();
+
 	m_callsign = m_conf.getCallsign();
 	m_suffix   = m_conf.getSuffix();
 
 	m_remoteGateway = m_conf.getRemoteGateway();
-	m_hangTime = m_conf.getHangTime();
+
+	// The tables load on their own threads while the networks come up, until then a lookup finds nothing
+	m_xlxReflectors = new CReflectors(m_conf.getDMRXLXFile(), 60U);
+	m_xlxReflectors->start();
+
+	m_lookup = new CDMRLookup(m_conf.getDMRIdLookupFile(), m_conf.getDMRIdLookupTime());
+	m_lookup->start();
+
+	// One TG list for the Wires-X of every session
+	if (m_conf.getEnableWiresX()) {
+		m_tgList = new CTGList(m_conf.getDMRTGListFile(), m_conf.getWiresXMakeUpper(), true, 60U);
+		m_tgList->start();
+	}
+
+	m_startup = STARTUP_LOGIN | STARTUP_DMR_IDS;
+	if (m_tgList != NULL)
+		m_startup |= STARTUP_TG_LIST;
+	if (!m_conf.getDMRXLXModule().empty())
+		m_startup |= STARTUP_XLX;
 
 	bool debug               = m_conf.getDMRNetworkDebug();
-	in_addr dstAddress       = CUDPSocket::lookup(m_conf.getDstAddress());
+	std::string dstAddress   = m_conf.getDstAddress();
 	unsigned int dstPort     = m_conf.getDstPort();
 	std::string localAddress = m_conf.getLocalAddress();
 	unsigned int localPort   = m_conf.getLocalPort();
 
-	std::string fileName    = m_conf.getDMRXLXFile();
-	m_xlxReflectors = new CReflectors(fileName, 60U);
-	m_xlxReflectors->load();
-
-	m_ysfNetwork = new CYSFNetwork(localAddress, localPort, m_callsign, debug);
-	m_ysfNetwork->setDestination(dstAddress, dstPort);
+	CYSFNetwork* ysfNetwork = new CYSFNetwork(localAddress, localPort, m_callsign, debug);
+	ysfNetwork->setDestination(dstAddress, dstPort);
 
 	LogInfo("General Parameters");
 	LogInfo("    Remote Gateway: %s", m_remoteGateway ? "yes" : "no");
-	LogInfo("    Hang Time: %u ms", m_hangTime);
+	LogInfo("    Hang Time: %u ms", m_conf.getHangTime());
 
-	ret = m_ysfNetwork->open();
+	ret = ysfNetwork->open();
 	if (!ret) {
 		::LogError("Cannot open the YSF network port");
 		::LogFinalise();
 		return 1;
 	}
 
+	m_ysfNetworks[0U] = ysfNetwork;
+
 	ret = createDMRNetwork();
 	if (!ret) {
 		::LogError("Cannot open DMR Network");
 		::LogFinalise();
 		return 1;
 	}
-	
-	std::string lookupFile  = m_conf.getDMRIdLookupFile();
-	unsigned int reloadTime = m_conf.getDMRIdLookupTime();
 
-	m_lookup = new CDMRLookup(lookupFile, reloadTime);
-	m_lookup->read();
-	m_dropUnknown = m_conf.getDMRDropUnknown();
+	if (m_conf.getNXDNNetworkEnabled()) {
+		ret = createNXDNNetwork();
+		if (!ret) {
+			::LogError("Cannot open the NXDN network port");
+			::LogFinalise();
+			return 1;
+		}
+	}
 
-	if (m_dmrpc)
-		m_dmrflco = FLCO_USER_USER;
-	else
-		m_dmrflco = FLCO_GROUP;
+	if (m_conf.getAPRSEnabled()) {
+		createGPS();
+		m_APRS = new CAPRSReader(m_conf.getAPRSAPIKey(), m_conf.getAPRSRefresh());
+	}
 
-	CTimer networkWatchdog(100U, 0U, 1500U);
-	CTimer pollTimer(1000U, 5U);
-	CTimer ysfWatchdog(1000U, 0U, 500U);
+	// Everything a reload may change for the sessions, published before any of them exists
+	m_sessionSettings.set(createSessionConfig(m_conf));
 
-	// CWiresX Control Object
-	if (m_enableWiresX) {
-		bool makeUpper = m_conf.getWiresXMakeUpper();
-		m_wiresX = new CWiresX(m_callsign, m_suffix, m_ysfNetwork, m_TGList, makeUpper);
-		m_dtmf = new CDTMF;
+	ret = createSessions(ysfNetwork);
+	if (!ret) {
+		::LogError("Cannot open the YSF network port of a session");
+		::LogFinalise();
+		return 1;
 	}
 
-	std::string name = m_conf.getDescription();
-	unsigned int rxFrequency = m_conf.getRxFrequency();
-	unsigned int txFrequency = m_conf.getTxFrequency();
-	int reflector = m_conf.getDMRDstId();
+	createWorkers();
 
-	if (m_wiresX != NULL)
-		m_wiresX->setInfo(name, txFrequency, rxFrequency, reflector);
+	// Without worker threads the main thread runs the only shard itself
+	bool threaded = m_conf.getSessionsWorkers() > 0U;
+	unsigned int idle = m_conf.getSessionsPipeline() ? 1U : 5U;
 
-	if (m_conf.getAPRSEnabled()) {
-		createGPS();
-		m_APRS = new CAPRSReader(m_conf.getAPRSAPIKey(), m_conf.getAPRSRefresh());
-	}
-	
-	CStopWatch TGChange;
 	CStopWatch stopWatch;
-	CStopWatch ysfWatch;
-	CStopWatch dmrWatch;
 	stopWatch.start();
-	ysfWatch.start();
-	dmrWatch.start();
-	pollTimer.start();
-	ysfWatchdog.stop();
 
-	unsigned char ysf_cnt = 0;
-	unsigned char dmr_cnt = 0;
+	// The counters of every session are logged at this interval, and at exit
+	m_reportTimer.start(m_conf.getSessionsReport());
 
-	LogMessage("Starting YSF2DMR-%s", VERSION);
+	// Link to reflector at startup (not NXDNGateway operation)
+	if (m_nxdnNetwork != NULL && m_nxdnTG != NXDNGW_DSTID_DEF) {
+		m_nxdnNetwork->writePoll(m_nxdnTG);
+		m_nxdnNetwork->writePoll(m_nxdnTG);
+		m_nxdnNetwork->writePoll(m_nxdnTG);
+	}
 
-	bool enableUnlink = m_conf.getDMRNetworkEnableUnlink();
-	bool unlinkReceived = false;
+	LogMessage("Starting YSF2DMR-%s", VERSION);
+	CStartup::reached("bridging");
 
-	TG_STATUS TG_connect_state = NONE;
-	unsigned char gps_buffer[20U];
+	for (unsigned int i = 0U; i < m_workerCount; i++)
+		m_workers[i]->startPipeline();
 
-	unsigned int tglistOpt = 0; 
+	if (threaded) {
+		for (unsigned int i = 0U; i < m_workerCount; i++)
+			m_workers[i]->run();
+	} else {
+		CRealTime::enter("main");
+	}
 
 	for (; end == 0;) {
-		unsigned char buffer[2000U];
+		unsigned int ms = 0U;
+
+		if (threaded) {
+			CThread::sleep(10U);
+			ms = stopWatch.elapsed();
+			stopWatch.start();
+		} else {
+			ms = m_workers[0U]->process();
+		}
 
-		CDMRData tx_dmrdata;
-		unsigned int ms = stopWatch.elapsed();
+		if (m_startup != 0U)
+			startup();
 
-		if (m_dmrNetwork->isConnected() && !m_xlxmodule.empty() && !m_xlxConnected) {
-			writeXLXLink(m_srcid, m_dstid, m_dmrNetwork);
-			LogMessage("XLX, Linking to reflector XLX%03u, module %s", m_xlxrefl, m_xlxmodule.c_str());
-			m_xlxConnected = true;
-		}
-		else if (!m_dmrNetwork->isConnected() && !m_xlxmodule.empty() && m_xlxConnected) {
-			LogMessage("XLX, Disconnected from reflector XLX%03u, module %s", m_xlxrefl, m_xlxmodule.c_str());
-			m_xlxConnected = false;
+		m_reportTimer.clock(ms);
+		if (m_reportTimer.isRunning() && m_reportTimer.hasExpired()) {
+			for (unsigned int i = 0U; i < m_workerCount; i++)
+				m_workers[i]->post(WC_REPORT);
+			m_reportTimer.start();
 		}
 
-		if (m_wiresX != NULL) {
-			switch (TG_connect_state) {
-				case WAITING_UNLINK:
-					if (unlinkReceived) {
-						//LogMessage("Unlink Received");
-						TGChange.start();
-						TG_connect_state = SEND_REPLY;
-						unlinkReceived = false;
-					}
-					break;
-				case SEND_REPLY:
-					if (TGChange.elapsed() > 600) {
-						TGChange.start();
-						TG_connect_state = SEND_PTT;
-						m_wiresX->sendConnectReply(m_dstid);
-					}
-					break;
-				case SEND_PTT:
-					if (TGChange.elapsed() > 600) {
-						TGChange.start();
-						TG_connect_state = NONE;
-						if (m_ptt_dstid) {
-							LogMessage("Sending PTT: Src: %s Dst: %s%d", m_ysfSrc.c_str(), m_ptt_pc ? "" : "TG ", m_ptt_dstid);
-							SendDummyDMR(m_srcid, m_ptt_dstid, m_ptt_pc ? FLCO_USER_USER : FLCO_GROUP);
-						}
-					}
-					break;
-				default: 
-					break;
-			}
-
-			if ((TG_connect_state != NONE) && (TGChange.elapsed() > 12000)) {
-				LogMessage("Timeout changing TG");
-				TG_connect_state = NONE;
-			}
+		// The file is parsed on a thread of its own, only the changes are applied here
+		if (reload != 0 && m_reader == NULL) {
+			reload = 0;
+			LogMessage("Reading %s again", m_conf.getFile().c_str());
+			m_reader = new CConfReader(m_conf.getFile());
+			m_reader->run();
 		}
 
-		while (m_ysfNetwork->read(buffer) > 0U) {
-			CYSFFICH fich;
-			bool valid = fich.decode(buffer + 35U);
-
-			if (valid) {
-				unsigned char fi = fich.getFI();
-				unsigned char dt = fich.getDT();
-				unsigned char fn = fich.getFN();
-				unsigned char ft = fich.getFT();
-				
-				if (m_wiresX != NULL) {
-					WX_STATUS status = m_wiresX->process(buffer + 35U, buffer + 14U, fi, dt, fn, ft);
-					m_ysfSrc = getSrcYSF(buffer);
-
-					switch (status) {
-						case WXS_CONNECT:
-							m_srcid = findYSFID(m_ysfSrc, false);
-
-							m_ptt_dstid = m_wiresX->getDstID();
-							tglistOpt = m_wiresX->getOpt(m_ptt_dstid);
-
-							switch (tglistOpt) {
-								case 0:
-									m_ptt_pc = false;
-									m_dstid = m_wiresX->getFullDstID();
-									m_ptt_dstid = m_dstid;
-									m_dmrflco = FLCO_GROUP;
-									LogMessage("Connect to TG %d has been requested by %s", m_dstid, m_ysfSrc.c_str());
-									break;
-							
-								case 1:
-									m_ptt_pc = true;
-									m_dstid = 9U;
-									m_dmrflco = FLCO_GROUP;
-									LogMessage("Connect to REF %d has been requested by %s", m_ptt_dstid, m_ysfSrc.c_str());
-									break;
-								
-								case 2:
-									m_ptt_dstid = 0;
-									m_ptt_pc = true;
-									m_dstid = m_wiresX->getFullDstID();
-									m_dmrflco = FLCO_USER_USER;
-									LogMessage("Connect to %d has been requested by %s", m_dstid, m_ysfSrc.c_str());
-									break;
-							
-								default:
-									m_ptt_pc = false;
-									m_dstid = m_wiresX->getFullDstID();
-									m_ptt_dstid = m_dstid;
-									m_dmrflco = FLCO_GROUP;
-									LogMessage("Connect to TG %d has been requested by %s", m_dstid, m_ysfSrc.c_str());
-									break;
-							}
-
-							if (enableUnlink && (tglistOpt != 2) && (m_ptt_dstid != m_idUnlink) && (m_ptt_dstid != 5000)) {
-								LogMessage("Sending DMR Disconnect: Src: %s Dst: %s%d", m_ysfSrc.c_str(), m_flcoUnlink == FLCO_GROUP ? "TG " : "", m_idUnlink);
-
-								SendDummyDMR(m_srcid, m_idUnlink, m_flcoUnlink);
-
-								unlinkReceived = false;
-								TG_connect_state = WAITING_UNLINK;
-							} else 
-								TG_connect_state = SEND_REPLY;
-
-							TGChange.start();
-							break;
-
-						case WXS_DX:
-							break;
-
-						case WXS_DISCONNECT:
-							LogMessage("Disconnect has been requested by %s", m_ysfSrc.c_str());
-
-							m_srcid = findYSFID(m_ysfSrc, false);
-							m_ptt_dstid = 9U;
-							m_ptt_pc = false;
-							m_dstid = 9U;
-							m_dmrflco = FLCO_GROUP;
-
-							SendDummyDMR(m_srcid, m_idUnlink, m_flcoUnlink);
-
-							TG_connect_state = WAITING_UNLINK;
-
-							TGChange.start();
-							break;
-
-						default:
-							break;
-					}
-
-					status = WXS_NONE;
-
-					if (dt == YSF_DT_VD_MODE2)
-						status = m_dtmf->decodeVDMode2(buffer + 35U, (buffer[34U] & 0x01U) == 0x01U);
-
-					switch (status) {
-						case WXS_CONNECT:
-							m_srcid = findYSFID(m_ysfSrc, false);
-
-							m_ptt_dstid = m_dtmf->getDstID();
-							tglistOpt = m_wiresX->getOpt(m_ptt_dstid);
-
-							switch (tglistOpt) {
-								case 0:
-									m_ptt_pc = false;
-									m_dstid = m_wiresX->getFullDstID();
-									m_ptt_dstid = m_dstid;
-									m_dmrflco = FLCO_GROUP;
-									LogMessage("Connect to TG %d has been requested by %s", m_dstid, m_ysfSrc.c_str());
-									break;
-							
-								case 1:
-									m_ptt_pc = true;
-									m_dstid = 9U;
-									m_dmrflco = FLCO_GROUP;
-									LogMessage("Connect to REF %d has been requested by %s", m_ptt_dstid, m_ysfSrc.c_str());
-									break;
-								
-								case 2:
-									m_ptt_dstid = 0;
-									m_ptt_pc = true;
-									m_dstid = m_wiresX->getFullDstID();
-									m_dmrflco = FLCO_USER_USER;
-									LogMessage("Connect to %d has been requested by %s", m_dstid, m_ysfSrc.c_str());
-									break;
-							
-								default:
-									m_ptt_pc = false;
-									m_dstid = m_wiresX->getFullDstID();
-									m_ptt_dstid = m_dstid;
-									m_dmrflco = FLCO_GROUP;
-									LogMessage("Connect to TG %d has been requested by %s", m_dstid, m_ysfSrc.c_str());
-									break;
-							}
-
-							LogMessage("Connect to %s%d via DTMF has been requested by %s", m_ptt_pc ? "" : "TG ", m_ptt_dstid, m_ysfSrc.c_str());
-
-							if (enableUnlink && (tglistOpt != 2) && (m_ptt_dstid != m_idUnlink) && (m_ptt_dstid != 5000)) {
-								LogMessage("Sending DMR Disconnect: Src: %s Dst: %s%d", m_ysfSrc.c_str(), m_flcoUnlink == FLCO_GROUP ? "TG " : "", m_idUnlink);
-
-								SendDummyDMR(m_srcid, m_idUnlink, m_flcoUnlink);
-							
-								unlinkReceived = false;
-								TG_connect_state = WAITING_UNLINK;
-							} else
-								TG_connect_state = SEND_REPLY;
-
-							TGChange.start();
-							break;
-
-						case WXS_DISCONNECT:
-							LogMessage("Disconnect via DTMF has been requested by %s", m_ysfSrc.c_str());
-
-							m_srcid = findYSFID(m_ysfSrc, false);
-							m_ptt_dstid = 9U;
-							m_ptt_pc = false;
-							m_dstid = 9U;
-							m_dmrflco = FLCO_GROUP;
-
-							SendDummyDMR(m_srcid, m_idUnlink, m_flcoUnlink);
-
-							TG_connect_state = WAITING_UNLINK;
-							TGChange.start();
-							break;
-
-						default:
-							break;
-					}
-				}
-
-				if ((::memcmp(buffer, "YSFD", 4U) == 0U) && (dt == YSF_DT_VD_MODE2)) {
-					CYSFPayload ysfPayload;
-
-					if (fi == YSF_FI_HEADER) {
-						if (ysfPayload.processHeaderData(buffer + 35U)) {
-							ysfWatchdog.start();
-							std::string ysfSrc = ysfPayload.getSource();
-							std::string ysfDst = ysfPayload.getDest();
-							LogMessage("Received YSF Header: Src: %s Dst: %s", ysfSrc.c_str(), ysfDst.c_str());
-							
-							m_dmrNetwork->reset(2U);	// OE1KBC fix
-							
-							m_srcid = findYSFID(ysfSrc, true);
-							if (m_dropUnknown == 0 || m_srcid != 0) {
-								ysfWatchdog.start();
-								m_dmrNetwork->reset(2U);	// OE1KBC fix
-								 m_conv.putYSFHeader();
-								m_ysfFrames = 0U;
-							}
-							else
-							{
-								LogMessage("Dropped source without DMR ID: %s", ysfSrc.c_str());
-							}
-						}
-					} else if (fi == YSF_FI_TERMINATOR) {
-						if (m_dropUnknown == 0 || m_srcid != 0) {
-							ysfWatchdog.stop();
-							int extraFrames = (m_hangTime / 100U) - m_ysfFrames - 2U;
-							for (int i = 0U; i < extraFrames; i++)
-								m_conv.putDummyYSF();
-							LogMessage("YSF received end of voice transmission, %.1f seconds", float(m_ysfFrames) / 10.0F);
-							m_conv.putYSFEOT();
-							m_ysfFrames = 0U;
-						}
-					} else if (fi == YSF_FI_COMMUNICATIONS) {
-						if (m_dropUnknown == 0 || m_srcid != 0) {
-							ysfWatchdog.start();
-							m_conv.putYSF(buffer + 35U);
-							m_ysfFrames++;
-						}
-					}
-				}
-
-				if (m_gps != NULL)
-					m_gps->data(buffer + 14U, buffer + 35U, fi, dt, fn, ft, m_dstid);
-				
-			}
+		if (m_reader != NULL && m_reader->isDone()) {
+			m_reader->wait();
 
-			if ((buffer[34U] & 0x01U) == 0x01U) {
-				if (m_gps != NULL)
-					m_gps->reset();
-				if (m_dtmf != NULL)
-					m_dtmf->reset();
-			}
-		}
+			if (m_reader->isValid())
+				reconfigure(m_reader->getConf());
+			else
+				LogWarning("Cannot read %s, keeping the running configuration", m_conf.getFile().c_str());
 
-		if (dmrWatch.elapsed() > DMR_FRAME_PER) {
-			unsigned int dmrFrameType = m_conv.getDMR(m_dmrFrame);
-
-			if(dmrFrameType == TAG_HEADER) {
-				CDMRData rx_dmrdata;
-				dmr_cnt = 0U;
-
-				rx_dmrdata.setSlotNo(2U);
-				rx_dmrdata.setSrcId(m_srcid);
-				rx_dmrdata.setDstId(m_dstid);
-				rx_dmrdata.setFLCO(m_dmrflco);
-				rx_dmrdata.setN(0U);
-				rx_dmrdata.setSeqNo(0U);
-				rx_dmrdata.setBER(0U);
-				rx_dmrdata.setRSSI(0U);
-				rx_dmrdata.setDataType(DT_VOICE_LC_HEADER);
-
-				// Add sync
-				CSync::addDMRDataSync(m_dmrFrame, 0);
-
-				// Add SlotType
-				CDMRSlotType slotType;
-				slotType.setColorCode(m_colorcode);
-				slotType.setDataType(DT_VOICE_LC_HEADER);
-				slotType.getData(m_dmrFrame);
-	
-				// Full LC
-				CDMRLC dmrLC = CDMRLC(m_dmrflco, m_srcid, m_dstid);
-				CDMRFullLC fullLC;
-				fullLC.encode(dmrLC, m_dmrFrame, DT_VOICE_LC_HEADER);
-				m_EmbeddedLC.setLC(dmrLC);
-				
-				rx_dmrdata.setData(m_dmrFrame);
-				//CUtils::dump(1U, "DMR data:", m_dmrFrame, 33U);
-
-				for (unsigned int i = 0U; i < 3U; i++) {
-					rx_dmrdata.setSeqNo(dmr_cnt);
-					m_dmrNetwork->write(rx_dmrdata);
-					dmr_cnt++;
-				}
-
-				dmrWatch.start();
-			}
-			else if(dmrFrameType == TAG_EOT) {
-				CDMRData rx_dmrdata;
-				unsigned int n_dmr = (dmr_cnt - 3U) % 6U;
-				unsigned int fill = (6U - n_dmr);
-				
-				if (n_dmr) {
-					for (unsigned int i = 0U; i < fill; i++) {
-
-						CDMREMB emb;
-						CDMRData rx_dmrdata;
-
-						rx_dmrdata.setSlotNo(2U);
-						rx_dmrdata.setSrcId(m_srcid);
-						rx_dmrdata.setDstId(m_dstid);
-						rx_dmrdata.setFLCO(m_dmrflco);
-						rx_dmrdata.setN(n_dmr);
-						rx_dmrdata.setSeqNo(dmr_cnt);
-						rx_dmrdata.setBER(0U);
-						rx_dmrdata.setRSSI(0U);
-						rx_dmrdata.setDataType(DT_VOICE);
-
-						::memcpy(m_dmrFrame, DMR_SILENCE_DATA, DMR_FRAME_LENGTH_BYTES);
-
-						// Generate the Embedded LC
-						unsigned char lcss = m_EmbeddedLC.getData(m_dmrFrame, n_dmr);
-
-						// Generate the EMB
-						emb.setColorCode(m_colorcode);
-						emb.setLCSS(lcss);
-						emb.getData(m_dmrFrame);
-
-						rx_dmrdata.setData(m_dmrFrame);
-				
-						//CUtils::dump(1U, "DMR data:", m_dmrFrame, 33U);
-						m_dmrNetwork->write(rx_dmrdata);
-
-						n_dmr++;
-						dmr_cnt++;
-					}
-				}
-
-				rx_dmrdata.setSlotNo(2U);
-				rx_dmrdata.setSrcId(m_srcid);
-				rx_dmrdata.setDstId(m_dstid);
-				rx_dmrdata.setFLCO(m_dmrflco);
-				rx_dmrdata.setN(n_dmr);
-				rx_dmrdata.setSeqNo(dmr_cnt);
-				rx_dmrdata.setBER(0U);
-				rx_dmrdata.setRSSI(0U);
-				rx_dmrdata.setDataType(DT_TERMINATOR_WITH_LC);
-
-				// Add sync
-				CSync::addDMRDataSync(m_dmrFrame, 0);
-
-				// Add SlotType
-				CDMRSlotType slotType;
-				slotType.setColorCode(m_colorcode);
-				slotType.setDataType(DT_TERMINATOR_WITH_LC);
-				slotType.getData(m_dmrFrame);
-	
-				// Full LC
-				CDMRLC dmrLC = CDMRLC(m_dmrflco, m_srcid, m_dstid);
-				CDMRFullLC fullLC;
-				fullLC.encode(dmrLC, m_dmrFrame, DT_TERMINATOR_WITH_LC);
-				
-				rx_dmrdata.setData(m_dmrFrame);
-				//CUtils::dump(1U, "DMR data:", m_dmrFrame, 33U);
-				m_dmrNetwork->write(rx_dmrdata);
-
-				dmrWatch.start();
-			}
-			else if(dmrFrameType == TAG_DATA) {
-				CDMREMB emb;
-				CDMRData rx_dmrdata;
-				unsigned int n_dmr = (dmr_cnt - 3U) % 6U;
-
-				rx_dmrdata.setSlotNo(2U);
-				rx_dmrdata.setSrcId(m_srcid);
-				rx_dmrdata.setDstId(m_dstid);
-				rx_dmrdata.setFLCO(m_dmrflco);
-				rx_dmrdata.setN(n_dmr);
-				rx_dmrdata.setSeqNo(dmr_cnt);
-				rx_dmrdata.setBER(0U);
-				rx_dmrdata.setRSSI(0U);
-			
-				if (!n_dmr) {
-					rx_dmrdata.setDataType(DT_VOICE_SYNC);
-					// Add sync
-					CSync::addDMRAudioSync(m_dmrFrame, 0U);
-					// Prepare Full LC data
-					CDMRLC dmrLC = CDMRLC(m_dmrflco, m_srcid, m_dstid);
-					// Configure the Embedded LC
-					m_EmbeddedLC.setLC(dmrLC);
-				}
-				else {
-					rx_dmrdata.setDataType(DT_VOICE);
-					// Generate the Embedded LC
-					unsigned char lcss = m_EmbeddedLC.getData(m_dmrFrame, n_dmr);
-					// Generate the EMB
-					emb.setColorCode(m_colorcode);
-					emb.setLCSS(lcss);
-					emb.getData(m_dmrFrame);
-				}
-
-				rx_dmrdata.setData(m_dmrFrame);
-				
-				//CUtils::dump(1U, "DMR data:", m_dmrFrame, 33U);
-				m_dmrNetwork->write(rx_dmrdata);
-
-				dmr_cnt++;
-				dmrWatch.start();
-			}
+			delete m_reader;
+			m_reader = NULL;
 		}
 
-		while (m_dmrNetwork->read(tx_dmrdata) > 0U) {
-			unsigned int SrcId = tx_dmrdata.getSrcId();
-			unsigned int DstId = tx_dmrdata.getDstId();
-			
-			FLCO netflco = tx_dmrdata.getFLCO();
-			unsigned char DataType = tx_dmrdata.getDataType();
-
-			if (!tx_dmrdata.isMissing()) {
-				networkWatchdog.start();
-
-				if(DataType == DT_TERMINATOR_WITH_LC) {
-					if (m_dmrFrames == 0U) {
-						m_dmrNetwork->reset(2U);
-						networkWatchdog.stop();
-						m_dmrinfo = false;
-						m_firstSync = false;
-						break;
-					}
-
-					LogMessage("DMR received end of voice transmission, %.1f seconds", float(m_dmrFrames) / 16.667F);
-
-					if (SrcId == 4000)
-						unlinkReceived = true;
-
-					m_conv.putDMREOT();
-					m_dmrNetwork->reset(2U);
-					networkWatchdog.stop();
-					m_dmrFrames = 0U;
-					m_dmrinfo = false;
-					m_firstSync = false;
-				}
-
-				if((DataType == DT_VOICE_LC_HEADER) && (DataType != m_dmrLastDT)) {
-					
-					// DT1 & DT2 without GPS info
-					::memcpy(gps_buffer, dt1_temp, 10U);
-					::memcpy(gps_buffer + 10U, dt2_temp, 10U);
-
-					if (SrcId == 9990U)
-						m_netSrc = "PARROT";
-					else if (SrcId == 9U)
-						m_netSrc = "LOCAL";
-					else if (SrcId == 4000U)
-						m_netSrc = "UNLINK";
-					else
-						m_netSrc = m_lookup->findCS(SrcId);
-
-					m_netDst = (netflco == FLCO_GROUP ? "TG " : "") + m_lookup->findCS(DstId);
-
-					m_conv.putDMRHeader();
-					LogMessage("DMR audio received from %s to %s", m_netSrc.c_str(), m_netDst.c_str());
-
-					m_dmrinfo = true;
-
-					if (m_lookup->exists(SrcId) && (m_APRS != NULL)) {
-						int lat, lon, resp;
-						resp = m_APRS->findCall(m_netSrc, &lat, &lon);
-
-						//LogMessage("Searching GPS Position of %s in aprs.fi", m_netSrc.c_str());
-
-						if (resp) {
-							LogMessage("GPS Position of %s Lat: %0.3f, Lon: %0.3f", m_netSrc.c_str(), (float)lat / 1000.0, (float)lon / 1000.0);
-							m_APRS->formatGPS(gps_buffer, lat, lon);
-						}
-						// else
-						//	LogMessage("GPS Position not available");
-					}
-
-					m_netSrc.resize(YSF_CALLSIGN_LENGTH, ' ');
-					m_netDst.resize(YSF_CALLSIGN_LENGTH, ' ');
-					
-					m_dmrFrames = 0U;
-					m_firstSync = false;
-				}
-
-				if(DataType == DT_VOICE_SYNC)
-					m_firstSync = true;
-
-				if((DataType == DT_VOICE_SYNC || DataType == DT_VOICE) && m_firstSync) {
-					unsigned char dmr_frame[50];
-
-					tx_dmrdata.getData(dmr_frame);
-
-					if (!m_dmrinfo) {
-						if (SrcId == 9990U)
-							m_netSrc = "PARROT";
-						else if (SrcId == 9U)
-							m_netSrc = "LOCAL";
-						else if (SrcId == 4000U)
-							m_netSrc = "UNLINK";
-						else
-							m_netSrc = m_lookup->findCS(SrcId);
-
-						m_netDst = (netflco == FLCO_GROUP ? "TG " : "") + m_lookup->findCS(DstId);
-
-						LogMessage("DMR audio late entry received from %s to %s", m_netSrc.c_str(), m_netDst.c_str());
-
-						if (m_lookup->exists(SrcId) && (m_APRS != NULL)) {
-							int lat, lon, resp;
-							resp = m_APRS->findCall(m_netSrc, &lat, &lon);
-
-							//LogMessage("Searching GPS Position of %s in aprs.fi", m_netSrc.c_str());
-
-							if (resp) {
-								LogMessage("GPS Position of %s Lat: %0.3f, Lon: %0.3f", m_netSrc.c_str(), (float)lat / 1000.0, (float)lon / 1000.0);
-								m_APRS->formatGPS(gps_buffer, lat, lon);
-							}
-							// else
-							//	LogMessage("GPS Position not available");
-						}
-
-						m_netSrc.resize(YSF_CALLSIGN_LENGTH, ' ');
-						m_netDst.resize(YSF_CALLSIGN_LENGTH, ' ');
-
-						m_dmrinfo = true;
-					}
-
-					m_conv.putDMR(dmr_frame); // Add DMR frame for YSF conversion
-					m_dmrFrames++;
-				}
-			}
-			else {
-				if(DataType == DT_VOICE_SYNC || DataType == DT_VOICE) {
-					unsigned char dmr_frame[50];
-					tx_dmrdata.getData(dmr_frame);
-					m_conv.putDMR(dmr_frame); // Add DMR frame for YSF conversion
-					m_dmrFrames++;
-				}
-
-				networkWatchdog.clock(ms);
-				if (networkWatchdog.hasExpired()) {
-					LogDebug("Network watchdog has expired, %.1f seconds", float(m_dmrFrames) / 16.667F);
-					m_dmrNetwork->reset(2U);
-					networkWatchdog.stop();
-					m_dmrFrames = 0U;
-					m_dmrinfo = false;
-				}
-			}
-			
-			m_dmrLastDT = DataType;
-		}
-		
-		if (ysfWatch.elapsed() > YSF_FRAME_PER) {
-			unsigned int ysfFrameType = m_conv.getYSF(m_ysfFrame + 35U);
-
-			if(ysfFrameType == TAG_HEADER) {
-				ysf_cnt = 0U;
-
-				::memcpy(m_ysfFrame + 0U, "YSFD", 4U);
-				::memcpy(m_ysfFrame + 4U, m_ysfNetwork->getCallsign().c_str(), YSF_CALLSIGN_LENGTH);
-				::memcpy(m_ysfFrame + 14U, m_netSrc.c_str(), YSF_CALLSIGN_LENGTH);
-				::memcpy(m_ysfFrame + 24U, "ALL       ", YSF_CALLSIGN_LENGTH);
-				m_ysfFrame[34U] = 0U; // Net frame counter
-
-				CSync::addYSFSync(m_ysfFrame + 35U);
-
-				// Set the FICH
-				CYSFFICH fich;
-				fich.setFI(YSF_FI_HEADER);
-				fich.setCS(m_conf.getFICHCallSign());
- 				fich.setCM(m_conf.getFICHCallMode());
- 				fich.setBN(0U);
- 				fich.setBT(0U);
- 				fich.setFN(0U);
-				fich.setFT(m_conf.getFICHFrameTotal());
- 				fich.setDev(0U);
-				fich.setMR(m_conf.getFICHMessageRoute());
- 				fich.setVoIP(m_conf.getFICHVOIP());
- 				fich.setDT(m_conf.getFICHDataType());
- 				fich.setSQL(m_conf.getFICHSQLType());
- 				fich.setSQ(m_conf.getFICHSQLCode());
-				fich.encode(m_ysfFrame + 35U);
-
-				unsigned char csd1[20U], csd2[20U];
-				memset(csd1, '*', YSF_CALLSIGN_LENGTH/2);
- 				memcpy(csd1 + YSF_CALLSIGN_LENGTH/2, m_conf.getYsfRadioID(), YSF_CALLSIGN_LENGTH/2);
-				memcpy(csd1 + YSF_CALLSIGN_LENGTH, m_netSrc.c_str(), YSF_CALLSIGN_LENGTH);
-				memset(csd2, ' ', YSF_CALLSIGN_LENGTH + YSF_CALLSIGN_LENGTH);
-
-				CYSFPayload payload;
-				payload.writeHeader(m_ysfFrame + 35U, csd1, csd2);
-
-				m_ysfNetwork->write(m_ysfFrame);
-
-				ysf_cnt++;
-				ysfWatch.start();
-			}
-			else if (ysfFrameType == TAG_EOT) {
-				::memcpy(m_ysfFrame + 0U, "YSFD", 4U);
-				::memcpy(m_ysfFrame + 4U, m_ysfNetwork->getCallsign().c_str(), YSF_CALLSIGN_LENGTH);
-				::memcpy(m_ysfFrame + 14U, m_netSrc.c_str(), YSF_CALLSIGN_LENGTH);
-				::memcpy(m_ysfFrame + 24U, "ALL       ", YSF_CALLSIGN_LENGTH);
-				m_ysfFrame[34U] = ysf_cnt; // Net frame counter
-
-				CSync::addYSFSync(m_ysfFrame + 35U);
-
-				// Set the FICH
-				CYSFFICH fich;
-				fich.setFI(YSF_FI_TERMINATOR);
-				fich.setCS(m_conf.getFICHCallSign());
- 				fich.setCM(m_conf.getFICHCallMode());
- 				fich.setBN(0U);
- 				fich.setBT(0U);
- 				fich.setFN(0U);
-				fich.setFT(m_conf.getFICHFrameTotal());
- 				fich.setDev(0U);
-				fich.setMR(m_conf.getFICHMessageRoute());
- 				fich.setVoIP(m_conf.getFICHVOIP());
- 				fich.setDT(m_conf.getFICHDataType());
- 				fich.setSQL(m_conf.getFICHSQLType());
- 				fich.setSQ(m_conf.getFICHSQLCode());
-				fich.encode(m_ysfFrame + 35U);
-
-				unsigned char csd1[20U], csd2[20U];
-				memset(csd1, '*', YSF_CALLSIGN_LENGTH/2);
- 				memcpy(csd1 + YSF_CALLSIGN_LENGTH/2, m_conf.getYsfRadioID(), YSF_CALLSIGN_LENGTH/2);
-				memcpy(csd1 + YSF_CALLSIGN_LENGTH, m_netSrc.c_str(), YSF_CALLSIGN_LENGTH);
-				memset(csd2, ' ', YSF_CALLSIGN_LENGTH + YSF_CALLSIGN_LENGTH);
-
-				CYSFPayload payload;
-				payload.writeHeader(m_ysfFrame + 35U, csd1, csd2);
-
-				m_ysfNetwork->write(m_ysfFrame);
-			}
-			else if (ysfFrameType == TAG_DATA) {
-				CYSFFICH fich;
-				CYSFPayload ysfPayload;
-				unsigned char dch[10U];
-
-				unsigned int fn = (ysf_cnt - 1U) % (m_conf.getFICHFrameTotal() + 1);
-
-				::memcpy(m_ysfFrame + 0U, "YSFD", 4U);
-				::memcpy(m_ysfFrame + 4U, m_ysfNetwork->getCallsign().c_str(), YSF_CALLSIGN_LENGTH);
-				::memcpy(m_ysfFrame + 14U, m_netSrc.c_str(), YSF_CALLSIGN_LENGTH);
-				::memcpy(m_ysfFrame + 24U, "ALL       ", YSF_CALLSIGN_LENGTH);
-
-				// Add the YSF Sync
-				CSync::addYSFSync(m_ysfFrame + 35U);
-
-				switch (fn) {
-					case 0:
-						memset(dch, '*', YSF_CALLSIGN_LENGTH/2);
- 						memcpy(dch + YSF_CALLSIGN_LENGTH/2, m_conf.getYsfRadioID(), YSF_CALLSIGN_LENGTH/2);
- 						ysfPayload.writeVDMode2Data(m_ysfFrame + 35U, dch);
-						break;
-					case 1:
-						ysfPayload.writeVDMode2Data(m_ysfFrame + 35U, (const unsigned char*)m_netSrc.c_str());
-						break;
-					case 2:
-						ysfPayload.writeVDMode2Data(m_ysfFrame + 35U, (const unsigned char*)m_netDst.c_str());
-						break;
-					case 5:
-						memset(dch, ' ', YSF_CALLSIGN_LENGTH/2);
- 						memcpy(dch + YSF_CALLSIGN_LENGTH/2, m_conf.getYsfRadioID(), YSF_CALLSIGN_LENGTH/2);
- 						ysfPayload.writeVDMode2Data(m_ysfFrame + 35U, dch);	// Rem3/4
- 						break;
-					case 6:
-						ysfPayload.writeVDMode2Data(m_ysfFrame + 35U, m_conf.getYsfDT1());
-						break;
-					case 7:
-						ysfPayload.writeVDMode2Data(m_ysfFrame + 35U, m_conf.getYsfDT2());
-						break;
-					default:
-						ysfPayload.writeVDMode2Data(m_ysfFrame + 35U, (const unsigned char*)"          ");
-				}
-
-				// Set the FICH
-				fich.setFI(YSF_FI_COMMUNICATIONS);
-				fich.setCS(m_conf.getFICHCallSign());
- 				fich.setCM(m_conf.getFICHCallMode());
- 				fich.setBN(0U);
- 				fich.setBT(0U);
- 				fich.setFN(fn);
-				fich.setFT(m_conf.getFICHFrameTotal());
- 				fich.setDev(0U);
-				fich.setMR(m_conf.getFICHMessageRoute());
- 				fich.setVoIP(m_conf.getFICHVOIP());
- 				fich.setDT(m_conf.getFICHDataType());
- 				fich.setSQL(m_conf.getFICHSQLType());
- 				fich.setSQ(m_conf.getFICHSQLCode());
- 				fich.encode(m_ysfFrame + 35U);
-
-				// Net frame counter
-				m_ysfFrame[34U] = (ysf_cnt & 0x7FU) << 1;
-
-				// Send data to MMDVMHost
-				m_ysfNetwork->write(m_ysfFrame);
-
-				ysf_cnt++;
-				ysfWatch.start();
-			}
+		for (unsigned int i = 0U; i < m_workerCount; i++) {
+			CSessionReport report;
+			while (m_workers[i]->getReport(report))
+				CSession::report(report);
 		}
 
-		stopWatch.start();
+		if (!threaded && ms < idle)
+			CThread::sleep(idle);
+	}
 
-		m_ysfNetwork->clock(ms);
-		m_dmrNetwork->clock(ms);
+	if (m_reader != NULL) {
+		m_reader->wait();
+		delete m_reader;
+	}
 
-		if (m_wiresX != NULL)
-			m_wiresX->clock(ms);
+	if (threaded) {
+		for (unsigned int i = 0U; i < m_workerCount; i++)
+			m_workers[i]->post(WC_STOP);
 
-		if (m_gps != NULL)
-			m_gps->clock(ms);
+		for (unsigned int i = 0U; i < m_workerCount; i++)
+			m_workers[i]->wait();
+	}
 
-		pollTimer.clock(ms);
-		if (pollTimer.isRunning() && pollTimer.hasExpired()) {
-			m_ysfNetwork->writePoll();
-			pollTimer.start();
-		}
+	for (unsigned int i = 0U; i < m_workerCount; i++) {
+		m_workers[i]->stopPipeline();
+		m_workers[i]->getWatchdog().report();
+	}
 
-		ysfWatchdog.clock(ms);
-		if (ysfWatchdog.isRunning() && ysfWatchdog.hasExpired()) {
-			int extraFrames = (m_hangTime / 100U) - m_ysfFrames;
-			for (int i = 0U; i < extraFrames; i++)
-				m_conv.putDummyYSF();
-			ysfWatchdog.stop();
-		}
+	// Every thread has finished, the sessions can be read directly
+	for (unsigned int i = 0U; i < m_sessionCount; i++) {
+		CSessionReport report;
+		m_sessions[i]->getReport(report);
+		CSession::report(report);
+	}
+
+	for (unsigned int i = 0U; i < m_sessionCount; i++)
+		m_sessions[i]->close();
 
-		if (m_xlxReflectors != NULL)
-			m_xlxReflectors->clock(ms);
+	for (unsigned int i = 0U; i < m_dmrCount; i++)
+		m_dmrNetworks[i]->close();
 
-		if (ms < 5U)
-			CThread::sleep(5U);
+	if (m_nxdnNetwork != NULL) {
+		// Unlink reflector at exit (not NXDNGateway operation)
+		if (m_nxdnTG != NXDNGW_DSTID_DEF) {
+			m_nxdnNetwork->writeUnlink(m_nxdnTG);
+			m_nxdnNetwork->writeUnlink(m_nxdnTG);
+			m_nxdnNetwork->writeUnlink(m_nxdnTG);
+		}
+
+		m_nxdnNetwork->close();
+		delete m_nxdnNetwork;
 	}
 
-	m_ysfNetwork->close();
-	m_dmrNetwork->close();
-	
 	if (m_APRS != NULL) {
 		m_APRS->stop();
 		delete m_APRS;
@@ -1119,17 +487,37 @@ int CYSF2DMR::run()
 		m_gps->close();
 		delete m_gps;
 	}
-	
-	delete m_dmrNetwork;
-	delete m_ysfNetwork;
 
-	if (m_wiresX != NULL) {
-		delete m_wiresX;
-		delete m_dtmf;
+	for (unsigned int i = 0U; i < m_sessionCount; i++) {
+		delete m_sessions[i];
+		delete m_ysfNetworks[i];
 	}
 
-	if (m_xlxReflectors != NULL)
+	for (unsigned int i = 0U; i < m_dmrCount; i++)
+		delete m_dmrNetworks[i];
+
+	for (unsigned int i = 0U; i < m_workerCount; i++)
+		delete m_workers[i];
+
+	if (m_xlxReflectors != NULL) {
+		m_xlxReflectors->stop();
 		delete m_xlxReflectors;
+	}
+
+	if (m_tgList != NULL) {
+		m_tgList->stop();
+		delete m_tgList;
+	}
+
+	if (m_nxdnLookup != NULL) {
+		m_nxdnLookup->stop();
+		delete m_nxdnLookup;
+	}
+
+	m_lookup->stop();
+	delete m_lookup;
+
+	CResolver::stop();
 
 	::LogFinalise();
 
@@ -1172,125 +560,146 @@ void CYSF2DMR::createGPS()
 	}
 }
 
-void CYSF2DMR::SendDummyDMR(unsigned int srcid,unsigned int dstid, FLCO dmr_flco)
+bool CYSF2DMR::createNXDNNetwork()
 {
-	CDMRData dmrdata;
-	CDMRSlotType slotType;
-	CDMRFullLC fullLC;
-
-	int dmr_cnt = 0U;
-
-	// Generate DMR LC for header and TermLC frames
-	CDMRLC dmrLC = CDMRLC(dmr_flco, srcid, dstid);
-
-	// Build DMR header
-	dmrdata.setSlotNo(2U);
-	dmrdata.setSrcId(srcid);
-	dmrdata.setDstId(dstid);
-	dmrdata.setFLCO(dmr_flco);
-	dmrdata.setN(0U);
-	dmrdata.setSeqNo(0U);
-	dmrdata.setBER(0U);
-	dmrdata.setRSSI(0U);
-	dmrdata.setDataType(DT_VOICE_LC_HEADER);
-
-	// Add sync
-	CSync::addDMRDataSync(m_dmrFrame, 0);
-
-	// Add SlotType
-	slotType.setColorCode(m_colorcode);
-	slotType.setDataType(DT_VOICE_LC_HEADER);
-	slotType.getData(m_dmrFrame);
-
-	// Full LC
-	fullLC.encode(dmrLC, m_dmrFrame, DT_VOICE_LC_HEADER);
-
-	dmrdata.setData(m_dmrFrame);
-
-	// Send DMR header
-	for (unsigned int i = 0U; i < 3U; i++) {
-		dmrdata.setSeqNo(dmr_cnt);
-		m_dmrNetwork->write(dmrdata);
-		dmr_cnt++;
+	bool debug               = m_conf.getNXDNNetworkDebug();
+	std::string dstAddress   = m_conf.getNXDNDstAddress();
+	unsigned int dstPort     = m_conf.getNXDNDstPort();
+	std::string localAddress = m_conf.getNXDNLocalAddress();
+	unsigned int localPort   = m_conf.getNXDNLocalPort();
+
+	m_nxdnTG        = m_conf.getNXDNTG();
+	m_nxdnDefaultID = m_conf.getNXDNDefaultID();
+
+	LogInfo("NXDN Network Parameters");
+	LogInfo("    TG: %u", m_nxdnTG);
+	LogInfo("    Destination: %s:%u", m_conf.getNXDNDstAddress().c_str(), dstPort);
+	LogInfo("    Local: %s:%u", localAddress.c_str(), localPort);
+	LogInfo("    Default ID: %u", m_nxdnDefaultID);
+
+	m_nxdnNetwork = new CNXDNNetwork(localAddress, localPort, m_callsign, debug);
+	m_nxdnNetwork->setDestination(dstAddress, dstPort);
+
+	bool ret = m_nxdnNetwork->open();
+	if (!ret) {
+		delete m_nxdnNetwork;
+		m_nxdnNetwork = NULL;
+		return false;
 	}
 
-	// Build DMR TermLC
-	dmrdata.setSeqNo(dmr_cnt);
-	dmrdata.setDataType(DT_TERMINATOR_WITH_LC);
+	m_nxdnLookup = new CNXDNLookup(m_conf.getNXDNIdLookupFile(), m_conf.getNXDNIdLookupTime());
+	m_nxdnLookup->start();
+	m_startup |= STARTUP_NXDN_IDS;
+
+	return true;
+}
+
+bool CYSF2DMR::createSessions(CYSFNetwork* ysfNetwork)
+{
+	assert(ysfNetwork != NULL);
 
-	// Add sync
-	CSync::addDMRDataSync(m_dmrFrame, 0);
+	// The main session keeps every feature, the extra ones bridge voice and Wires-X only
+	m_sessions[0U] = createSession(0U, ysfNetwork, 0U, 2U, m_dstid, m_dmrpc);
+	m_sessions[0U]->setGPS(m_gps);
+	if (m_nxdnNetwork != NULL)
+		m_sessions[0U]->setNXDN(m_nxdnNetwork, m_nxdnLookup, m_nxdnTG, m_nxdnDefaultID);
+	m_sessionCount = 1U;
 
-	// Add SlotType
-	slotType.setColorCode(m_colorcode);
-	slotType.setDataType(DT_TERMINATOR_WITH_LC);
-	slotType.getData(m_dmrFrame);
+	bool debug               = m_conf.getDMRNetworkDebug();
+	std::string localAddress = m_conf.getLocalAddress();
 
-	// Full LC for TermLC frame
-	fullLC.encode(dmrLC, m_dmrFrame, DT_TERMINATOR_WITH_LC);
+	for (std::vector<CSessionStruct>::const_iterator it = m_sessionConf.begin(); it != m_sessionConf.end(); ++it) {
+		const CSessionStruct& conf = *it;
 
-	dmrdata.setData(m_dmrFrame);
+		LogInfo("Session %u Parameters", m_sessionCount);
+		LogInfo("    YSF Destination: %s:%u", conf.m_dstAddress.c_str(), conf.m_dstPort);
+		LogInfo("    YSF Local: %s:%u", localAddress.c_str(), conf.m_localPort);
+		LogInfo("    DMR ID: %u, Slot: %u", conf.m_dmrId, conf.m_slotNo);
+		LogInfo("    Startup DstID: %s%u", conf.m_pc ? "" : "TG ", conf.m_dstId);
 
-	// Send DMR TermLC
-	m_dmrNetwork->write(dmrdata);
+		CYSFNetwork* network = new CYSFNetwork(localAddress, conf.m_localPort, m_callsign, debug);
+		network->setDestination(conf.m_dstAddress, conf.m_dstPort);
+
+		bool ret = network->open();
+		if (!ret) {
+			delete network;
+			return false;
+		}
+
+		m_ysfNetworks[m_sessionCount] = network;
+		m_sessionLogins[m_sessionCount] = findLogin(conf.m_dmrId);
+		m_sessions[m_sessionCount] = createSession(m_sessionCount, network, m_sessionLogins[m_sessionCount], conf.m_slotNo, conf.m_dstId, conf.m_pc);
+		m_sessionCount++;
+	}
+
+	return true;
 }
 
-unsigned int CYSF2DMR::findYSFID(std::string cs, bool showdst)
+CSession* CYSF2DMR::createSession(unsigned int number, CYSFNetwork* ysfNetwork, unsigned int login, unsigned int slotNo, unsigned int dstId, bool pc)
 {
-	std::string cstrim;
-	bool dmrpc = false;
+	assert(login < m_dmrCount);
 
-	int first = cs.find_first_not_of(' ');
-	int mid1 = cs.find_last_of('-');
-	int mid2 = cs.find_last_of('/');
-	int last = cs.find_last_not_of(' ');
-	
-	if (mid1 == -1 && mid2 == -1 && first == -1 && last == -1)
-		cstrim = "N0CALL";
-	else if (mid1 == -1 && mid2 == -1)
-		cstrim = cs.substr(first, (last - first + 1));
-	else if (mid1 > first)
-		cstrim = cs.substr(first, (mid1 - first));
-	else if (mid2 > first)
-		cstrim = cs.substr(first, (mid2 - first));
-	else
-		cstrim = "N0CALL";
+	CSession* session = new CSession(number, m_conf, ysfNetwork, m_dmrNetworks[login], slotNo, dstId, pc);
 
-	unsigned int id = m_lookup->findID(cstrim);
+	session->setIds(m_colorcode, m_defsrcid);
+	session->setConfig(m_sessionSettings);
+	session->setLookups(m_lookup, m_APRS);
 
-	if (m_dmrflco == FLCO_USER_USER)
-		dmrpc = true;
-	else if (m_dmrflco == FLCO_GROUP)
-		dmrpc = false;
+	if (m_enableWiresX)
+		session->setWiresX(m_callsign, m_suffix, m_tgList);
 
-	if (id == 0) {
-		if (m_dropUnknown == 0) id = m_defsrcid;
-		if (showdst)
-			LogMessage("Not DMR ID found, using default ID: %u, DstID: %s%u", id, dmrpc ? "" : "TG ", m_dstid);
-		else
-			LogMessage("Not DMR ID found, using default ID: %u", id);
+	return session;
+}
+
+void CYSF2DMR::createWorkers()
+{
+	unsigned int workers = m_conf.getSessionsWorkers();
+	bool affinity        = m_conf.getSessionsAffinity();
+	bool pipeline        = m_conf.getSessionsPipeline();
+
+	// A login and its two slots are never split between threads
+	if (workers > m_dmrCount) {
+		LogMessage("Only %u DMR login(s) to share out, using %u worker(s) instead of %u", m_dmrCount, m_dmrCount, workers);
+		workers = m_dmrCount;
 	}
-	else {
-		if (showdst)
-			LogMessage("DMR ID of %s: %u, DstID: %s%u", cstrim.c_str(), id, dmrpc ? "" : "TG ", m_dstid);
-		else
-			LogMessage("DMR ID of %s: %u", cstrim.c_str(), id);
+
+	m_workerCount = workers > 0U ? workers : 1U;
+
+	unsigned int cpus = CThread::getCPUCount();
+
+	// With the pipeline on each worker takes three CPUs in a row, for its transcode, RX and TX threads
+	unsigned int stride = pipeline ? 3U : 1U;
+
+	for (unsigned int i = 0U; i < m_workerCount; i++) {
+		m_workers[i] = new CSessionWorker(i, (workers > 0U && affinity) ? int((i * stride) % cpus) : -1);
+
+		if (pipeline)
+			m_workers[i]->setPipeline(affinity ? int((i * stride + 1U) % cpus) : -1, affinity ? int((i * stride + 2U) % cpus) : -1);
 	}
 
-	return id;
+	for (unsigned int i = 0U; i < m_dmrCount; i++)
+		m_workers[i % m_workerCount]->addLogin(m_dmrNetworks[i]);
+
+	for (unsigned int i = 0U; i < m_sessionCount; i++)
+		m_workers[m_sessionLogins[i] % m_workerCount]->addSession(m_sessions[i]);
+
+	// The main session is on the first login, so always in the first shard
+	m_workers[0U]->setNXDN(m_nxdnNetwork, m_nxdnTG);
+	m_workers[0U]->setGPS(m_gps);
+	m_workers[0U]->setXLX(m_xlxrefl, m_xlxmodule);
+
+	if (workers > 0U)
+		LogMessage("Sharing %u session(s) on %u DMR login(s) out to %u worker thread(s)", m_sessionCount, m_dmrCount, m_workerCount);
 }
 
-std::string CYSF2DMR::getSrcYSF(const unsigned char* buffer)
+unsigned int CYSF2DMR::findLogin(unsigned int id)
 {
-	unsigned char temp[YSF_CALLSIGN_LENGTH + 1U];
+	for (unsigned int i = 0U; i < m_dmrCount; i++) {
+		if (m_dmrIds[i] == id)
+			return i;
+	}
 
-	::memcpy(temp, buffer + 14U, YSF_CALLSIGN_LENGTH);
-	temp[YSF_CALLSIGN_LENGTH] = 0U;
-	
-	std::string trimmed = reinterpret_cast<char const*>(temp);
-	trimmed.erase(std::find_if(trimmed.rbegin(), trimmed.rend(), std::not1(std::ptr_fun<int, int>(std::isspace))).base(), trimmed.end());
-	
-	return trimmed;
+	return m_dmrCount;
 }
 
 bool CYSF2DMR::createDMRNetwork()
@@ -1300,18 +709,12 @@ bool CYSF2DMR::createDMRNetwork()
 	m_xlxrefl            = m_conf.getDMRXLXReflector();
 	unsigned int port    = m_conf.getDMRNetworkPort();
 	unsigned int local   = m_conf.getDMRNetworkLocal();
-	std::string password = m_conf.getDMRNetworkPassword();
-	bool debug           = m_conf.getDMRNetworkDebug();
 	unsigned int jitter  = m_conf.getDMRNetworkJitter();
-	bool slot1           = false;
-	bool slot2           = true;
-	bool duplex          = false;
-	HW_TYPE hwType       = HWT_MMDVM;
 
 	m_srcHS = m_conf.getDMRId();
 	m_colorcode = 1U;
 	m_TGList = m_conf.getDMRTGListFile();
-	m_idUnlink = m_conf.getDMRNetworkIDUnlink();
+	unsigned int idUnlink = m_conf.getDMRNetworkIDUnlink();
 	bool pcUnlink = m_conf.getDMRNetworkPCUnlink();
 	m_enableWiresX = m_conf.getEnableWiresX();
 
@@ -1324,18 +727,17 @@ bool CYSF2DMR::createDMRNetwork()
 		m_dstid = 4000 + xlxmod[0] - 64;
 		m_dmrpc = 0;
 
-		CReflector* reflector = m_xlxReflectors->find(m_xlxrefl);
-		if (reflector == NULL)
+		// The only stage that has to wait for a table, the master is in it
+		while (!m_xlxReflectors->isLoaded())
+			CThread::sleep(10U);
+
+		CReflector reflector;
+		if (!m_xlxReflectors->find(m_xlxrefl, reflector))
 			return false;
 		
-		address = reflector->m_address;
+		address = reflector.m_address;
 	}
 
-	if (pcUnlink)
-		m_flcoUnlink = FLCO_USER_USER;
-	else
-		m_flcoUnlink = FLCO_GROUP;
-
 	if (m_srcHS > 99999999U)
 		m_defsrcid = m_srcHS / 100U;
 	else if (m_srcHS > 9999999U)
@@ -1343,7 +745,6 @@ bool CYSF2DMR::createDMRNetwork()
 	else
 		m_defsrcid = m_srcHS;
 
-	m_srcid = m_defsrcid;
 	bool enableUnlink = m_conf.getDMRNetworkEnableUnlink();
 	
 	LogMessage("DMR Network Parameters");
@@ -1358,7 +759,7 @@ bool CYSF2DMR::createDMRNetwork()
 		LogMessage("    Address: %s", address.c_str());
 	}
 	LogMessage("    Port: %u", port);
-	LogMessage("    Send %s%u Disconect: %s", pcUnlink ? "" : "TG ", m_idUnlink, (enableUnlink) ? "Yes":"No");
+	LogMessage("    Send %s%u Disconect: %s", pcUnlink ? "" : "TG ", idUnlink, (enableUnlink) ? "Yes":"No");
 	LogMessage("    TGList file: %s", m_TGList.c_str());
 	if (local > 0U)
 		LogMessage("    Local: %u", local);
@@ -1366,13 +767,9 @@ bool CYSF2DMR::createDMRNetwork()
 		LogMessage("    Local: random");
 	LogMessage("    Jitter: %ums", jitter);
 
-	m_dmrNetwork = new CDMRNetwork(address, port, local, m_srcHS, password, duplex, VERSION, debug, slot1, slot2, hwType, jitter);
-
 	std::string options = m_conf.getDMRNetworkOptions();
-	if (!options.empty()) {
+	if (!options.empty())
 		LogMessage("    Options: %s", options.c_str());
-		m_dmrNetwork->setOptions(options);
-	}
 
 	unsigned int rxFrequency = m_conf.getRxFrequency();
 	unsigned int txFrequency = m_conf.getTxFrequency();
@@ -1396,72 +793,306 @@ bool CYSF2DMR::createDMRNetwork()
 	LogMessage("    Description: \"%s\"", description.c_str());
 	LogMessage("    URL: \"%s\"", url.c_str());
 
-	m_dmrNetwork->setConfig(m_callsign, rxFrequency, txFrequency, power, m_colorcode, latitude, longitude, height, location, description, url);
+	// Plan the logins first, a login that carries a slot 1 session has to be duplex
+	m_dmrIds[0U]    = m_srcHS;
+	m_dmrDuplex[0U] = false;
+	m_dmrCount      = 1U;
 
-	bool ret = m_dmrNetwork->open();
-	if (!ret) {
-		delete m_dmrNetwork;
-		m_dmrNetwork = NULL;
-		return false;
+	std::vector<CSessionStruct> sessions = m_conf.getSessions();
+	if (!m_xlxmodule.empty() && !sessions.empty()) {
+		LogWarning("The extra sessions are not available in XLX mode, ignoring them");
+		sessions.clear();
+	}
+
+	for (std::vector<CSessionStruct>::iterator it = sessions.begin(); it != sessions.end(); ++it) {
+		CSessionStruct session = *it;
+
+		if (session.m_slotNo != 1U && session.m_slotNo != 2U) {
+			LogWarning("Session on port %u, invalid slot %u, ignoring it", session.m_localPort, session.m_slotNo);
+			continue;
+		}
+
+		if (m_sessionConf.size() + 1U >= SESSION_POOL_SIZE) {
+			LogWarning("Session on port %u, no room left in the pool of %u sessions, ignoring it", session.m_localPort, SESSION_POOL_SIZE);
+			continue;
+		}
+
+		if (session.m_dmrId == 0U)
+			session.m_dmrId = m_srcHS;
+
+		unsigned int login = findLogin(session.m_dmrId);
+
+		bool duplicate = login == 0U && session.m_slotNo == 2U;
+		for (std::vector<CSessionStruct>::const_iterator jt = m_sessionConf.begin(); jt != m_sessionConf.end(); ++jt) {
+			if (jt->m_dmrId == session.m_dmrId && jt->m_slotNo == session.m_slotNo)
+				duplicate = true;
+		}
+
+		if (duplicate) {
+			LogError("Session on port %u, slot %u of DMR ID %u is already bridged", session.m_localPort, session.m_slotNo, session.m_dmrId);
+			return false;
+		}
+
+		if (login == m_dmrCount) {
+			m_dmrIds[m_dmrCount]    = session.m_dmrId;
+			m_dmrDuplex[m_dmrCount] = false;
+			m_dmrCount++;
+		}
+
+		if (session.m_slotNo == 1U)
+			m_dmrDuplex[login] = true;
+
+		m_sessionConf.push_back(session);
 	}
 
-	m_dmrNetwork->enable(true);
+	m_dmrAddress = address;
+
+	m_dmrNetworks[0U] = openDMRNetwork(address, local, m_srcHS, m_dmrDuplex[0U]);
+	if (m_dmrNetworks[0U] == NULL)
+		return false;
+
+	// The extra logins always use a random local port
+	for (unsigned int i = 1U; i < m_dmrCount; i++) {
+		LogMessage("DMR login %u, ID: %u, %s", i, m_dmrIds[i], m_dmrDuplex[i] ? "both slots" : "slot 2");
+
+		m_dmrNetworks[i] = openDMRNetwork(address, 0U, m_dmrIds[i], m_dmrDuplex[i]);
+		if (m_dmrNetworks[i] == NULL)
+			return false;
+	}
 
 	return true;
 }
 
-void CYSF2DMR::writeXLXLink(unsigned int srcId, unsigned int dstId, CDMRNetwork* network)
+CDMRNetwork* CYSF2DMR::openDMRNetwork(const std::string& address, unsigned int local, unsigned int id, bool duplex)
 {
-	assert(network != NULL);
+	unsigned int port    = m_conf.getDMRNetworkPort();
+	std::string password = m_conf.getDMRNetworkPassword();
+	bool debug           = m_conf.getDMRNetworkDebug();
+	unsigned int jitter  = m_conf.getDMRNetworkJitter();
+	// Slot 1 is only carried by a duplex login
+	bool slot1           = duplex;
+	bool slot2           = true;
+	HW_TYPE hwType       = HWT_MMDVM;
+
+	CDMRNetwork* network = new CDMRNetwork(address, port, local, id, password, duplex, VERSION, debug, slot1, slot2, hwType, jitter);
+
+	std::string options = m_conf.getDMRNetworkOptions();
+	if (!options.empty())
+		network->setOptions(options);
+
+	unsigned int rxFrequency = m_conf.getRxFrequency();
+	unsigned int txFrequency = m_conf.getTxFrequency();
+	unsigned int power       = m_conf.getPower();
+	float latitude           = m_conf.getLatitude();
+	float longitude          = m_conf.getLongitude();
+	int height               = m_conf.getHeight();
+	std::string location     = m_conf.getLocation();
+	std::string description  = m_conf.getDescription();
+	std::string url          = m_conf.getURL();
 
-	unsigned int streamId = ::rand() + 1U;
+	network->setConfig(m_callsign, rxFrequency, txFrequency, power, m_colorcode, latitude, longitude, height, location, description, url);
 
-	CDMRData data;
+	bool ret = network->open();
+	if (!ret) {
+		delete network;
+		return NULL;
+	}
 
-	data.setSlotNo(XLX_SLOT);
-	data.setFLCO(FLCO_USER_USER);
-	data.setSrcId(srcId);
-	data.setDstId(dstId);
-	data.setDataType(DT_VOICE_LC_HEADER);
-	data.setN(0U);
-	data.setStreamId(streamId);
+	network->enable(true);
 
-	unsigned char buffer[DMR_FRAME_LENGTH_BYTES];
+	return network;
+}
 
-	CDMRLC lc;
-	lc.setSrcId(srcId);
-	lc.setDstId(dstId);
-	lc.setFLCO(FLCO_USER_USER);
+std::shared_ptr<const CSessionConfig> CYSF2DMR::createSessionConfig(CConf& conf) const
+{
+	std::shared_ptr<CSessionConfig> config(new CSessionConfig);
+
+	config->m_hangTime         = conf.getHangTime();
+	config->m_dropUnknown      = conf.getDMRDropUnknown();
+	config->m_enableUnlink     = conf.getDMRNetworkEnableUnlink();
+	config->m_idUnlink         = conf.getDMRNetworkIDUnlink();
+	config->m_flcoUnlink       = conf.getDMRNetworkPCUnlink() ? FLCO_USER_USER : FLCO_GROUP;
+	config->m_fichCallSign     = conf.getFICHCallSign();
+	config->m_fichCallMode     = conf.getFICHCallMode();
+	config->m_fichFrameTotal   = conf.getFICHFrameTotal();
+	config->m_fichMessageRoute = conf.getFICHMessageRoute();
+	config->m_fichVOIP         = conf.getFICHVOIP();
+	config->m_fichDataType     = conf.getFICHDataType();
+	config->m_fichSQLType      = conf.getFICHSQLType();
+	config->m_fichSQLCode      = conf.getFICHSQLCode();
+
+	::memcpy(config->m_ysfDT1, conf.getYsfDT1(), 10U);
+	::memcpy(config->m_ysfDT2, conf.getYsfDT2(), 10U);
+	::memcpy(config->m_ysfRadioID, conf.getYsfRadioID(), 5U);
+
+	return config;
+}
+
+static bool sameSessions(const std::vector<CSessionStruct>& a, const std::vector<CSessionStruct>& b)
+{
+	if (a.size() != b.size())
+		return false;
 
-	CDMRFullLC fullLC;
-	fullLC.encode(lc, buffer, DT_VOICE_LC_HEADER);
+	for (unsigned int i = 0U; i < a.size(); i++) {
+		if (a[i].m_localPort != b[i].m_localPort || a[i].m_dstAddress != b[i].m_dstAddress || a[i].m_dstPort != b[i].m_dstPort ||
+			a[i].m_dmrId != b[i].m_dmrId || a[i].m_slotNo != b[i].m_slotNo || a[i].m_dstId != b[i].m_dstId || a[i].m_pc != b[i].m_pc)
+			return false;
+	}
 
-	CDMRSlotType slotType;
-	slotType.setColorCode(XLX_COLOR_CODE);
-	slotType.setDataType(DT_VOICE_LC_HEADER);
-	slotType.getData(buffer);
+	return true;
+}
 
-	CSync::addDMRDataSync(buffer, true);
+static void needsRestart(bool changed, const char* name)
+{
+	if (changed)
+		LogWarning("Reload, %s has changed, this only takes effect on a restart", name);
+}
 
-	data.setData(buffer);
+void CYSF2DMR::reconfigure(CConf& conf)
+{
+	// The sessions take the new version up between calls
+	bool sessions = conf.getHangTime() != m_conf.getHangTime() || conf.getDMRDropUnknown() != m_conf.getDMRDropUnknown() ||
+		conf.getDMRNetworkEnableUnlink() != m_conf.getDMRNetworkEnableUnlink() || conf.getDMRNetworkIDUnlink() != m_conf.getDMRNetworkIDUnlink() ||
+		conf.getDMRNetworkPCUnlink() != m_conf.getDMRNetworkPCUnlink() ||
+		conf.getFICHCallSign() != m_conf.getFICHCallSign() || conf.getFICHCallMode() != m_conf.getFICHCallMode() ||
+		conf.getFICHFrameTotal() != m_conf.getFICHFrameTotal() || conf.getFICHMessageRoute() != m_conf.getFICHMessageRoute() ||
+		conf.getFICHVOIP() != m_conf.getFICHVOIP() || conf.getFICHDataType() != m_conf.getFICHDataType() ||
+		conf.getFICHSQLType() != m_conf.getFICHSQLType() || conf.getFICHSQLCode() != m_conf.getFICHSQLCode() ||
+		::memcmp(conf.getYsfDT1(), m_conf.getYsfDT1(), 10U) != 0 || ::memcmp(conf.getYsfDT2(), m_conf.getYsfDT2(), 10U) != 0 ||
+		::memcmp(conf.getYsfRadioID(), m_conf.getYsfRadioID(), 5U) != 0;
+	if (sessions) {
+		m_sessionSettings.set(createSessionConfig(conf));
+		LogMessage("Reload, hang time %u ms, the unlink, FICH and DT settings are taken up by each session between calls", conf.getHangTime());
+	}
 
-	for (unsigned int i = 0U; i < 3U; i++) {
-		data.setSeqNo(i);
-		network->write(data);
+	if (conf.getDMRTGListFile() != m_conf.getDMRTGListFile() || conf.getWiresXMakeUpper() != m_conf.getWiresXMakeUpper()) {
+		m_TGList = conf.getDMRTGListFile();
+		if (m_tgList != NULL) {
+			m_tgList->setFile(m_TGList, conf.getWiresXMakeUpper());
+			LogMessage("Reload, loading the Wires-X TG list from %s", m_TGList.c_str());
+		}
 	}
 
-	data.setDataType(DT_TERMINATOR_WITH_LC);
+	if (conf.getDMRIdLookupTime() != m_conf.getDMRIdLookupTime()) {
+		m_lookup->setReloadTime(60U * conf.getDMRIdLookupTime());
+		LogMessage("Reload, DMR Id lookup reload time: %u hours", conf.getDMRIdLookupTime());
+	}
 
-	fullLC.encode(lc, buffer, DT_TERMINATOR_WITH_LC);
+	if (m_nxdnLookup != NULL && conf.getNXDNIdLookupTime() != m_conf.getNXDNIdLookupTime()) {
+		m_nxdnLookup->setReloadTime(60U * conf.getNXDNIdLookupTime());
+		LogMessage("Reload, NXDN Id lookup reload time: %u hours", conf.getNXDNIdLookupTime());
+	}
 
-	slotType.setDataType(DT_TERMINATOR_WITH_LC);
-	slotType.getData(buffer);
+	if (conf.getSessionsReport() != m_conf.getSessionsReport()) {
+		if (conf.getSessionsReport() > 0U)
+			m_reportTimer.start(conf.getSessionsReport());
+		else
+			m_reportTimer.stop();
+		LogMessage("Reload, session report interval: %u s", conf.getSessionsReport());
+	}
 
-	data.setData(buffer);
+	// Only the logins themselves go through the login again, the sessions and the Id tables stay as they are
+	bool info = conf.getRxFrequency() != m_conf.getRxFrequency() || conf.getTxFrequency() != m_conf.getTxFrequency() ||
+		conf.getPower() != m_conf.getPower() || conf.getLatitude() != m_conf.getLatitude() || conf.getLongitude() != m_conf.getLongitude() ||
+		conf.getHeight() != m_conf.getHeight() || conf.getLocation() != m_conf.getLocation() ||
+		conf.getDescription() != m_conf.getDescription() || conf.getURL() != m_conf.getURL();
+	bool login = info || conf.getDMRNetworkPassword() != m_conf.getDMRNetworkPassword() || conf.getDMRNetworkOptions() != m_conf.getDMRNetworkOptions();
+
+	// In XLX mode the master comes from the reflector list, only its port is taken from here
+	std::string address = m_xlxmodule.empty() ? conf.getDMRNetworkAddress() : m_dmrAddress;
+	unsigned int port   = conf.getDMRNetworkPort();
+	bool master = address != m_dmrAddress || port != m_conf.getDMRNetworkPort();
+
+	// The logins belong to the workers, which are handed the new details and apply them on their own thread
+	if (login || master) {
+		std::shared_ptr<CLoginSettings> settings(new CLoginSettings);
+		settings->m_password    = conf.getDMRNetworkPassword();
+		settings->m_options     = conf.getDMRNetworkOptions();
+		settings->m_callsign    = m_callsign;
+		settings->m_rxFrequency = conf.getRxFrequency();
+		settings->m_txFrequency = conf.getTxFrequency();
+		settings->m_power       = conf.getPower();
+		settings->m_colorCode   = m_colorcode;
+		settings->m_latitude    = conf.getLatitude();
+		settings->m_longitude   = conf.getLongitude();
+		settings->m_height      = conf.getHeight();
+		settings->m_location    = conf.getLocation();
+		settings->m_description = conf.getDescription();
+		settings->m_url         = conf.getURL();
+		settings->m_master      = master;
+		settings->m_address     = address;
+		settings->m_port        = port;
+
+		for (unsigned int i = 0U; i < m_workerCount; i++) {
+			if (!m_workers[i]->post(settings))
+				LogWarning("Reload, worker %u is busy, its logins keep the old details", i);
+		}
+	}
 
-	for (unsigned int i = 0U; i < 2U; i++) {
-		data.setSeqNo(i + 3U);
-		network->write(data);
+	if (master) {
+		LogMessage("Reload, DMR master: %s:%u, connecting %u login(s) to it", address.c_str(), port, m_dmrCount);
+		m_dmrAddress = address;
+	} else if (login) {
+		LogMessage("Reload, the DMR login details have changed, %u login(s) log in again once their slots are quiet", m_dmrCount);
 	}
+
+	needsRestart(conf.getCallsign() != m_conf.getCallsign() || conf.getSuffix() != m_conf.getSuffix(), "the callsign");
+	needsRestart(conf.getDstAddress() != m_conf.getDstAddress() || conf.getDstPort() != m_conf.getDstPort() ||
+		conf.getLocalAddress() != m_conf.getLocalAddress() || conf.getLocalPort() != m_conf.getLocalPort(), "the YSF network");
+	needsRestart(conf.getEnableWiresX() != m_conf.getEnableWiresX() || conf.getRemoteGateway() != m_conf.getRemoteGateway() ||
+		conf.getDaemon() != m_conf.getDaemon(), "the YSF mode");
+	needsRestart(info && (m_enableWiresX || m_gps != NULL), "the Wires-X and APRS-IS information");
+	needsRestart(conf.getDMRId() != m_conf.getDMRId() || conf.getDMRNetworkLocal() != m_conf.getDMRNetworkLocal() ||
+		conf.getDMRNetworkDebug() != m_conf.getDMRNetworkDebug() || conf.getDMRNetworkJitter() != m_conf.getDMRNetworkJitter(), "the DMR login");
+	needsRestart(conf.getDMRDstId() != m_conf.getDMRDstId() || conf.getDMRPC() != m_conf.getDMRPC(), "the startup destination");
+	needsRestart(conf.getDMRXLXFile() != m_conf.getDMRXLXFile() || conf.getDMRXLXModule() != m_conf.getDMRXLXModule() ||
+		conf.getDMRXLXReflector() != m_conf.getDMRXLXReflector(), "XLX");
+	needsRestart(conf.getDMRIdLookupFile() != m_conf.getDMRIdLookupFile() || conf.getNXDNIdLookupFile() != m_conf.getNXDNIdLookupFile(), "an Id lookup file");
+	needsRestart(conf.getNXDNNetworkEnabled() != m_conf.getNXDNNetworkEnabled() || conf.getNXDNTG() != m_conf.getNXDNTG() ||
+		conf.getNXDNDstAddress() != m_conf.getNXDNDstAddress() || conf.getNXDNDstPort() != m_conf.getNXDNDstPort() ||
+		conf.getNXDNLocalAddress() != m_conf.getNXDNLocalAddress() || conf.getNXDNLocalPort() != m_conf.getNXDNLocalPort() ||
+		conf.getNXDNDefaultID() != m_conf.getNXDNDefaultID() || conf.getNXDNNetworkDebug() != m_conf.getNXDNNetworkDebug(), "the NXDN network");
+	needsRestart(conf.getLogDisplayLevel() != m_conf.getLogDisplayLevel() || conf.getLogFileLevel() != m_conf.getLogFileLevel() ||
+		conf.getLogFilePath() != m_conf.getLogFilePath() || conf.getLogFileRoot() != m_conf.getLogFileRoot(), "logging");
+	needsRestart(conf.getCPUKernels() != m_conf.getCPUKernels() || conf.getCPURealTime() != m_conf.getCPURealTime() ||
+		conf.getCPUSharedMemory() != m_conf.getCPUSharedMemory() || conf.getCPUSharedMemoryUser() != m_conf.getCPUSharedMemoryUser(), "the CPU section");
+	needsRestart(!sameSessions(conf.getSessions(), m_conf.getSessions()) || conf.getSessionsWorkers() != m_conf.getSessionsWorkers() ||
+		conf.getSessionsAffinity() != m_conf.getSessionsAffinity() || conf.getSessionsPipeline() != m_conf.getSessionsPipeline(), "the session list");
+	needsRestart(conf.getAPRSEnabled() != m_conf.getAPRSEnabled() || conf.getAPRSServer() != m_conf.getAPRSServer() ||
+		conf.getAPRSPort() != m_conf.getAPRSPort() || conf.getAPRSPassword() != m_conf.getAPRSPassword() ||
+		conf.getAPRSCallsign() != m_conf.getAPRSCallsign() || conf.getAPRSAPIKey() != m_conf.getAPRSAPIKey() ||
+		conf.getAPRSRefresh() != m_conf.getAPRSRefresh() || conf.getAPRSDescription() != m_conf.getAPRSDescription(), "APRS");
+
+	// Nothing on another thread reads the configuration after startup, the next reload compares against this one
+	m_conf = conf;
+
+	LogMessage("Reloaded %s", m_conf.getFile().c_str());
 }
 
+void CYSF2DMR::startup()
+{
+	if ((m_startup & STARTUP_LOGIN) != 0U && m_dmrNetworks[0U]->isConnected()) {
+		CStartup::reached("logged into the DMR master");
+		m_startup &= ~STARTUP_LOGIN;
+	}
+
+	if ((m_startup & STARTUP_DMR_IDS) != 0U && m_lookup->isLoaded()) {
+		CStartup::reached("DMR Ids loaded");
+		m_startup &= ~STARTUP_DMR_IDS;
+	}
+
+	if ((m_startup & STARTUP_NXDN_IDS) != 0U && m_nxdnLookup->isLoaded()) {
+		CStartup::reached("NXDN Ids loaded");
+		m_startup &= ~STARTUP_NXDN_IDS;
+	}
+
+	if ((m_startup & STARTUP_TG_LIST) != 0U && m_tgList->isLoaded()) {
+		CStartup::reached("Wires-X TG list loaded");
+		m_startup &= ~STARTUP_TG_LIST;
+	}
+
+	if ((m_startup & STARTUP_XLX) != 0U && m_xlxReflectors->isLoaded()) {
+		CStartup::reached("XLX hosts loaded");
+		m_startup &= ~STARTUP_XLX;
+	}
+}
@@ -22,40 +22,27 @@
 #define YSF2DMR_H
 
 #include "DMRDefines.h"
-#include "ModeConv.h"
 #include "DMRNetwork.h"
-#include "DMREmbeddedData.h"
-#include "DMRLC.h"
-#include "DMRFullLC.h"
-#include "DMREMB.h"
 #include "DMRLookup.h"
+#include "NXDNNetwork.h"
+#include "NXDNLookup.h"
 #include "UDPSocket.h"
 #include "StopWatch.h"
 #include "Version.h"
-#include "YSFPayload.h"
 #include "YSFNetwork.h"
-#include "YSFFICH.h"
 #include "Reflectors.h"
+#include "Session.h"
+#include "SessionWorker.h"
+#include "Snapshot.h"
 #include "Thread.h"
 #include "Timer.h"
-#include "Sync.h"
-#include "Utils.h"
 #include "Conf.h"
-#include "DTMF.h"
 #include "GPS.h"
 #include "Log.h"
-#include "WiresX.h"
-#include "CRC.h"
 #include "APRSReader.h"
 
 #include <string>
-
-enum TG_STATUS {
-	NONE,
-	WAITING_UNLINK,
-	SEND_REPLY,
-	SEND_PTT
-};
+#include <vector>
 
 class CYSF2DMR
 {
@@ -69,52 +56,53 @@ private:
 	std::string      m_callsign;
 	std::string      m_suffix;
 	CConf            m_conf;
-	CWiresX*         m_wiresX;
-	CDMRNetwork*     m_dmrNetwork;
-	CYSFNetwork*     m_ysfNetwork;
+	CConfReader*     m_reader;
+	CDMRNetwork*     m_dmrNetworks[SESSION_POOL_SIZE];
+	unsigned int     m_dmrIds[SESSION_POOL_SIZE];
+	bool             m_dmrDuplex[SESSION_POOL_SIZE];
+	unsigned int     m_dmrCount;
+	CSession*        m_sessions[SESSION_POOL_SIZE];
+	CYSFNetwork*     m_ysfNetworks[SESSION_POOL_SIZE];
+	unsigned int     m_sessionLogins[SESSION_POOL_SIZE];
+	unsigned int     m_sessionCount;
+	CSessionWorker*  m_workers[SESSION_POOL_SIZE];
+	unsigned int     m_workerCount;
 	CDMRLookup*      m_lookup;
-	CModeConv        m_conv;
+	CNXDNNetwork*    m_nxdnNetwork;
+	CNXDNLookup*     m_nxdnLookup;
 	unsigned int     m_colorcode;
 	unsigned int     m_srcHS;
-	unsigned int     m_srcid;
 	unsigned int     m_defsrcid;
 	unsigned int     m_dstid;
-	unsigned int     m_ptt_dstid;
-	bool             m_ptt_pc;
+	unsigned int     m_nxdnTG;
+	unsigned int     m_nxdnDefaultID;
 	bool             m_dmrpc;
-	std::string      m_netSrc;
-	std::string      m_netDst;
-	std::string      m_ysfSrc;
-	unsigned char    m_dmrLastDT;
-	unsigned char*   m_ysfFrame;
-	unsigned char*   m_dmrFrame;
 	CGPS*            m_gps;
-	CDTMF*           m_dtmf;
 	CAPRSReader*     m_APRS;
-	unsigned int     m_dmrFrames;
-	unsigned int     m_ysfFrames;
-	CDMREmbeddedData m_EmbeddedLC;
 	std::string      m_TGList;
-	FLCO             m_dmrflco;
-	bool             m_dmrinfo;
-	unsigned int     m_idUnlink;
-	FLCO             m_flcoUnlink;
+	CTGList*         m_tgList;
 	bool             m_enableWiresX;
 	std::string      m_xlxmodule;
-	bool             m_xlxConnected;
 	CReflectors*     m_xlxReflectors;
 	unsigned int     m_xlxrefl;
 	bool             m_remoteGateway;
-	unsigned int     m_hangTime;
-	bool             m_firstSync;
-	bool             m_dropUnknown;
+	std::string      m_dmrAddress;
+	CTimer           m_reportTimer;
+	std::vector<CSessionStruct> m_sessionConf;
+	CSnapshot<CSessionConfig>   m_sessionSettings;
+	unsigned int     m_startup;
 
+	bool createSessions(CYSFNetwork* ysfNetwork);
+	CSession* createSession(unsigned int number, CYSFNetwork* ysfNetwork, unsigned int login, unsigned int slotNo, unsigned int dstId, bool pc);
 	bool createDMRNetwork();
+	CDMRNetwork* openDMRNetwork(const std::string& address, unsigned int local, unsigned int id, bool duplex);
+	unsigned int findLogin(unsigned int id);
+	bool createNXDNNetwork();
 	void createGPS();
-	void SendDummyDMR(unsigned int srcid, unsigned int dstid, FLCO dmr_flco);
-	unsigned int findYSFID(std::string cs, bool showdst);
-	std::string getSrcYSF(const unsigned char* source);
-	void writeXLXLink(unsigned int srcId, unsigned int dstId, CDMRNetwork* network);
+	void createWorkers();
+	std::shared_ptr<const CSessionConfig> createSessionConfig(CConf& conf) const;
+	void reconfigure(CConf& conf);
+	void startup();
 };
 
 #endif
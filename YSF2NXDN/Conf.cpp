@@ -34,7 +34,8 @@ enum SECTION {
   SECTION_NXDN_NETWORK,
   SECTION_NXDNID_LOOKUP,
   SECTION_LOG,
-  SECTION_APRS_FI
+  SECTION_APRS_FI,
+  SECTION_CPU
 };
 
 CConf::CConf(const std::string& file) :
@@ -79,6 +80,10 @@ m_logDisplayLevel(0U),
 m_logFileLevel(0U),
 m_logFilePath(),
 m_logFileRoot(),
+m_cpuKernels("auto"),
+m_cpuRealTime(0U),
+m_cpuSharedMemory(false),
+m_cpuSharedMemoryUser(),
 m_aprsEnabled(false),
 m_aprsServer(),
 m_aprsPort(0U),
@@ -119,6 +124,8 @@ bool CConf::read()
 		section = SECTION_NXDNID_LOOKUP;
 	  else if (::strncmp(buffer, "[Log]", 5U) == 0)
 		section = SECTION_LOG;
+	  else if (::strncmp(buffer, "[CPU]", 5U) == 0)
+		section = SECTION_CPU;
 	  else if (::strncmp(buffer, "[aprs.fi]", 5U) == 0)
 		section = SECTION_APRS_FI;
 	  else
@@ -247,6 +254,15 @@ bool CConf::read()
 			m_logFileLevel = (unsigned int)::atoi(value);
 		else if (::strcmp(key, "DisplayLevel") == 0)
 			m_logDisplayLevel = (unsigned int)::atoi(value);
+	} else if (section == SECTION_CPU) {
+		if (::strcmp(key, "Kernels") == 0)
+			m_cpuKernels = value;
+		else if (::strcmp(key, "RealTime") == 0)
+			m_cpuRealTime = (unsigned int)::atoi(value);
+		else if (::strcmp(key, "SharedMemory") == 0)
+			m_cpuSharedMemory = ::atoi(value) == 1;
+		else if (::strcmp(key, "SharedMemoryUser") == 0)
+			m_cpuSharedMemoryUser = value;
 	} else if (section == SECTION_APRS_FI) {
 		if (::strcmp(key, "Enable") == 0)
 			m_aprsEnabled = ::atoi(value) == 1;
@@ -470,6 +486,26 @@ std::string CConf::getLogFileRoot() const
   return m_logFileRoot;
 }
 
+std::string CConf::getCPUKernels() const
+{
+  return m_cpuKernels;
+}
+
+unsigned int CConf::getCPURealTime() const
+{
+  return m_cpuRealTime;
+}
+
+bool CConf::getCPUSharedMemory() const
+{
+  return m_cpuSharedMemory;
+}
+
+std::string CConf::getCPUSharedMemoryUser() const
+{
+  return m_cpuSharedMemoryUser;
+}
+
 bool CConf::getAPRSEnabled() const
 {
 	return m_aprsEnabled;
@@ -81,6 +81,12 @@ public:
   std::string  getLogFilePath() const;
   std::string  getLogFileRoot() const;
 
+  // The CPU section
+  std::string  getCPUKernels() const;
+  unsigned int getCPURealTime() const;
+  bool         getCPUSharedMemory() const;
+  std::string  getCPUSharedMemoryUser() const;
+
   // The aprs.fi section
   bool         getAPRSEnabled() const;
   std::string  getAPRSServer() const;
@@ -137,6 +143,11 @@ private:
   unsigned int m_logFileLevel;
   std::string  m_logFilePath;
   std::string  m_logFileRoot;
+
+  std::string  m_cpuKernels;
+  unsigned int m_cpuRealTime;
+  bool         m_cpuSharedMemory;
+  std::string  m_cpuSharedMemoryUser;
   
   bool         m_aprsEnabled;
   std::string  m_aprsServer;
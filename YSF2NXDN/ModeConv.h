@@ -41,7 +41,6 @@ public:
 	unsigned int getNXDN(unsigned char* bytes);
 
 private:
-	void putAMBE2YSF(unsigned int a, unsigned int b, unsigned int dat_c);
 	unsigned int m_ysfN;
 	unsigned int m_nxdnN;
 	CRingBuffer<unsigned char> m_YSF;
@@ -16,21 +16,22 @@
  *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
  */
 
-#ifndef	NXDNNetwork_H
-#define	NXDNNetwork_H
+#ifndef	NXDNGatewayNetwork_H
+#define	NXDNGatewayNetwork_H
 
 #include "NXDNDefines.h"
 #include "RingBuffer.h"
 #include "UDPSocket.h"
+#include "Resolver.h"
 #include "Timer.h"
 
 #include <cstdint>
 #include <string>
 
-class CNXDNNetwork {
+class CNXDNGatewayNetwork {
 public:
-	CNXDNNetwork(const std::string& localAddress, unsigned int localPort, const std::string& gatewayAddress, unsigned int gatewayPort, bool debug);
-	~CNXDNNetwork();
+	CNXDNGatewayNetwork(const std::string& localAddress, unsigned int localPort, const std::string& gatewayAddress, unsigned int gatewayPort, bool debug);
+	~CNXDNGatewayNetwork();
 
 	bool open();
 
@@ -46,7 +47,7 @@ public:
 
 private:
 	CUDPSocket                 m_socket;
-	in_addr                    m_address;
+	CResolvedHost*             m_address;
 	unsigned int               m_port;
 	bool                       m_debug;
 	CRingBuffer<unsigned char> m_buffer;
@@ -19,6 +19,9 @@
 */
 
 #include "YSF2NXDN.h"
+#include "CPUDispatch.h"
+#include "RealTime.h"
+#include "Resolver.h"
 
 #if defined(_WIN32) || defined(_WIN64)
 #include <Windows.h>
@@ -48,8 +51,6 @@ const char* HEADER2 = "it is to be used for educational purposes only. Its use o
 const char* HEADER3 = "commercial networks is strictly prohibited.";
 const char* HEADER4 = "Copyright(C) 2018,2019 by CA6JAU, G4KLX and others";
 
-#include <functional>
-#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -106,16 +107,20 @@ m_callsign(),
 m_suffix(),
 m_conf(configFile),
 m_wiresX(NULL),
+m_tgList(NULL),
 m_nxdnNetwork(NULL),
 m_ysfNetwork(NULL),
 m_lookup(NULL),
 m_conv(),
+m_nxdnCall(),
 m_srcid(1U),
 m_defsrcid(1U),
 m_dstid(1U),
 m_netSrc(),
 m_netDst(),
 m_ysfSrc(),
+m_ysfSrcRaw(),
+m_callsigns(),
 m_ysfFrame(NULL),
 m_nxdnFrame(NULL),
 m_gps(NULL),
@@ -177,8 +182,15 @@ int CYSF2NXDN::run()
 			::fprintf(stderr, "Couldn't cd /, exiting\n");
 			return -1;
 		}
+	}
+
+	// Locking the memory and raising the real-time limits need root, so they come before it is given up
+	unsigned int realTime = m_conf.getCPURealTime();
+	CRealTime::prepare(realTime);
 
-		//If we are currently root...
+	// Only a daemon gives up root, once the limits above have been raised
+	if (m_daemon) {
+		// If we are currently root...
 		if (getuid() == 0) {
 			struct passwd* user = ::getpwnam("mmdvm");
 			if (user == NULL) {
@@ -228,13 +240,20 @@ int CYSF2NXDN::run()
 	LogInfo(HEADER3);
 	LogInfo(HEADER4);
 
+	CCPUDispatch::init(m_conf.getCPUKernels());
+	CUDPSocket::setSharedMemory(m_conf.getCPUSharedMemory());
+	CUDPSocket::setSharedMemoryUser(m_conf.getCPUSharedMemoryUser());
+
+	// The networks below only queue their host names, nothing waits on DNS from here on
+	CResolver::start();
+
 	m_callsign = m_conf.getCallsign();
 	m_suffix   = m_conf.getSuffix();
 	m_defsrcid = m_conf.getNXDNId();
 	m_dstid    = m_conf.getNXDNDstId();
 
 	bool debug               = m_conf.getNXDNNetworkDebug();
-	in_addr dstAddress       = CUDPSocket::lookup(m_conf.getDstAddress());
+	std::string dstAddress   = m_conf.getDstAddress();
 	unsigned int dstPort     = m_conf.getDstPort();
 	std::string localAddress = m_conf.getLocalAddress();
 	unsigned int localPort   = m_conf.getLocalPort();
@@ -254,7 +273,7 @@ int CYSF2NXDN::run()
 	std::string nxdn_localAddress  = m_conf.getNXDNLocalAddress();
 	unsigned int nxdn_localPort    = m_conf.getNXDNLocalPort();
 
-	m_nxdnNetwork = new CNXDNNetwork(nxdn_localAddress, nxdn_localPort, nxdn_dstAddress, nxdn_dstPort, debug);
+	m_nxdnNetwork = new CNXDNGatewayNetwork(nxdn_localAddress, nxdn_localPort, nxdn_dstAddress, nxdn_dstPort, debug);
 
 	ret = m_nxdnNetwork->open();
 	if (!ret) {
@@ -269,6 +288,8 @@ int CYSF2NXDN::run()
 	m_lookup = new CNXDNLookup(lookupFile, reloadTime);
 	m_lookup->read();
 
+	m_callsigns.setLookup(m_lookup);
+
 	CTimer networkWatchdog(100U, 0U, 1500U);
 	CTimer pollTimer(1000U, 5U);
 
@@ -281,7 +302,10 @@ int CYSF2NXDN::run()
 	// CWiresX Control Object
 	if (enableWiresX) {
 		bool makeUpper = m_conf.getWiresXMakeUpper();
-		m_wiresX = new CWiresX(m_callsign, m_suffix, m_ysfNetwork, TGList, makeUpper);
+		m_tgList = new CTGList(TGList, makeUpper, false, 60U);
+		m_tgList->read();
+
+		m_wiresX = new CWiresX(m_callsign, m_suffix, m_ysfNetwork, m_tgList);
 		m_dtmf = new CDTMF;
 	}
 
@@ -309,10 +333,16 @@ int CYSF2NXDN::run()
 
 	unsigned char gps_buffer[20U];
 
+	// Counts the passes that took longer than the shortest frame period
+	CLoopWatchdog watchdog("YSF2NXDN", NXDN_FRAME_PER);
+
+	CRealTime::enter("main");
+
 	for (; end == 0;) {
 		unsigned char buffer[2000U];
 
 		unsigned int ms = stopWatch.elapsed();
+		watchdog.clock(ms);
 
 		while (m_ysfNetwork->read(buffer) > 0U) {
 			CYSFFICH fich;
@@ -326,11 +356,11 @@ int CYSF2NXDN::run()
 				
 				if (m_wiresX != NULL) {
 					WX_STATUS status = m_wiresX->process(buffer + 35U, buffer + 14U, fi, dt, fn, ft);
-					m_ysfSrc = getSrcYSF(buffer);
+					readSrcYSF(buffer);
 
 					switch (status) {
 						case WXS_CONNECT:
-							m_srcid = findYSFID(m_ysfSrc, false);
+							m_srcid = findYSFID(m_ysfSrcRaw, false);
 							m_dstid = m_wiresX->getDstID();
 							LogMessage("Connect to TG %d has been requested by %s", m_dstid, m_ysfSrc.c_str());
 							sendNXDNPTT(m_srcid, m_dstid);
@@ -355,7 +385,7 @@ int CYSF2NXDN::run()
 
 					switch (status) {
 						case WXS_CONNECT:
-							m_srcid = findYSFID(m_ysfSrc, false);
+							m_srcid = findYSFID(m_ysfSrcRaw, false);
 							m_dstid = m_dtmf->getDstID();
 							LogMessage("Connect to TG %d has been requested by %s", m_dstid, m_ysfSrc.c_str());
 							sendNXDNPTT(m_srcid, m_dstid);
@@ -379,7 +409,7 @@ int CYSF2NXDN::run()
 							std::string ysfSrc = ysfPayload.getSource();
 							std::string ysfDst = ysfPayload.getDest();
 							LogMessage("Received YSF Header: Src: %s Dst: %s", ysfSrc.c_str(), ysfDst.c_str());
-							m_srcid = findYSFID(ysfSrc, true);
+							m_srcid = findYSFID((const unsigned char*)ysfSrc.data(), true);
 							m_conv.putYSFHeader();
 							m_ysfFrames = 0U;
 						}
@@ -412,108 +442,24 @@ int CYSF2NXDN::run()
 			if(nxdnFrameType == TAG_HEADER) {
 				nxdn_cnt = 0U;
 
-				CNXDNLICH lich;
-				lich.setRFCT(NXDN_LICH_RFCT_RDCH);
-				lich.setFCT(NXDN_LICH_USC_SACCH_NS);
-				lich.setOption(NXDN_LICH_STEAL_FACCH);
-				lich.setDirection(NXDN_LICH_DIRECTION_INBOUND);
-				m_nxdnFrame[0U] = lich.getRaw();
-
-				CNXDNSACCH sacch;
-				sacch.setRAN(0x01);
-				sacch.setStructure(NXDN_SR_SINGLE);
-				sacch.setData(SACCH_IDLE);
-				sacch.getRaw(m_nxdnFrame + 1U);
-
-				unsigned char layer3data[25U];
-				CNXDNLayer3 layer3;
-				layer3.setMessageType(NXDN_MESSAGE_TYPE_VCALL);
-				layer3.setSourceUnitId(m_srcid & 0xFFFF);
-				layer3.setDestinationGroupId(m_dstid & 0xFFFF);
-				layer3.setGroup(true);
-				layer3.setDataBlocks(0U);
-				layer3.getData(layer3data);
-
-				::memcpy(m_nxdnFrame + 5U, layer3data, 14U);
-				::memcpy(m_nxdnFrame + 5U + 14U, layer3data, 14U);
+				m_nxdnCall.setCall(m_srcid, m_dstid);
+				m_nxdnCall.getHeader(m_nxdnFrame);
 
 				m_nxdnNetwork->write(m_nxdnFrame, false);
 
 				nxdnWatch.start();
 			}
 			else if (nxdnFrameType == TAG_EOT) {
-				CNXDNLICH lich;
-				lich.setRFCT(NXDN_LICH_RFCT_RDCH);
-				lich.setFCT(NXDN_LICH_USC_SACCH_NS);
-				lich.setOption(NXDN_LICH_STEAL_FACCH);
-				lich.setDirection(NXDN_LICH_DIRECTION_INBOUND);
-				m_nxdnFrame[0U] = lich.getRaw();
-
-				CNXDNSACCH sacch;
-				sacch.setRAN(0x01);
-				sacch.setStructure(NXDN_SR_SINGLE);
-				sacch.setData(SACCH_IDLE);
-				sacch.getRaw(m_nxdnFrame + 1U);
-
-				unsigned char layer3data[25U];
-				CNXDNLayer3 layer3;
-				layer3.setMessageType(NXDN_MESSAGE_TYPE_TX_REL);
-				layer3.setSourceUnitId(m_srcid & 0xFFFF);
-				layer3.setDestinationGroupId(m_dstid & 0xFFFF);
-				layer3.setGroup(true);
-				layer3.setDataBlocks(0U);
-				layer3.getData(layer3data);
-
-				::memcpy(m_nxdnFrame + 5U, layer3data, 14U);
-				::memcpy(m_nxdnFrame + 5U + 14U, layer3data, 14U);
+				m_nxdnCall.setCall(m_srcid, m_dstid);
+				m_nxdnCall.getTerminator(m_nxdnFrame);
 
 				m_nxdnNetwork->write(m_nxdnFrame, false);
 
 				nxdn_cnt = 0U;
 			}
 			else if (nxdnFrameType == TAG_DATA) {
-				CNXDNLICH lich;
-				lich.setRFCT(NXDN_LICH_RFCT_RDCH);
-				lich.setFCT(NXDN_LICH_USC_SACCH_SS);
-				lich.setOption(NXDN_LICH_STEAL_NONE);
-				lich.setDirection(NXDN_LICH_DIRECTION_INBOUND);
-				m_nxdnFrame[0U] = lich.getRaw();
-
-				CNXDNSACCH sacch;
-				CNXDNLayer3 layer3;
-				unsigned char message[3U];
-
-				layer3.setMessageType(NXDN_MESSAGE_TYPE_VCALL);
-				layer3.setSourceUnitId(m_srcid & 0xFFFF);
-				layer3.setDestinationGroupId(m_dstid & 0xFFFF);
-				layer3.setGroup(true);
-				layer3.setDataBlocks(0U);
-
-				switch (nxdn_cnt % 4) {
-					case 0:
-						sacch.setStructure(NXDN_SR_1_4);
-						layer3.encode(message, 18U, 0U);
-						sacch.setData(message);
-						break;
-					case 1:
-						sacch.setStructure(NXDN_SR_2_4);
-						layer3.encode(message, 18U, 18U);
-						sacch.setData(message);
-						break;
-					case 2:
-						sacch.setStructure(NXDN_SR_3_4);
-						layer3.encode(message, 18U, 36U);
-						sacch.setData(message);
-						break;
-					case 3:
-						sacch.setStructure(NXDN_SR_4_4);
-						layer3.encode(message, 18U, 54U);
-						sacch.setData(message);
-						break;
-				}
-
-				sacch.setRAN(0x01);
-				sacch.getRaw(m_nxdnFrame + 1U);
+				m_nxdnCall.setCall(m_srcid, m_dstid);
+				m_nxdnCall.getVoice(m_nxdnFrame, nxdn_cnt);
 
 				// Send data to MMDVMHost
 				m_nxdnNetwork->write(m_nxdnFrame, false);
@@ -759,6 +705,9 @@ int CYSF2NXDN::run()
 			CThread::sleep(5U);
 	}
 
+	watchdog.report();
+	m_callsigns.report();
+
 	m_ysfNetwork->close();
 	m_nxdnNetwork->close();
 
@@ -778,8 +727,13 @@ int CYSF2NXDN::run()
 	if (m_wiresX != NULL) {
 		delete m_wiresX;
 		delete m_dtmf;
+
+		m_tgList->stop();
+		delete m_tgList;
 	}
 
+	CResolver::stop();
+
 	::LogFinalise();
 
 	return 0;
@@ -816,28 +770,12 @@ void CYSF2NXDN::createGPS()
 	}
 }
 
-unsigned int CYSF2NXDN::findYSFID(std::string cs, bool showdst)
+unsigned int CYSF2NXDN::findYSFID(const unsigned char* source, bool showdst)
 {
-	std::string cstrim;
-	bool nxdnpc = false;
-
-	int first = cs.find_first_not_of(' ');
-	int mid1 = cs.find_last_of('-');
-	int mid2 = cs.find_last_of('/');
-	int last = cs.find_last_not_of(' ');
+	const CCallsignEntry& entry = m_callsigns.find(source);
 
-	if (mid1 == -1 && mid2 == -1 && first == -1 && last == -1)
-		cstrim = "N0CALL";
-	else if (mid1 == -1 && mid2 == -1)
-		cstrim = cs.substr(first, (last - first + 1));
-	else if (mid1 > first)
-		cstrim = cs.substr(first, (mid1 - first));
-	else if (mid2 > first)
-		cstrim = cs.substr(first, (mid2 - first));
-	else
-		cstrim = "N0CALL";
-
-	unsigned int id = m_lookup->findID(cstrim);
+	unsigned int id = entry.m_id;
+	bool nxdnpc = false;
 
 	if (id == 0) {
 		id = m_defsrcid;
@@ -848,79 +786,34 @@ unsigned int CYSF2NXDN::findYSFID(std::string cs, bool showdst)
 	}
 	else {
 		if (showdst)
-			LogMessage("NXDN ID of %s: %u, DstID: %s%u", cstrim.c_str(), id, nxdnpc ? "" : "TG ", m_dstid);
+			LogMessage("NXDN ID of %s: %u, DstID: %s%u", entry.m_callsign, id, nxdnpc ? "" : "TG ", m_dstid);
 		else
-			LogMessage("NXDN ID of %s: %u", cstrim.c_str(), id);
+			LogMessage("NXDN ID of %s: %u", entry.m_callsign, id);
 	}
 
 	return id;
 }
 
-std::string CYSF2NXDN::getSrcYSF(const unsigned char* buffer)
+void CYSF2NXDN::readSrcYSF(const unsigned char* buffer)
 {
-	unsigned char temp[YSF_CALLSIGN_LENGTH + 1U];
+	// Every frame of a Wires-X request carries the same source, only a new one is looked at
+	if (::memcmp(m_ysfSrcRaw, buffer + 14U, YSF_CALLSIGN_LENGTH) == 0)
+		return;
 
-	::memcpy(temp, buffer + 14U, YSF_CALLSIGN_LENGTH);
-	temp[YSF_CALLSIGN_LENGTH] = 0U;
-	
-	std::string trimmed = reinterpret_cast<char const*>(temp);
-	trimmed.erase(std::find_if(trimmed.rbegin(), trimmed.rend(), std::not1(std::ptr_fun<int, int>(std::isspace))).base(), trimmed.end());
-	
-	return trimmed;
+	::memcpy(m_ysfSrcRaw, buffer + 14U, YSF_CALLSIGN_LENGTH);
+	m_ysfSrc = m_callsigns.find(m_ysfSrcRaw).m_source;
 }
 
 void CYSF2NXDN::sendNXDNPTT(unsigned int src, unsigned int dst)
 {
-	// Send NXDN Header
-	CNXDNLICH lich;
-	lich.setRFCT(NXDN_LICH_RFCT_RDCH);
-	lich.setFCT(NXDN_LICH_USC_SACCH_NS);
-	lich.setOption(NXDN_LICH_STEAL_FACCH);
-	lich.setDirection(NXDN_LICH_DIRECTION_INBOUND);
-	m_nxdnFrame[0U] = lich.getRaw();
-
-	CNXDNSACCH sacch;
-	sacch.setRAN(0x01);
-	sacch.setStructure(NXDN_SR_SINGLE);
-	sacch.setData(SACCH_IDLE);
-	sacch.getRaw(m_nxdnFrame + 1U);
-
-	unsigned char layer3data[25U];
-	CNXDNLayer3 layer3;
-	layer3.setMessageType(NXDN_MESSAGE_TYPE_VCALL);
-	layer3.setSourceUnitId(src & 0xFFFF);
-	layer3.setDestinationGroupId(dst & 0xFFFF);
-	layer3.setGroup(true);
-	layer3.setDataBlocks(0U);
-	layer3.getData(layer3data);
-
-	::memcpy(m_nxdnFrame + 5U, layer3data, 14U);
-	::memcpy(m_nxdnFrame + 5U + 14U, layer3data, 14U);
+	m_nxdnCall.setCall(src, dst);
 
+	// Send NXDN Header
+	m_nxdnCall.getHeader(m_nxdnFrame);
 	m_nxdnNetwork->write(m_nxdnFrame, false);
 
 	// Send NXDN EOT
-	lich.setRFCT(NXDN_LICH_RFCT_RDCH);
-	lich.setFCT(NXDN_LICH_USC_SACCH_NS);
-	lich.setOption(NXDN_LICH_STEAL_FACCH);
-	lich.setDirection(NXDN_LICH_DIRECTION_INBOUND);
-	m_nxdnFrame[0U] = lich.getRaw();
-
-	sacch.setRAN(0x01);
-	sacch.setStructure(NXDN_SR_SINGLE);
-	sacch.setData(SACCH_IDLE);
-	sacch.getRaw(m_nxdnFrame + 1U);
-
-	layer3.setMessageType(NXDN_MESSAGE_TYPE_TX_REL);
-	layer3.setSourceUnitId(src & 0xFFFF);
-	layer3.setDestinationGroupId(dst & 0xFFFF);
-	layer3.setGroup(true);
-	layer3.setDataBlocks(0U);
-	layer3.getData(layer3data);
-
-	::memcpy(m_nxdnFrame + 5U, layer3data, 14U);
-	::memcpy(m_nxdnFrame + 5U + 14U, layer3data, 14U);
-
+	m_nxdnCall.getTerminator(m_nxdnFrame);
 	m_nxdnNetwork->write(m_nxdnFrame, false);
 }
 
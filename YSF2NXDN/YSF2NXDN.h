@@ -30,17 +30,19 @@
 #include "YSFPayload.h"
 #include "YSFNetwork.h"
 #include "NXDNConvolution.h"
+#include "NXDNCallTemplate.h"
 #include "NXDNCRC.h"
 #include "NXDNLayer3.h"
 #include "NXDNLICH.h"
 #include "NXDNSACCH.h"
-#include "NXDNNetwork.h"
+#include "NXDNGatewayNetwork.h"
 #include "YSFFICH.h"
 #include "Thread.h"
 #include "Timer.h"
 #include "Sync.h"
 #include "Utils.h"
 #include "Conf.h"
+#include "CallsignCache.h"
 #include "DTMF.h"
 #include "GPS.h"
 #include "Log.h"
@@ -63,16 +65,20 @@ private:
 	std::string      m_suffix;
 	CConf            m_conf;
 	CWiresX*         m_wiresX;
-	CNXDNNetwork*    m_nxdnNetwork;
+	CTGList*         m_tgList;
+	CNXDNGatewayNetwork* m_nxdnNetwork;
 	CYSFNetwork*     m_ysfNetwork;
 	CNXDNLookup*     m_lookup;
 	CModeConv        m_conv;
+	CNXDNCallTemplate m_nxdnCall;
 	unsigned int     m_srcid;
 	unsigned int     m_defsrcid;
 	unsigned int     m_dstid;
 	std::string      m_netSrc;
 	std::string      m_netDst;
 	std::string      m_ysfSrc;
+	unsigned char    m_ysfSrcRaw[YSF_CALLSIGN_LENGTH];
+	CCallsignCache<CNXDNLookup> m_callsigns;
 	unsigned char*   m_ysfFrame;
 	unsigned char*   m_nxdnFrame;
 	CGPS*            m_gps;
@@ -84,8 +90,8 @@ private:
 
 	void sendNXDNPTT(unsigned int src, unsigned int dst);
 	void createGPS();
-	unsigned int findYSFID(std::string cs, bool showdst);
-	std::string getSrcYSF(const unsigned char* source);
+	unsigned int findYSFID(const unsigned char* source, bool showdst);
+	void readSrcYSF(const unsigned char* buffer);
 };
 
 #endif
@@ -33,7 +33,8 @@ enum SECTION {
   SECTION_YSF_NETWORK,
   SECTION_P25_NETWORK,
   SECTION_DMRID_LOOKUP,
-  SECTION_LOG
+  SECTION_LOG,
+  SECTION_CPU
 };
 
 CConf::CConf(const std::string& file) :
@@ -46,6 +47,7 @@ m_localAddress(),
 m_localPort(0U),
 m_enableWiresX(false),
 m_wiresXMakeUpper(true),
+m_imbeCorrection(false),
 m_fichCallSign(2U),
 m_fichCallMode(0U),
 m_fichFrameTotal(7U),
@@ -75,7 +77,11 @@ m_dmrIdLookupTime(0U),
 m_logDisplayLevel(0U),
 m_logFileLevel(0U),
 m_logFilePath(),
-m_logFileRoot()
+m_logFileRoot(),
+m_cpuKernels("auto"),
+m_cpuRealTime(0U),
+m_cpuSharedMemory(false),
+m_cpuSharedMemoryUser()
 {
 }
 
@@ -109,6 +115,8 @@ bool CConf::read()
 		section = SECTION_DMRID_LOOKUP;
 	  else if (::strncmp(buffer, "[Log]", 5U) == 0)
 		section = SECTION_LOG;
+	  else if (::strncmp(buffer, "[CPU]", 5U) == 0)
+		section = SECTION_CPU;
 	  else
         section = SECTION_NONE;
 
@@ -162,6 +170,8 @@ bool CConf::read()
 			m_enableWiresX = ::atoi(value) == 1;
 		else if (::strcmp(key, "WiresXMakeUpper") == 0)
 			m_wiresXMakeUpper = ::atoi(value) == 1;
+		else if (::strcmp(key, "IMBECorrection") == 0)
+			m_imbeCorrection = ::atoi(value) == 1;
                 else if (::strcmp(key, "RadioID") == 0)
   			::memcpy(m_ysfRadioID, value, 5);
   		else if (::strcmp(key, "FICHCallsign") == 0)
@@ -231,6 +241,15 @@ bool CConf::read()
 			m_logFileLevel = (unsigned int)::atoi(value);
 		else if (::strcmp(key, "DisplayLevel") == 0)
 			m_logDisplayLevel = (unsigned int)::atoi(value);
+	} else if (section == SECTION_CPU) {
+		if (::strcmp(key, "Kernels") == 0)
+			m_cpuKernels = value;
+		else if (::strcmp(key, "RealTime") == 0)
+			m_cpuRealTime = (unsigned int)::atoi(value);
+		else if (::strcmp(key, "SharedMemory") == 0)
+			m_cpuSharedMemory = ::atoi(value) == 1;
+		else if (::strcmp(key, "SharedMemoryUser") == 0)
+			m_cpuSharedMemoryUser = value;
 	}
   }
 
@@ -294,6 +313,11 @@ bool CConf::getWiresXMakeUpper() const
 	return m_wiresXMakeUpper;
 }
 
+bool CConf::getIMBECorrection() const
+{
+	return m_imbeCorrection;
+}
+
 unsigned char CConf::getFICHCallSign() const
 {
   	return m_fichCallSign;
@@ -428,3 +452,23 @@ std::string CConf::getLogFileRoot() const
 {
   return m_logFileRoot;
 }
+
+std::string CConf::getCPUKernels() const
+{
+  return m_cpuKernels;
+}
+
+unsigned int CConf::getCPURealTime() const
+{
+  return m_cpuRealTime;
+}
+
+bool CConf::getCPUSharedMemory() const
+{
+  return m_cpuSharedMemory;
+}
+
+std::string CConf::getCPUSharedMemoryUser() const
+{
+  return m_cpuSharedMemoryUser;
+}
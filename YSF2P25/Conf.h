@@ -45,6 +45,7 @@ public:
   unsigned int getLocalPort() const;
   bool         getEnableWiresX() const;
   bool         getWiresXMakeUpper() const;
+  bool         getIMBECorrection() const;
   unsigned char getFICHCallSign() const;
   unsigned char getFICHCallMode() const;
   unsigned char getFICHFrameTotal() const;
@@ -79,6 +80,12 @@ public:
   std::string  getLogFilePath() const;
   std::string  getLogFileRoot() const;
 
+  // The CPU section
+  std::string  getCPUKernels() const;
+  unsigned int getCPURealTime() const;
+  bool         getCPUSharedMemory() const;
+  std::string  getCPUSharedMemoryUser() const;
+
 private:
   std::string  m_file;
   std::string  m_callsign;
@@ -89,6 +96,7 @@ private:
   unsigned int m_localPort;
   bool         m_enableWiresX;
   bool         m_wiresXMakeUpper;
+  bool         m_imbeCorrection;
   unsigned char m_fichCallSign;
   unsigned char m_fichCallMode;
   unsigned char m_fichFrameTotal;
@@ -123,6 +131,11 @@ private:
   unsigned int m_logFileLevel;
   std::string  m_logFilePath;
   std::string  m_logFileRoot;
+
+  std::string  m_cpuKernels;
+  unsigned int m_cpuRealTime;
+  bool         m_cpuSharedMemory;
+  std::string  m_cpuSharedMemoryUser;
 };
 
 #endif
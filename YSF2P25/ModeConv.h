@@ -40,7 +40,10 @@ public:
 	unsigned int getYSF(unsigned char* data);
 	unsigned int getP25(unsigned char* data);
 
+	void setIMBECorrection(bool on);
+
 private:
+	bool m_imbeCorrection;
 	unsigned int m_ysfN;
 	unsigned int m_p25N;
 	CRingBuffer<unsigned char> m_YSF;
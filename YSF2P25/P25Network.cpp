@@ -26,13 +26,13 @@
 
 CP25Network::CP25Network(const std::string& localAddress, unsigned int localPort, const std::string& gatewayAddress, unsigned int gatewayPort, const std::string& callsign, bool debug) :
 m_callsign(callsign),
-m_address(),
+m_address(NULL),
 m_port(gatewayPort),
 m_socket(localAddress, localPort),
 m_debug(debug)
 {
 	m_callsign.resize(10U, ' ');
-	m_address = CUDPSocket::lookup(gatewayAddress);
+	m_address = CResolver::find(gatewayAddress);
 }
 
 CP25Network::~CP25Network()
@@ -54,7 +54,7 @@ bool CP25Network::writeData(const unsigned char* data, unsigned int length)
 	if (m_debug)
 		CUtils::dump(1U, "P25 Network Data Sent", data, length);
 
-	return m_socket.write(data, length, m_address, m_port);
+	return m_socket.write(data, length, m_address->getAddress(), m_port);
 }
 
 bool CP25Network::writePoll()
@@ -69,7 +69,7 @@ bool CP25Network::writePoll()
 	if (m_debug)
 		CUtils::dump(1U, "P25 Network Poll Sent", data, 11U);
 
-	return m_socket.write(data, 11U, m_address, m_port);
+	return m_socket.write(data, 11U, m_address->getAddress(), m_port);
 }
 
 bool CP25Network::writeUnlink()
@@ -84,7 +84,7 @@ bool CP25Network::writeUnlink()
 	if (m_debug)
 		CUtils::dump(1U, "P25 Network Unlink Sent", data, 11U);
 
-	return m_socket.write(data, 11U, m_address, m_port);
+	return m_socket.write(data, 11U, m_address->getAddress(), m_port);
 }
 
 unsigned int CP25Network::readData(unsigned char* data, unsigned int length)
@@ -99,8 +99,8 @@ unsigned int CP25Network::readData(unsigned char* data, unsigned int length)
 		return 0U;
 
 	// Check if the data is for us
-	if (m_address.s_addr != address.s_addr || port != m_port) {
-		LogMessage("P25 packet received from an invalid source, %08X != %08X and/or %u != %u", m_address.s_addr, address.s_addr, m_port, port);
+	if (!m_address->matches(address) || port != m_port) {
+		LogMessage("P25 packet received from an invalid source, %08X != %08X and/or %u != %u", m_address->getAddress().s_addr, address.s_addr, m_port, port);
 		return 0U;
 	}
 
@@ -20,6 +20,7 @@
 #define	P25Network_H
 
 #include "UDPSocket.h"
+#include "Resolver.h"
 
 #include <cstdint>
 #include <string>
@@ -42,11 +43,11 @@ public:
 	void close();
 
 private:
-	std::string  m_callsign;
-	in_addr      m_address;
-	unsigned int m_port;
-	CUDPSocket   m_socket;
-	bool         m_debug;
+	std::string    m_callsign;
+	CResolvedHost* m_address;
+	unsigned int   m_port;
+	CUDPSocket     m_socket;
+	bool           m_debug;
 };
 
 #endif
@@ -19,6 +19,9 @@
 */
 
 #include "YSF2P25.h"
+#include "CPUDispatch.h"
+#include "RealTime.h"
+#include "Resolver.h"
 
 #if defined(_WIN32) || defined(_WIN64)
 #include <Windows.h>
@@ -106,8 +109,6 @@ const char* HEADER2 = "it is to be used for educational purposes only. Its use o
 const char* HEADER3 = "commercial networks is strictly prohibited.";
 const char* HEADER4 = "Copyright(C) 2018,2019 by CA6JAU, G4KLX and others";
 
-#include <functional>
-#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -164,6 +165,7 @@ m_callsign(),
 m_suffix(),
 m_conf(configFile),
 m_wiresX(NULL),
+m_tgList(NULL),
 m_p25Network(NULL),
 m_ysfNetwork(NULL),
 m_lookup(NULL),
@@ -174,6 +176,8 @@ m_dstid(1U),
 m_netSrc(),
 m_netDst(),
 m_ysfSrc(),
+m_ysfSrcRaw(),
+m_callsigns(),
 m_ysfFrame(NULL),
 m_p25Frame(NULL),
 m_dtmf(NULL),
@@ -233,7 +237,14 @@ int CYSF2P25::run()
 			::fprintf(stderr, "Couldn't cd /, exiting\n");
 			return -1;
 		}
+	}
+
+	// Locking the memory and raising the real-time limits need root, so they come before it is given up
+	unsigned int realTime = m_conf.getCPURealTime();
+	CRealTime::prepare(realTime);
 
+	// Only a daemon gives up root, once the limits above have been raised
+	if (m_daemon) {
 		// If we are currently root...
 		if (getuid() == 0) {
 			struct passwd* user = ::getpwnam("mmdvm");
@@ -284,16 +295,25 @@ int CYSF2P25::run()
 	LogInfo(HEADER3);
 	LogInfo(HEADER4);
 
+	CCPUDispatch::init(m_conf.getCPUKernels());
+	CUDPSocket::setSharedMemory(m_conf.getCPUSharedMemory());
+	CUDPSocket::setSharedMemoryUser(m_conf.getCPUSharedMemoryUser());
+
+	// The networks below only queue their host names, nothing waits on DNS from here on
+	CResolver::start();
+
 	m_callsign = m_conf.getCallsign();
 	m_defsrcid = m_conf.getP25Id();
 	m_dstid = m_conf.getP25DstId();
 
-	in_addr dstAddress       = CUDPSocket::lookup(m_conf.getDstAddress());
+	std::string dstAddress   = m_conf.getDstAddress();
 	unsigned int dstPort     = m_conf.getDstPort();
 	std::string localAddress = m_conf.getLocalAddress();
 	unsigned int localPort   = m_conf.getLocalPort();
 	bool debug               = m_conf.getNetworkDebug();
 
+	m_conv.setIMBECorrection(m_conf.getIMBECorrection());
+
 	m_ysfNetwork = new CYSFNetwork(localAddress, localPort, m_callsign, debug);
 	m_ysfNetwork->setDestination(dstAddress, dstPort);
 
@@ -325,6 +345,8 @@ int CYSF2P25::run()
 	m_lookup = new CDMRLookup(lookupFile, reloadTime);
 	m_lookup->read();
 
+	m_callsigns.setLookup(m_lookup);
+
 	CTimer networkWatchdog(100U, 0U, 1500U);
 	CTimer pollTimer(1000U, 5U);
 
@@ -338,7 +360,10 @@ int CYSF2P25::run()
 	// CWiresX Control Object
 	if (enableWiresX) {
 		bool makeUpper = m_conf.getWiresXMakeUpper();
-		m_wiresX = new CWiresX(m_callsign, suffix, m_ysfNetwork, TGList, makeUpper);
+		m_tgList = new CTGList(TGList, makeUpper, false, 60U);
+		m_tgList->read();
+
+		m_wiresX = new CWiresX(m_callsign, suffix, m_ysfNetwork, m_tgList);
 		m_dtmf = new CDTMF;
 	}
 
@@ -358,12 +383,18 @@ int CYSF2P25::run()
 
 	LogMessage("Starting YSF2P25-%s", VERSION);
 
+	// Counts the passes that took longer than the shortest frame period
+	CLoopWatchdog watchdog("YSF2P25", P25_FRAME_PER);
+
+	CRealTime::enter("main");
+
 	for (; end == 0;) {
 		unsigned char buffer[2000U];
 		unsigned int srcId = 0U;
 		unsigned int dstId = 0U;
 
 		unsigned int ms = stopWatch.elapsed();
+		watchdog.clock(ms);
 
 		while (m_ysfNetwork->read(buffer) > 0U) {
 			CYSFFICH fich;
@@ -377,11 +408,11 @@ int CYSF2P25::run()
 
 				if (m_wiresX != NULL) {
 					WX_STATUS status = m_wiresX->process(buffer + 35U, buffer + 14U, fi, dt, fn, ft);
-					m_ysfSrc = getSrcYSF(buffer);
+					readSrcYSF(buffer);
 
 					switch (status) {
 						case WXS_CONNECT:
-							m_srcid = findYSFID(m_ysfSrc, false);
+							m_srcid = findYSFID(m_ysfSrcRaw, false);
 							m_dstid = m_wiresX->getDstID();
 							LogMessage("Connect to TG %d has been requested by %s", m_dstid, m_ysfSrc.c_str());
 							sendP25PTT(m_srcid, m_dstid);
@@ -412,7 +443,7 @@ int CYSF2P25::run()
 
 					switch (status) {
 						case WXS_CONNECT:
-							m_srcid = findYSFID(m_ysfSrc, false);
+							m_srcid = findYSFID(m_ysfSrcRaw, false);
 							m_dstid = m_dtmf->getDstID();
 							LogMessage("Connect to TG %d has been requested by %s", m_dstid, m_ysfSrc.c_str());
 							sendP25PTT(m_srcid, m_dstid);
@@ -436,7 +467,7 @@ int CYSF2P25::run()
 							std::string ysfSrc = ysfPayload.getSource();
 							std::string ysfDst = ysfPayload.getDest();
 							LogMessage("Received YSF Header: Src: %s Dst: %s", ysfSrc.c_str(), ysfDst.c_str());
-							m_srcid = findYSFID(ysfSrc, true);
+							m_srcid = findYSFID((const unsigned char*)ysfSrc.data(), true);
 							m_conv.putYSFHeader();
 							m_ysfFrames = 0U;
 						}
@@ -744,6 +775,9 @@ int CYSF2P25::run()
 			CThread::sleep(5U);
 	}
 
+	watchdog.report();
+	m_callsigns.report();
+
 	m_ysfNetwork->close();
 	m_p25Network->close();
 
@@ -753,34 +787,23 @@ int CYSF2P25::run()
 	if (m_wiresX != NULL) {
 		delete m_wiresX;
 		delete m_dtmf;
+
+		m_tgList->stop();
+		delete m_tgList;
 	}
 
+	CResolver::stop();
+
 	::LogFinalise();
 
 	return 0;
 }
 
-unsigned int CYSF2P25::findYSFID(std::string cs, bool showdst)
+unsigned int CYSF2P25::findYSFID(const unsigned char* source, bool showdst)
 {
-	std::string cstrim;
-
-	int first = cs.find_first_not_of(' ');
-	int mid1 = cs.find_last_of('-');
-	int mid2 = cs.find_last_of('/');
-	int last = cs.find_last_not_of(' ');
-
-	if (mid1 == -1 && mid2 == -1 && first == -1 && last == -1)
-		cstrim = "N0CALL";
-	else if (mid1 == -1 && mid2 == -1)
-		cstrim = cs.substr(first, (last - first + 1));
-	else if (mid1 > first)
-		cstrim = cs.substr(first, (mid1 - first));
-	else if (mid2 > first)
-		cstrim = cs.substr(first, (mid2 - first));
-	else
-		cstrim = "N0CALL";
-
-	unsigned int id = m_lookup->findID(cstrim);
+	const CCallsignEntry& entry = m_callsigns.find(source);
+
+	unsigned int id = entry.m_id;
 
 	if (id == 0) {
 		id = m_defsrcid;
@@ -791,25 +814,22 @@ unsigned int CYSF2P25::findYSFID(std::string cs, bool showdst)
 	}
 	else {
 		if (showdst)
-			LogMessage("P25 ID of %s: %u, DstID: TG %u", cstrim.c_str(), id, m_dstid);
+			LogMessage("P25 ID of %s: %u, DstID: TG %u", entry.m_callsign, id, m_dstid);
 		else
-			LogMessage("P25 ID of %s: %u", cstrim.c_str(), id);
+			LogMessage("P25 ID of %s: %u", entry.m_callsign, id);
 	}
 
 	return id;
 }
 
-std::string CYSF2P25::getSrcYSF(const unsigned char* buffer)
+void CYSF2P25::readSrcYSF(const unsigned char* buffer)
 {
-	unsigned char temp[YSF_CALLSIGN_LENGTH + 1U];
-
-	::memcpy(temp, buffer + 14U, YSF_CALLSIGN_LENGTH);
-	temp[YSF_CALLSIGN_LENGTH] = 0U;
-	
-	std::string trimmed = reinterpret_cast<char const*>(temp);
-	trimmed.erase(std::find_if(trimmed.rbegin(), trimmed.rend(), std::not1(std::ptr_fun<int, int>(std::isspace))).base(), trimmed.end());
-	
-	return trimmed;
+	// Every frame of a Wires-X request carries the same source, only a new one is looked at
+	if (::memcmp(m_ysfSrcRaw, buffer + 14U, YSF_CALLSIGN_LENGTH) == 0)
+		return;
+
+	::memcpy(m_ysfSrcRaw, buffer + 14U, YSF_CALLSIGN_LENGTH);
+	m_ysfSrc = m_callsigns.find(m_ysfSrcRaw).m_source;
 }
 
 void CYSF2P25::sendP25PTT(unsigned int src, unsigned int dst)
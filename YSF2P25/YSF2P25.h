@@ -36,6 +36,7 @@
 #include "Sync.h"
 #include "Utils.h"
 #include "Conf.h"
+#include "CallsignCache.h"
 #include "Log.h"
 #include "CRC.h"
 #include "DTMF.h"
@@ -56,6 +57,7 @@ private:
 	std::string      m_suffix;
 	CConf            m_conf;
 	CWiresX*         m_wiresX;
+	CTGList*         m_tgList;
 	CP25Network*     m_p25Network;
 	CYSFNetwork*     m_ysfNetwork;
 	CDMRLookup*      m_lookup;
@@ -66,6 +68,8 @@ private:
 	std::string      m_netSrc;
 	std::string      m_netDst;
 	std::string      m_ysfSrc;
+	unsigned char    m_ysfSrcRaw[YSF_CALLSIGN_LENGTH];
+	CCallsignCache<CDMRLookup> m_callsigns;
 	unsigned char*   m_ysfFrame;
 	unsigned char*   m_p25Frame;
 	CDTMF*           m_dtmf;
@@ -74,8 +78,8 @@ private:
 	bool             m_p25info;
 
 	void sendP25PTT(unsigned int src, unsigned int dst);
-	unsigned int findYSFID(std::string cs, bool showdst);
-	std::string getSrcYSF(const unsigned char* source);
+	unsigned int findYSFID(const unsigned char* source, bool showdst);
+	void readSrcYSF(const unsigned char* buffer);
 };
 
 #endif